@@ -711,6 +711,7 @@ struct Chunk
    int                   elemsize;           /**< size of each element in the chunk */
    int                   storesize;          /**< number of elements in this chunk */
    int                   eagerfreesize;      /**< number of elements in the eager free list */
+   int                   cachepower;         /**< the chunk has size 2^cachepower and can be cached, or -1 */
 }; /* the chunk data structure must be aligned, because the storage is allocated directly behind the chunk header! */
 
 /** collection of memory chunks of the same element size */
@@ -745,6 +746,183 @@ static
 SCIP_DEF_RBTREE_FIND(rbTreeFindChunk, const void*, CHUNK, CHUNK_LT, CHUNK_GT) /*lint !e123*/
 
 
+/*
+ * thread-local cache of unused chunks
+ *
+ * Chunks that are not needed anymore, e.g., because the block memory of a sub-SCIP is destroyed, are kept in a cache
+ * of the thread that frees them and are reused for the next chunk that is created by this thread. For this, chunks are
+ * allocated with a size that is a power of two, such that they can be reused by chunk blocks of all element sizes. The
+ * cache is only kept while the thread holds a block memory or has captured the cache otherwise, and since it is local
+ * to the thread, no synchronization is needed.
+ */
+
+#define CHUNKCACHE_MINPOWER          10 /**< power of two of the smallest chunk size that is cached */
+#define CHUNKCACHE_MAXPOWER          20 /**< power of two of the largest chunk size that is cached */
+#define CHUNKCACHE_MAXSIZE    (1LL<<25) /**< maximal number of bytes in the chunk cache of a thread */
+
+#if defined(_MSC_VER)
+#define BMS_THREADLOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define BMS_THREADLOCAL __thread
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define BMS_THREADLOCAL _Thread_local
+#else
+#define BMS_NOCHUNKCACHE
+#endif
+
+#ifndef BMS_NOCHUNKCACHE
+static BMS_THREADLOCAL FREELIST* chunkcache[CHUNKCACHE_MAXPOWER - CHUNKCACHE_MINPOWER + 1]; /**< cached chunks per size */
+static BMS_THREADLOCAL long long chunkcachesize = 0; /**< total number of bytes of the cached chunks of this thread */
+static BMS_THREADLOCAL int chunkcachenuses = 0;      /**< number of uses of the chunk cache of this thread */
+#endif
+
+/** returns the power of two of the size class of a chunk with the given size, or -1 if chunks of this size are not
+ *  cached; the size class is the largest power of two that is not larger than the size
+ */
+static
+int getChunkCachePower(
+   size_t                size                /**< size of the chunk including its header */
+   )
+{
+#ifndef BMS_NOCHUNKCACHE
+   int power;
+
+   if( size < ((size_t)1 << CHUNKCACHE_MINPOWER) || size >= ((size_t)1 << (CHUNKCACHE_MAXPOWER + 1)) )
+      return -1;
+
+   power = CHUNKCACHE_MINPOWER;
+   while( size >= ((size_t)1 << (power + 1)) )
+      ++power;
+
+   return power;
+#else
+   (void) size;
+   return -1;
+#endif
+}
+
+/** takes a chunk of size 2^power from the chunk cache of the calling thread, or returns NULL if there is none */
+static
+CHUNK* takeCachedChunk(
+   int                   power               /**< power of two of the chunk size */
+   )
+{
+#ifndef BMS_NOCHUNKCACHE
+   FREELIST* cached;
+
+   assert(power >= CHUNKCACHE_MINPOWER && power <= CHUNKCACHE_MAXPOWER);
+
+   cached = chunkcache[power - CHUNKCACHE_MINPOWER];
+   if( cached == NULL )
+      return NULL;
+
+   chunkcache[power - CHUNKCACHE_MINPOWER] = cached->next;
+   chunkcachesize -= 1LL << power;
+   assert(chunkcachesize >= 0);
+
+   return (CHUNK*) cached;
+#else
+   (void) power;
+   return NULL;
+#endif
+}
+
+/** puts an unused chunk into the chunk cache of the calling thread; returns TRUE if successful, FALSE if the chunk
+ *  needs to be freed
+ */
+static
+int cacheChunk(
+   CHUNK*                chunk               /**< memory chunk */
+   )
+{
+#ifndef BMS_NOCHUNKCACHE
+   FREELIST* cached;
+   int power;
+
+   assert(chunk != NULL);
+
+   power = chunk->cachepower;
+   if( power < 0 || chunkcachenuses <= 0 || chunkcachesize + (1LL << power) > CHUNKCACHE_MAXSIZE )
+      return FALSE;
+
+   assert(power >= CHUNKCACHE_MINPOWER && power <= CHUNKCACHE_MAXPOWER);
+
+   cached = (FREELIST*) chunk;
+   cached->next = chunkcache[power - CHUNKCACHE_MINPOWER];
+   chunkcache[power - CHUNKCACHE_MINPOWER] = cached;
+   chunkcachesize += 1LL << power;
+
+   return TRUE;
+#else
+   (void) chunk;
+   return FALSE;
+#endif
+}
+
+/** frees all chunks in the chunk cache of the calling thread */
+static
+void clearChunkCache(
+   void
+   )
+{
+#ifndef BMS_NOCHUNKCACHE
+   int i;
+
+   for( i = 0; i <= CHUNKCACHE_MAXPOWER - CHUNKCACHE_MINPOWER; ++i )
+   {
+      while( chunkcache[i] != NULL )
+      {
+         FREELIST* cached;
+
+         cached = chunkcache[i];
+         chunkcache[i] = cached->next;
+         BMSfreeMemory(&cached);
+      }
+   }
+
+   chunkcachesize = 0;
+#endif
+}
+
+/** captures the chunk cache of the calling thread, such that unused chunks are kept for reuse until the cache is
+ *  released again
+ */
+void BMScaptureChunkCache_call(
+   void
+   )
+{
+#ifndef BMS_NOCHUNKCACHE
+   ++chunkcachenuses;
+#endif
+}
+
+/** releases the chunk cache of the calling thread and frees all cached chunks if the cache is not captured anymore */
+void BMSreleaseChunkCache_call(
+   void
+   )
+{
+#ifndef BMS_NOCHUNKCACHE
+   /* block memories might be freed by another thread than the one that created them */
+   if( --chunkcachenuses <= 0 )
+   {
+      chunkcachenuses = 0;
+      clearChunkCache();
+   }
+#endif
+}
+
+/** returns the number of bytes in the chunk cache of the calling thread */
+long long BMSgetChunkCacheSize_call(
+   void
+   )
+{
+#ifndef BMS_NOCHUNKCACHE
+   return chunkcachesize;
+#else
+   return 0LL;
+#endif
+}
+
 /** aligns the given byte size corresponding to the minimal alignment */
 static
 void alignSize(
@@ -1032,6 +1210,8 @@ int createChunk(
 {
    CHUNK *newchunk;
    FREELIST *freelist;
+   size_t chunksize;
+   int cachepower;
    int i;
    int storesize;
    int retval;
@@ -1050,15 +1230,36 @@ int createChunk(
    storesize = MIN(storesize, CHUNKLENGTH_MAX / chkmem->elemsize);
    storesize = MIN(storesize, STORESIZE_MAX);
    storesize = MAX(storesize, 1);
-   chkmem->lastchunksize = storesize;
 
    /* create new chunk */
    assert(BMSisAligned(sizeof(CHUNK)));
    assert( chkmem->elemsize < INT_MAX / storesize );
    assert( sizeof(CHUNK) < MAXMEMSIZE - (size_t)(storesize * chkmem->elemsize) ); /*lint !e571 !e647*/
-   BMSallocMemorySize(&newchunk, sizeof(CHUNK) + storesize * chkmem->elemsize);
+   chunksize = sizeof(CHUNK) + (size_t)storesize * (size_t)chkmem->elemsize;
+
+   /* round the chunk size down to its size class, such that the chunk can be reused from the cache */
+   cachepower = getChunkCachePower(chunksize);
+   if( cachepower >= 0 && ((size_t)1 << cachepower) >= sizeof(CHUNK) + (size_t)chkmem->elemsize )
+   {
+      chunksize = (size_t)1 << cachepower;
+      storesize = (int) ((chunksize - sizeof(CHUNK)) / (size_t)chkmem->elemsize);
+      assert(storesize >= 1);
+
+      newchunk = takeCachedChunk(cachepower);
+   }
+   else
+   {
+      cachepower = -1;
+      newchunk = NULL;
+   }
+   chkmem->lastchunksize = storesize;
+
    if( newchunk == NULL )
-      return FALSE;
+   {
+      BMSallocMemorySize(&newchunk, chunksize);
+      if( newchunk == NULL )
+         return FALSE;
+   }
 
    /* the store is allocated directly behind the chunk header */
    newchunk->store = (void*) ((char*) newchunk + sizeof(CHUNK));
@@ -1070,9 +1271,10 @@ int createChunk(
    newchunk->elemsize = chkmem->elemsize;
    newchunk->storesize = storesize;
    newchunk->eagerfreesize = 0;
+   newchunk->cachepower = cachepower;
 
    if( memsize != NULL )
-      (*memsize) += ((long long)((long long)sizeof(CHUNK) + (long long)storesize * chkmem->elemsize));
+      (*memsize) += (long long)chunksize;
 
    debugMessage("allocated new chunk %p: %d elements with size %d\n", (void*)newchunk, newchunk->storesize, newchunk->elemsize);
 
@@ -1111,10 +1313,18 @@ void destroyChunk(
    debugMessage("destroying chunk %p\n", (void*)*chunk);
 
    if( memsize != NULL )
-      (*memsize) -= ((long long)sizeof(CHUNK) + (long long)(*chunk)->storesize * (*chunk)->elemsize);
+   {
+      if( (*chunk)->cachepower >= 0 )
+         (*memsize) -= 1LL << (*chunk)->cachepower;
+      else
+         (*memsize) -= ((long long)sizeof(CHUNK) + (long long)(*chunk)->storesize * (*chunk)->elemsize);
+   }
 
-   /* free chunk header and store (allocated in one call) */
-   BMSfreeMemory(chunk);
+   /* keep the chunk for reuse, or free chunk header and store (allocated in one call) */
+   if( cacheChunk(*chunk) )
+      *chunk = NULL;
+   else
+      BMSfreeMemory(chunk);
 }
 
 /** removes a completely unused chunk, i.e. a chunk with all elements in the eager free list */
@@ -1266,14 +1476,30 @@ void clearChkmem(
    long long*            memsize             /**< pointer to total size of allocated memory (or NULL) */
    )
 {
+   CHUNK* chunklist;
+
    assert(chkmem != NULL);
 
-   /* destroy all chunks of the chunk block */
+   /* collect all chunks of the chunk block in a list, such that they can be destroyed at once without removing them
+    * from the tree one by one
+    */
+   chunklist = NULL;
    FOR_EACH_NODE(CHUNK*, chunk, chkmem->rootchunk,
    {
-      SCIPrbtreeDelete(&chkmem->rootchunk, chunk);
-      destroyChunk(&chunk, memsize);
+      chunk->nexteager = chunklist;
+      chunklist = chunk;
    })
+   chkmem->rootchunk = NULL;
+
+   /* destroy all chunks of the chunk block */
+   while( chunklist != NULL )
+   {
+      CHUNK* chunk;
+
+      chunk = chunklist;
+      chunklist = chunk->nexteager;
+      destroyChunk(&chunk, memsize);
+   }
 
    chkmem->lazyfree = NULL;
    chkmem->firsteager = NULL;
@@ -1748,6 +1974,9 @@ BMS_BLKMEM* BMScreateBlockMemory_call(
       blkmem->maxmemused = 0;
       blkmem->maxmemunused = 0;
       blkmem->maxmemallocated = 0;
+
+      /* keep the chunks that are freed by this thread for reuse as long as the block memory exists */
+      BMScaptureChunkCache_call();
    }
    else
    {
@@ -1806,6 +2035,8 @@ void BMSdestroyBlockMemory_call(
       BMSclearBlockMemory_call(*blkmem, filename, line);
       BMSfreeMemory(blkmem);
       assert(*blkmem == NULL);
+
+      BMSreleaseChunkCache_call();
    }
    else
    {
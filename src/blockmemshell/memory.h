@@ -473,6 +473,10 @@ typedef struct BMS_BlkMem BMS_BLKMEM;           /**< block memory: collection of
 #define BMSdisplayBlockMemory(mem)            BMSdisplayBlockMemory_call(mem)
 #define BMSblockMemoryCheckEmpty(mem)         BMScheckEmptyBlockMemory_call(mem)
 
+#define BMScaptureChunkCache()                BMScaptureChunkCache_call()
+#define BMSreleaseChunkCache()                BMSreleaseChunkCache_call()
+#define BMSgetChunkCacheSize()                BMSgetChunkCacheSize_call()
+
 #else
 
 /* block memory management mapped to standard memory management */
@@ -507,6 +511,9 @@ typedef struct BMS_BlkMem BMS_BLKMEM;           /**< block memory: collection of
 #define BMSgetBlockPointerSize(mem,ptr)                      (SCIP_UNUSED(mem), SCIP_UNUSED(ptr), 0)
 #define BMSdisplayBlockMemory(mem)                           SCIP_UNUSED(mem)
 #define BMSblockMemoryCheckEmpty(mem)                        (SCIP_UNUSED(mem), 0LL)
+#define BMScaptureChunkCache()                               /**/
+#define BMSreleaseChunkCache()                               /**/
+#define BMSgetChunkCacheSize()                               0LL
 
 #endif
 
@@ -701,6 +708,28 @@ long long BMScheckEmptyBlockMemory_call(
    const BMS_BLKMEM*     blkmem              /**< block memory */
    );
 
+/** captures the chunk cache of the calling thread, such that memory chunks that are freed by this thread are kept for
+ *  reuse by block memories of this thread until the cache is released again
+ *
+ *  @note the chunk cache is captured automatically as long as the thread holds a block memory that it created
+ */
+SCIP_EXPORT
+void BMScaptureChunkCache_call(
+   void
+   );
+
+/** releases the chunk cache of the calling thread; all cached chunks are freed if the cache is not captured anymore */
+SCIP_EXPORT
+void BMSreleaseChunkCache_call(
+   void
+   );
+
+/** returns the number of bytes in the chunk cache of the calling thread */
+SCIP_EXPORT
+long long BMSgetChunkCacheSize_call(
+   void
+   );
+
 
 
 
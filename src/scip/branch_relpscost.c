@@ -26,6 +26,7 @@
 
 #include "blockmemshell/memory.h"
 #include "scip/branch_relpscost.h"
+#include "scip/concurrent.h"
 #include "scip/treemodel.h"
 #include "scip/cons_and.h"
 #include "scip/pub_branch.h"
@@ -52,6 +53,7 @@
 #include "scip/scip_var.h"
 #include "scip/prop_symmetry.h"
 #include "scip/symmetry.h"
+#include "tpi/tpi.h"
 #include <string.h>
 
 #define BRANCHRULE_NAME          "relpscost"
@@ -68,6 +70,8 @@
 #define DEFAULT_NLSCOREWEIGHT    0.1         /**< weight in score calculations for nlcount score */
 #define DEFAULT_MINRELIABLE      1.0         /**< minimal value for minimum pseudo cost size to regard pseudo cost value as reliable */
 #define DEFAULT_MAXRELIABLE      5.0         /**< maximal value for minimum pseudo cost size to regard pseudo cost value as reliable */
+#define DEFAULT_PREVRUNWEIGHT    0.0         /**< weight of pseudo cost observations of previous runs and imported histories
+                                              *   in the pseudo cost size used for the reliability check */
 #define DEFAULT_SBITERQUOT       0.5         /**< maximal fraction of strong branching LP iterations compared to normal iterations */
 #define DEFAULT_SBITEROFS        100000      /**< additional number of allowed strong branching LP iterations */
 #define DEFAULT_MAXLOOKAHEAD     9           /**< maximal number of further variables evaluated without better score */
@@ -89,6 +93,8 @@
 #define DEFAULT_SKIPBADINITCANDS TRUE        /**< should branching rule skip candidates that have a low probability to be
                                               *  better than the best strong-branching or pseudo-candidate? */
 #define DEFAULT_STARTRANDSEED    5           /**< start random seed for random number generation */
+#define DEFAULT_NSBTHREADS       1           /**< number of threads used to evaluate strong branching candidates in
+                                              *   parallel on copies of the LP solver interface (1: sequential) */
 #define DEFAULT_RANDINITORDER    FALSE       /**< should slight perturbation of scores be used to break ties in the prior scores? */
 #define DEFAULT_USESMALLWEIGHTSITLIM FALSE   /**< should smaller weights be used for pseudo cost updates after hitting the LP iteration limit? */
 #define DEFAULT_DYNAMICWEIGHTS   TRUE        /**< should the weights of the branching rule be adjusted dynamically during solving based
@@ -110,6 +116,8 @@ struct SCIP_BranchruleData
    SCIP_Real             nlscoreweight;      /**< weight in score calculations for nlcount score */
    SCIP_Real             minreliable;        /**< minimal value for minimum pseudo cost size to regard pseudo cost value as reliable */
    SCIP_Real             maxreliable;        /**< maximal value for minimum pseudo cost size to regard pseudo cost value as reliable */
+   SCIP_Real             prevrunweight;      /**< weight of pseudo cost observations of previous runs and imported histories
+                                              *   in the pseudo cost size used for the reliability check */
    SCIP_Real             sbiterquot;         /**< maximal fraction of strong branching LP iterations compared to normal iterations */
    int                   sbiterofs;          /**< additional number of allowed strong branching LP iterations */
    int                   maxlookahead;       /**< maximal number of further variables evaluated without better score */
@@ -140,6 +148,9 @@ struct SCIP_BranchruleData
    SCIP_Bool             randinitorder;      /**< should slight perturbation of scores be used to break ties in the prior scores? */
    SCIP_RANDNUMGEN*      randnumgen;         /**< random number generator */
    int                   startrandseed;      /**< start random seed for random number generation */
+   int                   nsbthreads;         /**< number of threads used to evaluate strong branching candidates in
+                                              *   parallel on copies of the LP solver interface (1: sequential) */
+   SCIP_Bool             tpiinitialized;     /**< was the task processing interface initialized by this branching rule? */
    SCIP_Bool             usesmallweightsitlim; /**< should smaller weights be used for pseudo cost updates after hitting the LP iteration limit? */
    SCIP_TREEMODEL*       treemodel;          /**< Parameters for the Treemodel branching rules */
 
@@ -843,6 +854,20 @@ SCIP_RETCODE execRelpscost(
       SCIP_Real* scores = NULL;
       SCIP_Real* scoresfrompc = NULL;
       SCIP_Real* scoresfromothers = NULL;
+      /* strong branching results of the candidates evaluated in parallel */
+      SCIP_VAR** parsbvars = NULL;
+      SCIP_Real* parsbdown = NULL;
+      SCIP_Real* parsbup = NULL;
+      SCIP_Bool* parsbdownvalid = NULL;
+      SCIP_Bool* parsbupvalid = NULL;
+      SCIP_Bool* parsbdowninf = NULL;
+      SCIP_Bool* parsbupinf = NULL;
+      SCIP_Bool* parsbdownconflict = NULL;
+      SCIP_Bool* parsbupconflict = NULL;
+      SCIP_Bool parsblperror = FALSE;
+      int parsbbatchsize = 0;
+      int parsbstart = 0;
+      int parsbend = 0;
       int* bdchginds;
       SCIP_BOUNDTYPE* bdchgtypes;
       SCIP_Real* bdchgbounds;
@@ -1148,6 +1173,15 @@ SCIP_RETCODE execRelpscost(
             /* check, if the pseudo cost score of the variable is reliable */
             downsize = SCIPgetVarPseudocostCountCurrentRun(scip, branchcands[c], SCIP_BRANCHDIR_DOWNWARDS);
             upsize = SCIPgetVarPseudocostCountCurrentRun(scip, branchcands[c], SCIP_BRANCHDIR_UPWARDS);
+
+            /* observations of previous runs, e.g., imported by SCIPaddVarHistoryData(), count partially */
+            if( branchruledata->prevrunweight > 0.0 )
+            {
+               downsize += branchruledata->prevrunweight * MAX(SCIPgetVarPseudocostCount(scip, branchcands[c],
+                     SCIP_BRANCHDIR_DOWNWARDS) - downsize, 0.0);
+               upsize += branchruledata->prevrunweight * MAX(SCIPgetVarPseudocostCount(scip, branchcands[c],
+                     SCIP_BRANCHDIR_UPWARDS) - upsize, 0.0);
+            }
             size = MIN(downsize, upsize);
 
             /* determine if variable is considered reliable based on the current reliability setting */
@@ -1383,6 +1417,22 @@ SCIP_RETCODE execRelpscost(
                SCIP_CALL( SCIPallocBlockMemoryArray(scip, &newlbs, nvars) );
                SCIP_CALL( SCIPallocBlockMemoryArray(scip, &newubs, nvars) );
             }
+
+            /* create arrays for the results of candidates evaluated in parallel */
+            if( !propagate && branchruledata->nsbthreads > 1 && SCIPtpiIsAvailable() )
+            {
+               parsbbatchsize = MIN(branchruledata->nsbthreads, ninitcands);
+
+               SCIP_CALL( SCIPallocBufferArray(scip, &parsbvars, parsbbatchsize) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &parsbdown, parsbbatchsize) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &parsbup, parsbbatchsize) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &parsbdownvalid, parsbbatchsize) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &parsbupvalid, parsbbatchsize) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &parsbdowninf, parsbbatchsize) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &parsbupinf, parsbbatchsize) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &parsbdownconflict, parsbbatchsize) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &parsbupconflict, parsbbatchsize) );
+            }
          }
 
          if( propagate )
@@ -1392,6 +1442,40 @@ SCIP_RETCODE execRelpscost(
                   branchruledata->maxproprounds, &down, &up, &downvalid, &upvalid, &ndomredsdown, &ndomredsup, &downinf, &upinf,
                   &downconflict, &upconflict, &lperror, newlbs, newubs) );
          }
+         else if( parsbbatchsize > 1 )
+         {
+            int k;
+
+            /* evaluate the next candidates in parallel; the results are used in the order of the candidates, such that
+             * the branching decision does not depend on the timing of the threads
+             */
+            if( i >= parsbend )
+            {
+               parsbstart = i;
+               parsbend = MIN(i + parsbbatchsize, ninitcands);
+
+               for( k = parsbstart; k < parsbend; ++k )
+                  parsbvars[k - parsbstart] = branchcands[initcands[k]];
+
+               SCIP_CALL( SCIPgetVarsStrongbranchesFracParallel(scip, parsbvars, parsbend - parsbstart, inititer,
+                     branchruledata->nsbthreads, parsbdown, parsbup, parsbdownvalid, parsbupvalid, parsbdowninf,
+                     parsbupinf, parsbdownconflict, parsbupconflict, &parsblperror) );
+            }
+            assert(parsbstart <= i && i < parsbend);
+
+            k = i - parsbstart;
+            down = parsbdown[k];
+            up = parsbup[k];
+            downvalid = parsbdownvalid[k];
+            upvalid = parsbupvalid[k];
+            downinf = parsbdowninf[k];
+            upinf = parsbupinf[k];
+            downconflict = parsbdownconflict[k];
+            upconflict = parsbupconflict[k];
+            lperror = parsblperror;
+
+            ndomredsdown = ndomredsup = 0;
+         }
          else
          {
             /* apply strong branching */
@@ -1680,6 +1764,16 @@ SCIP_RETCODE execRelpscost(
             SCIPfreeBlockMemoryArray(scip, &newlbs, nvars);
          }
 
+         SCIPfreeBufferArrayNull(scip, &parsbupconflict);
+         SCIPfreeBufferArrayNull(scip, &parsbdownconflict);
+         SCIPfreeBufferArrayNull(scip, &parsbupinf);
+         SCIPfreeBufferArrayNull(scip, &parsbdowninf);
+         SCIPfreeBufferArrayNull(scip, &parsbupvalid);
+         SCIPfreeBufferArrayNull(scip, &parsbdownvalid);
+         SCIPfreeBufferArrayNull(scip, &parsbup);
+         SCIPfreeBufferArrayNull(scip, &parsbdown);
+         SCIPfreeBufferArrayNull(scip, &parsbvars);
+
          SCIP_CALL( SCIPendStrongbranch(scip) );
 
          if( SCIPgetLPSolstat(scip) == SCIP_LPSOLSTAT_OBJLIMIT || SCIPgetLPSolstat(scip) == SCIP_LPSOLSTAT_INFEASIBLE )
@@ -1914,6 +2008,13 @@ SCIP_DECL_BRANCHINITSOL(branchInitsolRelpscost)
    SCIP_CALL( SCIPcreateRandom(scip, &branchruledata->randnumgen,
          (unsigned int)branchruledata->startrandseed, TRUE) );
 
+   /* make sure that jobs can be submitted if strong branching should be parallelized */
+   branchruledata->tpiinitialized = FALSE;
+   if( branchruledata->nsbthreads > 1 )
+   {
+      SCIP_CALL( SCIPinitParallelJobs(scip, branchruledata->nsbthreads, &branchruledata->tpiinitialized) );
+   }
+
    return SCIP_OKAY;
 }
 
@@ -1941,6 +2042,12 @@ SCIP_DECL_BRANCHEXITSOL(branchExitsolRelpscost)
    branchruledata->permvarmap = NULL;
    branchruledata->npermvars = 0;
 
+   if( branchruledata->tpiinitialized )
+   {
+      SCIP_CALL( SCIPexitParallelJobs(scip) );
+      branchruledata->tpiinitialized = FALSE;
+   }
+
    return SCIP_OKAY;
 }
 
@@ -2040,6 +2147,7 @@ SCIP_RETCODE SCIPincludeBranchruleRelpscost(
    /* create relpscost branching rule data */
    SCIP_CALL( SCIPallocBlockMemory(scip, &branchruledata) );
 
+   branchruledata->tpiinitialized = FALSE;
    branchruledata->nosymmetry = FALSE;
    branchruledata->orbits = NULL;
    branchruledata->orbitbegins = NULL;
@@ -2096,6 +2204,10 @@ SCIP_RETCODE SCIPincludeBranchruleRelpscost(
          "branching/relpscost/maxreliable",
          "maximal value for minimum pseudo cost size to regard pseudo cost value as reliable",
          &branchruledata->maxreliable, TRUE, DEFAULT_MAXRELIABLE, 0.0, SCIP_REAL_MAX, NULL, NULL) );
+   SCIP_CALL( SCIPaddRealParam(scip,
+         "branching/relpscost/prevrunweight",
+         "weight of pseudo cost observations of previous runs and imported histories in the pseudo cost size used for the reliability check",
+         &branchruledata->prevrunweight, FALSE, DEFAULT_PREVRUNWEIGHT, 0.0, 1.0, NULL, NULL) );
    SCIP_CALL( SCIPaddRealParam(scip,
          "branching/relpscost/sbiterquot",
          "maximal fraction of strong branching LP iterations compared to node relaxation LP iterations",
@@ -2192,6 +2304,9 @@ SCIP_RETCODE SCIPincludeBranchruleRelpscost(
          NULL, NULL) );
    SCIP_CALL( SCIPaddIntParam(scip, "branching/relpscost/startrandseed", "start seed for random number generation",
          &branchruledata->startrandseed, TRUE, DEFAULT_STARTRANDSEED, 0, INT_MAX, NULL, NULL) );
+   SCIP_CALL( SCIPaddIntParam(scip, "branching/relpscost/nsbthreads",
+         "number of threads used to evaluate strong branching candidates in parallel on copies of the LP solver interface (1: sequential)",
+         &branchruledata->nsbthreads, TRUE, DEFAULT_NSBTHREADS, 1, 64, NULL, NULL) );
 
    SCIP_CALL( SCIPaddBoolParam(scip, "branching/relpscost/filtercandssym",
          "Use symmetry to filter branching candidates?",
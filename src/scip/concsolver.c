@@ -220,6 +220,7 @@ SCIP_RETCODE SCIPconcsolverCreateInstance(
    (*concsolver)->ntighterbnds = 0;
    (*concsolver)->ntighterintbnds = 0;
    SCIP_CALL( SCIPcreateWallClock(set->scip, &(*concsolver)->totalsynctime) );
+   SCIP_CALL( SCIPcreateWallClock(set->scip, &(*concsolver)->totalwaittime) );
 
    /* initialize synchronization fields */
    (*concsolver)->nsyncs = 0;
@@ -258,6 +259,7 @@ SCIP_RETCODE SCIPconcsolverDestroyInstance(
    SCIP_CALL( (*concsolver)->type->concsolverdestroyinst(set->scip, *concsolver) );
    --(*concsolver)->type->ninstances;
 
+   SCIP_CALL( SCIPfreeClock(set->scip, &(*concsolver)->totalwaittime) );
    SCIP_CALL( SCIPfreeClock(set->scip, &(*concsolver)->totalsynctime) );
    BMSfreeMemoryArray(&(*concsolver)->name);
 
@@ -360,6 +362,16 @@ SCIP_RETCODE SCIPconcsolverStop(
    return SCIP_OKAY;
 }
 
+/** returns whether the concurrent solver has been stopped */
+SCIP_Bool SCIPconcsolverIsStopped(
+   SCIP_CONCSOLVER*      concsolver          /**< concurrent solver */
+   )
+{
+   assert(concsolver != NULL);
+
+   return concsolver->stopped;
+}
+
 /** let the given concurrent solver synchronize, i.e. pass its own solutions and bounds to
  *  the SPI.
  */
@@ -390,7 +402,10 @@ SCIP_RETCODE SCIPconcsolverSync(
    syncstore = SCIPgetSyncstore(set->scip);
    assert(syncstore != NULL);
 
+   /* starting the synchronization waits until no other solver is writing to the synchronization data */
+   SCIP_CALL( SCIPstartClock(set->scip, concsolver->totalwaittime) );
    SCIP_CALL( SCIPsyncstoreStartSync(syncstore, concsolver->nsyncs, &syncdata) );
+   SCIP_CALL( SCIPstopClock(set->scip, concsolver->totalwaittime) );
 
    if( syncdata == NULL )
    {
@@ -480,7 +495,9 @@ SCIP_RETCODE SCIPconcsolverSync(
 
    while( syncdata != NULL )
    {
+      SCIP_CALL( SCIPstartClock(set->scip, concsolver->totalwaittime) );
       SCIP_CALL( SCIPsyncstoreEnsureAllSynced(syncstore, syncdata) );
+      SCIP_CALL( SCIPstopClock(set->scip, concsolver->totalwaittime) );
       concsolver->syncdata = syncdata;
       SCIP_CALL( concsolvertype->concsolversyncread(concsolver, syncstore, syncdata, &nsols, &ntighterbnds, &ntighterintbnds) );
       concsolver->ntighterbnds += ntighterbnds;
@@ -550,6 +567,16 @@ SCIP_Real SCIPconcsolverGetSyncTime(
    return SCIPclockGetTime(concsolver->totalsynctime);
 }
 
+/** gets the time the concurrent solver spent waiting for other solvers during synchronization */
+SCIP_Real SCIPconcsolverGetWaitTime(
+   SCIP_CONCSOLVER*      concsolver          /**< concurrent solver */
+   )
+{
+   assert(concsolver != NULL);
+
+   return SCIPclockGetTime(concsolver->totalwaittime);
+}
+
 /** gets the number of lp iterations the concurrent solver used */
 SCIP_Longint SCIPconcsolverGetNLPIterations(
    SCIP_CONCSOLVER*      concsolver          /**< concurrent solver */
@@ -131,6 +131,11 @@ SCIP_RETCODE SCIPconcsolverStop(
    SCIP_CONCSOLVER*      concsolver          /**< concurrent solver */
    );
 
+/** returns whether the concurrent solver has been stopped */
+SCIP_Bool SCIPconcsolverIsStopped(
+   SCIP_CONCSOLVER*      concsolver          /**< concurrent solver */
+   );
+
 /** let the given concurrent solver synchronize, i.e. pass its own solutions and bounds to
  *  the SPI.
  */
@@ -167,6 +172,11 @@ SCIP_Real SCIPconcsolverGetSyncTime(
    SCIP_CONCSOLVER*      concsolver          /**< concurrent solver */
    );
 
+/** gets the time the concurrent solver spent waiting for other solvers during synchronization */
+SCIP_Real SCIPconcsolverGetWaitTime(
+   SCIP_CONCSOLVER*      concsolver          /**< concurrent solver */
+   );
+
 /** gets the number of lp iterations the concurrent solver used */
 SCIP_Longint SCIPconcsolverGetNLPIterations(
    SCIP_CONCSOLVER*      concsolver          /**< concurrent solver */
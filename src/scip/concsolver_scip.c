@@ -317,6 +317,7 @@ SCIP_DECL_CONCSOLVERCREATEINST(concsolverScipCreateInstance)
    char*                    prefix;
    char                     filename[SCIP_MAXSTRLEN];
    SCIP_Bool                changechildsel;
+   SCIP_Bool                splittree;
 
    assert(scip != NULL);
    assert(concsolvertype != NULL);
@@ -399,15 +400,18 @@ SCIP_DECL_CONCSOLVERCREATEINST(concsolverScipCreateInstance)
    /* don't catch ctrlc since already caught in main SCIP */
    SCIP_CALL( SCIPsetBoolParam(data->solverscip, "misc/catchctrlc", FALSE) );
 
+   /* if the tree is split among the solvers, all solvers need to build the identical tree until the split */
+   splittree = SCIPisConcurrentTreeSplit(scip);
+
    /* one solver can do all dual reductions and share them with the other solvers */
-   if( SCIPconcsolverGetIdx(concsolver) != 0 )
+   if( SCIPconcsolverGetIdx(concsolver) != 0 && !splittree )
    {
       SCIP_CALL( disableConflictingDualReductions(data->solverscip) );
    }
 
    /* set different child selection rules if corresponding parameter is TRUE */
    SCIP_CALL( SCIPgetBoolParam(scip, "concurrent/changechildsel", &changechildsel) );
-   if( changechildsel )
+   if( changechildsel && !splittree )
    {
       SCIP_CALL( setChildSelRule(concsolver) );
    }
@@ -524,8 +528,14 @@ SCIP_DECL_CONCSOLVERCOPYSOLVINGDATA(concsolverGetSolvingData)
    /* free the buffer array */
    SCIPfreeBufferArray(scip, &solvals);
 
-   /* copy solving statistics and status from the solver SCIP to the given SCIP */
-   SCIP_CALL( SCIPcopyConcurrentSolvingStats(data->solverscip, scip) );
+   /* copy solving statistics and status from the solver SCIP to the given SCIP; if the tree was split, only the winner
+    * holding the smallest dual bound provides them
+    */
+   if( !SCIPsyncstoreIsTreeSplit(SCIPgetSyncstore(scip))
+      || SCIPsyncstoreGetWinner(SCIPgetSyncstore(scip)) == SCIPconcsolverGetIdx(concsolver) )
+   {
+      SCIP_CALL( SCIPcopyConcurrentSolvingStats(data->solverscip, scip) );
+   }
 
    return SCIP_OKAY;
 }
@@ -594,8 +604,15 @@ SCIP_DECL_CONCSOLVERSYNCWRITE(concsolverScipSyncWrite)
    concsolverid = SCIPconcsolverGetIdx(concsolver);
    solverstatus = SCIPgetStatus(data->solverscip);
 
-   SCIPsyncdataSetStatus(syncdata, solverstatus, concsolverid);
-   SCIPsyncdataSetLowerbound(syncdata, SCIPgetDualbound(data->solverscip));
+   if( SCIPsyncstoreIsTreeSplit(syncstore) )
+   {
+      SCIPsyncdataSetSubtreeStatus(syncstore, syncdata, solverstatus, SCIPgetDualbound(data->solverscip), concsolverid);
+   }
+   else
+   {
+      SCIPsyncdataSetStatus(syncdata, solverstatus, concsolverid);
+      SCIPsyncdataSetLowerbound(syncdata, SCIPgetDualbound(data->solverscip));
+   }
    SCIPsyncdataSetUpperbound(syncdata, SCIPgetPrimalbound(data->solverscip));
 
    *nsolsshared = 0;
@@ -39,6 +39,7 @@
 #include "scip/prop_sync.h"
 #include "scip/heur_sync.h"
 #include "scip/event_globalbnd.h"
+#include "scip/event_treesplit.h"
 #include "scip/scip.h"
 #include "scip/syncstore.h"
 #include "scip/set.h"
@@ -94,7 +95,16 @@ SCIP_RETCODE SCIPcreateConcurrent(
    scip->concurrent->eventglobalbnd = NULL;
    assert(SCIPfindEventhdlr(scip, "globalbnd") == NULL);
 
-   if( scip->set->concurrent_commvarbnds )
+   /* if the tree is split, the solvers work on different subtrees and their global bounds are not valid for the other
+    * solvers, hence they are not communicated
+    */
+   if( SCIPisConcurrentTreeSplit(scip) )
+   {
+      assert(SCIPfindEventhdlr(scip, "treesplit") == NULL);
+
+      SCIP_CALL( SCIPincludeEventHdlrTreesplit(scip, SCIPconcsolverGetIdx(concsolver)) );
+   }
+   else if( scip->set->concurrent_commvarbnds )
    {
       SCIP_CALL( SCIPincludeEventHdlrGlobalbnd(scip) );
       scip->concurrent->eventglobalbnd = SCIPfindEventhdlr(scip, "globalbnd");
@@ -103,6 +113,19 @@ SCIP_RETCODE SCIPcreateConcurrent(
    return SCIP_OKAY;
 }
 
+/** returns whether the concurrent solvers split the branch-and-bound tree among each other instead of racing, which
+ *  is only possible in deterministic parallel mode
+ */
+SCIP_Bool SCIPisConcurrentTreeSplit(
+   SCIP*                 scip                /**< SCIP datastructure */
+   )
+{
+   assert(scip != NULL);
+   assert(scip->set != NULL);
+
+   return scip->set->concurrent_splittree && scip->set->parallel_mode == (int) SCIP_PARA_DETERMINISTIC;
+}
+
 /** get number of initialized concurrent solvers */
 int SCIPgetNConcurrentSolvers(
    SCIP*                 scip                /**< SCIP datastructure */
@@ -459,13 +482,29 @@ SCIP_RETCODE execConcsolver(
    )
 {
    SCIP* scip;
+   SCIP_CONCSOLVER* concsolver;
+   SCIP_SYNCSTORE* syncstore;
 
    assert(args != NULL);
 
    scip = (SCIP*) args;
+   concsolver = scip->set->concsolvers[SCIPtpiGetThreadNum()];
+   syncstore = SCIPgetSyncstore(scip);
 
-   SCIP_CALL( SCIPconcsolverExec(scip->set->concsolvers[SCIPtpiGetThreadNum()]) );
-   SCIP_CALL( SCIPconcsolverSync(scip->set->concsolvers[SCIPtpiGetThreadNum()], scip->set) );
+   SCIP_CALL( SCIPconcsolverExec(concsolver) );
+   SCIP_CALL( SCIPconcsolverSync(concsolver, scip->set) );
+
+   /* if the tree is split, a solver that finished its part of the tree keeps synchronizing until all solvers are
+    * finished, such that the solvers which are still working can receive its solutions and see when to stop
+    */
+   if( SCIPsyncstoreIsTreeSplit(syncstore) )
+   {
+      while( !SCIPconcsolverIsStopped(concsolver) && !SCIPsyncstoreSolveIsStopped(syncstore) )
+      {
+         SCIPconcsolverSetTimeSinceLastSync(concsolver, SCIPconcsolverGetSyncFreq(concsolver));
+         SCIP_CALL( SCIPconcsolverSync(concsolver, scip->set) );
+      }
+   }
 
    return SCIP_OKAY;
 }
@@ -517,11 +556,81 @@ SCIP_RETCODE SCIPconcurrentSolve(
    idx = SCIPsyncstoreGetWinner(syncstore);
    assert(idx >= 0 && idx < nconcsolvers);
 
-   SCIP_CALL( SCIPconcsolverGetSolvingData(concsolvers[idx], scip) );
+   if( SCIPsyncstoreIsTreeSplit(syncstore) )
+   {
+      /* each solver found the solutions of its own part of the tree, but the statistics and the stage are only taken
+       * from the winner, so the winner is processed last
+       */
+      for( i = 0; i < nconcsolvers; ++i )
+      {
+         if( i != idx )
+         {
+            SCIP_CALL( SCIPconcsolverGetSolvingData(concsolvers[i], scip) );
+         }
+      }
+
+      SCIP_CALL( SCIPconcsolverGetSolvingData(concsolvers[idx], scip) );
+
+      /* the status of the winner only refers to its own part of the tree */
+      scip->stat->status = SCIPsyncstoreGetStatus(syncstore);
+   }
+   else
+   {
+      SCIP_CALL( SCIPconcsolverGetSolvingData(concsolvers[idx], scip) );
+   }
 
    return retcode;
 }
 
+/** initializes the task processing interface for parallel jobs within a single solve, unless it is available already,
+ *  e.g., because the solve is part of a concurrent solve
+ *
+ *  If the TPI is initialized by this call, then initialized is set to TRUE and SCIPexitParallelJobs() needs to be
+ *  called at the end of the solve. The number of threads is bounded by the parameter parallel/maxnthreads. If SCIP was
+ *  compiled without task processing interface, nothing is done.
+ */
+SCIP_RETCODE SCIPinitParallelJobs(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int                   nthreads,           /**< number of threads to use */
+   SCIP_Bool*            initialized         /**< pointer to store whether the TPI was initialized by this call */
+   )
+{
+   assert(scip != NULL);
+   assert(initialized != NULL);
+
+   *initialized = FALSE;
+
+#ifndef TPI_NONE
+   nthreads = MIN(nthreads, scip->set->parallel_maxnthreads);
+
+   if( nthreads > 1 && !SCIPtpiIsAvailable() )
+   {
+      SCIP_CALL( SCIPtpiInit(nthreads, INT_MAX, FALSE) );
+      *initialized = TRUE;
+   }
+#else
+   SCIP_UNUSED( nthreads );
+#endif
+
+   return SCIP_OKAY;
+}
+
+/** deinitializes the task processing interface that has been initialized by SCIPinitParallelJobs() */
+SCIP_RETCODE SCIPexitParallelJobs(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   assert(scip != NULL);
+
+#ifndef TPI_NONE
+   assert(SCIPtpiIsAvailable());
+
+   SCIP_CALL( SCIPtpiExit() );
+#endif
+
+   return SCIP_OKAY;
+}
+
 /** copy solving statistics */
 SCIP_RETCODE SCIPcopyConcurrentSolvingStats(
    SCIP*                 source,             /**< SCIP data structure */
@@ -43,6 +43,13 @@ SCIP_RETCODE SCIPcreateConcurrent(
    int*                  varperm             /**< permutation of variables for communication */
    );
 
+/** returns whether the concurrent solvers split the branch-and-bound tree among each other instead of racing, which
+ *  is only possible in deterministic parallel mode
+ */
+SCIP_Bool SCIPisConcurrentTreeSplit(
+   SCIP*                 scip                /**< SCIP datastructure */
+   );
+
 /** get number of initialized concurrent solvers */
 int SCIPgetNConcurrentSolvers(
    SCIP*                 scip                /**< SCIP datastructure */
@@ -124,6 +131,24 @@ SCIP_RETCODE SCIPconcurrentSolve(
    SCIP*                 scip                /**< pointer to scip datastructure */
    );
 
+/** initializes the task processing interface for parallel jobs within a single solve, unless it is available already,
+ *  e.g., because the solve is part of a concurrent solve
+ *
+ *  If the TPI is initialized by this call, then initialized is set to TRUE and SCIPexitParallelJobs() needs to be
+ *  called at the end of the solve. The number of threads is bounded by the parameter parallel/maxnthreads. If SCIP was
+ *  compiled without task processing interface, nothing is done.
+ */
+SCIP_RETCODE SCIPinitParallelJobs(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int                   nthreads,           /**< number of threads to use */
+   SCIP_Bool*            initialized         /**< pointer to store whether the TPI was initialized by this call */
+   );
+
+/** deinitializes the task processing interface that has been initialized by SCIPinitParallelJobs() */
+SCIP_RETCODE SCIPexitParallelJobs(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
 /** disables storing global bound changes */
 void SCIPdisableConcurrentBoundStorage(
    SCIP*                 scip                /**< SCIP data structure */
@@ -79,6 +79,7 @@
 #include "scip/scip_solvingstats.h"
 #include "scip/scip_tree.h"
 #include "scip/scip_var.h"
+#include "tpi/tpi.h"
 #include <ctype.h>
 #include <string.h>
 #if defined(_WIN32) || defined(_WIN64)
@@ -157,6 +158,8 @@
 #define DEFAULT_MAXMULTAGGRQUOT     1e+03 /**< maximum coefficient dynamism (ie. maxabsval / minabsval) for multiaggregation */
 #define DEFAULT_MAXDUALMULTAGGRQUOT 1e+20 /**< maximum coefficient dynamism (ie. maxabsval / minabsval) for multiaggregation */
 #define DEFAULT_EXTRACTCLIQUES       TRUE /**< should cliques be extracted? */
+#define DEFAULT_SHARECOEFS           TRUE /**< should copies of constraints share the coefficient array with the source
+                                           *   constraint until one of them changes its coefficients? */
 
 #define MAXDNOM                   10000LL /**< maximal denominator for simple rational fixed values */
 #define MAXSCALEDCOEF                   0 /**< maximal coefficient value after scaling */
@@ -178,6 +181,23 @@
  */
 
 
+/** coefficient array that is shared by copies of linear constraints, e.g., among concurrent solvers
+ *
+ *  The coefficients are never changed.  A constraint that changes its coefficients gets its own copy of the array
+ *  first.  The array is allocated independently of the block memory of the SCIP instances, since it may outlive the
+ *  instance that created it.
+ */
+typedef struct SharedVals SHAREDVALS;
+struct SharedVals
+{
+   SCIP_Real*            vals;               /**< coefficients */
+   SHAREDVALS*           permuted;           /**< coefficients permuted by perm, or NULL if not created yet */
+   int*                  perm;               /**< permutation that yields the permuted coefficients, or NULL */
+   int                   nvals;              /**< number of coefficients */
+   int                   nuses;              /**< number of references to the array, changed atomically */
+   SCIP_LOCK             lock;               /**< lock to protect the creation of the permuted coefficients */
+};
+
 /** constraint data for linear constraints */
 struct SCIP_ConsData
 {
@@ -209,6 +229,7 @@ struct SCIP_ConsData
    SCIP_NLROW*           nlrow;              /**< NLP row, if constraint has been added to NLP relaxation */
    SCIP_VAR**            vars;               /**< variables of constraint entries */
    SCIP_Real*            vals;               /**< coefficients of constraint entries */
+   SHAREDVALS*           sharedvals;         /**< shared coefficient array that vals points to, or NULL if vals is owned */
    SCIP_EVENTDATA**      eventdata;          /**< event data for bound change events of the variables */
    int                   minactivityneginf;  /**< number of coefficients contributing with neg. infinite value to minactivity */
    int                   minactivityposinf;  /**< number of coefficients contributing with pos. infinite value to minactivity */
@@ -321,6 +342,8 @@ struct SCIP_ConshdlrData
    SCIP_Real             maxmultaggrquot;    /**< maximum coefficient dynamism (ie. maxabsval / minabsval) for primal multiaggregation */
    SCIP_Real             maxdualmultaggrquot;/**< maximum coefficient dynamism (ie. maxabsval / minabsval) for dual multiaggregation */
    SCIP_Bool             extractcliques;     /**< should cliques be extracted? */
+   SCIP_Bool             sharecoefs;         /**< should copies of constraints share the coefficient array with the
+                                              *   source constraint until one of them changes its coefficients? */
 };
 
 /** linear constraint update method */
@@ -462,6 +485,187 @@ SCIP_RETCODE conshdlrdataEnsureLinconsupgradesSize(
    return SCIP_OKAY;
 }
 
+/** creates and captures a shared coefficient array */
+static
+SCIP_RETCODE sharedvalsCreate(
+   SHAREDVALS**          sharedvals,         /**< pointer to store the shared coefficient array */
+   SCIP_Real*            vals,               /**< coefficients to copy */
+   int                   nvals               /**< number of coefficients */
+   )
+{
+   assert(sharedvals != NULL);
+   assert(vals != NULL);
+   assert(nvals > 0);
+
+   SCIP_ALLOC( BMSallocMemory(sharedvals) );
+   SCIP_ALLOC( BMSduplicateMemoryArray(&(*sharedvals)->vals, vals, nvals) );
+   (*sharedvals)->permuted = NULL;
+   (*sharedvals)->perm = NULL;
+   (*sharedvals)->nvals = nvals;
+   (*sharedvals)->nuses = 1;
+   SCIP_CALL( SCIPtpiInitLock(&(*sharedvals)->lock) );
+
+   return SCIP_OKAY;
+}
+
+/** captures a shared coefficient array */
+static
+void sharedvalsCapture(
+   SHAREDVALS*           sharedvals          /**< shared coefficient array */
+   )
+{
+   assert(sharedvals != NULL);
+
+   (void) SCIPtpiAtomicFetchAddInt(&sharedvals->nuses, 1);
+}
+
+/** releases a shared coefficient array and frees it if it is not referenced anymore */
+static
+void sharedvalsRelease(
+   SHAREDVALS**          sharedvals          /**< pointer to the shared coefficient array */
+   )
+{
+   assert(sharedvals != NULL);
+   assert(*sharedvals != NULL);
+
+   if( SCIPtpiAtomicFetchAddInt(&(*sharedvals)->nuses, -1) == 1 )
+   {
+      if( (*sharedvals)->permuted != NULL )
+         sharedvalsRelease(&(*sharedvals)->permuted);
+
+      SCIPtpiDestroyLock(&(*sharedvals)->lock);
+      BMSfreeMemoryArrayNull(&(*sharedvals)->perm);
+      BMSfreeMemoryArray(&(*sharedvals)->vals);
+      BMSfreeMemory(sharedvals);
+   }
+
+   *sharedvals = NULL;
+}
+
+/** returns the captured shared coefficient array obtained by applying the given permutation, or NULL if a different
+ *  permutation was applied to the array before
+ *
+ *  Copies of a constraint usually sort their variables identically for the propagation, such that they can share the
+ *  sorted coefficients as well.
+ */
+static
+SCIP_RETCODE sharedvalsGetPermuted(
+   SHAREDVALS*           sharedvals,         /**< shared coefficient array */
+   int*                  perm,               /**< permutation, the i-th permuted coefficient is vals[perm[i]] */
+   int                   nvals,              /**< number of coefficients to permute */
+   SHAREDVALS**          permuted            /**< pointer to store the captured permuted array, or NULL */
+   )
+{
+   assert(sharedvals != NULL);
+   assert(perm != NULL);
+   assert(0 < nvals && nvals <= sharedvals->nvals);
+   assert(permuted != NULL);
+
+   *permuted = NULL;
+
+   SCIP_CALL( SCIPtpiAcquireLock(&sharedvals->lock) );
+
+   if( sharedvals->permuted == NULL )
+   {
+      SHAREDVALS* newpermuted;
+      int i;
+
+      SCIP_ALLOC( BMSallocMemory(&newpermuted) );
+      SCIP_ALLOC( BMSallocMemoryArray(&newpermuted->vals, nvals) );
+      for( i = 0; i < nvals; ++i )
+         newpermuted->vals[i] = sharedvals->vals[perm[i]];
+      newpermuted->permuted = NULL;
+      newpermuted->perm = NULL;
+      newpermuted->nvals = nvals;
+      newpermuted->nuses = 1;
+      SCIP_CALL( SCIPtpiInitLock(&newpermuted->lock) );
+
+      SCIP_ALLOC( BMSduplicateMemoryArray(&sharedvals->perm, perm, nvals) );
+      sharedvals->permuted = newpermuted;
+   }
+
+   if( sharedvals->permuted->nvals == nvals && memcmp(sharedvals->perm, perm, (size_t)nvals * sizeof(int)) == 0 )
+   {
+      *permuted = sharedvals->permuted;
+      sharedvalsCapture(*permuted);
+   }
+
+   SCIP_CALL( SCIPtpiReleaseLock(&sharedvals->lock) );
+
+   return SCIP_OKAY;
+}
+
+/** gives the constraint data its own coefficient array if the array is shared, such that it can be changed */
+static
+SCIP_RETCODE consdataUnshareVals(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSDATA*        consdata,           /**< linear constraint data */
+   int                   size                /**< size of the own coefficient array, at least varssize */
+   )
+{
+   SCIP_Real* vals;
+
+   assert(scip != NULL);
+   assert(consdata != NULL);
+   assert(size >= consdata->varssize);
+
+   if( consdata->sharedvals == NULL )
+      return SCIP_OKAY;
+
+   assert(consdata->vals == consdata->sharedvals->vals);
+   assert(consdata->nvars <= consdata->sharedvals->nvals);
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &vals, size) );
+   BMScopyMemoryArray(vals, consdata->vals, consdata->nvars);
+
+   sharedvalsRelease(&consdata->sharedvals);
+   consdata->vals = vals;
+
+   return SCIP_OKAY;
+}
+
+/** lets a copy of a linear constraint share the coefficient array of the source constraint if the coefficients of both
+ *  constraints are identical
+ */
+static
+SCIP_RETCODE consdataShareVals(
+   SCIP*                 sourcescip,         /**< SCIP data structure of the source constraint */
+   SCIP_CONSDATA*        sourcedata,         /**< linear constraint data of the source constraint */
+   SCIP*                 targetscip,         /**< SCIP data structure of the copied constraint */
+   SCIP_CONSDATA*        targetdata          /**< linear constraint data of the copied constraint */
+   )
+{
+   int v;
+
+   assert(sourcedata != NULL);
+   assert(targetdata != NULL);
+
+   if( targetdata->sharedvals != NULL || targetdata->nvars == 0 || targetdata->nvars != sourcedata->nvars )
+      return SCIP_OKAY;
+
+   /* the coefficients may differ if variables were replaced by their active representatives */
+   for( v = 0; v < targetdata->nvars; ++v )
+   {
+      if( targetdata->vals[v] != sourcedata->vals[v] ) /*lint !e777*/
+         return SCIP_OKAY;
+   }
+
+   /* turn the coefficients of the source constraint into a shared array */
+   if( sourcedata->sharedvals == NULL )
+   {
+      SCIP_CALL( sharedvalsCreate(&sourcedata->sharedvals, sourcedata->vals, sourcedata->nvars) );
+      SCIPfreeBlockMemoryArray(sourcescip, &sourcedata->vals, sourcedata->varssize);
+      sourcedata->vals = sourcedata->sharedvals->vals;
+   }
+
+   SCIPfreeBlockMemoryArray(targetscip, &targetdata->vals, targetdata->varssize);
+   sharedvalsCapture(sourcedata->sharedvals);
+   targetdata->sharedvals = sourcedata->sharedvals;
+   targetdata->vals = targetdata->sharedvals->vals;
+
+   return SCIP_OKAY;
+}
+
 /** ensures, that vars and vals arrays can store at least num entries */
 static
 SCIP_RETCODE consdataEnsureVarsSize(
@@ -480,7 +684,14 @@ SCIP_RETCODE consdataEnsureVarsSize(
 
       newsize = SCIPcalcMemGrowSize(scip, num);
       SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->vars, consdata->varssize, newsize) );
-      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->vals, consdata->varssize, newsize) );
+      if( consdata->sharedvals != NULL )
+      {
+         SCIP_CALL( consdataUnshareVals(scip, consdata, newsize) );
+      }
+      else
+      {
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->vals, consdata->varssize, newsize) );
+      }
       if( consdata->eventdata != NULL )
       {
          SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &consdata->eventdata, consdata->varssize, newsize) );
@@ -888,6 +1099,7 @@ SCIP_RETCODE consdataCreate(
    (*consdata)->hasnonbinvalid = TRUE;
    (*consdata)->vars = NULL;
    (*consdata)->vals = NULL;
+   (*consdata)->sharedvals = NULL;
 
    constant = 0.0;
    if( nvars > 0 )
@@ -1086,7 +1298,15 @@ SCIP_RETCODE consdataFree(
    }
 
    SCIPfreeBlockMemoryArrayNull(scip, &(*consdata)->vars, (*consdata)->varssize);
-   SCIPfreeBlockMemoryArrayNull(scip, &(*consdata)->vals, (*consdata)->varssize);
+   if( (*consdata)->sharedvals != NULL )
+   {
+      sharedvalsRelease(&(*consdata)->sharedvals);
+      (*consdata)->vals = NULL;
+   }
+   else
+   {
+      SCIPfreeBlockMemoryArrayNull(scip, &(*consdata)->vals, (*consdata)->varssize);
+   }
    SCIPfreeBlockMemory(scip, consdata);
 
    return SCIP_OKAY;
@@ -3327,7 +3547,8 @@ static
 void permSortConsdata(
    SCIP_CONSDATA*        consdata,           /**< the constraint data */
    int*                  perm,               /**< the target permutation */
-   int                   nvars               /**< the number of variables */
+   int                   nvars,              /**< the number of variables */
+   SCIP_Bool             permutevals         /**< should the coefficients be permuted, too? */
    )
 {  /*lint --e{715}*/
    SCIP_VAR* varv;
@@ -3356,7 +3577,8 @@ void permSortConsdata(
             assert(0 <= perm[i] && perm[i] < nvars);
             assert(perm[i] != i);
             consdata->vars[i] = consdata->vars[perm[i]];
-            consdata->vals[i] = consdata->vals[perm[i]];
+            if( permutevals )
+               consdata->vals[i] = consdata->vals[perm[i]];
             if( consdata->eventdata != NULL )
             {
                consdata->eventdata[i] = consdata->eventdata[perm[i]];
@@ -3368,7 +3590,8 @@ void permSortConsdata(
          }
          while( perm[i] != v );
          consdata->vars[i] = varv;
-         consdata->vals[i] = valv;
+         if( permutevals )
+            consdata->vals[i] = valv;
          if( consdata->eventdata != NULL )
          {
             consdata->eventdata[i] = eventdatav;
@@ -3430,7 +3653,40 @@ SCIP_RETCODE consdataSort(
       else
          SCIPsort(perm, consdataCompVarProp, (void*)consdata, consdata->nvars);
 
-      permSortConsdata(consdata, perm, consdata->nvars);
+      /* a shared coefficient array is replaced by the shared permuted array if the other copies of the constraint
+       * were sorted identically
+       */
+      if( consdata->sharedvals != NULL )
+      {
+         for( v = 0; v < consdata->nvars && perm[v] == v; ++v )
+         {
+         }
+
+         if( v < consdata->nvars )
+         {
+            SHAREDVALS* permuted;
+
+            SCIP_CALL( sharedvalsGetPermuted(consdata->sharedvals, perm, consdata->nvars, &permuted) );
+
+            if( permuted != NULL )
+            {
+               sharedvalsRelease(&consdata->sharedvals);
+               consdata->sharedvals = permuted;
+               consdata->vals = permuted->vals;
+            }
+            else
+            {
+               SCIP_CALL( consdataUnshareVals(scip, consdata, consdata->varssize) );
+               permSortConsdata(consdata, perm, consdata->nvars, TRUE);
+            }
+         }
+
+         /* the permutation was applied to the coefficients already */
+         if( consdata->sharedvals != NULL )
+            permSortConsdata(consdata, perm, consdata->nvars, FALSE);
+      }
+      else
+         permSortConsdata(consdata, perm, consdata->nvars, TRUE);
 
       /* free temporary memory */
       SCIPfreeBufferArray(scip, &perm);
@@ -3757,6 +4013,7 @@ SCIP_RETCODE addCoef(
    assert(transformed == SCIPvarIsTransformed(var));
 
    SCIP_CALL( consdataEnsureVarsSize(scip, consdata, consdata->nvars+1) );
+   SCIP_CALL( consdataUnshareVals(scip, consdata, consdata->varssize) );
    consdata->vars[consdata->nvars] = var;
    consdata->vals[consdata->nvars] = val;
    consdata->nvars++;
@@ -3933,6 +4190,7 @@ SCIP_RETCODE delCoefPos(
    /* move the last variable to the free slot */
    if( pos != consdata->nvars - 1 )
    {
+      SCIP_CALL( consdataUnshareVals(scip, consdata, consdata->varssize) );
       consdata->vars[pos] = consdata->vars[consdata->nvars-1];
       consdata->vals[pos] = consdata->vals[consdata->nvars-1];
 
@@ -4051,6 +4309,7 @@ SCIP_RETCODE chgCoefPos(
    }
 
    /* change the value */
+   SCIP_CALL( consdataUnshareVals(scip, consdata, consdata->varssize) );
    consdata->vals[pos] = newval;
 
    if( consdata->coefsorted )
@@ -4114,6 +4373,8 @@ SCIP_RETCODE scaleCons(
       return SCIP_OKAY;
    }
 
+   SCIP_CALL( consdataUnshareVals(scip, consdata, consdata->varssize) );
+
    /* scale the coefficients */
    for( i = consdata->nvars - 1; i >= 0; --i )
    {
@@ -5757,6 +6018,97 @@ SCIP_RETCODE tightenVarBoundsEasy(
    return SCIP_OKAY;
 }
 
+/** marks the variables at positions first,...,nvars-1 whose bounds may be tightened by tightenVarBoundsEasy() w.r.t.
+ *  the current activity bounds
+ *
+ *  The local bounds are collected into the arrays lbs and ubs first, such that the test of all variables against the
+ *  slack of both sides runs over contiguous arrays and can be vectorized by the compiler. A variable is only skipped if
+ *  tightenVarBoundsEasy() would neither find a bound change nor infeasibility for it, i.e., the activity contribution
+ *  val * (ub - lb) does not exceed the smaller one of the two slacks. If one of the sides is violated by the activity
+ *  bounds, all variables are marked such that the infeasibility is detected as before.
+ */
+static
+void consdataScreenEasyBounds(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSDATA*        consdata,           /**< linear constraint data */
+   int                   first,              /**< first position to screen */
+   SCIP_Real*            lbs,                /**< buffer to store the local lower bounds of the variables */
+   SCIP_Real*            ubs,                /**< buffer to store the local upper bounds of the variables */
+   SCIP_Bool*            candidates          /**< buffer to mark the variables that may be tightened */
+   )
+{
+   SCIP_VAR** vars;
+   SCIP_Real* vals;
+   SCIP_Real sumepsilon;
+   SCIP_Real slack;
+   int nvars;
+   int i;
+
+   assert(scip != NULL);
+   assert(consdata != NULL);
+   assert(lbs != NULL);
+   assert(ubs != NULL);
+   assert(candidates != NULL);
+   assert(0 <= first && first <= consdata->nvars);
+
+   vars = consdata->vars;
+   vals = consdata->vals;
+   nvars = consdata->nvars;
+
+   /* compute the activities in the same way as tightenVarBoundsEasy() */
+   if( !consdata->validactivities )
+      consdataCalcActivities(scip, consdata);
+   assert(consdata->validactivities);
+   if( !consdata->validminact )
+      consdataRecomputeMinactivity(scip, consdata);
+   assert(consdata->validminact);
+
+   slack = SCIPinfinity(scip);
+
+   if( !SCIPisInfinity(scip, consdata->rhs) )
+   {
+      if( SCIPisFeasLT(scip, consdata->rhs, consdata->minactivity) )
+         slack = -SCIPinfinity(scip);
+      else if( SCIPisPositive(scip, consdata->rhs - consdata->minactivity) )
+         slack = consdata->rhs - consdata->minactivity;
+      else
+         slack = 0.0;
+   }
+
+   if( !SCIPisInfinity(scip, -consdata->lhs) )
+   {
+      if( !consdata->validmaxact )
+         consdataRecomputeMaxactivity(scip, consdata);
+      assert(consdata->validmaxact);
+
+      if( SCIPisFeasLT(scip, consdata->maxactivity, consdata->lhs) )
+         slack = -SCIPinfinity(scip);
+      else if( SCIPisPositive(scip, consdata->maxactivity - consdata->lhs) )
+         slack = MIN(slack, consdata->maxactivity - consdata->lhs);
+      else
+         slack = MIN(slack, 0.0);
+   }
+
+   /* a violated side is detected by the first call of tightenVarBoundsEasy() */
+   if( SCIPisInfinity(scip, -slack) )
+   {
+      for( i = first; i < nvars; ++i )
+         candidates[i] = TRUE;
+      return;
+   }
+
+   for( i = first; i < nvars; ++i )
+   {
+      lbs[i] = SCIPvarGetLbLocal(vars[i]);
+      ubs[i] = SCIPvarGetUbLocal(vars[i]);
+   }
+
+   /* same test as SCIPisSumGT(scip, alpha, slack) in tightenVarBoundsEasy() */
+   sumepsilon = SCIPsumepsilon(scip);
+   for( i = first; i < nvars; ++i )
+      candidates[i] = (REALABS(vals[i]) * (ubs[i] - lbs[i]) - slack > sumepsilon);
+}
+
 /** analyzes conflicting bounds on given ranged row constraint, and adds conflict constraint to problem */
 static
 SCIP_RETCODE analyzeConflictRangedRow(
@@ -7084,6 +7436,9 @@ SCIP_RETCODE tightenBounds(
    )
 {
    SCIP_CONSDATA* consdata;
+   SCIP_Real* lbs;
+   SCIP_Real* ubs;
+   SCIP_Bool* candidates;
    unsigned int tightenmode;
    int nvars;
    int nrounds;
@@ -7095,6 +7450,7 @@ SCIP_RETCODE tightenBounds(
    int v;
    SCIP_Bool force;
    SCIP_Bool easycase;
+   SCIP_Bool screen;
 
    assert(scip != NULL);
    assert(cons != NULL);
@@ -7182,6 +7538,19 @@ SCIP_RETCODE tightenBounds(
    /* check if we can use fast implementation for easy and numerically well behaved cases */
    easycase = SCIPisLT(scip, consdata->maxactdelta, maxeasyactivitydelta);
 
+   /* in the easy case, screen all variables at once and only try to tighten those whose bounds may change */
+   screen = easycase && !force;
+   lbs = NULL;
+   ubs = NULL;
+   candidates = NULL;
+
+   if( screen )
+   {
+      SCIP_CALL( SCIPallocBufferArray(scip, &lbs, nvars) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &ubs, nvars) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &candidates, nvars) );
+   }
+
    /* as long as the bounds might be tightened again, try to tighten them; abort after a maximal number of rounds */
    lastchange = -1;
    oldnchgbds = 0;
@@ -7208,6 +7577,9 @@ SCIP_RETCODE tightenBounds(
       /* try to tighten the bounds of each variable in the constraint. During solving process, the binary variable
        * sorting enables skipping variables
        */
+      if( screen )
+         consdataScreenEasyBounds(scip, consdata, 0, lbs, ubs, candidates);
+
       v = 0;
       while( v < nvars && v != lastchange && !(*cutoff) )
       {
@@ -7215,7 +7587,10 @@ SCIP_RETCODE tightenBounds(
 
          if( easycase )
          {
-            SCIP_CALL( tightenVarBoundsEasy(scip, cons, v, cutoff, nchgbds, force) );
+            if( !screen || candidates[v] )
+            {
+               SCIP_CALL( tightenVarBoundsEasy(scip, cons, v, cutoff, nchgbds, force) );
+            }
          }
          else
          {
@@ -7227,6 +7602,10 @@ SCIP_RETCODE tightenBounds(
          {
             lastchange = v;
             ++v;
+
+            /* the activities changed, so the remaining variables have to be screened again */
+            if( screen && !(*cutoff) )
+               consdataScreenEasyBounds(scip, consdata, v, lbs, ubs, candidates);
          }
          else if( consdata->coefsorted && v < consdata->nbinvars - 1
             && !SCIPisFeasEQ(scip, SCIPvarGetUbLocal(consdata->vars[v]), SCIPvarGetLbLocal(consdata->vars[v])) )
@@ -7242,6 +7621,10 @@ SCIP_RETCODE tightenBounds(
 #endif
    }
 
+   SCIPfreeBufferArrayNull(scip, &candidates);
+   SCIPfreeBufferArrayNull(scip, &ubs);
+   SCIPfreeBufferArrayNull(scip, &lbs);
+
 #ifndef NDEBUG
    if( force && SCIPisEQ(scip, consdata->lhs, consdata->rhs) )
       assert(*cutoff || SCIPisFeasEQ(scip, SCIPvarGetLbLocal(consdata->vars[0]), SCIPvarGetUbLocal(consdata->vars[0])));
@@ -11642,7 +12025,8 @@ SCIP_RETCODE simplifyInequalities(
    SCIPsort(perm, consdataCompSim, (void*)consdata, nvars);
 
    /* perform sorting after permutation array */
-   permSortConsdata(consdata, perm, nvars);
+   SCIP_CALL( consdataUnshareVals(scip, consdata, consdata->varssize) );
+   permSortConsdata(consdata, perm, nvars, TRUE);
    consdata->indexsorted = FALSE;
    consdata->coefsorted = FALSE;
 
@@ -15902,6 +16286,12 @@ SCIP_DECL_CONSTRANS(consTransLinear)
    /* create linear constraint data for target constraint */
    SCIP_CALL( consdataCreate(scip, &targetdata, sourcedata->nvars, sourcedata->vars, sourcedata->vals, sourcedata->lhs, sourcedata->rhs) );
 
+   /* let the transformed constraint share the coefficients of the original constraint */
+   if( SCIPconshdlrGetData(conshdlr)->sharecoefs )
+   {
+      SCIP_CALL( consdataShareVals(scip, sourcedata, scip, targetdata) );
+   }
+
 #ifndef NDEBUG
    /* if this is a checked or enforced constraints, then there must be no relaxation-only variables */
    if( SCIPconsIsEnforced(sourcecons) || SCIPconsIsChecked(sourcecons) )
@@ -16900,6 +17290,21 @@ SCIP_DECL_CONSCOPY(consCopyLinear)
          initial, separate, enforce, check, propagate, local, modifiable, dynamic, removable, stickingatnode, global, valid) );
    assert(cons != NULL || *valid == FALSE);
 
+   /* let the copied constraint share the coefficients of the source constraint, e.g., among concurrent solvers */
+   if( *valid && *cons != NULL )
+   {
+      SCIP_CONSHDLR* conshdlr;
+
+      conshdlr = SCIPfindConshdlr(scip, CONSHDLR_NAME);
+      assert(conshdlr != NULL);
+      assert(SCIPconsGetHdlr(*cons) == conshdlr);
+
+      if( SCIPconshdlrGetData(conshdlr)->sharecoefs )
+      {
+         SCIP_CALL( consdataShareVals(sourcescip, SCIPconsGetData(sourcecons), scip, SCIPconsGetData(*cons)) );
+      }
+   }
+
    /* @todo should also the checkabsolute flag of the constraint be copied? */
 
    return SCIP_OKAY;
@@ -17742,6 +18147,10 @@ SCIP_RETCODE SCIPincludeConshdlrLinear(
          "constraints/" CONSHDLR_NAME "/extractcliques",
          "should Cliques be extracted?",
          &conshdlrdata->extractcliques, TRUE, DEFAULT_EXTRACTCLIQUES, NULL, NULL) );
+   SCIP_CALL( SCIPaddBoolParam(scip,
+         "constraints/" CONSHDLR_NAME "/sharecoefs",
+         "should copies of constraints share the coefficient array with the source constraint until one of them changes its coefficients?",
+         &conshdlrdata->sharecoefs, TRUE, DEFAULT_SHARECOEFS, NULL, NULL) );
 
    return SCIP_OKAY;
 }
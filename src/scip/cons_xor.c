@@ -116,9 +116,6 @@
  * Data structures
  */
 
-/** type used for matrix entries in function checkGauss() */
-typedef unsigned short Type;
-
 /** constraint data for xor constraints */
 struct SCIP_ConsData
 {
@@ -2132,172 +2129,6 @@ SCIP_RETCODE separateCons(
    return SCIP_OKAY;
 }
 
-/** Transform linear system \f$A x = b\f$ into row echolon form via the Gauss algorithm with row pivoting over GF2
- *  @returns the rank of @p A
- *
- *  Here, \f$A \in R^{m \times n},\; b \in R^m\f$. On exit, the vector @p p contains a permutation of the row indices
- *  used for pivoting and the function returns the rank @p r of @p A. For each row \f$i = 1, \ldots, r\f$, the entry @p
- *  s[i] contains the column index of the first nonzero in row @p i.
- */
-static
-int computeRowEcholonGF2(
-   SCIP*                 scip,               /**< SCIP data structure */
-   int                   m,                  /**< number of rows */
-   int                   n,                  /**< number of columns */
-   int*                  p,                  /**< row permutation */
-   int*                  s,                  /**< steps indicators of the row echolon form */
-   Type**                A,                  /**< matrix */
-   Type*                 b                   /**< rhs */
-   )
-{
-   int pi;
-   int i;
-   int j;
-   int k;
-
-   assert( A != NULL );
-   assert( b != NULL );
-   assert( p != NULL );
-   assert( s != NULL );
-
-   /* init permutation and step indicators */
-   for (i = 0; i < m; ++i)
-   {
-      p[i] = i;
-      s[i] = i;
-   }
-
-   /* loop through possible steps in echolon form (stop at min {n, m}) */
-   for (i = 0; i < m && i < n; ++i)
-   {
-      assert( s[i] == i );
-
-      /* init starting column */
-      if ( i == 0 )
-         j = 0;
-      else
-         j = s[i-1] + 1;
-
-      /* find pivot row (i.e., first nonzero entry), if all entries in current row are 0 we search the next column */
-      do
-      {
-         /* search in current column j */
-         k = i;
-         while ( k < m && A[p[k]][j] == 0 )
-            ++k;
-
-         /* found pivot */
-         if ( k < m )
-            break;
-
-         /* otherwise search next column */
-         ++j;
-      }
-      while ( j < n );
-
-      /* if not pivot entry was found (checked all columns), the rank of A is equal to the current index i; in this case
-       * all entries in and below row i are 0 */
-      if ( j >= n )
-         return i;
-
-      /* at this place: we have found a pivot entry (p[k], j) */
-      assert( k < m );
-
-      /* store step index */
-      s[i] = j;
-      assert( A[p[k]][j] != 0 );
-
-      /* swap row indices */
-      if ( k != i )
-      {
-         int h = p[i];
-         p[i] = p[k];
-         p[k] = h;
-      }
-      pi = p[i];
-      assert( A[pi][s[i]] != 0 );
-
-      /* do elimination */
-      for (k = i+1; k < m; ++k)
-      {
-         int pk = p[k];
-         /* if entry in leading column is nonzero (otherwise we already have a 0) */
-         if ( A[pk][s[i]] != 0 )
-         {
-            for (j = s[i]; j < n; ++j)
-               A[pk][j] = A[pk][j] ^ A[pi][j];  /*lint !e732*/
-            b[pk] = b[pk] ^ b[pi];  /*lint !e732*/
-         }
-      }
-
-      /* check stopped (only every 100 rows in order to save time */
-      if ( i % 100 == 99 )
-      {
-         if ( SCIPisStopped(scip) )
-            return -1;
-      }
-   }
-
-   /* at this point we have treated all rows in which a step can occur; the rank is the minimum of the number of rows or
-    * columns min {n,m}. */
-   if ( n <= m )
-      return n;
-   return m;
-}
-
-/** Construct solution from matrix in row echolon form over GF2
- *
- *  Compute solution of \f$A x = b\f$, which is already in row echolon form (@see computeRowEcholonGF2()) */
-static
-void solveRowEcholonGF2(
-   int                   m,                  /**< number of rows */
-   int                   n,                  /**< number of columns */
-   int                   r,                  /**< rank of matrix */
-   int*                  p,                  /**< row permutation */
-   int*                  s,                  /**< steps indicators of the row echolon form */
-   Type**                A,                  /**< matrix */
-   Type*                 b,                  /**< rhs */
-   Type*                 x                   /**< solution vector on exit */
-   )
-{
-   int i;
-   int k;
-
-   assert( A != NULL );
-   assert( b != NULL );
-   assert( s != NULL );
-   assert( p != NULL );
-   assert( x != NULL );
-   assert( r <= m && r <= n );
-
-   /* init solution vector to 0 */
-   for (k = 0; k < n; ++k)
-      x[k] = 0;
-
-   /* init last entry */
-   x[s[r-1]] = b[p[r-1]];
-
-   /* loop backwards through solution vector */
-   for (i = r-2; i >= 0; --i)
-   {
-      Type val;
-
-      assert( i <= s[i] && s[i] <= n );
-
-      /* init val with rhs and then add the contributions of the components of x already computed */
-      val = b[p[i]];
-      for (k = i+1; k < r; ++k)
-      {
-         assert( i <= s[k] && s[k] <= n );
-         if ( A[p[i]][s[k]] != 0 )
-            val = val ^ x[s[k]];  /*lint !e732*/
-      }
-
-      /* store solution */
-      x[s[i]] = val;
-   }
-}
-
 /** solve equation system over GF 2 by Gauss algorithm and create solution out of it or return cutoff
  *
  *  Collect all information in xor constraints into a linear system over GF2. Then solve the system by computing a row
@@ -2327,8 +2158,7 @@ SCIP_RETCODE checkSystemGF2(
    SCIP_Real* xorvals;
    SCIP_VAR** xorvars;
    SCIP_Bool noaggr = TRUE;
-   Type** A;
-   Type* b;
+   SCIP_GF2MATRIX* gf2matrix;
    int* s;
    int* p;
    int* xoridx;
@@ -2464,10 +2294,11 @@ SCIP_RETCODE checkSystemGF2(
    }
 
    /* init matrix and rhs */
-   SCIP_CALL( SCIPallocBufferArray(scip, &b, nconssactive) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &A, nconssactive) );
+   SCIP_CALL( SCIPgf2matrixCreate(&gf2matrix, SCIPblkmem(scip), nconssactive, nvarsmat) );
    for (i = 0; i < nconss; ++i)
    {
+      SCIP_Bool rhs;
+
       if ( ! xoractive[i] )
          continue;
 
@@ -2476,11 +2307,8 @@ SCIP_RETCODE checkSystemGF2(
       assert( consdata != NULL );
       assert( consdata->nvars > 0 );
 
-      SCIP_CALL( SCIPallocBufferArray(scip, &(A[nconssmat]), nvarsmat) ); /*lint !e866*/
-      BMSclearMemoryArray(A[nconssmat], nvarsmat); /*lint !e866*/
-
       /* correct rhs w.r.t. to fixed variables and count nonfixed variables in constraint */
-      b[nconssmat] = (Type) consdata->rhs;
+      rhs = (consdata->rhs != 0);
       for (j = 0; j < consdata->nvars; ++j)
       {
          SCIP_VAR* var;
@@ -2494,7 +2322,7 @@ SCIP_RETCODE checkSystemGF2(
          {
             var = SCIPvarGetNegatedVar(var);
             assert( var != NULL );
-            b[nconssmat] = ! b[nconssmat];
+            rhs = ! rhs;
          }
 
          /* replace aggregated variables */
@@ -2511,7 +2339,7 @@ SCIP_RETCODE checkSystemGF2(
             {
                assert(SCIPisEQ(scip, constant, 0.0) || SCIPisEQ(scip, constant, 1.0));
                if( SCIPisEQ(scip, constant, 1.0) )
-                  b[nconssmat] = ! b[nconssmat];
+                  rhs = ! rhs;
                var = NULL;
                break;
             }
@@ -2520,7 +2348,7 @@ SCIP_RETCODE checkSystemGF2(
             {
                assert(SCIPisEQ(scip, scalar, 1.0) || SCIPisEQ(scip, scalar, -1.0));
                if( SCIPisEQ(scip, constant, 1.0) )
-                  b[nconssmat] = ! b[nconssmat];
+                  rhs = ! rhs;
 
                var = SCIPvarGetAggrVar(var);
                assert(var != NULL);
@@ -2539,7 +2367,7 @@ SCIP_RETCODE checkSystemGF2(
          if ( SCIPcomputeVarLbLocal(scip, var) > 0.5 )
          {
             /* variable is fixed to 1, invert rhs */
-            b[nconssmat] = ! b[nconssmat];
+            rhs = ! rhs;
             assert( ! SCIPhashmapExists(varhash, var) );
          }
          else
@@ -2552,10 +2380,13 @@ SCIP_RETCODE checkSystemGF2(
                idx = SCIPhashmapGetImageInt(varhash, var);
                assert( idx < nvarsmat );
                assert( 0 <= xorbackidx[idx] && xorbackidx[idx] < nvarsmat );
-               A[nconssmat][xorbackidx[idx]] = 1;
+
+               /* a variable that appears twice after resolving aggregations cancels out */
+               SCIP_CALL( SCIPgf2matrixFlipEntry(gf2matrix, nconssmat, xorbackidx[idx]) );
             }
          }
       }
+      SCIPgf2matrixSetRhs(gf2matrix, nconssmat, rhs);
       ++nconssmat;
    }
    SCIPdebugMsg(scip, "Found %d non-fixed variables in %d nonempty xor constraints.\n", nvarsmat, nconssmat);
@@ -2570,8 +2401,8 @@ SCIP_RETCODE checkSystemGF2(
    for (i = 0; i < nconssmat; ++i)
    {
       for (j = 0; j < nvarsmat; ++j)
-         SCIPinfoMessage(scip, NULL, "%d ", A[i][j]);
-      SCIPinfoMessage(scip, NULL, " = %d\n", b[i]);
+         SCIPinfoMessage(scip, NULL, "%d ", SCIPgf2matrixGetEntry(gf2matrix, i, j));
+      SCIPinfoMessage(scip, NULL, " = %d\n", SCIPgf2matrixGetRhs(gf2matrix, i));
    }
    SCIPinfoMessage(scip, NULL, "\n");
 #endif
@@ -2579,11 +2410,11 @@ SCIP_RETCODE checkSystemGF2(
    rank = -1;
    if ( ! SCIPisStopped(scip) )
    {
-      rank = computeRowEcholonGF2(scip, nconssmat, nvarsmat, p, s, A, b);
+      SCIP_CALL( SCIPgf2matrixComputeRowEchelon(gf2matrix, p, s, &rank) );
       assert( rank <= nconssmat && rank <= nvarsmat );
    }
 
-   /* rank is < 0 if the solution process has been stopped */
+   /* rank is < 0 if the solving process has been stopped */
    if ( rank >= 0 )
    {
 #ifdef SCIP_OUTPUT
@@ -2591,8 +2422,8 @@ SCIP_RETCODE checkSystemGF2(
       for (i = 0; i < nconssmat; ++i)
       {
          for (j = 0; j < nvarsmat; ++j)
-            SCIPinfoMessage(scip, NULL, "%d ", A[p[i]][j]);
-         SCIPinfoMessage(scip, NULL, " = %d\n", b[p[i]]);
+            SCIPinfoMessage(scip, NULL, "%d ", SCIPgf2matrixGetEntry(gf2matrix, p[i], j));
+         SCIPinfoMessage(scip, NULL, " = %d\n", SCIPgf2matrixGetRhs(gf2matrix, p[i]));
       }
       SCIPinfoMessage(scip, NULL, "\n");
 #endif
@@ -2600,7 +2431,7 @@ SCIP_RETCODE checkSystemGF2(
       /* check whether system is feasible */
       for (i = rank; i < nconssmat; ++i)
       {
-         if ( b[p[i]] != 0 )
+         if ( SCIPgf2matrixGetRhs(gf2matrix, p[i]) )
             break;
       }
 
@@ -2614,13 +2445,13 @@ SCIP_RETCODE checkSystemGF2(
          {
             SCIP_Bool tightened;
             SCIP_Bool infeasible;
-            Type* x;
+            SCIP_Bool* x;
 
             SCIPdebugMsg(scip, "Found unique solution.\n");
 
             /* construct solution */
             SCIP_CALL( SCIPallocBufferArray(scip, &x, nvarsmat) );
-            solveRowEcholonGF2(nconssmat, nvarsmat, rank, p, s, A, b, x);
+            SCIP_CALL( SCIPgf2matrixSolveRowEchelon(gf2matrix, p, s, rank, x) );
 
 #ifdef SCIP_OUTPUT
             SCIPinfoMessage(scip, NULL, "Solution:\n");
@@ -2635,7 +2466,7 @@ SCIP_RETCODE checkSystemGF2(
                assert( SCIPhashmapGetImageInt(varhash, xorvars[j]) < nvars );
                assert( xorbackidx[SCIPhashmapGetImageInt(varhash, xorvars[j])] == j );
                assert( SCIPcomputeVarLbLocal(scip, xorvars[j]) < 0.5 );
-               if( x[j] == 0 )
+               if( ! x[j] )
                {
                   SCIP_CALL( SCIPtightenVarUb(scip, xorvars[j], 0.0, FALSE, &infeasible, &tightened) );
                   assert(tightened);
@@ -2643,7 +2474,6 @@ SCIP_RETCODE checkSystemGF2(
                }
                else
                {
-                  assert(x[j] == 1);
                   SCIP_CALL( SCIPtightenVarLb(scip, xorvars[j], 1.0, FALSE, &infeasible, &tightened) );
                   assert(tightened);
                   assert(!infeasible);
@@ -2666,11 +2496,11 @@ SCIP_RETCODE checkSystemGF2(
                SCIP_Bool success;
                SCIP_VAR** vars;
                SCIP_SOL* sol;
-               Type* x;
+               SCIP_Bool* x;
 
                /* construct solution */
                SCIP_CALL( SCIPallocBufferArray(scip, &x, nvarsmat) );
-               solveRowEcholonGF2(nconssmat, nvarsmat, rank, p, s, A, b, x);
+               SCIP_CALL( SCIPgf2matrixSolveRowEchelon(gf2matrix, p, s, rank, x) );
 
 #ifdef SCIP_OUTPUT
                SCIPinfoMessage(scip, NULL, "Solution:\n");
@@ -2685,7 +2515,7 @@ SCIP_RETCODE checkSystemGF2(
                /* transfer solution */
                for (j = 0; j < nvarsmat; ++j)
                {
-                  if ( x[j] != 0 )
+                  if ( x[j] )
                   {
                      assert( SCIPhashmapGetImageInt(varhash, xorvars[j]) < nvars );
                      assert( xorbackidx[SCIPhashmapGetImageInt(varhash, xorvars[j])] == j );
@@ -2765,23 +2595,7 @@ SCIP_RETCODE checkSystemGF2(
    /* free storage */
    SCIPfreeBufferArray(scip, &s);
    SCIPfreeBufferArray(scip, &p);
-   j = nconssmat - 1;
-   for (i = nconss - 1; i >= 0 ; --i)
-   {
-      consdata = SCIPconsGetData(conss[i]);
-      assert(consdata != NULL);
-
-      if ( consdata->nvars == 0 )
-         continue;
-
-      if( !xoractive[i] )
-         continue;
-
-      SCIPfreeBufferArray(scip, &(A[j]));
-      --j;
-   }
-   SCIPfreeBufferArray(scip, &A);
-   SCIPfreeBufferArray(scip, &b);
+   SCIPgf2matrixFree(&gf2matrix);
    SCIPfreeBufferArray(scip, &xorbackidx);
    SCIPfreeBufferArray(scip, &xoridx);
    SCIPfreeBufferArray(scip, &xorvars);
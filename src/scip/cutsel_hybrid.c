@@ -25,11 +25,14 @@
 
 #include <assert.h>
 
+#include "scip/concurrent.h"
+#include "scip/pub_misc.h"
 #include "scip/scip_cutsel.h"
 #include "scip/scip_cut.h"
 #include "scip/scip_lp.h"
 #include "scip/scip_randnumgen.h"
 #include "scip/cutsel_hybrid.h"
+#include "tpi/tpi.h"
 
 
 #define CUTSEL_NAME              "hybrid"
@@ -46,6 +49,11 @@
 #define DEFAULT_INTSUPPORTWEIGHT        0.1  /**< weight of integral support in cut score calculation */
 #define DEFAULT_MINORTHO                0.90 /**< minimal orthogonality for a cut to enter the LP */
 #define DEFAULT_MINORTHOROOT            0.90 /**< minimal orthogonality for a cut to enter the LP in the root node */
+#define DEFAULT_NTHREADS                   1 /**< number of threads used to score the cuts */
+
+#define SIGNATURESIZE                      4 /**< number of 64 bit words of the column signature of a cut */
+#define PARALLELISMEPS                  1e-9 /**< safety margin for the parallelism bound used to skip cut pairs */
+#define MINNCUTSPERJOB                   250 /**< minimal number of cuts scored by one job */
 
 /*
  * Data structures
@@ -64,82 +72,90 @@ struct SCIP_CutselData
    SCIP_Real             intsupportweight;   /**< weight of integral support in cut score calculation */
    SCIP_Real             minortho;           /**< minimal orthogonality for a cut to enter the LP */
    SCIP_Real             minorthoroot;       /**< minimal orthogonality for a cut to enter the LP in the root node */
+   int                   nthreads;           /**< number of threads used to score the cuts */
+   SCIP_Bool             tpiinitialized;     /**< was the task processing interface initialized by the cut selector? */
+};
+
+/** support and norms of a cut, which are used to skip the computation of the parallelism of pairs of cuts that cannot
+ *  be too parallel
+ */
+struct CutInfo
+{
+   uint64_t              signature[SIGNATURESIZE]; /**< bit signature of the column indices of the cut */
+   int                   minidx;             /**< minimal column index of the cut */
+   int                   maxidx;             /**< maximal column index of the cut */
+   SCIP_Real             maxabsval;          /**< maximal absolute coefficient of the cut */
+   SCIP_Real             sumabsval;          /**< sum of absolute coefficients of the cut */
+   SCIP_Real             norm;               /**< Euclidean norm of the cut, as used for the parallelism */
 };
+typedef struct CutInfo CUTINFO;
+
+/** data of a job that scores a range of cuts */
+struct ScoreJob
+{
+   SCIP*                 scip;               /**< SCIP data structure */
+   SCIP_ROW**            cuts;               /**< array with all cuts */
+   SCIP_SOL*             sol;                /**< incumbent for the directed cutoff distance, or NULL */
+   SCIP_Real*            scores;             /**< array to store the scores of the cuts */
+   CUTINFO*              cutinfos;           /**< array to store the support and norms of the cuts, or NULL */
+   SCIP_Real             dircutoffdistweight;/**< weight of directed cutoff distance in cut score calculation */
+   SCIP_Real             efficacyweight;     /**< weight of efficacy in cut score calculation */
+   SCIP_Real             objparalweight;     /**< weight of objective parallelism in cut score calculation */
+   SCIP_Real             intsupportweight;   /**< weight of integral support in cut score calculation */
+   int                   start;              /**< index of the first cut to score */
+   int                   end;                /**< index after the last cut to score */
+};
+typedef struct ScoreJob SCOREJOB;
 
 
 /*
  * Local methods
  */
 
-/** returns the maximum score of cuts; if scores is not NULL, then stores the individual score of each cut in scores */
+/** returns the score of a cut without the random tie-breaking term */
 static
-SCIP_Real scoring(
+SCIP_Real scoreCut(
    SCIP*                 scip,               /**< SCIP data structure */
-   SCIP_ROW**            cuts,               /**< array with cuts to score */
-   SCIP_RANDNUMGEN*      randnumgen,         /**< random number generator for tie-breaking, or NULL */
+   SCIP_ROW*             cut,                /**< cut to score */
+   SCIP_SOL*             sol,                /**< incumbent for the directed cutoff distance, or NULL */
    SCIP_Real             dircutoffdistweight,/**< weight of directed cutoff distance in cut score calculation */
    SCIP_Real             efficacyweight,     /**< weight of efficacy in cut score calculation */
    SCIP_Real             objparalweight,     /**< weight of objective parallelism in cut score calculation */
-   SCIP_Real             intsupportweight,   /**< weight of integral support in cut score calculation */
-   int                   ncuts,              /**< number of cuts in cuts array */
-   SCIP_Real*            scores              /**< array to store the score of cuts or NULL */
+   SCIP_Real             intsupportweight    /**< weight of integral support in cut score calculation */
    )
 {
-   SCIP_Real maxscore = 0.0;
-   SCIP_SOL* sol;
-   int i;
+   SCIP_Real score;
+   SCIP_Real objparallelism;
+   SCIP_Real intsupport;
+   SCIP_Real efficacy;
 
-   sol = SCIPgetBestSol(scip);
+   if( intsupportweight > 0.0 )
+      intsupport = intsupportweight * SCIPgetRowNumIntCols(scip, cut) / (SCIP_Real) SCIProwGetNNonz(cut);
+   else
+      intsupport = 0.0;
+
+   if( objparalweight > 0.0 )
+      objparallelism = objparalweight * SCIPgetRowObjParallelism(scip, cut);
+   else
+      objparallelism = 0.0;
 
    /* if there is an incumbent and the factor is not 0.0, compute directed cutoff distances for the incumbent */
    if( sol != NULL && dircutoffdistweight > 0.0 )
    {
-      for( i = 0; i < ncuts; ++i )
+      efficacy = SCIPgetCutEfficacy(scip, NULL, cut);
+
+      if( SCIProwIsLocal(cut) )
       {
-         SCIP_Real score;
-         SCIP_Real objparallelism;
-         SCIP_Real intsupport;
-         SCIP_Real efficacy;
-
-         if( intsupportweight > 0.0 )
-            intsupport = intsupportweight * SCIPgetRowNumIntCols(scip, cuts[i]) / (SCIP_Real) SCIProwGetNNonz(cuts[i]);
-         else
-            intsupport = 0.0;
-
-         if( objparalweight > 0.0 )
-            objparallelism = objparalweight * SCIPgetRowObjParallelism(scip, cuts[i]);
-         else
-            objparallelism = 0.0;
-
-         efficacy = SCIPgetCutEfficacy(scip, NULL, cuts[i]);
-
-         if( SCIProwIsLocal(cuts[i]) )
-         {
-            score = dircutoffdistweight * efficacy;
-         }
-         else
-         {
-            score = SCIPgetCutLPSolCutoffDistance(scip, sol, cuts[i]);
-            score = dircutoffdistweight * MAX(score, efficacy);
-         }
-
-         efficacy *= efficacyweight;
-         score += objparallelism + intsupport + efficacy;
-
-         /* add small term to prefer global pool cuts */
-         if( SCIProwIsInGlobalCutpool(cuts[i]) )
-            score += 1e-4;
-
-         if( randnumgen != NULL )
-         {
-            score += SCIPrandomGetReal(randnumgen, 0.0, 1e-6);
-         }
-
-         maxscore = MAX(maxscore, score);
-
-         if( scores != NULL )
-            scores[i] = score;
+         score = dircutoffdistweight * efficacy;
       }
+      else
+      {
+         score = SCIPgetCutLPSolCutoffDistance(scip, sol, cut);
+         score = dircutoffdistweight * MAX(score, efficacy);
+      }
+
+      efficacy *= efficacyweight;
+      score += objparallelism + intsupport + efficacy;
    }
    else
    {
@@ -147,43 +163,319 @@ SCIP_Real scoring(
        * since the efficacy underestimates the directed cuttoff distance
        */
       efficacyweight += dircutoffdistweight;
-      for( i = 0; i < ncuts; ++i )
+      efficacy = efficacyweight > 0.0 ?  efficacyweight * SCIPgetCutEfficacy(scip, NULL, cut) : 0.0;
+
+      score = objparallelism + intsupport + efficacy;
+   }
+
+   /* add small term to prefer global pool cuts */
+   if( SCIProwIsInGlobalCutpool(cut) )
+      score += 1e-4;
+
+   return score;
+}
+
+/** computes the support and norms of a cut */
+static
+void computeCutInfo(
+   SCIP_ROW*             cut,                /**< cut */
+   CUTINFO*              cutinfo             /**< pointer to store the support and norms of the cut */
+   )
+{
+   SCIP_COL** cols;
+   SCIP_Real* vals;
+   int nnonz;
+   int i;
+
+   assert(cut != NULL);
+   assert(cutinfo != NULL);
+
+   cols = SCIProwGetCols(cut);
+   vals = SCIProwGetVals(cut);
+   nnonz = SCIProwGetNNonz(cut);
+
+   BMSclearMemoryArray(cutinfo->signature, SIGNATURESIZE);
+   cutinfo->minidx = INT_MAX;
+   cutinfo->maxidx = -1;
+   cutinfo->maxabsval = 0.0;
+   cutinfo->sumabsval = 0.0;
+
+   for( i = 0; i < nnonz; ++i )
+   {
+      int idx;
+
+      idx = SCIPcolGetIndex(cols[i]);
+      assert(idx >= 0);
+
+      cutinfo->signature[idx % SIGNATURESIZE] |= SCIPhashSignature64(idx / SIGNATURESIZE);
+      cutinfo->minidx = MIN(cutinfo->minidx, idx);
+      cutinfo->maxidx = MAX(cutinfo->maxidx, idx);
+      cutinfo->maxabsval = MAX(cutinfo->maxabsval, REALABS(vals[i]));
+      cutinfo->sumabsval += REALABS(vals[i]);
+   }
+
+   cutinfo->norm = SCIProwGetNorm(cut);
+}
+
+/** returns whether the parallelism of two cuts may exceed the given value
+ *
+ *  The parallelism is zero if the cuts have no common column, which is detected by disjoint column index ranges or
+ *  signatures. Otherwise, it is bounded by |a^T d| / (||a|| ||d||) <= min(||a||_inf ||d||_1, ||a||_1 ||d||_inf) /
+ *  (||a|| ||d||).
+ */
+static
+SCIP_Bool mayBeParallel(
+   CUTINFO*              cutinfo1,           /**< support and norms of the first cut */
+   CUTINFO*              cutinfo2,           /**< support and norms of the second cut */
+   SCIP_Real             maxparall           /**< maximal parallelism */
+   )
+{
+   SCIP_Real normprod;
+   int w;
+
+   assert(cutinfo1 != NULL);
+   assert(cutinfo2 != NULL);
+
+   if( cutinfo1->maxidx < cutinfo2->minidx || cutinfo2->maxidx < cutinfo1->minidx )
+      return FALSE;
+
+   for( w = 0; w < SIGNATURESIZE; ++w )
+   {
+      if( (cutinfo1->signature[w] & cutinfo2->signature[w]) != 0 )
+         break;
+   }
+   if( w == SIGNATURESIZE )
+      return FALSE;
+
+   normprod = cutinfo1->norm * cutinfo2->norm;
+
+   /* the parallelism computation corrects wrong zero norms, so no bound is derived for them */
+   if( normprod > 0.0 )
+   {
+      SCIP_Real bound;
+
+      bound = MIN(cutinfo1->maxabsval * cutinfo2->sumabsval, cutinfo1->sumabsval * cutinfo2->maxabsval) / normprod;
+
+      if( bound < maxparall - PARALLELISMEPS )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+/** scores a range of cuts and computes their support and norms */
+static
+SCIP_RETCODE scoreCutsJob(
+   void*                 args                /**< score job */
+   )
+{
+   SCOREJOB* job;
+   int i;
+
+   job = (SCOREJOB*) args;
+   assert(job != NULL);
+
+   for( i = job->start; i < job->end; ++i )
+   {
+      job->scores[i] = scoreCut(job->scip, job->cuts[i], job->sol, job->dircutoffdistweight, job->efficacyweight,
+         job->objparalweight, job->intsupportweight);
+
+      if( job->cutinfos != NULL )
+         computeCutInfo(job->cuts[i], &job->cutinfos[i]);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** scores the given cuts with several jobs in parallel
+ *
+ *  The objective norm and the direction to the incumbent are computed and cached by the LP when they are used first.
+ *  Therefore, the cuts up to the first global cut are scored sequentially before the jobs are started.
+ */
+static
+SCIP_RETCODE scoreCutsParallel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROW**            cuts,               /**< array with cuts to score */
+   SCIP_SOL*             sol,                /**< incumbent for the directed cutoff distance, or NULL */
+   SCIP_Real             dircutoffdistweight,/**< weight of directed cutoff distance in cut score calculation */
+   SCIP_Real             efficacyweight,     /**< weight of efficacy in cut score calculation */
+   SCIP_Real             objparalweight,     /**< weight of objective parallelism in cut score calculation */
+   SCIP_Real             intsupportweight,   /**< weight of integral support in cut score calculation */
+   int                   ncuts,              /**< number of cuts in cuts array */
+   int                   nthreads,           /**< number of threads to use */
+   SCIP_Real*            scores,             /**< array to store the scores of the cuts without tie-breaking term */
+   CUTINFO*              cutinfos,           /**< array to store the support and norms of the cuts, or NULL */
+   int*                  nscored             /**< pointer to store the number of scored cuts */
+   )
+{
+   SCOREJOB* jobs;
+   SCIP_RETCODE retcode;
+   int njobs;
+   int jobid;
+   int start;
+   int j;
+
+   assert(nscored != NULL);
+
+   *nscored = 0;
+   start = 0;
+
+   do
+   {
+      SCOREJOB job;
+
+      job.scip = scip;
+      job.cuts = cuts;
+      job.sol = sol;
+      job.scores = scores;
+      job.cutinfos = cutinfos;
+      job.dircutoffdistweight = dircutoffdistweight;
+      job.efficacyweight = efficacyweight;
+      job.objparalweight = objparalweight;
+      job.intsupportweight = intsupportweight;
+      job.start = start;
+      job.end = start + 1;
+
+      SCIP_CALL( scoreCutsJob((void*) &job) );
+   }
+   while( SCIProwIsLocal(cuts[start++]) && start < ncuts );
+
+   njobs = MIN(nthreads, (ncuts - start) / MINNCUTSPERJOB);
+
+   if( njobs <= 1 )
+   {
+      *nscored = start;
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobs, njobs) );
+
+   jobid = SCIPtpiGetNewJobID();
+   retcode = SCIP_OKAY;
+
+   for( j = 0; j < njobs && retcode == SCIP_OKAY; ++j )
+   {
+      SCIP_SUBMITSTATUS status;
+      SCIP_JOB* job;
+
+      jobs[j].scip = scip;
+      jobs[j].cuts = cuts;
+      jobs[j].sol = sol;
+      jobs[j].scores = scores;
+      jobs[j].cutinfos = cutinfos;
+      jobs[j].dircutoffdistweight = dircutoffdistweight;
+      jobs[j].efficacyweight = efficacyweight;
+      jobs[j].objparalweight = objparalweight;
+      jobs[j].intsupportweight = intsupportweight;
+      jobs[j].start = start + (int) ((SCIP_Longint) (ncuts - start) * j / njobs);
+      jobs[j].end = start + (int) ((SCIP_Longint) (ncuts - start) * (j + 1) / njobs);
+
+      retcode = SCIPtpiCreateJob(&job, jobid, scoreCutsJob, (void*) &jobs[j]);
+
+      if( retcode == SCIP_OKAY )
       {
-         SCIP_Real score;
-         SCIP_Real objparallelism;
-         SCIP_Real intsupport;
-         SCIP_Real efficacy;
+         retcode = SCIPtpiSumbitJob(job, &status);
+
+         if( retcode == SCIP_OKAY && status != SCIP_SUBMIT_SUCCESS )
+            retcode = SCIP_ERROR;
+      }
+   }
+
+   retcode = MIN(retcode, SCIPtpiCollectJobs(jobid));
+
+   SCIPfreeBufferArray(scip, &jobs);
+
+   SCIP_CALL( retcode );
+
+   *nscored = ncuts;
 
-         if( intsupportweight > 0.0 )
-            intsupport = intsupportweight * SCIPgetRowNumIntCols(scip, cuts[i]) / (SCIP_Real) SCIProwGetNNonz(cuts[i]);
-         else
-            intsupport = 0.0;
+   return SCIP_OKAY;
+}
+
+/** returns the maximum score of cuts; if scores is not NULL, then stores the individual score of each cut in scores;
+ *  if cutinfos is not NULL, then stores the support and norms of each cut in cutinfos
+ */
+static
+SCIP_RETCODE scoring(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROW**            cuts,               /**< array with cuts to score */
+   SCIP_RANDNUMGEN*      randnumgen,         /**< random number generator for tie-breaking, or NULL */
+   SCIP_Real             dircutoffdistweight,/**< weight of directed cutoff distance in cut score calculation */
+   SCIP_Real             efficacyweight,     /**< weight of efficacy in cut score calculation */
+   SCIP_Real             objparalweight,     /**< weight of objective parallelism in cut score calculation */
+   SCIP_Real             intsupportweight,   /**< weight of integral support in cut score calculation */
+   int                   ncuts,              /**< number of cuts in cuts array */
+   int                   nthreads,           /**< number of threads to use for scoring */
+   SCIP_Real*            scores,             /**< array to store the score of cuts or NULL */
+   CUTINFO*              cutinfos,           /**< array to store the support and norms of cuts or NULL */
+   SCIP_Real*            maxscore            /**< pointer to store the maximum score */
+   )
+{
+   SCIP_SOL* sol;
+   int nscored;
+   int i;
 
-         if( objparalweight > 0.0 )
-            objparallelism = objparalweight * SCIPgetRowObjParallelism(scip, cuts[i]);
-         else
-            objparallelism = 0.0;
+   assert(maxscore != NULL);
 
-         efficacy = efficacyweight > 0.0 ?  efficacyweight * SCIPgetCutEfficacy(scip, NULL, cuts[i]) : 0.0;
+   *maxscore = 0.0;
+   sol = SCIPgetBestSol(scip);
+   nscored = 0;
 
-         score = objparallelism + intsupport + efficacy;
+   /* the scores and supports are computed in parallel if possible; the tie-breaking terms are added afterwards in the
+    * order of the cuts, such that the scores do not depend on the number of threads
+    */
+   if( scores != NULL && nthreads > 1 && ncuts >= 2 * MINNCUTSPERJOB && SCIPtpiIsAvailable() )
+   {
+      SCIP_CALL( scoreCutsParallel(scip, cuts, sol, dircutoffdistweight, efficacyweight, objparalweight,
+            intsupportweight, ncuts, nthreads, scores, cutinfos, &nscored) );
+   }
 
-         /* add small term to prefer global pool cuts */
-         if( SCIProwIsInGlobalCutpool(cuts[i]) )
-            score += 1e-4;
+   for( i = 0; i < ncuts; ++i )
+   {
+      SCIP_Real score;
 
-         if( randnumgen != NULL )
-         {
-            score += SCIPrandomGetReal(randnumgen, 0.0, 1e-6);
-         }
+      if( i < nscored )
+         score = scores[i];
+      else
+      {
+         score = scoreCut(scip, cuts[i], sol, dircutoffdistweight, efficacyweight, objparalweight, intsupportweight);
 
-         maxscore = MAX(maxscore, score);
+         if( cutinfos != NULL )
+            computeCutInfo(cuts[i], &cutinfos[i]);
+      }
 
-         if( scores != NULL )
-            scores[i] = score;
+      if( randnumgen != NULL )
+      {
+         score += SCIPrandomGetReal(randnumgen, 0.0, 1e-6);
       }
+
+      *maxscore = MAX(*maxscore, score);
+
+      if( scores != NULL )
+         scores[i] = score;
    }
-   return maxscore;
+
+   return SCIP_OKAY;
+}
+
+/** swaps two cuts together with their scores and support and norms */
+static
+void swapCuts(
+   SCIP_ROW**            cuts,               /**< array with cuts */
+   SCIP_Real*            scores,             /**< array with scores of cuts */
+   CUTINFO*              cutinfos,           /**< array with support and norms of cuts */
+   int                   pos1,               /**< position of first cut */
+   int                   pos2                /**< position of second cut */
+   )
+{
+   CUTINFO tmpcutinfo;
+
+   SCIPswapPointers((void**) &cuts[pos1], (void**) &cuts[pos2]);
+   SCIPswapReals(&scores[pos1], &scores[pos2]);
+
+   tmpcutinfo = cutinfos[pos1];
+   cutinfos[pos1] = cutinfos[pos2];
+   cutinfos[pos2] = tmpcutinfo;
 }
 
 
@@ -192,6 +484,7 @@ static
 void selectBestCut(
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
    SCIP_Real*            scores,             /**< array with scores of cuts to perform selection algorithm */
+   CUTINFO*              cutinfos,           /**< array with support and norms of cuts */
    int                   ncuts               /**< number of cuts in given array */
    )
 {
@@ -215,17 +508,21 @@ void selectBestCut(
       }
    }
 
-   SCIPswapPointers((void**) &cuts[bestpos], (void**) &cuts[0]);
-   SCIPswapReals(&scores[bestpos], &scores[0]);
+   swapCuts(cuts, scores, cutinfos, bestpos, 0);
 }
 
 /** filters the given array of cuts to enforce a maximum parallelism constraint
- *  w.r.t the given cut; moves filtered cuts to the end of the array and returns number of selected cuts */
+ *  w.r.t the given cut; moves filtered cuts to the end of the array and returns number of selected cuts
+ *
+ *  The parallelism is only computed for the cuts that may be too parallel according to their support and norms.
+ */
 static
 int filterWithParallelism(
    SCIP_ROW*             cut,                /**< cut to filter orthogonality with */
+   CUTINFO*              cutinfo,            /**< support and norms of the cut to filter orthogonality with */
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
    SCIP_Real*            scores,             /**< array with scores of cuts to perform selection algorithm */
+   CUTINFO*              cutinfos,           /**< array with support and norms of cuts */
    int                   ncuts,              /**< number of cuts in given array */
    SCIP_Real             goodscore,          /**< threshold for the score to be considered a good cut */
    SCIP_Real             goodmaxparall,      /**< maximal parallelism for good cuts */
@@ -243,14 +540,17 @@ int filterWithParallelism(
       SCIP_Real thisparall;
       SCIP_Real thismaxparall;
 
-      thisparall = SCIProwGetParallelism(cut, cuts[i], 'e');
       thismaxparall = scores[i] >= goodscore ? goodmaxparall : maxparall;
 
+      if( !mayBeParallel(cutinfo, &cutinfos[i], thismaxparall) )
+         continue;
+
+      thisparall = SCIProwGetParallelism(cut, cuts[i], 'e');
+
       if( thisparall > thismaxparall )
       {
          --ncuts;
-         SCIPswapPointers((void**) &cuts[i], (void**) &cuts[ncuts]);
-         SCIPswapReals(&scores[i], &scores[ncuts]);
+         swapCuts(cuts, scores, cutinfos, i, ncuts);
       }
    }
 
@@ -258,6 +558,113 @@ int filterWithParallelism(
 }
 
 
+/** perform the hybrid cut selection algorithm for the given array of cuts, see SCIPselectCutsHybrid() */
+static
+SCIP_RETCODE selectCutsHybrid(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
+   SCIP_ROW**            forcedcuts,         /**< array with forced cuts */
+   SCIP_RANDNUMGEN*      randnumgen,         /**< random number generator for tie-breaking, or NULL */
+   SCIP_Real             goodscorefac,       /**< factor of best score among the given cuts to consider a cut good
+                                              *   and filter with less strict settings of the maximum parallelism */
+   SCIP_Real             badscorefac,        /**< factor of best score among the given cuts to consider a cut bad
+                                              *   and discard it regardless of its parallelism to other cuts */
+   SCIP_Real             goodmaxparall,      /**< maximum parallelism for good cuts */
+   SCIP_Real             maxparall,          /**< maximum parallelism for non-good cuts */
+   SCIP_Real             dircutoffdistweight,/**< weight of directed cutoff distance in cut score calculation */
+   SCIP_Real             efficacyweight,     /**< weight of efficacy in cut score calculation */
+   SCIP_Real             objparalweight,     /**< weight of objective parallelism in cut score calculation */
+   SCIP_Real             intsupportweight,   /**< weight of integral support in cut score calculation */
+   int                   ncuts,              /**< number of cuts in cuts array */
+   int                   nforcedcuts,        /**< number of forced cuts */
+   int                   maxselectedcuts,    /**< maximal number of cuts from cuts array to select */
+   int                   nthreads,           /**< number of threads to use for scoring */
+   int*                  nselectedcuts       /**< pointer to return number of selected cuts from cuts array */
+   )
+{
+   SCIP_Real* scores;
+   SCIP_Real* scoresptr;
+   CUTINFO* cutinfos;
+   CUTINFO* cutinfosptr;
+   SCIP_Real maxforcedscores;
+   SCIP_Real maxnonforcedscores;
+   SCIP_Real goodscore;
+   SCIP_Real badscore;
+   int i;
+
+   assert(cuts != NULL && ncuts > 0);
+   assert(forcedcuts != NULL || nforcedcuts == 0);
+   assert(nselectedcuts != NULL);
+
+   *nselectedcuts = 0;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &scores, ncuts) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &cutinfos, ncuts) );
+
+   /* compute scores of cuts and max score of cuts and forced cuts (used to define goodscore) */
+   SCIP_CALL( scoring(scip, forcedcuts, randnumgen, dircutoffdistweight, efficacyweight, objparalweight,
+         intsupportweight, nforcedcuts, 1, NULL, NULL, &maxforcedscores) );
+   SCIP_CALL( scoring(scip, cuts, randnumgen, dircutoffdistweight, efficacyweight, objparalweight, intsupportweight,
+         ncuts, nthreads, scores, cutinfos, &maxnonforcedscores) );
+
+   goodscore = MAX(maxforcedscores, maxnonforcedscores);
+
+   /* compute values for filtering cuts */
+   badscore = goodscore * badscorefac;
+   goodscore *= goodscorefac;
+
+   /* perform cut selection algorithm for the cuts */
+
+   /* forced cuts are going to be selected so use them to filter cuts */
+   for( i = 0; i < nforcedcuts && ncuts > 0; ++i )
+   {
+      CUTINFO forcedcutinfo;
+
+      computeCutInfo(forcedcuts[i], &forcedcutinfo);
+      ncuts = filterWithParallelism(forcedcuts[i], &forcedcutinfo, cuts, scores, cutinfos, ncuts, goodscore,
+         goodmaxparall, maxparall);
+   }
+
+   /* now greedily select the remaining cuts */
+   scoresptr = scores;
+   cutinfosptr = cutinfos;
+   while( ncuts > 0 )
+   {
+      SCIP_ROW* selectedcut;
+      CUTINFO* selectedcutinfo;
+
+      selectBestCut(cuts, scores, cutinfos, ncuts);
+      selectedcut = cuts[0];
+      selectedcutinfo = &cutinfos[0];
+
+      /* if the best cut of the remaining cuts is considered bad, we discard it and all remaining cuts */
+      if( scores[0] < badscore )
+         goto TERMINATE;
+
+      ++(*nselectedcuts);
+
+      /* if the maximal number of cuts was selected, we can stop here */
+      if( *nselectedcuts == maxselectedcuts )
+         goto TERMINATE;
+
+      /* move the pointers to the next position and filter the remaining cuts to enforce the maximum parallelism constraint */
+      ++cuts;
+      ++scores;
+      ++cutinfos;
+      --ncuts;
+
+      ncuts = filterWithParallelism(selectedcut, selectedcutinfo, cuts, scores, cutinfos, ncuts, goodscore,
+         goodmaxparall, maxparall);
+   }
+
+TERMINATE:
+   SCIPfreeBufferArray(scip, &cutinfosptr);
+   SCIPfreeBufferArray(scip, &scoresptr);
+
+   return SCIP_OKAY;
+}
+
+
 /*
  * Callback methods of cut selector
  */
@@ -323,6 +730,43 @@ SCIP_DECL_CUTSELEXIT(cutselExitHybrid)
    return SCIP_OKAY;
 }
 
+/** solving process initialization method of cut selector (called when branch and bound process is about to begin) */
+static
+SCIP_DECL_CUTSELINITSOL(cutselInitsolHybrid)
+{  /*lint --e{715}*/
+   SCIP_CUTSELDATA* cutseldata;
+
+   cutseldata = SCIPcutselGetData(cutsel);
+   assert(cutseldata != NULL);
+
+   /* make sure that jobs can be submitted if the scoring should be parallelized */
+   cutseldata->tpiinitialized = FALSE;
+   if( cutseldata->nthreads > 1 )
+   {
+      SCIP_CALL( SCIPinitParallelJobs(scip, cutseldata->nthreads, &cutseldata->tpiinitialized) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** solving process deinitialization method of cut selector (called before branch and bound process data is freed) */
+static
+SCIP_DECL_CUTSELEXITSOL(cutselExitsolHybrid)
+{  /*lint --e{715}*/
+   SCIP_CUTSELDATA* cutseldata;
+
+   cutseldata = SCIPcutselGetData(cutsel);
+   assert(cutseldata != NULL);
+
+   if( cutseldata->tpiinitialized )
+   {
+      SCIP_CALL( SCIPexitParallelJobs(scip) );
+      cutseldata->tpiinitialized = FALSE;
+   }
+
+   return SCIP_OKAY;
+}
+
 /** cut selection method of cut selector */
 static
 SCIP_DECL_CUTSELSELECT(cutselSelectHybrid)
@@ -350,9 +794,10 @@ SCIP_DECL_CUTSELSELECT(cutselSelectHybrid)
       goodmaxparall = MAX(0.5, 1.0 - cutseldata->minortho);
    }
 
-   SCIP_CALL( SCIPselectCutsHybrid(scip, cuts, forcedcuts, cutseldata->randnumgen, cutseldata->goodscore, cutseldata->badscore,
+   SCIP_CALL( selectCutsHybrid(scip, cuts, forcedcuts, cutseldata->randnumgen, cutseldata->goodscore, cutseldata->badscore,
          goodmaxparall, maxparall, cutseldata->dircutoffdistweight, cutseldata->efficacyweight,
-         cutseldata->objparalweight, cutseldata->intsupportweight, ncuts, nforcedcuts, maxnselectedcuts, nselectedcuts) );
+         cutseldata->objparalweight, cutseldata->intsupportweight, ncuts, nforcedcuts, maxnselectedcuts,
+         cutseldata->nthreads, nselectedcuts) );
 
    return SCIP_OKAY;
 }
@@ -387,6 +832,8 @@ SCIP_RETCODE SCIPincludeCutselHybrid(
    SCIP_CALL( SCIPsetCutselFree(scip, cutsel, cutselFreeHybrid) );
    SCIP_CALL( SCIPsetCutselInit(scip, cutsel, cutselInitHybrid) );
    SCIP_CALL( SCIPsetCutselExit(scip, cutsel, cutselExitHybrid) );
+   SCIP_CALL( SCIPsetCutselInitsol(scip, cutsel, cutselInitsolHybrid) );
+   SCIP_CALL( SCIPsetCutselExitsol(scip, cutsel, cutselExitsolHybrid) );
 
    /* add hybrid cut selector parameters */
    SCIP_CALL( SCIPaddRealParam(scip,
@@ -419,6 +866,11 @@ SCIP_RETCODE SCIPincludeCutselHybrid(
          "minimal orthogonality for a cut to enter the LP in the root node",
          &cutseldata->minorthoroot, FALSE, DEFAULT_MINORTHOROOT, 0.0, 1.0, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "cutselection/" CUTSEL_NAME "/nthreads",
+         "number of threads used to score the cuts (the selected cuts do not depend on it)",
+         &cutseldata->nthreads, TRUE, DEFAULT_NTHREADS, 1, 64, NULL, NULL) );
+
    return SCIP_OKAY;
 }
 
@@ -451,69 +903,9 @@ SCIP_RETCODE SCIPselectCutsHybrid(
    int*                  nselectedcuts       /**< pointer to return number of selected cuts from cuts array */
    )
 {
-   SCIP_Real* scores;
-   SCIP_Real* scoresptr;
-   SCIP_Real maxforcedscores;
-   SCIP_Real maxnonforcedscores;
-   SCIP_Real goodscore;
-   SCIP_Real badscore;
-   int i;
-
-   assert(cuts != NULL && ncuts > 0);
-   assert(forcedcuts != NULL || nforcedcuts == 0);
-   assert(nselectedcuts != NULL);
-
-   *nselectedcuts = 0;
-
-   SCIP_CALL( SCIPallocBufferArray(scip, &scores, ncuts) );
-
-   /* compute scores of cuts and max score of cuts and forced cuts (used to define goodscore) */
-   maxforcedscores = scoring(scip, forcedcuts, randnumgen, dircutoffdistweight, efficacyweight, objparalweight, intsupportweight, nforcedcuts, NULL);
-   maxnonforcedscores = scoring(scip, cuts, randnumgen, dircutoffdistweight, efficacyweight, objparalweight, intsupportweight, ncuts, scores);
-
-   goodscore = MAX(maxforcedscores, maxnonforcedscores);
-
-   /* compute values for filtering cuts */
-   badscore = goodscore * badscorefac;
-   goodscore *= goodscorefac;
-
-   /* perform cut selection algorithm for the cuts */
-
-   /* forced cuts are going to be selected so use them to filter cuts */
-   for( i = 0; i < nforcedcuts && ncuts > 0; ++i )
-   {
-      ncuts = filterWithParallelism(forcedcuts[i], cuts, scores, ncuts, goodscore, goodmaxparall, maxparall);
-   }
-
-   /* now greedily select the remaining cuts */
-   scoresptr = scores;
-   while( ncuts > 0 )
-   {
-      SCIP_ROW* selectedcut;
-
-      selectBestCut(cuts, scores, ncuts);
-      selectedcut = cuts[0];
-
-      /* if the best cut of the remaining cuts is considered bad, we discard it and all remaining cuts */
-      if( scores[0] < badscore )
-         goto TERMINATE;
-
-      ++(*nselectedcuts);
-
-      /* if the maximal number of cuts was selected, we can stop here */
-      if( *nselectedcuts == maxselectedcuts )
-         goto TERMINATE;
-
-      /* move the pointers to the next position and filter the remaining cuts to enforce the maximum parallelism constraint */
-      ++cuts;
-      ++scores;
-      --ncuts;
-
-      ncuts = filterWithParallelism(selectedcut, cuts, scores, ncuts, goodscore, goodmaxparall, maxparall);
-   }
-
-TERMINATE:
-   SCIPfreeBufferArray(scip, &scoresptr);
+   SCIP_CALL( selectCutsHybrid(scip, cuts, forcedcuts, randnumgen, goodscorefac, badscorefac, goodmaxparall, maxparall,
+         dircutoffdistweight, efficacyweight, objparalweight, intsupportweight, ncuts, nforcedcuts, maxselectedcuts, 1,
+         nselectedcuts) );
 
    return SCIP_OKAY;
 }
@@ -52,6 +52,11 @@
  * If the score of cut is not good, then cut is dropped if its parallelism with @p fcut is larger or equal than 1 - minimum
  * orthogonality.
  *
+ * The parallelism is only computed for pairs of cuts that can be too parallel: pairs with disjoint column index ranges
+ * or disjoint bit signatures of their columns are orthogonal, and the parallelism of the remaining pairs is bounded from
+ * above by \f$ \frac{\min(\|a\|_\infty \|d\|_1, \|a\|_1 \|d\|_\infty)}{\|a\| \|d\|} \f$. The cuts can be scored in
+ * parallel by several threads; the selected cuts do not depend on the number of threads.
+ *
  * @note The minimum orthogonality is a parameter that can be set, as well as the weights for the score.
  *
  * @note In the case of no primal solution, the weight assigned to the directed cutoff distance is transfered to the
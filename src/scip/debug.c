@@ -621,13 +621,13 @@ SCIP_RETCODE isSolutionInNode(
    if( *solcontained )
    {
       /* check whether the bound changes at the current node remove the debugging solution from the subproblem */
-      if( node->domchg != NULL )
+      if( SCIPnodeGetDomchg(node) != NULL )
       {
          SCIP_DOMCHGBOUND* domchgbound;
          SCIP_BOUNDCHG* boundchgs;
          int i;
 
-         domchgbound = &node->domchg->domchgbound;
+         domchgbound = &SCIPnodeGetDomchg(node)->domchgbound;
          boundchgs = domchgbound->boundchgs;
          for( i = 0; i < (int)domchgbound->nboundchgs && *solcontained; ++i )
          {
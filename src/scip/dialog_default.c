@@ -49,6 +49,7 @@
 #include "scip/pub_sepa.h"
 #include "scip/pub_sol.h"
 #include "scip/pub_var.h"
+#include "scip/reader_ckp.h"
 #include "scip/scip_benders.h"
 #include "scip/scip_branch.h"
 #include "scip/scip_compr.h"
@@ -3709,6 +3710,54 @@ SCIP_DECL_DIALOGEXEC(SCIPdialogExecWriteMIPStart)
    return SCIP_OKAY;
 }
 
+/** dialog execution method for the write checkpoint command */
+static
+SCIP_DECL_DIALOGEXEC(SCIPdialogExecWriteCheckpoint)
+{  /*lint --e{715}*/
+   char* filename;
+   SCIP_Bool endoffile;
+
+   SCIPdialogMessage(scip, NULL, "\n");
+
+   if( SCIPgetStage(scip) < SCIP_STAGE_PRESOLVED || SCIPgetStage(scip) > SCIP_STAGE_SOLVED )
+   {
+      SCIPdialogMessage(scip, NULL, "no presolved problem available\n\n");
+      *nextdialog = SCIPdialoghdlrGetRoot(dialoghdlr);
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPdialoghdlrGetWord(dialoghdlr, dialog, "enter filename: ", &filename, &endoffile) );
+   if( endoffile )
+   {
+      *nextdialog = NULL;
+      return SCIP_OKAY;
+   }
+   if( filename[0] != '\0' )
+   {
+      SCIP_RETCODE retcode;
+
+      SCIP_CALL( SCIPdialoghdlrAddHistory(dialoghdlr, dialog, filename, TRUE) );
+
+      retcode = SCIPwriteCkp(scip, filename);
+
+      if( retcode == SCIP_FILECREATEERROR || retcode == SCIP_WRITEERROR )
+      {
+         SCIPdialogMessage(scip, NULL, "error writing checkpoint to file <%s>\n", filename);
+         SCIPdialoghdlrClearBuffer(dialoghdlr);
+      }
+      else
+      {
+         SCIP_CALL( retcode );
+      }
+   }
+
+   SCIPdialogMessage(scip, NULL, "\n");
+
+   *nextdialog = SCIPdialoghdlrGetRoot(dialoghdlr);
+
+   return SCIP_OKAY;
+}
+
 /** dialog execution method for writing command line history */
 static
 SCIP_DECL_DIALOGEXEC(SCIPdialogExecWriteCommandHistory)
@@ -4694,6 +4743,18 @@ SCIP_RETCODE SCIPincludeDialogDefaultBasic(
       SCIP_CALL( SCIPreleaseDialog(scip, &dialog) );
    }
 
+   /* write checkpoint */
+   if( !SCIPdialogHasEntry(submenu, "checkpoint") )
+   {
+      SCIP_CALL( SCIPincludeDialog(scip, &dialog,
+            NULL,
+            SCIPdialogExecWriteCheckpoint, NULL, NULL,
+            "checkpoint", "write checkpoint of the interrupted solving process to file, which can be read to resume it",
+            FALSE, NULL) );
+      SCIP_CALL( SCIPaddDialogEntry(scip, submenu, dialog) );
+      SCIP_CALL( SCIPreleaseDialog(scip, &dialog) );
+   }
+
    /* write statistics */
    if( !SCIPdialogHasEntry(submenu, "statistics") )
    {
@@ -0,0 +1,271 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   event_treesplit.c
+ * @ingroup DEFPLUGINS_EVENT
+ * @brief  eventhandler for splitting the branch-and-bound tree among concurrent solvers
+ *
+ * All concurrent solvers solve the problem with identical settings in deterministic mode, such that they build identical
+ * search trees. As soon as the number of open nodes reaches the given number of nodes per solver, each solver keeps
+ * only every k-th open node, ordered by node number, where k is the number of solvers, and cuts off the remaining
+ * ones. The solvers thereby split the tree among each other without any communication.
+ *
+ * After the split, the local bounds of the remaining part of the tree may be regarded as global bounds by a solver.
+ * Hence, global bound changes must not be communicated and restarts are disabled.
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "blockmemshell/memory.h"
+#include "scip/concurrent.h"
+#include "scip/event_treesplit.h"
+#include "scip/pub_event.h"
+#include "scip/pub_message.h"
+#include "scip/pub_misc_sort.h"
+#include "scip/pub_tree.h"
+#include "scip/scip_concurrent.h"
+#include "scip/scip_copy.h"
+#include "scip/scip_event.h"
+#include "scip/scip_mem.h"
+#include "scip/scip_message.h"
+#include "scip/scip_param.h"
+#include "scip/scip_solvingstats.h"
+#include "scip/scip_tree.h"
+#include "scip/syncstore.h"
+#include <string.h>
+
+#define EVENTHDLR_NAME         "treesplit"
+#define EVENTHDLR_DESC         "event handler for splitting the tree among concurrent solvers"
+
+
+/*
+ * Data structures
+ */
+
+/** event handler data */
+struct SCIP_EventhdlrData
+{
+   int                    filterpos;          /**< filter position of the node branched event */
+   int                    solveridx;          /**< index of the concurrent solver */
+   int                    nsolvers;           /**< number of concurrent solvers sharing the tree */
+   SCIP_Bool              split;              /**< has the tree been split already? */
+};
+
+/*
+ * Local methods
+ */
+
+/** compares two nodes by their number */
+static
+SCIP_DECL_SORTPTRCOMP(nodeCompNumber)
+{
+   SCIP_Longint number1;
+   SCIP_Longint number2;
+
+   number1 = SCIPnodeGetNumber((SCIP_NODE*)elem1);
+   number2 = SCIPnodeGetNumber((SCIP_NODE*)elem2);
+
+   if( number1 < number2 )
+      return -1;
+   if( number1 > number2 )
+      return +1;
+   return 0;
+}
+
+/** cuts off all open nodes that are assigned to other concurrent solvers */
+static
+SCIP_RETCODE splitTree(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EVENTHDLRDATA*   eventhdlrdata       /**< event handler data */
+   )
+{
+   SCIP_NODE** leaves;
+   SCIP_NODE** children;
+   SCIP_NODE** siblings;
+   SCIP_NODE** opennodes;
+   int nleaves;
+   int nchildren;
+   int nsiblings;
+   int nopennodes;
+   int i;
+
+   SCIP_CALL( SCIPgetOpenNodesData(scip, &leaves, &children, &siblings, &nleaves, &nchildren, &nsiblings) );
+
+   nopennodes = nleaves + nchildren + nsiblings;
+   SCIP_CALL( SCIPallocBufferArray(scip, &opennodes, nopennodes) );
+
+   BMScopyMemoryArray(opennodes, leaves, nleaves);
+   BMScopyMemoryArray(&opennodes[nleaves], children, nchildren);
+   BMScopyMemoryArray(&opennodes[nleaves + nchildren], siblings, nsiblings);
+
+   /* all solvers have built the same tree, so the node numbers give the same order of the open nodes in all solvers */
+   SCIPsortPtr((void**)opennodes, nodeCompNumber, nopennodes);
+
+   for( i = 0; i < nopennodes; ++i )
+   {
+      if( i % eventhdlrdata->nsolvers != eventhdlrdata->solveridx )
+      {
+         SCIP_CALL( SCIPcutoffNode(scip, opennodes[i]) );
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &opennodes);
+
+   SCIP_CALL( SCIPpruneTree(scip) );
+
+   /* a restart would turn the local bounds of the remaining part of the tree into global bounds of the problem */
+   SCIP_CALL( SCIPsetIntParam(scip, "presolving/maxrestarts", SCIPgetNRuns(scip) - 1) );
+
+   SCIPdebugMsg(scip, "concurrent solver %d keeps %d of %d open nodes after splitting the tree\n",
+      eventhdlrdata->solveridx, (nopennodes - eventhdlrdata->solveridx + eventhdlrdata->nsolvers - 1) / eventhdlrdata->nsolvers,
+      nopennodes);
+
+   eventhdlrdata->split = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/*
+ * Callback methods of event handler
+ */
+
+/** destructor of event handler to free user data (called when SCIP is exiting) */
+static
+SCIP_DECL_EVENTFREE(eventFreeTreesplit)
+{  /*lint --e{715}*/
+   SCIP_EVENTHDLRDATA* eventhdlrdata;
+
+   assert(scip != NULL);
+   assert(eventhdlr != NULL);
+   assert(strcmp(SCIPeventhdlrGetName(eventhdlr), EVENTHDLR_NAME) == 0);
+
+   eventhdlrdata = SCIPeventhdlrGetData(eventhdlr);
+   assert(eventhdlrdata != NULL);
+
+   SCIPfreeMemory(scip, &eventhdlrdata);
+   SCIPeventhdlrSetData(eventhdlr, NULL);
+
+   return SCIP_OKAY;
+}
+
+/** initialization method of event handler (called after problem was transformed) */
+static
+SCIP_DECL_EVENTINIT(eventInitTreesplit)
+{  /*lint --e{715}*/
+   SCIP_EVENTHDLRDATA* eventhdlrdata;
+
+   assert(scip != NULL);
+   assert(eventhdlr != NULL);
+   assert(strcmp(SCIPeventhdlrGetName(eventhdlr), EVENTHDLR_NAME) == 0);
+
+   eventhdlrdata = SCIPeventhdlrGetData(eventhdlr);
+   assert(eventhdlrdata != NULL);
+
+   if( eventhdlrdata->filterpos < 0 && SCIPgetSubscipDepth(scip) == 0 && SCIPsyncstoreIsInitialized(SCIPgetSyncstore(scip)) )
+   {
+      eventhdlrdata->nsolvers = SCIPsyncstoreGetNSolvers(SCIPgetSyncstore(scip));
+      eventhdlrdata->split = FALSE;
+      assert(eventhdlrdata->solveridx < eventhdlrdata->nsolvers);
+
+      SCIP_CALL( SCIPcatchEvent(scip, SCIP_EVENTTYPE_NODEBRANCHED, eventhdlr, NULL, &eventhdlrdata->filterpos) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** deinitialization method of event handler (called before transformed problem is freed) */
+static
+SCIP_DECL_EVENTEXIT(eventExitTreesplit)
+{  /*lint --e{715}*/
+   SCIP_EVENTHDLRDATA* eventhdlrdata;
+
+   assert(scip != NULL);
+   assert(eventhdlr != NULL);
+   assert(strcmp(SCIPeventhdlrGetName(eventhdlr), EVENTHDLR_NAME) == 0);
+
+   eventhdlrdata = SCIPeventhdlrGetData(eventhdlr);
+   assert(eventhdlrdata != NULL);
+
+   if( eventhdlrdata->filterpos >= 0 )
+   {
+      SCIP_CALL( SCIPdropEvent(scip, SCIP_EVENTTYPE_NODEBRANCHED, eventhdlr, NULL, eventhdlrdata->filterpos) );
+      eventhdlrdata->filterpos = -1;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** execution method of event handler */
+static
+SCIP_DECL_EVENTEXEC(eventExecTreesplit)
+{  /*lint --e{715}*/
+   SCIP_EVENTHDLRDATA* eventhdlrdata;
+   int splitnodes;
+
+   assert(eventhdlr != NULL);
+   assert(strcmp(SCIPeventhdlrGetName(eventhdlr), EVENTHDLR_NAME) == 0);
+   assert(event != NULL);
+   assert(SCIPeventGetType(event) == SCIP_EVENTTYPE_NODEBRANCHED);
+   assert(scip != NULL);
+
+   eventhdlrdata = SCIPeventhdlrGetData(eventhdlr);
+   assert(eventhdlrdata != NULL);
+
+   if( eventhdlrdata->split )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPgetIntParam(scip, "concurrent/splitnodes", &splitnodes) );
+
+   /* the children of the branched node are counted as open nodes */
+   if( SCIPgetNNodesLeft(scip) >= (SCIP_Longint)splitnodes * eventhdlrdata->nsolvers )
+   {
+      SCIP_CALL( splitTree(scip, eventhdlrdata) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** creates event handler for splitting the tree among concurrent solvers */
+SCIP_RETCODE SCIPincludeEventHdlrTreesplit(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int                   solveridx           /**< index of the concurrent solver the SCIP instance belongs to */
+   )
+{
+   SCIP_EVENTHDLRDATA* eventhdlrdata;
+   SCIP_EVENTHDLR* eventhdlr;
+
+   assert(solveridx >= 0);
+
+   /* create treesplit event handler data */
+   eventhdlrdata = NULL;
+   SCIP_CALL( SCIPallocMemory(scip, &eventhdlrdata) );
+   eventhdlrdata->filterpos = -1;
+   eventhdlrdata->solveridx = solveridx;
+   eventhdlrdata->nsolvers = 1;
+   eventhdlrdata->split = FALSE;
+   eventhdlr = NULL;
+
+   /* include event handler into SCIP */
+   SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC,
+         eventExecTreesplit, eventhdlrdata) );
+   assert(eventhdlr != NULL);
+
+   /* set non fundamental callbacks via setter functions */
+   SCIP_CALL( SCIPsetEventhdlrFree(scip, eventhdlr, eventFreeTreesplit) );
+   SCIP_CALL( SCIPsetEventhdlrInit(scip, eventhdlr, eventInitTreesplit) );
+   SCIP_CALL( SCIPsetEventhdlrExit(scip, eventhdlr, eventExitTreesplit) );
+
+   return SCIP_OKAY;
+}
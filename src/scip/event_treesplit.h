@@ -0,0 +1,51 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   event_treesplit.h
+ * @ingroup EVENTS
+ * @brief  eventhdlr for splitting the branch-and-bound tree among concurrent solvers
+ *
+ * All concurrent solvers solve the problem with identical settings in deterministic mode, such that they build identical
+ * search trees. As soon as the number of open nodes reaches the given number of nodes per solver, each solver keeps
+ * only every k-th open node, ordered by node number, where k is the number of solvers, and cuts off the remaining
+ * ones. The solvers thereby split the tree among each other without any communication.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_EVENT_TREESPLIT_H__
+#define __SCIP_EVENT_TREESPLIT_H__
+
+#include "scip/def.h"
+#include "scip/type_event.h"
+#include "scip/type_retcode.h"
+#include "scip/type_scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** creates event handler for splitting the tree among concurrent solvers */
+SCIP_EXPORT
+SCIP_RETCODE SCIPincludeEventHdlrTreesplit(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int                   solveridx           /**< index of the concurrent solver the SCIP instance belongs to */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -22,6 +22,7 @@
 /*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
 
 #include "blockmemshell/memory.h"
+#include "scip/concurrent.h"
 #include "scip/cons_linear.h"
 #include "scip/heur_alns.h"
 #include "scip/heuristics.h"
@@ -59,6 +60,7 @@
 #include "scip/scip_timing.h"
 #include "scip/scip_tree.h"
 #include "scip/scip_var.h"
+#include "tpi/tpi.h"
 #include <string.h>
 
 #if !defined(_WIN32) && !defined(_WIN64)
@@ -92,6 +94,7 @@
 #define LPLIMFAC                 4.0
 #define DEFAULT_INITDURINGROOT FALSE
 #define DEFAULT_MAXCALLSSAMESOL  -1   /**< number of allowed executions of the heuristic on the same incumbent solution */
+#define DEFAULT_NTHREADS         1    /**< number of threads to solve the sub-SCIPs of several neighborhoods in parallel */
 
 /*
  * parameters for the minimum improvement
@@ -444,6 +447,7 @@ struct SCIP_HeurData
    int                   ndelayedcalls;      /**< the number of delayed calls */
    int                   maxcallssamesol;    /**< number of allowed executions of the heuristic on the same incumbent solution
                                               *   (-1: no limit, 0: number of active neighborhoods) */
+   int                   nthreads;           /**< number of threads to solve the sub-SCIPs of several neighborhoods in parallel */
    SCIP_Longint          firstcallthissol;   /**< counter for the number of calls on this incumbent */
    char                  banditalgo;         /**< the bandit algorithm: (u)pper confidence bounds, (e)xp.3, epsilon (g)reedy */
    SCIP_Bool             useredcost;         /**< should reduced cost scores be used for variable prioritization? */
@@ -461,6 +465,7 @@ struct SCIP_HeurData
    SCIP_Bool             copycuts;           /**< should cutting planes be copied to the sub-SCIP? */
    SCIP_Bool             uselocalredcost;    /**< should local reduced costs be used for generic (un)fixing? */
    SCIP_Bool             initduringroot;     /**< should the heuristic be executed multiple times during the root node? */
+   SCIP_Bool             tpiinitialized;     /**< was the task processing interface initialized by this heuristic? */
 };
 
 /** event handler data */
@@ -473,6 +478,8 @@ struct SCIP_EventData
    SCIP_Real             lplimfac;           /**< limit fraction of LPs per node to interrupt sub-SCIP */
    NH_STATS*             runstats;           /**< run statistics for the current neighborhood */
    SCIP_Bool             allrewardsmode;     /**< true if solutions should only be checked for reward comparisons */
+   SCIP_Bool             deferred;           /**< are solutions transferred after the solve, because the sub-SCIP is
+                                              *   solved in a parallel job? */
 };
 
 /** represents limits for the sub-SCIP solving process */
@@ -486,6 +493,20 @@ struct SolveLimits
 
 typedef struct SolveLimits SOLVELIMITS;
 
+/** parallel job that solves the sub-SCIP of a neighborhood */
+struct AlnsJob
+{
+   SCIP*                 subscip;            /**< sub-SCIP of the neighborhood */
+   SCIP_VAR**            subvars;            /**< sub-SCIP variables in the order of the main SCIP */
+   SCIP_EVENTDATA        eventdata;          /**< event data of the sub-SCIP */
+   NH_STATS              runstats;           /**< run statistics */
+   SCIP_Real             targetfixingrate;   /**< target fixing rate of the neighborhood */
+   SCIP_RETCODE          retcode;            /**< return code of the sub-SCIP solve */
+   int                   neighborhoodidx;    /**< index of the neighborhood */
+};
+
+typedef struct AlnsJob ALNSJOB;
+
 /** data structure that can be used for variable prioritization for additional fixings */
 struct VarPrio
 {
@@ -916,21 +937,19 @@ SCIP_RETCODE neighborhoodExit(
 static
 SCIP_RETCODE transferSolution(
    SCIP*                 subscip,            /**< SCIP data structure of the subproblem */
+   SCIP_SOL*             subsol,             /**< solution of the subproblem */
    SCIP_EVENTDATA*       eventdata           /**< event handler data */
    )
 {
    SCIP*      sourcescip;         /* original SCIP data structure */
    SCIP_VAR** subvars;            /* the variables of the subproblem */
    SCIP_HEUR* heur;               /* alns heuristic structure */
-   SCIP_SOL*  subsol;             /* solution of the subproblem */
    SCIP_SOL*  newsol;             /* solution to be created for the original problem */
    SCIP_Bool  success;
    NH_STATS*  runstats;
    SCIP_SOL*  oldbestsol;
 
    assert(subscip != NULL);
-
-   subsol = SCIPgetBestSol(subscip);
    assert(subsol != NULL);
 
    sourcescip = eventdata->sourcescip;
@@ -982,6 +1001,30 @@ SCIP_RETCODE transferSolution(
    return SCIP_OKAY;
 }
 
+/** transfers the solutions of a sub-SCIP that was solved in a parallel job, starting with the worst solution */
+static
+SCIP_RETCODE transferSolutions(
+   SCIP*                 subscip,            /**< SCIP data structure of the subproblem */
+   SCIP_EVENTDATA*       eventdata           /**< event handler data */
+   )
+{
+   SCIP_SOL** subsols;
+   int i;
+
+   assert(subscip != NULL);
+   assert(eventdata != NULL);
+   assert(eventdata->deferred);
+
+   subsols = SCIPgetSols(subscip);
+
+   for( i = SCIPgetNSols(subscip) - 1; i >= 0; --i )
+   {
+      SCIP_CALL( transferSolution(subscip, subsols[i], eventdata) );
+   }
+
+   return SCIP_OKAY;
+}
+
 
 /* ---------------- Callback methods of event handler ---------------- */
 
@@ -1004,8 +1047,11 @@ SCIP_DECL_EVENTEXEC(eventExecAlns)
    {
    case SCIP_EVENTTYPE_SOLFOUND:
    case SCIP_EVENTTYPE_BESTSOLFOUND:
-      /* try to transfer the solution to the original SCIP */
-      SCIP_CALL( transferSolution(scip, eventdata) );
+      /* try to transfer the solution to the original SCIP, unless this is done after the parallel solve */
+      if( ! eventdata->deferred )
+      {
+         SCIP_CALL( transferSolution(scip, SCIPgetBestSol(scip), eventdata) );
+      }
       break;
    case SCIP_EVENTTYPE_LPSOLVED:
       /* interrupt solution process of sub-SCIP */
@@ -2289,6 +2335,343 @@ SCIP_RETCODE setupSubScip(
    return SCIP_OKAY;
 }
 
+/** updates the statistics, the fixing rate, the minimum improvement, the target node limit, and the bandit algorithm
+ *  after a neighborhood was run
+ */
+static
+SCIP_RETCODE finishNeighborhoodRun(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< this heuristic */
+   SCIP_HEURDATA*        heurdata,           /**< heuristic data of the ALNS neighborhood */
+   NH*                   neighborhood,       /**< the neighborhood that was run last */
+   NH_STATS*             runstats,           /**< run statistics of the rewarded neighborhood */
+   SCIP_STATUS           subscipstatus,      /**< status of the sub-SCIP of the rewarded neighborhood */
+   SCIP_Real             reward,             /**< measured reward */
+   int                   banditidx,          /**< index of the rewarded neighborhood */
+   SCIP_Bool             allrewardsmode      /**< are all neighborhoods run to measure all rewards? */
+   )
+{
+   /* decrease the number of neighborhoods that have not been initialized */
+   if( neighborhood->stats.nruns == 0 )
+      --heurdata->ninitneighborhoods;
+
+   heurdata->usednodes += runstats->usednodes;
+
+   /* determine the success of this neighborhood, and update the target fixing rate for the next time */
+   updateNeighborhoodStats(runstats, heurdata->neighborhoods[banditidx], subscipstatus);
+
+   /* adjust the fixing rate for this neighborhood
+    * make no adjustments in all rewards mode, because this only affects 1 of 8 heuristics
+    */
+   if( heurdata->adjustfixingrate && ! allrewardsmode )
+   {
+      SCIPdebugMsg(scip, "Update fixing rate: %.2f\n", heurdata->neighborhoods[banditidx]->fixingrate.targetfixingrate);
+      updateFixingRate(heurdata->neighborhoods[banditidx], subscipstatus, runstats);
+      SCIPdebugMsg(scip, "New fixing rate: %.2f\n", heurdata->neighborhoods[banditidx]->fixingrate.targetfixingrate);
+   }
+   /* similarly, update the minimum improvement for the ALNS heuristic */
+   if( heurdata->adjustminimprove )
+   {
+      SCIPdebugMsg(scip, "Update Minimum Improvement: %.4f\n", heurdata->minimprove);
+      updateMinimumImprovement(heurdata, subscipstatus, runstats);
+      SCIPdebugMsg(scip, "--> %.4f\n", heurdata->minimprove);
+   }
+
+   /* update the target node limit based on the status of the selected algorithm */
+   if( heurdata->adjusttargetnodes && SCIPheurGetNCalls(heur) >= heurdata->nactiveneighborhoods )
+   {
+      updateTargetNodeLimit(heurdata, runstats, subscipstatus);
+   }
+
+   /* update the bandit algorithm by the measured reward */
+   SCIP_CALL( updateBanditAlgorithm(scip, heurdata, reward, banditidx) );
+
+   resetCurrentNeighborhood(heurdata);
+
+   return SCIP_OKAY;
+}
+
+/** presolves and solves the sub-SCIP of a neighborhood in a parallel job */
+static
+SCIP_RETCODE solveNeighborhoodJob(
+   void*                 args                /**< the ALNS job */
+   )
+{
+   ALNSJOB* job;
+   SCIP_Real allfixingrate;
+
+   job = (ALNSJOB*) args;
+   assert(job != NULL);
+   assert(job->subscip != NULL);
+
+   job->retcode = SCIPpresolve(job->subscip);
+   if( job->retcode != SCIP_OKAY )
+      return SCIP_OKAY;
+
+   /* was presolving successful enough regarding fixings? otherwise, terminate */
+   allfixingrate = (SCIPgetNOrigVars(job->subscip) - SCIPgetNVars(job->subscip)) / (SCIP_Real)SCIPgetNOrigVars(job->subscip);
+   allfixingrate = MAX(allfixingrate, 0.0);
+
+   if( allfixingrate >= job->targetfixingrate / 2.0 )
+      job->retcode = SCIPsolve(job->subscip);
+
+   return SCIP_OKAY;
+}
+
+/** runs several neighborhoods at once, whose sub-SCIPs are solved in parallel jobs
+ *
+ *  The neighborhoods are selected by the bandit algorithm. Their variable fixings and sub-SCIPs are created one after
+ *  the other, because they access the main SCIP, and only the solves of the sub-SCIPs run in parallel. When all jobs
+ *  have finished, the solutions of the sub-SCIPs are passed to the main SCIP and the neighborhoods are rewarded in the
+ *  order of their selection, such that the result does not depend on the timing of the threads.
+ */
+static
+SCIP_RETCODE runNeighborhoodsParallel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< this heuristic */
+   SOLVELIMITS*          solvelimits,        /**< solving limits of a single sub-SCIP */
+   SCIP_RESULT*          result              /**< pointer to store the result of the heuristic */
+   )
+{
+   SCIP_HEURDATA* heurdata;
+   SOLVELIMITS joblimits;
+   ALNSJOB* jobs;
+   SCIP_VAR** varbuf;
+   SCIP_Real* valbuf;
+   SCIP_VAR** vars;
+   SCIP_Bool* selected;
+   SCIP_RETCODE retcode;
+   int nselected;
+   int maxjobs;
+   int njobs;
+   int nvars;
+   int jobid;
+   int j;
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+   assert(heurdata->nactiveneighborhoods > 0);
+   assert(heurdata->currneighborhood == -1);
+
+   maxjobs = MIN(heurdata->nthreads, heurdata->nactiveneighborhoods);
+
+   /* the sub-SCIPs share the memory that is left */
+   joblimits = *solvelimits;
+   if( ! SCIPisInfinity(scip, joblimits.memorylimit) )
+      joblimits.memorylimit /= maxjobs;
+
+   SCIP_CALL( SCIPgetVarsData(scip, &vars, &nvars, NULL, NULL, NULL, NULL) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &varbuf, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &valbuf, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobs, maxjobs) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &selected, heurdata->nactiveneighborhoods) );
+
+   njobs = 0;
+   nselected = 0;
+
+   /* create the sub-SCIPs of the selected neighborhoods */
+   while( njobs < maxjobs && nselected < heurdata->nactiveneighborhoods )
+   {
+      ALNSJOB* job;
+      NH* neighborhood;
+      SCIP_HASHMAP* varmapf;
+      SCIP_EVENTHDLR* eventhdlr;
+      char probnamesuffix[SCIP_MAXSTRLEN];
+      SCIP_RESULT fixresult;
+      SCIP_Bool success;
+      int neighborhoodidx;
+      int nfixings;
+      int ndomchgs;
+      int nchgobjs;
+      int naddedconss;
+      int v;
+
+      SCIP_CALL( selectNeighborhood(scip, heurdata, &neighborhoodidx) );
+
+      /* the bandit algorithm is only updated after the jobs finished and may select a neighborhood again */
+      while( selected[neighborhoodidx] )
+         neighborhoodidx = (neighborhoodidx + 1) % heurdata->nactiveneighborhoods;
+
+      selected[neighborhoodidx] = TRUE;
+      ++nselected;
+
+      neighborhood = heurdata->neighborhoods[neighborhoodidx];
+      job = &jobs[njobs];
+      SCIPdebugMsg(scip, "Prepare '%s' neighborhood %d for parallel job %d\n", neighborhood->name, neighborhoodidx, njobs);
+
+      initRunStats(scip, &job->runstats);
+      SCIP_CALL( SCIPstartClock(scip, neighborhood->stats.setupclock) );
+
+      /* determine variable fixings and objective coefficients of this neighborhood */
+      SCIP_CALL( neighborhoodFixVariables(scip, heurdata, neighborhood, varbuf, valbuf, &nfixings, &fixresult) );
+
+      /* delayed neighborhoods are skipped, because the other neighborhoods are run anyway */
+      if( fixresult != SCIP_SUCCESS )
+      {
+         SCIP_CALL( SCIPstopClock(scip, neighborhood->stats.setupclock) );
+
+         if( fixresult == SCIP_DIDNOTRUN )
+         {
+            SCIP_CALL( updateBanditAlgorithm(scip, heurdata, 0.0, neighborhoodidx) );
+         }
+         else if( fixresult == SCIP_DIDNOTFIND )
+         {
+            *result = SCIP_DIDNOTFIND;
+            SCIP_CALL( finishNeighborhoodRun(scip, heur, heurdata, neighborhood, &job->runstats, SCIP_STATUS_UNKNOWN,
+                  0.0, neighborhoodidx, FALSE) );
+         }
+         else if( *result == SCIP_DIDNOTRUN )
+         {
+            assert(fixresult == SCIP_DELAYED);
+            *result = SCIP_DELAYED;
+         }
+
+         continue;
+      }
+
+      *result = SCIP_DIDNOTFIND;
+
+      neighborhood->stats.nfixings += nfixings;
+      job->runstats.nfixings = nfixings;
+
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &job->subvars, nvars) );
+      SCIP_CALL( SCIPcreate(&job->subscip) );
+      SCIP_CALL( SCIPhashmapCreate(&varmapf, SCIPblkmem(scip), nvars) );
+      (void) SCIPsnprintf(probnamesuffix, SCIP_MAXSTRLEN, "alns_%s", neighborhood->name);
+
+      SCIP_CALL( SCIPcopyLargeNeighborhoodSearch(scip, job->subscip, varmapf, probnamesuffix, varbuf, valbuf, nfixings,
+            FALSE, heurdata->copycuts, &success, NULL) );
+
+      for( v = 0; v < nvars; ++v )
+      {
+         job->subvars[v] = (SCIP_VAR*)SCIPhashmapGetImage(varmapf, (void *)vars[v]);
+      }
+
+      SCIPhashmapFree(&varmapf);
+
+      /* let the neighborhood add additional constraints, or restrict domains */
+      SCIP_CALL( neighborhoodChangeSubscip(scip, job->subscip, neighborhood, job->subvars, &ndomchgs, &nchgobjs,
+            &naddedconss, &success) );
+
+      if( ! success )
+      {
+         SCIP_CALL( SCIPstopClock(scip, neighborhood->stats.setupclock) );
+
+         SCIP_CALL( SCIPfree(&job->subscip) );
+         SCIPfreeBlockMemoryArray(scip, &job->subvars, nvars);
+
+         SCIP_CALL( finishNeighborhoodRun(scip, heur, heurdata, neighborhood, &job->runstats, SCIP_STATUS_UNKNOWN, 0.0,
+               neighborhoodidx, FALSE) );
+
+         continue;
+      }
+
+      /* set up sub-SCIP parameters */
+      SCIP_CALL( setupSubScip(scip, job->subscip, job->subvars, &joblimits, heur, nchgobjs > 0) );
+
+      /* the solutions are transferred into the main SCIP after all jobs have finished */
+      job->eventdata.nodelimit = joblimits.nodelimit;
+      job->eventdata.lplimfac = heurdata->lplimfac;
+      job->eventdata.heur = heur;
+      job->eventdata.sourcescip = scip;
+      job->eventdata.subvars = job->subvars;
+      job->eventdata.runstats = &job->runstats;
+      job->eventdata.allrewardsmode = FALSE;
+      job->eventdata.deferred = TRUE;
+
+      SCIP_CALL( SCIPincludeEventhdlrBasic(job->subscip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC, eventExecAlns, NULL) );
+
+      /* transform the problem before catching the events */
+      SCIP_CALL( SCIPtransformProb(job->subscip) );
+      SCIP_CALL( SCIPcatchEvent(job->subscip, SCIP_EVENTTYPE_ALNS, eventhdlr, &job->eventdata, NULL) );
+
+      SCIP_CALL( SCIPstopClock(scip, neighborhood->stats.setupclock) );
+
+      job->targetfixingrate = neighborhood->fixingrate.targetfixingrate;
+      job->retcode = SCIP_OKAY;
+      job->neighborhoodidx = neighborhoodidx;
+      ++njobs;
+   }
+
+   /* solve the sub-SCIPs in parallel */
+   for( j = 0; j < njobs; ++j )
+   {
+      SCIP_CALL( SCIPstartClock(scip, heurdata->neighborhoods[jobs[j].neighborhoodidx]->stats.submipclock) );
+   }
+
+   retcode = SCIP_OKAY;
+
+   if( njobs > 0 )
+   {
+      jobid = SCIPtpiGetNewJobID();
+
+      for( j = 0; j < njobs && retcode == SCIP_OKAY; ++j )
+      {
+         SCIP_SUBMITSTATUS status;
+         SCIP_JOB* job;
+
+         retcode = SCIPtpiCreateJob(&job, jobid, solveNeighborhoodJob, (void*) &jobs[j]);
+
+         if( retcode == SCIP_OKAY )
+         {
+            retcode = SCIPtpiSumbitJob(job, &status);
+
+            if( retcode == SCIP_OKAY && status != SCIP_SUBMIT_SUCCESS )
+               retcode = SCIP_ERROR;
+         }
+      }
+
+      retcode = MIN(retcode, SCIPtpiCollectJobs(jobid));
+   }
+
+   for( j = 0; j < njobs; ++j )
+   {
+      SCIP_CALL( SCIPstopClock(scip, heurdata->neighborhoods[jobs[j].neighborhoodidx]->stats.submipclock) );
+   }
+
+   /* transfer the solutions and reward the neighborhoods in the order of their selection */
+   for( j = 0; j < njobs; ++j )
+   {
+      ALNSJOB* job;
+      SCIP_Real rewards[NREWARDTYPES];
+      SCIP_STATUS subscipstatus;
+
+      job = &jobs[j];
+
+      if( job->retcode != SCIP_OKAY )
+      {
+         SCIPwarningMessage(scip, "Error while solving subproblem in ALNS heuristic; sub-SCIP terminated with code <%d>\n", job->retcode);
+         SCIPABORT();  /*lint --e{527}*/
+      }
+
+      SCIP_CALL( transferSolutions(job->subscip, &job->eventdata) );
+
+#ifdef ALNS_SUBSCIPOUTPUT
+      SCIP_CALL( SCIPprintStatistics(job->subscip, NULL) );
+#endif
+
+      /* update statistics based on the sub-SCIP run results */
+      updateRunStats(&job->runstats, job->subscip);
+      subscipstatus = SCIPgetStatus(job->subscip);
+      SCIPdebugMsg(scip, "Status of sub-SCIP run of neighborhood %d: %d\n", job->neighborhoodidx, subscipstatus);
+
+      SCIP_CALL( getReward(scip, heurdata, &job->runstats, rewards) );
+
+      SCIP_CALL( finishNeighborhoodRun(scip, heur, heurdata, heurdata->neighborhoods[job->neighborhoodidx], &job->runstats,
+            subscipstatus, rewards[REWARDTYPE_TOTAL], job->neighborhoodidx, FALSE) );
+
+      SCIP_CALL( SCIPfree(&job->subscip) );
+      SCIPfreeBlockMemoryArray(scip, &job->subvars, nvars);
+   }
+
+   SCIPfreeBufferArray(scip, &selected);
+   SCIPfreeBufferArray(scip, &jobs);
+   SCIPfreeBufferArray(scip, &valbuf);
+   SCIPfreeBufferArray(scip, &varbuf);
+
+   return retcode;
+}
+
 /** execution method of primal heuristic */
 static
 SCIP_DECL_HEUREXEC(heurExecAlns)
@@ -2397,6 +2780,16 @@ SCIP_DECL_HEUREXEC(heurExecAlns)
       }
    }
 
+   /* run several neighborhoods in parallel, unless all rewards are measured */
+   if( heurdata->nthreads > 1 && ! allrewardsmode && SCIPtpiIsAvailable() )
+   {
+      resetCurrentNeighborhood(heurdata);
+
+      SCIP_CALL( runNeighborhoodsParallel(scip, heur, &solvelimits, result) );
+
+      return SCIP_OKAY;
+   }
+
    /* use the neighborhood that requested a delay or select the next neighborhood to run based on the selected bandit algorithm */
    if( heurdata->currneighborhood >= 0 )
    {
@@ -2573,6 +2966,7 @@ SCIP_DECL_HEUREXEC(heurExecAlns)
       eventdata.subvars = subvars;
       eventdata.runstats = &runstats[neighborhoodidx];
       eventdata.allrewardsmode = allrewardsmode;
+      eventdata.deferred = FALSE;
 
       /* include an event handler to transfer solutions into the main SCIP */
       SCIP_CALL( SCIPincludeEventhdlrBasic(subscip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC, eventExecAlns, NULL) );
@@ -2652,42 +3046,8 @@ SCIP_DECL_HEUREXEC(heurExecAlns)
 
    if( *result != SCIP_DELAYED )
    {
-      /* decrease the number of neighborhoods that have not been initialized */
-      if( neighborhood->stats.nruns == 0 )
-         --heurdata->ninitneighborhoods;
-
-      heurdata->usednodes += runstats[banditidx].usednodes;
-
-      /* determine the success of this neighborhood, and update the target fixing rate for the next time */
-      updateNeighborhoodStats(&runstats[banditidx], heurdata->neighborhoods[banditidx], subscipstatus[banditidx]);
-
-      /* adjust the fixing rate for this neighborhood
-       * make no adjustments in all rewards mode, because this only affects 1 of 8 heuristics
-       */
-      if( heurdata->adjustfixingrate && ! allrewardsmode )
-      {
-         SCIPdebugMsg(scip, "Update fixing rate: %.2f\n", heurdata->neighborhoods[banditidx]->fixingrate.targetfixingrate);
-         updateFixingRate(heurdata->neighborhoods[banditidx], subscipstatus[banditidx], &runstats[banditidx]);
-         SCIPdebugMsg(scip, "New fixing rate: %.2f\n", heurdata->neighborhoods[banditidx]->fixingrate.targetfixingrate);
-      }
-      /* similarly, update the minimum improvement for the ALNS heuristic */
-      if( heurdata->adjustminimprove )
-      {
-         SCIPdebugMsg(scip, "Update Minimum Improvement: %.4f\n", heurdata->minimprove);
-         updateMinimumImprovement(heurdata, subscipstatus[banditidx], &runstats[banditidx]);
-         SCIPdebugMsg(scip, "--> %.4f\n", heurdata->minimprove);
-      }
-
-      /* update the target node limit based on the status of the selected algorithm */
-      if( heurdata->adjusttargetnodes && SCIPheurGetNCalls(heur) >= heurdata->nactiveneighborhoods )
-      {
-         updateTargetNodeLimit(heurdata, &runstats[banditidx], subscipstatus[banditidx]);
-      }
-
-      /* update the bandit algorithm by the measured reward */
-      SCIP_CALL( updateBanditAlgorithm(scip, heurdata, rewards[banditidx][REWARDTYPE_TOTAL], banditidx) );
-
-      resetCurrentNeighborhood(heurdata);
+      SCIP_CALL( finishNeighborhoodRun(scip, heur, heurdata, neighborhood, &runstats[banditidx], subscipstatus[banditidx],
+            rewards[banditidx][REWARDTYPE_TOTAL], banditidx, allrewardsmode) );
    }
 
    /* write single, measured rewards and the bandit index to the reward file */
@@ -3878,6 +4238,35 @@ SCIP_DECL_HEURINITSOL(heurInitsolAlns)
 
    SCIPfreeBufferArray(scip, &priorities);
 
+   /* make sure that jobs can be submitted if several neighborhoods should be run in parallel */
+   heurdata->tpiinitialized = FALSE;
+   if( heurdata->nthreads > 1 )
+   {
+      SCIP_CALL( SCIPinitParallelJobs(scip, heurdata->nthreads, &heurdata->tpiinitialized) );
+   }
+
+   return SCIP_OKAY;
+}
+
+
+/** solving process deinitialization method of primal heuristic (called before branch and bound process data is freed) */
+static
+SCIP_DECL_HEUREXITSOL(heurExitsolAlns)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+
+   assert(scip != NULL);
+   assert(heur != NULL);
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   if( heurdata->tpiinitialized )
+   {
+      SCIP_CALL( SCIPexitParallelJobs(scip) );
+      heurdata->tpiinitialized = FALSE;
+   }
+
    return SCIP_OKAY;
 }
 
@@ -3999,6 +4388,7 @@ SCIP_RETCODE SCIPincludeHeurAlns(
    SCIP_CALL( SCIPsetHeurInit(scip, heur, heurInitAlns) );
    SCIP_CALL( SCIPsetHeurInitsol(scip, heur, heurInitsolAlns) );
    SCIP_CALL( SCIPsetHeurExit(scip, heur, heurExitAlns) );
+   SCIP_CALL( SCIPsetHeurExitsol(scip, heur, heurExitsolAlns) );
 
    /* add alns primal heuristic parameters */
    SCIP_CALL( SCIPaddLongintParam(scip, "heuristics/" HEUR_NAME "/maxnodes",
@@ -4092,6 +4482,10 @@ SCIP_RETCODE SCIPincludeHeurAlns(
          "number of allowed executions of the heuristic on the same incumbent solution (-1: no limit, 0: number of active neighborhoods)",
          &heurdata->maxcallssamesol, TRUE, DEFAULT_MAXCALLSSAMESOL, -1, 100, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddIntParam(scip, "heuristics/" HEUR_NAME "/nthreads",
+         "number of threads to solve the sub-SCIPs of several neighborhoods in parallel (1: one neighborhood per call)",
+         &heurdata->nthreads, TRUE, DEFAULT_NTHREADS, 1, 64, NULL, NULL) );
+
    SCIP_CALL( SCIPaddBoolParam(scip, "heuristics/" HEUR_NAME "/adjustminimprove",
          "should the factor by which the minimum improvement is bound be dynamically updated?",
          &heurdata->adjustminimprove, TRUE, DEFAULT_ADJUSTMINIMPROVE, NULL, NULL) );
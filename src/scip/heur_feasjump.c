@@ -0,0 +1,903 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   heur_feasjump.c
+ * @ingroup DEFPLUGINS_HEUR
+ * @brief  feasibility jump primal heuristic
+ *
+ * Each search keeps the values of the variables, the activities and the weights of the rows, and the list of violated
+ * rows. The weighted violation of the rows of a variable is a convex piecewise linear function of the value of the
+ * variable, whose minimizer is found by sorting the breakpoints of the rows, i.e., the values at which a row becomes
+ * satisfied or violated. This minimizer is the jump value of the variable. Since the searches only read the constraint
+ * matrix and write to their own arrays, they run in parallel without locks; the only shared data is an atomic counter
+ * of the searches that found a feasible assignment.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/concurrent.h"
+#include "scip/heur_feasjump.h"
+#include "scip/pub_heur.h"
+#include "scip/pub_matrix.h"
+#include "scip/pub_message.h"
+#include "scip/pub_misc.h"
+#include "scip/pub_misc_sort.h"
+#include "scip/pub_var.h"
+#include "scip/scip_general.h"
+#include "scip/scip_heur.h"
+#include "scip/scip_mem.h"
+#include "scip/scip_message.h"
+#include "scip/scip_numerics.h"
+#include "scip/scip_param.h"
+#include "scip/scip_prob.h"
+#include "scip/scip_randnumgen.h"
+#include "scip/scip_sol.h"
+#include "scip/scip_solvingstats.h"
+#include "tpi/tpi.h"
+#include <string.h>
+
+#define HEUR_NAME             "feasjump"
+#define HEUR_DESC             "start heuristic that searches a feasible assignment by weighted violation local search"
+#define HEUR_DISPCHAR         SCIP_HEURDISPCHAR_LNS
+#define HEUR_PRIORITY         500
+#define HEUR_FREQ             -1
+#define HEUR_FREQOFS          0
+#define HEUR_MAXDEPTH         -1
+#define HEUR_TIMING           SCIP_HEURTIMING_BEFOREPRESOL | SCIP_HEURTIMING_DURINGPRESOLLOOP
+#define HEUR_USESSUBSCIP      FALSE  /**< does the heuristic use a secondary SCIP instance? */
+
+#define DEFAULT_MAXSTEPS      100000 /**< maximal number of steps of a search */
+#define DEFAULT_NTHREADS      1      /**< number of threads for independent searches */
+#define DEFAULT_ONLYWITHOUTSOL TRUE  /**< should the heuristic only run if no solution is known? */
+#define DEFAULT_RANDSEED      29     /**< initial random seed */
+
+#define SAMPLESIZE            25     /**< number of variables of a violated row that are evaluated for a jump */
+#define CHECKFREQ             64     /**< number of steps after which a search checks whether it should stop */
+#define MINVARREDUCTION       0.1    /**< fraction of variables that presolving has to remove before the next call */
+
+/*
+ * Data structures
+ */
+
+/** constraint matrix data that is shared by all searches */
+struct FjProblem
+{
+   SCIP_MATRIX*          matrix;             /**< constraint matrix */
+   SCIP_Bool*            isintegral;         /**< is the variable of a column integral? */
+   SCIP_Real             feastol;            /**< feasibility tolerance */
+   SCIP_Real             infinity;           /**< value for infinity */
+   int                   maxsteps;           /**< maximal number of steps of a search */
+   int                   nfeasible;          /**< number of searches that found a feasible assignment, accessed atomically */
+};
+typedef struct FjProblem FJPROBLEM;
+
+/** a single search */
+struct FjSearch
+{
+   FJPROBLEM*            problem;            /**< shared problem data */
+   SCIP_RANDNUMGEN*      randnumgen;         /**< random number generator of the search */
+   SCIP_Real*            vals;               /**< current values of the columns */
+   SCIP_Real*            activities;         /**< activities of the rows */
+   SCIP_Real*            weights;            /**< weights of the rows */
+   SCIP_Real*            breakpoints;        /**< buffer for the breakpoints of a column */
+   SCIP_Real*            slopes;             /**< buffer for the weighted coefficients of the rows of a column */
+   int*                  bpinds;             /**< buffer for the position in the column of the row of a breakpoint */
+   int*                  violrows;           /**< violated rows */
+   int*                  violpos;            /**< position of a row in violrows, or -1 if it is not violated */
+   int                   nviolrows;          /**< number of violated rows */
+   int                   nsteps;             /**< number of steps done */
+   SCIP_Bool             feasible;           /**< did the search find a feasible assignment? */
+};
+typedef struct FjSearch FJSEARCH;
+
+/** primal heuristic data */
+struct SCIP_HeurData
+{
+   int                   maxsteps;           /**< maximal number of steps of a search */
+   int                   nthreads;           /**< number of threads for independent searches */
+   SCIP_Bool             onlywithoutsol;     /**< should the heuristic only run if no solution is known? */
+   SCIP_Bool             tpiinitialized;     /**< was the task processing interface initialized by this heuristic? */
+   int                   lastnvars;          /**< number of variables in the last call, or -1 if not called yet */
+};
+
+/*
+ * Local methods
+ */
+
+/** returns the violation of a row with the given activity */
+static
+SCIP_Real rowViolation(
+   FJPROBLEM*            problem,            /**< shared problem data */
+   int                   row,                /**< row index */
+   SCIP_Real             activity            /**< activity of the row */
+   )
+{
+   SCIP_Real lhs;
+
+   lhs = SCIPmatrixGetRowLhs(problem->matrix, row);
+
+   if( activity < lhs - problem->feastol )
+      return lhs - activity;
+
+   if( !SCIPmatrixIsRowRhsInfinity(problem->matrix, row) )
+   {
+      SCIP_Real rhs;
+
+      rhs = SCIPmatrixGetRowRhs(problem->matrix, row);
+
+      if( activity > rhs + problem->feastol )
+         return activity - rhs;
+   }
+
+   return 0.0;
+}
+
+/** updates the list of violated rows after the activity of a row changed */
+static
+void updateViolatedRow(
+   FJSEARCH*             search,             /**< search data */
+   int                   row                 /**< row index */
+   )
+{
+   SCIP_Bool violated;
+
+   violated = rowViolation(search->problem, row, search->activities[row]) > 0.0;
+
+   if( violated && search->violpos[row] == -1 )
+   {
+      search->violpos[row] = search->nviolrows;
+      search->violrows[search->nviolrows] = row;
+      ++search->nviolrows;
+   }
+   else if( !violated && search->violpos[row] >= 0 )
+   {
+      int pos;
+
+      pos = search->violpos[row];
+      --search->nviolrows;
+      search->violrows[pos] = search->violrows[search->nviolrows];
+      search->violpos[search->violrows[pos]] = pos;
+      search->violpos[row] = -1;
+   }
+}
+
+/** computes the activities of all rows from scratch and collects the violated rows */
+static
+void initActivities(
+   FJSEARCH*             search              /**< search data */
+   )
+{
+   SCIP_MATRIX* matrix;
+   int nrows;
+   int r;
+
+   matrix = search->problem->matrix;
+   nrows = SCIPmatrixGetNRows(matrix);
+   search->nviolrows = 0;
+
+   for( r = 0; r < nrows; ++r )
+   {
+      SCIP_Real* rowvals;
+      int* rowinds;
+      int rowlen;
+      int k;
+
+      rowvals = SCIPmatrixGetRowValPtr(matrix, r);
+      rowinds = SCIPmatrixGetRowIdxPtr(matrix, r);
+      rowlen = SCIPmatrixGetRowNNonzs(matrix, r);
+
+      search->activities[r] = 0.0;
+      for( k = 0; k < rowlen; ++k )
+         search->activities[r] += rowvals[k] * search->vals[rowinds[k]];
+
+      search->violpos[r] = -1;
+      updateViolatedRow(search, r);
+   }
+}
+
+/** returns the weighted violation of the rows of a column if the column takes the given value */
+static
+SCIP_Real columnViolation(
+   FJSEARCH*             search,             /**< search data */
+   int                   col,                /**< column index */
+   SCIP_Real             val                 /**< value of the column */
+   )
+{
+   SCIP_MATRIX* matrix;
+   SCIP_Real* colvals;
+   int* colinds;
+   SCIP_Real delta;
+   SCIP_Real violation;
+   int collen;
+   int k;
+
+   matrix = search->problem->matrix;
+   colvals = SCIPmatrixGetColValPtr(matrix, col);
+   colinds = SCIPmatrixGetColIdxPtr(matrix, col);
+   collen = SCIPmatrixGetColNNonzs(matrix, col);
+   delta = val - search->vals[col];
+   violation = 0.0;
+
+   for( k = 0; k < collen; ++k )
+   {
+      violation += search->weights[colinds[k]] * rowViolation(search->problem, colinds[k],
+            search->activities[colinds[k]] + colvals[k] * delta);
+   }
+
+   return violation;
+}
+
+/** computes the jump value of a column, which minimizes the weighted violation of its rows, and the decrease of the
+ *  weighted violation by the jump
+ */
+static
+void computeJump(
+   FJSEARCH*             search,             /**< search data */
+   int                   col,                /**< column index */
+   SCIP_Real*            jumpval,            /**< pointer to store the jump value */
+   SCIP_Real*            score               /**< pointer to store the decrease of the weighted violation */
+   )
+{
+   FJPROBLEM* problem;
+   SCIP_MATRIX* matrix;
+   SCIP_Real* colvals;
+   int* colinds;
+   SCIP_Real lb;
+   SCIP_Real ub;
+   SCIP_Real slope;
+   SCIP_Real minimizer;
+   SCIP_Real oldviolation;
+   int nbreakpoints;
+   int collen;
+   int k;
+
+   problem = search->problem;
+   matrix = problem->matrix;
+   colvals = SCIPmatrixGetColValPtr(matrix, col);
+   colinds = SCIPmatrixGetColIdxPtr(matrix, col);
+   collen = SCIPmatrixGetColNNonzs(matrix, col);
+   lb = SCIPmatrixGetColLb(matrix, col);
+   ub = SCIPmatrixGetColUb(matrix, col);
+
+   /* collect the values of the column at which a row becomes satisfied or violated, together with the change of the
+    * slope of the weighted violation at these values; the slope left of all breakpoints is the negative sum of the
+    * weights of the rows that are violated for small values
+    */
+   nbreakpoints = 0;
+   slope = 0.0;
+   for( k = 0; k < collen; ++k )
+   {
+      SCIP_Real residual;
+      SCIP_Real weight;
+      SCIP_Real lower;
+      SCIP_Real upper;
+      int row;
+
+      row = colinds[k];
+      residual = search->activities[row] - colvals[k] * search->vals[col];
+      weight = search->weights[row] * REALABS(colvals[k]);
+      search->slopes[k] = weight;
+
+      /* the row is satisfied for values in [lower, upper] */
+      if( colvals[k] > 0.0 )
+      {
+         lower = (SCIPmatrixGetRowLhs(matrix, row) - residual) / colvals[k];
+         upper = SCIPmatrixIsRowRhsInfinity(matrix, row) ? problem->infinity
+            : (SCIPmatrixGetRowRhs(matrix, row) - residual) / colvals[k];
+      }
+      else
+      {
+         upper = (SCIPmatrixGetRowLhs(matrix, row) - residual) / colvals[k];
+         lower = SCIPmatrixIsRowRhsInfinity(matrix, row) ? -problem->infinity
+            : (SCIPmatrixGetRowRhs(matrix, row) - residual) / colvals[k];
+      }
+
+      if( lower > -problem->infinity )
+      {
+         slope -= weight;
+         search->breakpoints[nbreakpoints] = lower;
+         search->bpinds[nbreakpoints] = k;
+         ++nbreakpoints;
+      }
+
+      if( upper < problem->infinity )
+      {
+         search->breakpoints[nbreakpoints] = upper;
+         search->bpinds[nbreakpoints] = k;
+         ++nbreakpoints;
+      }
+   }
+
+   /* the minimizer of the convex weighted violation is the first breakpoint at which the slope becomes nonnegative */
+   minimizer = search->vals[col];
+   if( nbreakpoints > 0 )
+   {
+      SCIPsortRealInt(search->breakpoints, search->bpinds, nbreakpoints);
+
+      for( k = 0; k < nbreakpoints; ++k )
+      {
+         slope += search->slopes[search->bpinds[k]];
+
+         if( slope >= 0.0 )
+            break;
+      }
+
+      minimizer = search->breakpoints[MIN(k, nbreakpoints - 1)];
+   }
+
+   /* the weighted violation is convex, such that the closest feasible value to the minimizer is optimal */
+   minimizer = MAX(minimizer, lb);
+   minimizer = MIN(minimizer, ub);
+
+   oldviolation = columnViolation(search, col, search->vals[col]);
+
+   if( problem->isintegral[col] )
+   {
+      SCIP_Real downval;
+      SCIP_Real upval;
+      SCIP_Real downviolation;
+      SCIP_Real upviolation;
+
+      downval = floor(minimizer + problem->feastol);
+      upval = ceil(minimizer - problem->feastol);
+      downval = MAX(downval, lb);
+      upval = MIN(upval, ub);
+
+      /* prefer a value that differs from the current value on ties */
+      downviolation = columnViolation(search, col, downval);
+      upviolation = columnViolation(search, col, upval);
+
+      if( downviolation < upviolation || (downviolation == upviolation && downval != search->vals[col]) ) /*lint !e777*/
+      {
+         *jumpval = downval;
+         *score = oldviolation - downviolation;
+      }
+      else
+      {
+         *jumpval = upval;
+         *score = oldviolation - upviolation;
+      }
+   }
+   else
+   {
+      *jumpval = minimizer;
+      *score = oldviolation - columnViolation(search, col, minimizer);
+   }
+}
+
+/** sets the value of a column and updates the activities and the violated rows */
+static
+void applyJump(
+   FJSEARCH*             search,             /**< search data */
+   int                   col,                /**< column index */
+   SCIP_Real             val                 /**< new value of the column */
+   )
+{
+   SCIP_MATRIX* matrix;
+   SCIP_Real* colvals;
+   int* colinds;
+   SCIP_Real delta;
+   int collen;
+   int k;
+
+   matrix = search->problem->matrix;
+   colvals = SCIPmatrixGetColValPtr(matrix, col);
+   colinds = SCIPmatrixGetColIdxPtr(matrix, col);
+   collen = SCIPmatrixGetColNNonzs(matrix, col);
+   delta = val - search->vals[col];
+   search->vals[col] = val;
+
+   for( k = 0; k < collen; ++k )
+   {
+      search->activities[colinds[k]] += colvals[k] * delta;
+      updateViolatedRow(search, colinds[k]);
+   }
+}
+
+/** runs a search until all rows are satisfied, the step limit is reached, or another search found a feasible
+ *  assignment
+ */
+static
+SCIP_RETCODE runSearch(
+   void*                 args                /**< search data */
+   )
+{
+   FJSEARCH* search;
+   FJPROBLEM* problem;
+   SCIP_MATRIX* matrix;
+
+   search = (FJSEARCH*) args;
+   assert(search != NULL);
+
+   problem = search->problem;
+   matrix = problem->matrix;
+
+   initActivities(search);
+
+   for( search->nsteps = 0; search->nsteps < problem->maxsteps; ++search->nsteps )
+   {
+      int* rowinds;
+      SCIP_Real bestscore;
+      SCIP_Real bestval;
+      int bestcol;
+      int rowlen;
+      int nsamples;
+      int row;
+      int s;
+
+      if( search->nviolrows == 0 )
+      {
+         /* the activities are updated incrementally, which accumulates rounding errors */
+         initActivities(search);
+
+         if( search->nviolrows == 0 )
+         {
+            search->feasible = TRUE;
+            (void) SCIPtpiAtomicFetchAddInt(&problem->nfeasible, 1);
+            break;
+         }
+      }
+
+      if( search->nsteps % CHECKFREQ == 0 && SCIPtpiAtomicLoadInt(&problem->nfeasible) > 0 )
+         break;
+
+      /* evaluate the jumps of a sample of the variables of a random violated row */
+      row = search->violrows[SCIPrandomGetInt(search->randnumgen, 0, search->nviolrows - 1)];
+      rowinds = SCIPmatrixGetRowIdxPtr(matrix, row);
+      rowlen = SCIPmatrixGetRowNNonzs(matrix, row);
+      nsamples = MIN(rowlen, SAMPLESIZE);
+
+      bestscore = problem->feastol;
+      bestval = 0.0;
+      bestcol = -1;
+
+      for( s = 0; s < nsamples; ++s )
+      {
+         SCIP_Real jumpval;
+         SCIP_Real score;
+         int col;
+
+         col = rowlen <= SAMPLESIZE ? rowinds[s] : rowinds[SCIPrandomGetInt(search->randnumgen, 0, rowlen - 1)];
+
+         computeJump(search, col, &jumpval, &score);
+
+         if( score > bestscore && jumpval != search->vals[col] ) /*lint !e777*/
+         {
+            bestscore = score;
+            bestval = jumpval;
+            bestcol = col;
+         }
+      }
+
+      /* if no jump decreases the weighted violation, increase the weights of the violated rows */
+      if( bestcol == -1 )
+      {
+         int k;
+
+         for( k = 0; k < search->nviolrows; ++k )
+            search->weights[search->violrows[k]] += 1.0;
+
+         continue;
+      }
+
+      applyJump(search, bestcol, bestval);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** creates the data of a search and sets the initial values of the columns */
+static
+SCIP_RETCODE searchCreate(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FJSEARCH*             search,             /**< search data */
+   FJPROBLEM*            problem,            /**< shared problem data */
+   unsigned int          seed                /**< random seed of the search */
+   )
+{
+   SCIP_MATRIX* matrix;
+   int maxcollen;
+   int ncols;
+   int nrows;
+   int c;
+   int r;
+
+   matrix = problem->matrix;
+   ncols = SCIPmatrixGetNColumns(matrix);
+   nrows = SCIPmatrixGetNRows(matrix);
+
+   maxcollen = 1;
+   for( c = 0; c < ncols; ++c )
+      maxcollen = MAX(maxcollen, SCIPmatrixGetColNNonzs(matrix, c));
+
+   search->problem = problem;
+   search->nviolrows = 0;
+   search->nsteps = 0;
+   search->feasible = FALSE;
+
+   SCIP_CALL( SCIPcreateRandom(scip, &search->randnumgen, seed, TRUE) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &search->vals, ncols) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &search->activities, nrows) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &search->weights, nrows) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &search->breakpoints, 2 * maxcollen) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &search->slopes, maxcollen) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &search->bpinds, 2 * maxcollen) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &search->violrows, nrows) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &search->violpos, nrows) );
+
+   /* start at the bound that is closest to zero */
+   for( c = 0; c < ncols; ++c )
+   {
+      SCIP_Real lb;
+      SCIP_Real ub;
+
+      lb = SCIPmatrixGetColLb(matrix, c);
+      ub = SCIPmatrixGetColUb(matrix, c);
+
+      if( lb > 0.0 )
+         search->vals[c] = lb;
+      else if( ub < 0.0 )
+         search->vals[c] = ub;
+      else
+         search->vals[c] = 0.0;
+   }
+
+   for( r = 0; r < nrows; ++r )
+      search->weights[r] = 1.0;
+
+   return SCIP_OKAY;
+}
+
+/** frees the data of a search */
+static
+void searchFree(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FJSEARCH*             search              /**< search data */
+   )
+{
+   SCIP_MATRIX* matrix;
+   int maxcollen;
+   int ncols;
+   int nrows;
+   int c;
+
+   matrix = search->problem->matrix;
+   ncols = SCIPmatrixGetNColumns(matrix);
+   nrows = SCIPmatrixGetNRows(matrix);
+
+   maxcollen = 1;
+   for( c = 0; c < ncols; ++c )
+      maxcollen = MAX(maxcollen, SCIPmatrixGetColNNonzs(matrix, c));
+
+   SCIPfreeBlockMemoryArray(scip, &search->violpos, nrows);
+   SCIPfreeBlockMemoryArray(scip, &search->violrows, nrows);
+   SCIPfreeBlockMemoryArray(scip, &search->bpinds, 2 * maxcollen);
+   SCIPfreeBlockMemoryArray(scip, &search->slopes, maxcollen);
+   SCIPfreeBlockMemoryArray(scip, &search->breakpoints, 2 * maxcollen);
+   SCIPfreeBlockMemoryArray(scip, &search->weights, nrows);
+   SCIPfreeBlockMemoryArray(scip, &search->activities, nrows);
+   SCIPfreeBlockMemoryArray(scip, &search->vals, ncols);
+   SCIPfreeRandom(scip, &search->randnumgen);
+}
+
+/** runs the searches in parallel jobs */
+static
+SCIP_RETCODE runSearchesParallel(
+   FJSEARCH*             searches,           /**< searches to run */
+   int                   nsearches           /**< number of searches */
+   )
+{
+   SCIP_RETCODE retcode;
+   int jobid;
+   int s;
+
+   jobid = SCIPtpiGetNewJobID();
+   retcode = SCIP_OKAY;
+
+   for( s = 0; s < nsearches && retcode == SCIP_OKAY; ++s )
+   {
+      SCIP_SUBMITSTATUS status;
+      SCIP_JOB* job;
+
+      retcode = SCIPtpiCreateJob(&job, jobid, runSearch, (void*) &searches[s]);
+
+      if( retcode == SCIP_OKAY )
+      {
+         retcode = SCIPtpiSumbitJob(job, &status);
+
+         if( retcode == SCIP_OKAY && status != SCIP_SUBMIT_SUCCESS )
+            retcode = SCIP_ERROR;
+      }
+   }
+
+   retcode = MIN(retcode, SCIPtpiCollectJobs(jobid));
+
+   return retcode;
+}
+
+/*
+ * Callback methods of primal heuristic
+ */
+
+/** copy method for primal heuristic plugins (called when SCIP copies plugins) */
+static
+SCIP_DECL_HEURCOPY(heurCopyFeasjump)
+{  /*lint --e{715}*/
+   assert(scip != NULL);
+   assert(heur != NULL);
+   assert(strcmp(SCIPheurGetName(heur), HEUR_NAME) == 0);
+
+   /* call inclusion method of primal heuristic */
+   SCIP_CALL( SCIPincludeHeurFeasjump(scip) );
+
+   return SCIP_OKAY;
+}
+
+/** destructor of primal heuristic to free user data (called when SCIP is exiting) */
+static
+SCIP_DECL_HEURFREE(heurFreeFeasjump)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+
+   assert(heur != NULL);
+   assert(scip != NULL);
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   SCIPfreeBlockMemory(scip, &heurdata);
+   SCIPheurSetData(heur, NULL);
+
+   return SCIP_OKAY;
+}
+
+/** initialization method of primal heuristic (called after problem was transformed) */
+static
+SCIP_DECL_HEURINIT(heurInitFeasjump)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+
+   assert(heur != NULL);
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   heurdata->lastnvars = -1;
+
+   /* make sure that jobs can be submitted if several searches should run in parallel */
+   heurdata->tpiinitialized = FALSE;
+   if( heurdata->nthreads > 1 && SCIPheurGetFreq(heur) >= 0 )
+   {
+      SCIP_CALL( SCIPinitParallelJobs(scip, heurdata->nthreads, &heurdata->tpiinitialized) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** deinitialization method of primal heuristic (called before transformed problem is freed) */
+static
+SCIP_DECL_HEUREXIT(heurExitFeasjump)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+
+   assert(heur != NULL);
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   if( heurdata->tpiinitialized )
+   {
+      SCIP_CALL( SCIPexitParallelJobs(scip) );
+      heurdata->tpiinitialized = FALSE;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** execution method of primal heuristic */
+static
+SCIP_DECL_HEUREXEC(heurExecFeasjump)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+   FJPROBLEM problem;
+   FJSEARCH* searches;
+   SCIP_RETCODE retcode;
+   SCIP_Bool initialized;
+   SCIP_Bool complete;
+   SCIP_Bool infeasible;
+   int naddconss;
+   int ndelconss;
+   int nchgcoefs;
+   int nchgbds;
+   int nfixedvars;
+   int nsearches;
+   int bestsearch;
+   int ncols;
+   int c;
+   int s;
+
+   assert(heur != NULL);
+   assert(result != NULL);
+
+   *result = SCIP_DIDNOTRUN;
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   if( heurdata->onlywithoutsol && SCIPgetNSols(scip) > 0 )
+      return SCIP_OKAY;
+
+   /* the matrix is only created during presolving, because creating it cleans up the constraints */
+   if( SCIPgetStage(scip) != SCIP_STAGE_PRESOLVING )
+      return SCIP_OKAY;
+
+   if( SCIPgetNBinVars(scip) + SCIPgetNIntVars(scip) == 0 )
+      return SCIP_OKAY;
+
+   /* during the presolving loop, only search again if presolving reduced the problem considerably */
+   if( heurdata->lastnvars >= 0 && SCIPgetNVars(scip) > (1.0 - MINVARREDUCTION) * heurdata->lastnvars )
+      return SCIP_OKAY;
+
+   heurdata->lastnvars = SCIPgetNVars(scip);
+
+   naddconss = 0;
+   ndelconss = 0;
+   nchgcoefs = 0;
+   nchgbds = 0;
+   nfixedvars = 0;
+
+   problem.matrix = NULL;
+   SCIP_CALL( SCIPmatrixCreate(scip, &problem.matrix, FALSE, &initialized, &complete, &infeasible, &naddconss,
+         &ndelconss, &nchgcoefs, &nchgbds, &nfixedvars) );
+
+   if( !initialized || infeasible || SCIPmatrixGetNRows(problem.matrix) == 0 )
+   {
+      if( problem.matrix != NULL )
+         SCIPmatrixFree(scip, &problem.matrix);
+
+      return SCIP_OKAY;
+   }
+
+   *result = SCIP_DIDNOTFIND;
+
+   ncols = SCIPmatrixGetNColumns(problem.matrix);
+   problem.feastol = SCIPfeastol(scip);
+   problem.infinity = SCIPinfinity(scip);
+   problem.maxsteps = heurdata->maxsteps;
+   problem.nfeasible = 0;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &problem.isintegral, ncols) );
+   for( c = 0; c < ncols; ++c )
+      problem.isintegral[c] = SCIPvarIsIntegral(SCIPmatrixGetVar(problem.matrix, c));
+
+   nsearches = SCIPtpiIsAvailable() ? heurdata->nthreads : 1;
+   SCIP_CALL( SCIPallocBufferArray(scip, &searches, nsearches) );
+
+   for( s = 0; s < nsearches; ++s )
+   {
+      SCIP_CALL( searchCreate(scip, &searches[s], &problem,
+            SCIPinitializeRandomSeed(scip, (unsigned int)(DEFAULT_RANDSEED + s + SCIPheurGetNCalls(heur)))) );
+   }
+
+   if( nsearches > 1 )
+      retcode = runSearchesParallel(searches, nsearches);
+   else
+      retcode = runSearch((void*) &searches[0]);
+
+   /* try the feasible assignment with the best objective value */
+   bestsearch = -1;
+   if( retcode == SCIP_OKAY )
+   {
+      SCIP_Real bestobj;
+
+      bestobj = SCIPinfinity(scip);
+
+      for( s = 0; s < nsearches; ++s )
+      {
+         SCIP_Real obj;
+
+         SCIPdebugMsg(scip, "search %d: %d steps, %d violated rows\n", s, searches[s].nsteps, searches[s].nviolrows);
+
+         if( !searches[s].feasible )
+            continue;
+
+         obj = 0.0;
+         for( c = 0; c < ncols; ++c )
+            obj += SCIPvarGetObj(SCIPmatrixGetVar(problem.matrix, c)) * searches[s].vals[c];
+
+         if( obj < bestobj )
+         {
+            bestobj = obj;
+            bestsearch = s;
+         }
+      }
+   }
+
+   if( bestsearch >= 0 )
+   {
+      SCIP_SOL* sol;
+      SCIP_Bool stored;
+
+      SCIP_CALL( SCIPcreateSol(scip, &sol, heur) );
+
+      for( c = 0; c < ncols; ++c )
+      {
+         SCIP_CALL( SCIPsetSolVal(scip, sol, SCIPmatrixGetVar(problem.matrix, c), searches[bestsearch].vals[c]) );
+      }
+
+      /* the matrix does not contain all constraints, e.g., nonlinear ones, such that all constraints are checked */
+      SCIP_CALL( SCIPtrySolFree(scip, &sol, FALSE, FALSE, TRUE, TRUE, !complete, &stored) );
+
+      if( stored )
+         *result = SCIP_FOUNDSOL;
+   }
+
+   for( s = nsearches - 1; s >= 0; --s )
+      searchFree(scip, &searches[s]);
+
+   SCIPfreeBufferArray(scip, &searches);
+   SCIPfreeBufferArray(scip, &problem.isintegral);
+   SCIPmatrixFree(scip, &problem.matrix);
+
+   SCIP_CALL( retcode );
+
+   return SCIP_OKAY;
+}
+
+/*
+ * primal heuristic specific interface methods
+ */
+
+/** creates the feasibility jump primal heuristic and includes it in SCIP */
+SCIP_RETCODE SCIPincludeHeurFeasjump(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_HEURDATA* heurdata;
+   SCIP_HEUR* heur;
+
+   /* create feasibility jump primal heuristic data */
+   SCIP_CALL( SCIPallocBlockMemory(scip, &heurdata) );
+   heurdata->tpiinitialized = FALSE;
+   heurdata->lastnvars = -1;
+
+   /* include primal heuristic */
+   SCIP_CALL( SCIPincludeHeurBasic(scip, &heur,
+         HEUR_NAME, HEUR_DESC, HEUR_DISPCHAR, HEUR_PRIORITY, HEUR_FREQ, HEUR_FREQOFS,
+         HEUR_MAXDEPTH, HEUR_TIMING, HEUR_USESSUBSCIP, heurExecFeasjump, heurdata) );
+
+   assert(heur != NULL);
+
+   /* set non-NULL pointers to callback methods */
+   SCIP_CALL( SCIPsetHeurCopy(scip, heur, heurCopyFeasjump) );
+   SCIP_CALL( SCIPsetHeurFree(scip, heur, heurFreeFeasjump) );
+   SCIP_CALL( SCIPsetHeurInit(scip, heur, heurInitFeasjump) );
+   SCIP_CALL( SCIPsetHeurExit(scip, heur, heurExitFeasjump) );
+
+   /* add feasibility jump primal heuristic parameters */
+   SCIP_CALL( SCIPaddIntParam(scip, "heuristics/" HEUR_NAME "/maxsteps",
+         "maximal number of steps of a search",
+         &heurdata->maxsteps, TRUE, DEFAULT_MAXSTEPS, 0, INT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "heuristics/" HEUR_NAME "/nthreads",
+         "number of threads for independent searches with different random seeds",
+         &heurdata->nthreads, TRUE, DEFAULT_NTHREADS, 1, 64, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip, "heuristics/" HEUR_NAME "/onlywithoutsol",
+         "should the heuristic only run if no solution is known?",
+         &heurdata->onlywithoutsol, TRUE, DEFAULT_ONLYWITHOUTSOL, NULL, NULL) );
+
+   return SCIP_OKAY;
+}
@@ -0,0 +1,59 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   heur_feasjump.h
+ * @ingroup PRIMALHEURISTICS
+ * @brief  feasibility jump primal heuristic
+ *
+ * The feasibility jump heuristic is a start heuristic that searches for a feasible assignment of the linear
+ * constraints by weighted violation local search, without solving any LP. The constraints are taken from the
+ * constraint matrix (see matrix.c), and each constraint gets a weight that is increased whenever the search gets
+ * stuck while the constraint is violated. In every step, a violated constraint is chosen at random, and one of its
+ * variables jumps to the value that minimizes the weighted violation of the constraints of the variable, given the
+ * values of all other variables. The heuristic runs before and during presolving, since the constraint matrix cannot
+ * be created anymore once the LP rows of the constraints exist.
+ *
+ * Several independent searches with different random seeds can run in parallel, see parameter nthreads. The searches
+ * stop as soon as one of them finds an assignment that satisfies all constraints of the matrix, and the best such
+ * assignment is checked by SCIPtrySol().
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_HEUR_FEASJUMP_H__
+#define __SCIP_HEUR_FEASJUMP_H__
+
+#include "scip/def.h"
+#include "scip/type_retcode.h"
+#include "scip/type_scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** creates the feasibility jump primal heuristic and includes it in SCIP
+ *
+ *  @ingroup PrimalHeuristicIncludes
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPincludeHeurFeasjump(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
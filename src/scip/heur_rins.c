@@ -72,6 +72,7 @@
                                          * of the original scip be copied to constraints of the subscip
                                          */
 #define DEFAULT_USEUCT        FALSE     /* should uct node selection be used at the beginning of the search?     */
+#define DEFAULT_USETEMPLATE   FALSE     /* should the sub-SCIP be copied once and reused by all calls?           */
 
 /* event handler properties */
 #define EVENTHDLR_NAME         "Rins"
@@ -99,6 +100,8 @@ struct SCIP_HeurData
                                               *   to constraints in subproblem?
                                               */
    SCIP_Bool             useuct;             /**< should uct node selection be used at the beginning of the search?  */
+   SCIP_Bool             usetemplate;        /**< should the sub-SCIP be copied once and reused by all calls?         */
+   SCIP_LNSTEMPLATE*     lnstemplate;        /**< template of the sub-SCIP, or NULL if not created yet                */
 };
 
 /*
@@ -192,38 +195,14 @@ SCIP_RETCODE determineFixings(
 static
 SCIP_DECL_EVENTEXEC(eventExecRins);
 
-/** wrapper for the part of heuristic that runs a subscip. Wrapper is needed to avoid possible ressource leaks */
+/** sets up the plugins and parameters of the sub-SCIP that do not depend on the neighborhood */
 static
-SCIP_RETCODE wrapperRins(
-   SCIP*                 scip,               /**< original SCIP data structure                        */
+SCIP_RETCODE setupSubscipRins(
    SCIP*                 subscip,            /**< SCIP structure of the subproblem                    */
-   SCIP_HEUR*            heur,               /**< Heuristic pointer                                   */
-   SCIP_HEURDATA*        heurdata,           /**< Heuristic's data                                    */
-   SCIP_VAR**            vars,               /**< original problem's variables                        */
-   SCIP_VAR**            fixedvars,          /**< Fixed variables of original SCIP                    */
-   SCIP_Real*            fixedvals,          /**< Fixed values of original SCIP                       */
-   SCIP_RESULT*          result,             /**< Result pointer                                      */
-   int                   nvars,              /**< Number of variables                                 */
-   int                   nfixedvars,         /**< Number of fixed variables                           */
-   SCIP_Longint          nnodes              /**< Number of nodes in the b&b tree                     */
+   SCIP_HEURDATA*        heurdata            /**< Heuristic's data                                    */
    )
 {
-   SCIP_VAR** subvars;                       /* variables of the subscip */
-   SCIP_HASHMAP*  varmapfw;                  /* hashmap for mapping between vars of scip and subscip */
    SCIP_EVENTHDLR* eventhdlr;                /* event handler for LP events  */
-   SCIP_Real upperbound;                     /* upperbound of the original SCIP */
-   SCIP_Real cutoff;                         /* objective cutoff for the subproblem */
-
-   SCIP_Bool success;
-
-   int i;
-
-   /* create the variable mapping hash map */
-   SCIP_CALL( SCIPhashmapCreate(&varmapfw, SCIPblkmem(subscip), nvars) );
-
-   /* create a problem copy as sub SCIP */
-   SCIP_CALL( SCIPcopyLargeNeighborhoodSearch(scip, subscip, varmapfw, "rins", fixedvars, fixedvals, nfixedvars,
-      heurdata->uselprows, heurdata->copycuts, &success, NULL) );
 
    eventhdlr = NULL;
    /* create event handler for LP events */
@@ -234,14 +213,6 @@ SCIP_RETCODE wrapperRins(
       return SCIP_PLUGINNOTFOUND;
    }
 
-   /* copy subproblem variables from map to obtain the same order */
-   SCIP_CALL( SCIPallocBufferArray(scip, &subvars, nvars) );
-   for( i = 0; i < nvars; i++ )
-      subvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmapfw, vars[i]);
-
-   /* free hash map */
-   SCIPhashmapFree(&varmapfw);
-
    /* do not abort subproblem on CTRL-C */
    SCIP_CALL( SCIPsetBoolParam(subscip, "misc/catchctrlc", FALSE) );
 
@@ -255,13 +226,6 @@ SCIP_RETCODE wrapperRins(
    SCIP_CALL( SCIPsetBoolParam(subscip, "timing/statistictiming", FALSE) );
 #endif
 
-   /* set limits for the subproblem */
-   SCIP_CALL( SCIPcopyLimits(scip, subscip) );
-   heurdata->nodelimit = nnodes;
-   SCIP_CALL( SCIPsetLongintParam(subscip, "limits/nodes", nnodes) );
-   SCIP_CALL( SCIPsetLongintParam(subscip, "limits/stallnodes", MAX(10, nnodes/10)) );
-   SCIP_CALL( SCIPsetIntParam(subscip, "limits/bestsol", 3) );
-
    /* forbid recursive call of heuristics and separators solving subMIPs */
    SCIP_CALL( SCIPsetSubscipsOff(subscip, TRUE) );
 
@@ -306,6 +270,39 @@ SCIP_RETCODE wrapperRins(
    /* speed up sub-SCIP by not checking dual LP feasibility */
    SCIP_CALL( SCIPsetBoolParam(subscip, "lp/checkdualfeas", FALSE) );
 
+   return SCIP_OKAY;
+}
+
+/** solves the sub-SCIP, which contains the neighborhood, and transfers its solutions */
+static
+SCIP_RETCODE solveSubscipRins(
+   SCIP*                 scip,               /**< original SCIP data structure                        */
+   SCIP*                 subscip,            /**< SCIP structure of the subproblem                    */
+   SCIP_HEUR*            heur,               /**< Heuristic pointer                                   */
+   SCIP_HEURDATA*        heurdata,           /**< Heuristic's data                                    */
+   SCIP_VAR**            vars,               /**< original problem's variables                        */
+   SCIP_VAR**            subvars,            /**< subproblem's variables                              */
+   SCIP_RESULT*          result,             /**< Result pointer                                      */
+   int                   nvars,              /**< Number of variables                                 */
+   SCIP_Longint          nnodes              /**< Number of nodes in the b&b tree                     */
+   )
+{
+   SCIP_EVENTHDLR* eventhdlr;                /* event handler for LP events  */
+   SCIP_Real upperbound;                     /* upperbound of the original SCIP */
+   SCIP_Real cutoff;                         /* objective cutoff for the subproblem */
+
+   SCIP_Bool success;
+
+   eventhdlr = SCIPfindEventhdlr(subscip, EVENTHDLR_NAME);
+   assert(eventhdlr != NULL);
+
+   /* set limits for the subproblem */
+   SCIP_CALL( SCIPcopyLimits(scip, subscip) );
+   heurdata->nodelimit = nnodes;
+   SCIP_CALL( SCIPsetLongintParam(subscip, "limits/nodes", nnodes) );
+   SCIP_CALL( SCIPsetLongintParam(subscip, "limits/stallnodes", MAX(10, nnodes/10)) );
+   SCIP_CALL( SCIPsetIntParam(subscip, "limits/bestsol", 3) );
+
    /* add an objective cutoff */
    assert( !SCIPisInfinity(scip,SCIPgetUpperbound(scip)) );
 
@@ -349,12 +346,107 @@ SCIP_RETCODE wrapperRins(
    if( success )
       *result = SCIP_FOUNDSOL;
 
+   return SCIP_OKAY;
+}
+
+/** wrapper for the part of heuristic that runs a subscip. Wrapper is needed to avoid possible ressource leaks */
+static
+SCIP_RETCODE wrapperRins(
+   SCIP*                 scip,               /**< original SCIP data structure                        */
+   SCIP*                 subscip,            /**< SCIP structure of the subproblem                    */
+   SCIP_HEUR*            heur,               /**< Heuristic pointer                                   */
+   SCIP_HEURDATA*        heurdata,           /**< Heuristic's data                                    */
+   SCIP_VAR**            vars,               /**< original problem's variables                        */
+   SCIP_VAR**            fixedvars,          /**< Fixed variables of original SCIP                    */
+   SCIP_Real*            fixedvals,          /**< Fixed values of original SCIP                       */
+   SCIP_RESULT*          result,             /**< Result pointer                                      */
+   int                   nvars,              /**< Number of variables                                 */
+   int                   nfixedvars,         /**< Number of fixed variables                           */
+   SCIP_Longint          nnodes              /**< Number of nodes in the b&b tree                     */
+   )
+{
+   SCIP_VAR** subvars;                       /* variables of the subscip */
+   SCIP_HASHMAP*  varmapfw;                  /* hashmap for mapping between vars of scip and subscip */
+
+   SCIP_Bool success;
+
+   int i;
+
+   /* create the variable mapping hash map */
+   SCIP_CALL( SCIPhashmapCreate(&varmapfw, SCIPblkmem(subscip), nvars) );
+
+   /* create a problem copy as sub SCIP */
+   SCIP_CALL( SCIPcopyLargeNeighborhoodSearch(scip, subscip, varmapfw, "rins", fixedvars, fixedvals, nfixedvars,
+      heurdata->uselprows, heurdata->copycuts, &success, NULL) );
+
+   SCIP_CALL( setupSubscipRins(subscip, heurdata) );
+
+   /* copy subproblem variables from map to obtain the same order */
+   SCIP_CALL( SCIPallocBufferArray(scip, &subvars, nvars) );
+   for( i = 0; i < nvars; i++ )
+      subvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmapfw, vars[i]);
+
+   /* free hash map */
+   SCIPhashmapFree(&varmapfw);
+
+   SCIP_CALL( solveSubscipRins(scip, subscip, heur, heurdata, vars, subvars, result, nvars, nnodes) );
+
    /* free subproblem */
    SCIPfreeBufferArray(scip, &subvars);
 
    return SCIP_OKAY;
 }
 
+/** solves the neighborhood in the sub-SCIP of the template, which is created at the first call and after the variables
+ *  of the problem changed
+ */
+static
+SCIP_RETCODE templateRins(
+   SCIP*                 scip,               /**< original SCIP data structure                        */
+   SCIP_HEUR*            heur,               /**< Heuristic pointer                                   */
+   SCIP_HEURDATA*        heurdata,           /**< Heuristic's data                                    */
+   SCIP_VAR**            vars,               /**< original problem's variables                        */
+   SCIP_VAR**            fixedvars,          /**< Fixed variables of original SCIP                    */
+   SCIP_Real*            fixedvals,          /**< Fixed values of original SCIP                       */
+   SCIP_RESULT*          result,             /**< Result pointer                                      */
+   int                   nvars,              /**< Number of variables                                 */
+   int                   nfixedvars,         /**< Number of fixed variables                           */
+   SCIP_Longint          nnodes              /**< Number of nodes in the b&b tree                     */
+   )
+{
+   SCIP_RETCODE retcode;
+
+   if( heurdata->lnstemplate != NULL && !SCIPisLNSTemplateValid(scip, heurdata->lnstemplate) )
+   {
+      SCIP_CALL( SCIPfreeLNSTemplate(scip, &heurdata->lnstemplate) );
+   }
+
+   if( heurdata->lnstemplate == NULL )
+   {
+      SCIP_Bool success;
+
+      SCIP_CALL( SCIPcreateLNSTemplate(scip, &heurdata->lnstemplate, "rins", heurdata->uselprows, &success) );
+
+      if( !success )
+      {
+         SCIP_CALL( SCIPfreeLNSTemplate(scip, &heurdata->lnstemplate) );
+         return SCIP_OKAY;
+      }
+
+      SCIP_CALL( setupSubscipRins(SCIPgetLNSTemplateSubscip(heurdata->lnstemplate), heurdata) );
+   }
+
+   SCIP_CALL( SCIPapplyLNSTemplate(scip, heurdata->lnstemplate, fixedvars, fixedvals, nfixedvars, NULL,
+         heurdata->copycuts && !heurdata->uselprows) );
+
+   retcode = solveSubscipRins(scip, SCIPgetLNSTemplateSubscip(heurdata->lnstemplate), heur, heurdata, vars,
+         SCIPgetLNSTemplateSubvars(heurdata->lnstemplate), result, nvars, nnodes);
+
+   SCIP_CALL( SCIPresetLNSTemplate(heurdata->lnstemplate) );
+
+   return retcode;
+}
+
 /* ---------------- Callback methods of event handler ---------------- */
 
 /* exec the event handler
@@ -444,6 +536,28 @@ SCIP_DECL_HEURINIT(heurInitRins)
    return SCIP_OKAY;
 }
 
+/** solving process deinitialization method of primal heuristic (called before branch and bound process data is freed) */
+static
+SCIP_DECL_HEUREXITSOL(heurExitsolRins)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+
+   assert( heur != NULL );
+   assert( scip != NULL );
+
+   /* get heuristic's data */
+   heurdata = SCIPheurGetData(heur);
+   assert( heurdata != NULL );
+
+   /* the template is a copy of the transformed problem */
+   if( heurdata->lnstemplate != NULL )
+   {
+      SCIP_CALL( SCIPfreeLNSTemplate(scip, &heurdata->lnstemplate) );
+   }
+
+   return SCIP_OKAY;
+}
+
 
 /** execution method of primal heuristic */
 static
@@ -551,6 +665,13 @@ SCIP_DECL_HEUREXEC(heurExecRins)
    *result = SCIP_DIDNOTFIND;
 
    SCIPdebugMsg(scip, "RINS heuristic fixes %d out of %d binary+integer variables\n", nfixedvars, nbinvars + nintvars);
+
+   if( heurdata->usetemplate )
+   {
+      SCIP_CALL( templateRins(scip, heur, heurdata, vars, fixedvars, fixedvals, result, nvars, nfixedvars, nnodes) );
+      goto TERMINATE;
+   }
+
    SCIP_CALL( SCIPcreate(&subscip) );
 
    retcode = wrapperRins(scip, subscip, heur, heurdata, vars, fixedvars, fixedvals, result, nvars, nfixedvars, nnodes);
@@ -580,6 +701,7 @@ SCIP_RETCODE SCIPincludeHeurRins(
 
    /* create Rins primal heuristic data */
    SCIP_CALL( SCIPallocBlockMemory(scip, &heurdata) );
+   heurdata->lnstemplate = NULL;
 
    /* include primal heuristic */
    SCIP_CALL( SCIPincludeHeurBasic(scip, &heur,
@@ -592,6 +714,7 @@ SCIP_RETCODE SCIPincludeHeurRins(
    SCIP_CALL( SCIPsetHeurCopy(scip, heur, heurCopyRins) );
    SCIP_CALL( SCIPsetHeurFree(scip, heur, heurFreeRins) );
    SCIP_CALL( SCIPsetHeurInit(scip, heur, heurInitRins) );
+   SCIP_CALL( SCIPsetHeurExitsol(scip, heur, heurExitsolRins) );
 
    /* add RINS primal heuristic parameters */
    SCIP_CALL( SCIPaddIntParam(scip, "heuristics/" HEUR_NAME "/nodesofs",
@@ -638,5 +761,9 @@ SCIP_RETCODE SCIPincludeHeurRins(
          "should uct node selection be used at the beginning of the search?",
          &heurdata->useuct, TRUE, DEFAULT_USEUCT, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddBoolParam(scip, "heuristics/" HEUR_NAME "/usetemplate",
+         "should the subproblem be copied once per run and reused by all calls with the fixings of the call?",
+         &heurdata->usetemplate, TRUE, DEFAULT_USETEMPLATE, NULL, NULL) );
+
    return SCIP_OKAY;
 }
@@ -861,6 +861,8 @@ SCIP_RETCODE createRows(
    SCIP_ROW** rows;                          /* original scip rows                       */
    SCIP_CONS* cons;                          /* new constraint                           */
    SCIP_VAR** consvars;                      /* new constraint's variables               */
+   SCIP_VAR** subvars;                       /* copies of the variables by problem index */
+   SCIP_VAR** vars;                          /* original scip variables                  */
    SCIP_COL** cols;                          /* original row's columns                   */
 
    SCIP_Real constant;                       /* constant added to the row                */
@@ -868,6 +870,7 @@ SCIP_RETCODE createRows(
    SCIP_Real rhs;                            /* left right side of the row               */
    SCIP_Real* vals;                          /* variables' coefficient values of the row */
 
+   int nvars;
    int nrows;
    int nnonz;
    int i;
@@ -876,6 +879,15 @@ SCIP_RETCODE createRows(
    /* get the rows and their number */
    SCIP_CALL( SCIPgetLPRowsData(scip, &rows, &nrows) );
 
+   /* look up the copies of the variables once, such that the columns of the rows can be mapped by their problem index */
+   SCIP_CALL( SCIPgetVarsData(scip, &vars, &nvars, NULL, NULL, NULL, NULL) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &subvars, nvars) );
+   for( i = 0; i < nvars; i++ )
+   {
+      assert(SCIPvarGetProbindex(vars[i]) == i);
+      subvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmap, vars[i]);
+   }
+
    /* copy all rows to linear constraints */
    for( i = 0; i < nrows; i++ )
    {
@@ -896,7 +908,10 @@ SCIP_RETCODE createRows(
       /* allocate memory array to be filled with the corresponding subproblem variables */
       SCIP_CALL( SCIPallocBufferArray(scip, &consvars, nnonz) );
       for( j = 0; j < nnonz; j++ )
-         consvars[j] = (SCIP_VAR*) SCIPhashmapGetImage(varmap, (SCIPcolGetVar(cols[j])));
+      {
+         assert(0 <= SCIPvarGetProbindex(SCIPcolGetVar(cols[j])) && SCIPvarGetProbindex(SCIPcolGetVar(cols[j])) < nvars);
+         consvars[j] = subvars[SCIPvarGetProbindex(SCIPcolGetVar(cols[j]))];
+      }
 
       /* create a new linear constraint and add it to the subproblem */
       SCIP_CALL( SCIPcreateConsLinear(subscip, &cons, SCIProwGetName(rows[i]), nnonz, consvars, vals, lhs, rhs,
@@ -908,6 +923,8 @@ SCIP_RETCODE createRows(
       SCIPfreeBufferArray(scip, &consvars);
    }
 
+   SCIPfreeBufferArray(scip, &subvars);
+
    return SCIP_OKAY;
 }
 
@@ -1072,3 +1089,318 @@ SCIP_RETCODE SCIPaddTrustregionNeighborhoodConstraint(
 
    return SCIP_OKAY;
 }
+
+/** persistent sub-SCIP copy for large neighborhood search heuristics */
+struct SCIP_LnsTemplate
+{
+   SCIP*                 subscip;            /**< sub-SCIP holding the global copy of the transformed problem */
+   SCIP_HASHMAP*         varmap;             /**< map from the variables of the source SCIP to their copies */
+   SCIP_VAR**            vars;               /**< variables of the source SCIP when the template was created */
+   SCIP_VAR**            subvars;            /**< copies of the variables in the sub-SCIP */
+   SCIP_Real*            subobjs;            /**< objective coefficients of the copies in the template */
+   SCIP_CONS**           cutconss;           /**< constraints created from cuts for the current neighborhood */
+   int                   nvars;              /**< number of variables */
+   int                   ncutconss;          /**< number of constraints created from cuts */
+   int                   cutconsssize;       /**< size of cutconss array */
+   SCIP_Bool             objchanged;         /**< was the objective function changed for the current neighborhood? */
+};
+
+/** sets the bounds of an original variable of the sub-SCIP */
+static
+SCIP_RETCODE setSubvarBounds(
+   SCIP*                 subscip,            /**< sub-SCIP data structure */
+   SCIP_VAR*             subvar,             /**< original variable of the sub-SCIP */
+   SCIP_Real             lb,                 /**< new lower bound */
+   SCIP_Real             ub                  /**< new upper bound */
+   )
+{
+   /* change the upper bound first if the new lower bound exceeds the old upper bound */
+   if( lb > SCIPvarGetUbOriginal(subvar) )
+   {
+      SCIP_CALL( SCIPchgVarUb(subscip, subvar, ub) );
+      SCIP_CALL( SCIPchgVarLb(subscip, subvar, lb) );
+   }
+   else
+   {
+      if( lb != SCIPvarGetLbOriginal(subvar) ) /*lint !e777*/
+      {
+         SCIP_CALL( SCIPchgVarLb(subscip, subvar, lb) );
+      }
+      if( ub != SCIPvarGetUbOriginal(subvar) ) /*lint !e777*/
+      {
+         SCIP_CALL( SCIPchgVarUb(subscip, subvar, ub) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** creates a template for the sub-SCIPs of a large neighborhood search heuristic
+ *
+ *  The template holds a global copy of the transformed problem without fixings, which is reused by every call of the
+ *  heuristic: SCIPapplyLNSTemplate() applies the neighborhood of the call to the original problem of the sub-SCIP and
+ *  SCIPresetLNSTemplate() frees the transformed problem of the sub-SCIP after the solve. The parameters and plugins of
+ *  the sub-SCIP are kept, such that the heuristic sets them up only once after the creation of the template.
+ *
+ *  The template belongs to the transformed problem of the source SCIP and has to be freed before the solving process
+ *  data is freed, e.g., in the exitsol callback of the heuristic.
+ */
+SCIP_RETCODE SCIPcreateLNSTemplate(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_LNSTEMPLATE**    lnstemplate,        /**< pointer to store the template */
+   const char*           suffix,             /**< suffix for the problem name */
+   SCIP_Bool             uselprows,          /**< should the linear relaxation of the problem defined by LP rows be copied? */
+   SCIP_Bool*            success             /**< pointer to store whether the template was created */
+   )
+{
+   SCIP_VAR** vars;
+   int v;
+
+   assert(sourcescip != NULL);
+   assert(lnstemplate != NULL);
+   assert(suffix != NULL);
+   assert(success != NULL);
+
+   SCIP_CALL( SCIPgetVarsData(sourcescip, &vars, NULL, NULL, NULL, NULL, NULL) );
+
+   SCIP_CALL( SCIPallocBlockMemory(sourcescip, lnstemplate) );
+   (*lnstemplate)->nvars = SCIPgetNVars(sourcescip);
+   (*lnstemplate)->cutconss = NULL;
+   (*lnstemplate)->ncutconss = 0;
+   (*lnstemplate)->cutconsssize = 0;
+   (*lnstemplate)->objchanged = FALSE;
+
+   SCIP_CALL( SCIPcreate(&(*lnstemplate)->subscip) );
+   SCIP_CALL( SCIPhashmapCreate(&(*lnstemplate)->varmap, SCIPblkmem((*lnstemplate)->subscip), MAX((*lnstemplate)->nvars, 1)) );
+
+   /* copy the problem without fixings and cuts, which depend on the neighborhood */
+   SCIP_CALL( SCIPcopyLargeNeighborhoodSearch(sourcescip, (*lnstemplate)->subscip, (*lnstemplate)->varmap, suffix, NULL,
+         NULL, 0, uselprows, FALSE, success, NULL) );
+
+   /* the solutions of a neighborhood must not be kept for the next neighborhood */
+   SCIP_CALL( SCIPsetBoolParam((*lnstemplate)->subscip, "misc/transsolsorig", FALSE) );
+
+   SCIP_CALL( SCIPduplicateBlockMemoryArray(sourcescip, &(*lnstemplate)->vars, vars, MAX((*lnstemplate)->nvars, 1)) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(sourcescip, &(*lnstemplate)->subvars, MAX((*lnstemplate)->nvars, 1)) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(sourcescip, &(*lnstemplate)->subobjs, MAX((*lnstemplate)->nvars, 1)) );
+
+   for( v = 0; v < (*lnstemplate)->nvars; ++v )
+   {
+      /* relaxation-only variables are not copied */
+      (*lnstemplate)->subvars[v] = (SCIP_VAR*) SCIPhashmapGetImage((*lnstemplate)->varmap, vars[v]);
+      (*lnstemplate)->subobjs[v] = ((*lnstemplate)->subvars[v] != NULL ? SCIPvarGetObj((*lnstemplate)->subvars[v]) : 0.0);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** frees a template for the sub-SCIPs of a large neighborhood search heuristic */
+SCIP_RETCODE SCIPfreeLNSTemplate(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_LNSTEMPLATE**    lnstemplate         /**< pointer to the template */
+   )
+{
+   int c;
+
+   assert(sourcescip != NULL);
+   assert(lnstemplate != NULL);
+   assert(*lnstemplate != NULL);
+
+   for( c = 0; c < (*lnstemplate)->ncutconss; ++c )
+   {
+      SCIP_CALL( SCIPreleaseCons((*lnstemplate)->subscip, &(*lnstemplate)->cutconss[c]) );
+   }
+   SCIPfreeBlockMemoryArrayNull(sourcescip, &(*lnstemplate)->cutconss, (*lnstemplate)->cutconsssize);
+
+   SCIPfreeBlockMemoryArray(sourcescip, &(*lnstemplate)->subobjs, MAX((*lnstemplate)->nvars, 1));
+   SCIPfreeBlockMemoryArray(sourcescip, &(*lnstemplate)->subvars, MAX((*lnstemplate)->nvars, 1));
+   SCIPfreeBlockMemoryArray(sourcescip, &(*lnstemplate)->vars, MAX((*lnstemplate)->nvars, 1));
+
+   SCIPhashmapFree(&(*lnstemplate)->varmap);
+   SCIP_CALL( SCIPfree(&(*lnstemplate)->subscip) );
+
+   SCIPfreeBlockMemory(sourcescip, lnstemplate);
+
+   return SCIP_OKAY;
+}
+
+/** returns whether the template still matches the variables of the source SCIP */
+SCIP_Bool SCIPisLNSTemplateValid(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_LNSTEMPLATE*     lnstemplate         /**< template */
+   )
+{
+   SCIP_VAR** vars;
+   int v;
+
+   assert(sourcescip != NULL);
+   assert(lnstemplate != NULL);
+
+   if( SCIPgetNVars(sourcescip) != lnstemplate->nvars )
+      return FALSE;
+
+   vars = SCIPgetVars(sourcescip);
+   for( v = 0; v < lnstemplate->nvars; ++v )
+   {
+      if( vars[v] != lnstemplate->vars[v] )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+/** returns the sub-SCIP of the template */
+SCIP* SCIPgetLNSTemplateSubscip(
+   SCIP_LNSTEMPLATE*     lnstemplate         /**< template */
+   )
+{
+   assert(lnstemplate != NULL);
+
+   return lnstemplate->subscip;
+}
+
+/** returns the copies of the variables of the source SCIP in the sub-SCIP, in the order of SCIPgetVars() */
+SCIP_VAR** SCIPgetLNSTemplateSubvars(
+   SCIP_LNSTEMPLATE*     lnstemplate         /**< template */
+   )
+{
+   assert(lnstemplate != NULL);
+
+   return lnstemplate->subvars;
+}
+
+/** applies a neighborhood to the sub-SCIP of the template
+ *
+ *  The bounds of all variables are set to the current global bounds in the source SCIP, the given variables are fixed,
+ *  and the objective function is changed if objective coefficients are given. All changes are made to the original
+ *  problem of the sub-SCIP, which has to be in the problem stage, and are undone by SCIPresetLNSTemplate() or by the
+ *  next application.
+ */
+SCIP_RETCODE SCIPapplyLNSTemplate(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_LNSTEMPLATE*     lnstemplate,        /**< template */
+   SCIP_VAR**            fixedvars,          /**< source variables whose copies should be fixed, or NULL */
+   SCIP_Real*            fixedvals,          /**< array of fixing values, or NULL */
+   int                   nfixedvars,         /**< number of variables to fix */
+   SCIP_Real*            objcoefs,           /**< objective coefficients of the copies in the order of SCIPgetVars(), or
+                                              *   NULL to keep the objective function of the source SCIP */
+   SCIP_Bool             copycuts            /**< should the active cuts of the source SCIP be added as constraints? */
+   )
+{
+   SCIP* subscip;
+   int i;
+
+   assert(sourcescip != NULL);
+   assert(lnstemplate != NULL);
+   assert(nfixedvars == 0 || (fixedvars != NULL && fixedvals != NULL));
+   assert(SCIPisLNSTemplateValid(sourcescip, lnstemplate));
+
+   subscip = lnstemplate->subscip;
+   assert(SCIPgetStage(subscip) == SCIP_STAGE_PROBLEM);
+   assert(lnstemplate->ncutconss == 0);
+
+   /* the global bounds of the source SCIP may have been tightened since the last neighborhood */
+   for( i = 0; i < lnstemplate->nvars; ++i )
+   {
+      if( lnstemplate->subvars[i] == NULL )
+         continue;
+
+      SCIP_CALL( setSubvarBounds(subscip, lnstemplate->subvars[i], SCIPvarGetLbGlobal(lnstemplate->vars[i]),
+            SCIPvarGetUbGlobal(lnstemplate->vars[i])) );
+   }
+
+   for( i = 0; i < nfixedvars; ++i )
+   {
+      int probindex;
+
+      probindex = SCIPvarGetProbindex(fixedvars[i]);
+      assert(0 <= probindex && probindex < lnstemplate->nvars);
+      assert(lnstemplate->vars[probindex] == fixedvars[i]);
+
+      if( lnstemplate->subvars[probindex] == NULL )
+         continue;
+
+      SCIP_CALL( setSubvarBounds(subscip, lnstemplate->subvars[probindex], fixedvals[i], fixedvals[i]) );
+   }
+
+   if( objcoefs != NULL )
+   {
+      for( i = 0; i < lnstemplate->nvars; ++i )
+      {
+         if( lnstemplate->subvars[i] != NULL && objcoefs[i] != SCIPvarGetObj(lnstemplate->subvars[i]) ) /*lint !e777*/
+         {
+            SCIP_CALL( SCIPchgVarObj(subscip, lnstemplate->subvars[i], objcoefs[i]) );
+         }
+      }
+      lnstemplate->objchanged = TRUE;
+   }
+
+   if( copycuts )
+   {
+      SCIP_CONS** conss;
+      int nconss;
+
+      nconss = SCIPgetNConss(subscip);
+
+      SCIP_CALL( SCIPcopyCuts(sourcescip, subscip, lnstemplate->varmap, NULL, TRUE, NULL) );
+
+      /* remember the new constraints to remove them for the next neighborhood */
+      conss = SCIPgetConss(subscip);
+      lnstemplate->ncutconss = SCIPgetNConss(subscip) - nconss;
+
+      if( lnstemplate->ncutconss > lnstemplate->cutconsssize )
+      {
+         int newsize;
+
+         newsize = SCIPcalcMemGrowSize(sourcescip, lnstemplate->ncutconss);
+         SCIP_CALL( SCIPreallocBlockMemoryArray(sourcescip, &lnstemplate->cutconss, lnstemplate->cutconsssize, newsize) );
+         lnstemplate->cutconsssize = newsize;
+      }
+
+      for( i = 0; i < lnstemplate->ncutconss; ++i )
+      {
+         lnstemplate->cutconss[i] = conss[nconss + i];
+         SCIP_CALL( SCIPcaptureCons(subscip, lnstemplate->cutconss[i]) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** frees the transformed problem of the sub-SCIP of the template and removes the constraints and the objective
+ *  function of the last neighborhood
+ */
+SCIP_RETCODE SCIPresetLNSTemplate(
+   SCIP_LNSTEMPLATE*     lnstemplate         /**< template */
+   )
+{
+   SCIP* subscip;
+   int i;
+
+   assert(lnstemplate != NULL);
+
+   subscip = lnstemplate->subscip;
+
+   SCIP_CALL( SCIPfreeTransform(subscip) );
+
+   for( i = 0; i < lnstemplate->ncutconss; ++i )
+   {
+      SCIP_CALL( SCIPdelCons(subscip, lnstemplate->cutconss[i]) );
+      SCIP_CALL( SCIPreleaseCons(subscip, &lnstemplate->cutconss[i]) );
+   }
+   lnstemplate->ncutconss = 0;
+
+   if( lnstemplate->objchanged )
+   {
+      for( i = 0; i < lnstemplate->nvars; ++i )
+      {
+         if( lnstemplate->subvars[i] != NULL && lnstemplate->subobjs[i] != SCIPvarGetObj(lnstemplate->subvars[i]) ) /*lint !e777*/
+         {
+            SCIP_CALL( SCIPchgVarObj(subscip, lnstemplate->subvars[i], lnstemplate->subobjs[i]) );
+         }
+      }
+      lnstemplate->objchanged = FALSE;
+   }
+
+   return SCIP_OKAY;
+}
@@ -120,6 +120,78 @@ SCIP_RETCODE SCIPaddTrustregionNeighborhoodConstraint(
    SCIP_Real             violpenalty         /**< the penalty for violating the trust region */
    );
 
+/** creates a template for the sub-SCIPs of a large neighborhood search heuristic
+ *
+ *  The template holds a global copy of the transformed problem without fixings, which is reused by every call of the
+ *  heuristic: SCIPapplyLNSTemplate() applies the neighborhood of the call to the original problem of the sub-SCIP and
+ *  SCIPresetLNSTemplate() frees the transformed problem of the sub-SCIP after the solve. The parameters and plugins of
+ *  the sub-SCIP are kept, such that the heuristic sets them up only once after the creation of the template.
+ *
+ *  The template belongs to the transformed problem of the source SCIP and has to be freed before the solving process
+ *  data is freed, e.g., in the exitsol callback of the heuristic.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcreateLNSTemplate(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_LNSTEMPLATE**    lnstemplate,        /**< pointer to store the template */
+   const char*           suffix,             /**< suffix for the problem name */
+   SCIP_Bool             uselprows,          /**< should the linear relaxation of the problem defined by LP rows be copied? */
+   SCIP_Bool*            success             /**< pointer to store whether the template was created */
+   );
+
+/** frees a template for the sub-SCIPs of a large neighborhood search heuristic */
+SCIP_EXPORT
+SCIP_RETCODE SCIPfreeLNSTemplate(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_LNSTEMPLATE**    lnstemplate         /**< pointer to the template */
+   );
+
+/** returns whether the template still matches the variables of the source SCIP */
+SCIP_EXPORT
+SCIP_Bool SCIPisLNSTemplateValid(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_LNSTEMPLATE*     lnstemplate         /**< template */
+   );
+
+/** returns the sub-SCIP of the template */
+SCIP_EXPORT
+SCIP* SCIPgetLNSTemplateSubscip(
+   SCIP_LNSTEMPLATE*     lnstemplate         /**< template */
+   );
+
+/** returns the copies of the variables of the source SCIP in the sub-SCIP, in the order of SCIPgetVars() */
+SCIP_EXPORT
+SCIP_VAR** SCIPgetLNSTemplateSubvars(
+   SCIP_LNSTEMPLATE*     lnstemplate         /**< template */
+   );
+
+/** applies a neighborhood to the sub-SCIP of the template
+ *
+ *  The bounds of all variables are set to the current global bounds in the source SCIP, the given variables are fixed,
+ *  and the objective function is changed if objective coefficients are given. All changes are made to the original
+ *  problem of the sub-SCIP, which has to be in the problem stage, and are undone by SCIPresetLNSTemplate() or by the
+ *  next application.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPapplyLNSTemplate(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_LNSTEMPLATE*     lnstemplate,        /**< template */
+   SCIP_VAR**            fixedvars,          /**< source variables whose copies should be fixed, or NULL */
+   SCIP_Real*            fixedvals,          /**< array of fixing values, or NULL */
+   int                   nfixedvars,         /**< number of variables to fix */
+   SCIP_Real*            objcoefs,           /**< objective coefficients of the copies in the order of SCIPgetVars(), or
+                                              *   NULL to keep the objective function of the source SCIP */
+   SCIP_Bool             copycuts            /**< should the active cuts of the source SCIP be added as constraints? */
+   );
+
+/** frees the transformed problem of the sub-SCIP of the template and removes the constraints and the objective
+ *  function of the last neighborhood
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPresetLNSTemplate(
+   SCIP_LNSTEMPLATE*     lnstemplate         /**< template */
+   );
+
 /** @} */
 
 #ifdef __cplusplus
@@ -156,6 +156,76 @@ void SCIPhistoryUnite(
    }
 }
 
+/** stores the values of the history entry in an array of SCIP_HISTORY_NDATA values; for each of the pseudo cost count,
+ *  mean, and variance, the VSIDS, the conflict length sum, the inference sum, the cutoff sum, the number of active
+ *  conflicts, the number of branchings, and the branching depth sum, the value of the downwards direction is followed by
+ *  the value of the upwards direction
+ */
+void SCIPhistoryGetData(
+   SCIP_HISTORY*         history,            /**< branching and inference history */
+   SCIP_Real*            data,               /**< array of size SCIP_HISTORY_NDATA to store the values */
+   SCIP_Bool             switcheddirs        /**< should the directions be switched */
+   )
+{
+   int i;
+
+   assert(history != NULL);
+   assert(data != NULL);
+
+   for( i = 0; i <= 1; ++i )
+   {
+      int d;
+      d = (switcheddirs ? 1 - i : i);
+
+      data[i] = history->pscostcount[d];
+      data[2 + i] = history->pscostweightedmean[d];
+      data[4 + i] = history->pscostvariance[d];
+      data[6 + i] = history->vsids[d];
+      data[8 + i] = history->conflengthsum[d];
+      data[10 + i] = history->inferencesum[d];
+      data[12 + i] = history->cutoffsum[d];
+      data[14 + i] = (SCIP_Real)history->nactiveconflicts[d];
+      data[16 + i] = (SCIP_Real)history->nbranchings[d];
+      data[18 + i] = (SCIP_Real)history->branchdepthsum[d];
+   }
+}
+
+/** adds history values given by an array of SCIP_HISTORY_NDATA values, see SCIPhistoryGetData(), to the history entry */
+void SCIPhistoryAddData(
+   SCIP_HISTORY*         history,            /**< branching and inference history */
+   const SCIP_Real*      data,               /**< array of SCIP_HISTORY_NDATA values to add */
+   SCIP_Bool             switcheddirs        /**< should the history entries be added with switched branching directions */
+   )
+{
+   SCIP_HISTORY addhistory;
+   int i;
+
+   assert(history != NULL);
+   assert(data != NULL);
+
+   BMSclearMemory(&addhistory);
+
+   for( i = 0; i <= 1; ++i )
+   {
+      /* ignore invalid pseudo costs, which would spoil the weighted mean */
+      if( data[i] > 0.0 && data[4 + i] >= 0.0 )
+      {
+         addhistory.pscostcount[i] = data[i];
+         addhistory.pscostweightedmean[i] = data[2 + i];
+         addhistory.pscostvariance[i] = data[4 + i];
+      }
+      addhistory.vsids[i] = MAX(data[6 + i], 0.0);
+      addhistory.conflengthsum[i] = MAX(data[8 + i], 0.0);
+      addhistory.inferencesum[i] = MAX(data[10 + i], 0.0);
+      addhistory.cutoffsum[i] = MAX(data[12 + i], 0.0);
+      addhistory.nactiveconflicts[i] = (SCIP_Longint)MAX(data[14 + i], 0.0);
+      addhistory.nbranchings[i] = (SCIP_Longint)MAX(data[16 + i], 0.0);
+      addhistory.branchdepthsum[i] = (SCIP_Longint)MAX(data[18 + i], 0.0);
+   }
+
+   SCIPhistoryUnite(history, &addhistory, switcheddirs);
+}
+
 /** updates the pseudo costs for a change of "solvaldelta" in the variable's LP solution value and a change of "objdelta"
  *  in the LP's objective value
  */
@@ -64,6 +64,24 @@ void SCIPhistoryUnite(
    SCIP_Bool             switcheddirs        /**< should the history entries be united with switched directories */
    );
 
+/** stores the values of the history entry in an array of SCIP_HISTORY_NDATA values; for each of the pseudo cost count,
+ *  mean, and variance, the VSIDS, the conflict length sum, the inference sum, the cutoff sum, the number of active
+ *  conflicts, the number of branchings, and the branching depth sum, the value of the downwards direction is followed by
+ *  the value of the upwards direction
+ */
+void SCIPhistoryGetData(
+   SCIP_HISTORY*         history,            /**< branching and inference history */
+   SCIP_Real*            data,               /**< array of size SCIP_HISTORY_NDATA to store the values */
+   SCIP_Bool             switcheddirs        /**< should the directions be switched */
+   );
+
+/** adds history values given by an array of SCIP_HISTORY_NDATA values, see SCIPhistoryGetData(), to the history entry */
+void SCIPhistoryAddData(
+   SCIP_HISTORY*         history,            /**< branching and inference history */
+   const SCIP_Real*      data,               /**< array of SCIP_HISTORY_NDATA values to add */
+   SCIP_Bool             switcheddirs        /**< should the history entries be added with switched branching directions */
+   );
+
 /** updates the pseudo costs for a change of "solvaldelta" in the variable's LP solution value and a change of "objdelta"
  *  in the LP's objective value
  */
@@ -1420,6 +1420,10 @@ SCIP_RETCODE cliquelistCreate(
    SCIP_ALLOC( BMSallocBlockMemory(blkmem, cliquelist) );
    (*cliquelist)->cliques[0] = NULL;
    (*cliquelist)->cliques[1] = NULL;
+   (*cliquelist)->ids[0] = NULL;
+   (*cliquelist)->ids[1] = NULL;
+   (*cliquelist)->signature[0] = 0;
+   (*cliquelist)->signature[1] = 0;
    (*cliquelist)->ncliques[0] = 0;
    (*cliquelist)->ncliques[1] = 0;
    (*cliquelist)->size[0] = 0;
@@ -1440,6 +1444,8 @@ void SCIPcliquelistFree(
    {
       BMSfreeBlockMemoryArrayNull(blkmem, &(*cliquelist)->cliques[0], (*cliquelist)->size[0]);
       BMSfreeBlockMemoryArrayNull(blkmem, &(*cliquelist)->cliques[1], (*cliquelist)->size[1]);
+      BMSfreeBlockMemoryArrayNull(blkmem, &(*cliquelist)->ids[0], (*cliquelist)->size[0]);
+      BMSfreeBlockMemoryArrayNull(blkmem, &(*cliquelist)->ids[1], (*cliquelist)->size[1]);
       BMSfreeBlockMemory(blkmem, cliquelist);
    }
 }
@@ -1462,6 +1468,7 @@ SCIP_RETCODE cliquelistEnsureSize(
 
       newsize = SCIPsetCalcMemGrowSize(set, num);
       SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &cliquelist->cliques[value], cliquelist->size[value], newsize) ); /*lint !e866*/
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &cliquelist->ids[value], cliquelist->size[value], newsize) ); /*lint !e866*/
       cliquelist->size[value] = newsize;
    }
    assert(num <= cliquelist->size[value]);
@@ -1469,6 +1476,9 @@ SCIP_RETCODE cliquelistEnsureSize(
    return SCIP_OKAY;
 }
 
+/** returns the bit of a clique id in the signature of a clique list */
+#define cliquelistSignatureBit(id) (((uint64_t)1) << ((id) % 64))
+
 /** adds a clique to the clique list */
 SCIP_RETCODE SCIPcliquelistAdd(
    SCIP_CLIQUELIST**     cliquelist,         /**< pointer to the clique list data structure */
@@ -1495,9 +1505,9 @@ SCIP_RETCODE SCIPcliquelistAdd(
    {
       if( (*cliquelist)->cliques[value] != NULL )
       {
-         for( i = (*cliquelist)->ncliques[value]; i > 0 && (*cliquelist)->cliques[value][i - 1]->id > id; --i ); /*lint !e574 !e722*/
+         for( i = (*cliquelist)->ncliques[value]; i > 0 && (*cliquelist)->ids[value][i - 1] > id; --i ); /*lint !e722*/
          /* do not put the same clique twice in the cliquelist */
-         if( i > 0 && (*cliquelist)->cliques[value][i - 1]->id == id )
+         if( i > 0 && (*cliquelist)->ids[value][i - 1] == id )
             return SCIP_OKAY;
       }
    }
@@ -1507,8 +1517,11 @@ SCIP_RETCODE SCIPcliquelistAdd(
       clique->id, (void*)*cliquelist, value, (*cliquelist)->ncliques[value]);
 
    BMSmoveMemoryArray(&((*cliquelist)->cliques[value][i+1]), &((*cliquelist)->cliques[value][i]), (*cliquelist)->ncliques[value] - i); /*lint !e866*/
+   BMSmoveMemoryArray(&((*cliquelist)->ids[value][i+1]), &((*cliquelist)->ids[value][i]), (*cliquelist)->ncliques[value] - i); /*lint !e866*/
 
    (*cliquelist)->cliques[value][i] = clique;
+   (*cliquelist)->ids[value][i] = id;
+   (*cliquelist)->signature[value] |= cliquelistSignatureBit(id);
    (*cliquelist)->ncliques[value]++;
 
    return SCIP_OKAY;
@@ -1581,8 +1594,15 @@ SCIP_RETCODE SCIPcliquelistDel(
    {
       BMSmoveMemoryArray(&((*cliquelist)->cliques[value][pos]), &((*cliquelist)->cliques[value][pos+1]),
          (*cliquelist)->ncliques[value] - pos); /*lint !e866*/
+      BMSmoveMemoryArray(&((*cliquelist)->ids[value][pos]), &((*cliquelist)->ids[value][pos+1]),
+         (*cliquelist)->ncliques[value] - pos); /*lint !e866*/
    }
 
+   /* other cliques may share the bit of the removed clique, so the signature is recomputed */
+   (*cliquelist)->signature[value] = 0;
+   for( pos = 0; pos < (*cliquelist)->ncliques[value]; ++pos )
+      (*cliquelist)->signature[value] |= cliquelistSignatureBit((*cliquelist)->ids[value][pos]);
+
    /* free cliquelist if it is empty */
    if( (*cliquelist)->ncliques[0] == 0 && (*cliquelist)->ncliques[1] == 0 )
       SCIPcliquelistFree(cliquelist, blkmem);
@@ -1590,8 +1610,54 @@ SCIP_RETCODE SCIPcliquelistDel(
    return SCIP_OKAY;
 }
 
+/** returns the position of the first id in a sorted array of clique ids that is not smaller than the given id, or
+ *  the number of ids if there is no such id; the search gallops from the start position
+ */
+static
+int cliqueidsGallop(
+   unsigned int*         ids,                /**< sorted array of clique ids */
+   int                   nids,               /**< number of clique ids */
+   int                   start,              /**< position to start the search at */
+   unsigned int          id                  /**< clique id to search for */
+   )
+{
+   int left;
+   int right;
+   int step;
+
+   assert(ids != NULL);
+   assert(0 <= start && start <= nids);
+
+   /* find a range [left, right) that contains the position by doubling the step size */
+   left = start;
+   step = 1;
+   while( left + step < nids && ids[left + step] < id )
+   {
+      left += step;
+      step *= 2;
+   }
+   right = MIN(left + step, nids);
+
+   /* binary search in the range */
+   while( left < right )
+   {
+      int middle = left + (right - left) / 2;
+
+      if( ids[middle] < id )
+         left = middle + 1;
+      else
+         right = middle;
+   }
+
+   return left;
+}
+
 /** returns whether the given clique lists have a non-empty intersection, i.e. whether there is a clique that appears
  *  in both lists
+ *
+ *  The signatures of the clique lists detect most pairs of disjoint clique lists without looking at the clique ids. If
+ *  one clique list is much longer than the other one, the ids of the shorter list are searched in the longer list by
+ *  galloping; otherwise, both sorted lists of ids are merged.
  */
 SCIP_Bool SCIPcliquelistsHaveCommonClique(
    SCIP_CLIQUELIST*      cliquelist1,        /**< first clique list data structure */
@@ -1600,73 +1666,71 @@ SCIP_Bool SCIPcliquelistsHaveCommonClique(
    SCIP_Bool             value2              /**< value of second variable */
    )
 {
-   SCIP_CLIQUE** cliques1;
-   SCIP_CLIQUE** cliques2;
-   int ncliques1;
-   int ncliques2;
+   unsigned int* ids1;
+   unsigned int* ids2;
+   int nids1;
+   int nids2;
    int i1;
    int i2;
 
    if( cliquelist1 == NULL || cliquelist2 == NULL )
       return FALSE;
 
-   ncliques1 = cliquelist1->ncliques[value1];
-   cliques1 = cliquelist1->cliques[value1];
-   ncliques2 = cliquelist2->ncliques[value2];
-   cliques2 = cliquelist2->cliques[value2];
+   if( (cliquelist1->signature[value1] & cliquelist2->signature[value2]) == 0 )
+      return FALSE;
 
-   i1 = 0;
-   i2 = 0;
+   nids1 = cliquelist1->ncliques[value1];
+   ids1 = cliquelist1->ids[value1];
+   nids2 = cliquelist2->ncliques[value2];
+   ids2 = cliquelist2->ids[value2];
+   assert(nids1 > 0 && nids2 > 0);
 
-   if( i1 < ncliques1 && i2 < ncliques2 )
+   /* make the longer list the first one */
+   if( nids2 > nids1 )
    {
-      unsigned int cliqueid;
-
-      /* make the bigger clique the first one */
-      if( ncliques2 > ncliques1 )
-      {
-         SCIP_CLIQUE** tmpc;
-         int tmpi;
-
-         tmpc = cliques1;
-         tmpi = ncliques1;
-         cliques1 = cliques2;
-         ncliques1 = ncliques2;
-         cliques2 = tmpc;
-         ncliques2 = tmpi;
-      }
+      unsigned int* tmpids;
+      int tmpn;
 
-      /* check whether both clique lists have a same clique */
-      while( TRUE )  /*lint !e716*/
-      {
-         cliqueid = SCIPcliqueGetId(cliques2[i2]);
+      tmpids = ids1;
+      tmpn = nids1;
+      ids1 = ids2;
+      nids1 = nids2;
+      ids2 = tmpids;
+      nids2 = tmpn;
+   }
 
-         /* if last item in clique1 has a smaller index than the actual clique in clique2, than cause of increasing order
-          * there will be no same item and we can stop */
-         if( SCIPcliqueGetId(cliques1[ncliques1 - 1]) < cliqueid )
-            break;
+   /* the lists cannot intersect if their id ranges are disjoint */
+   if( ids1[nids1 - 1] < ids2[0] || ids2[nids2 - 1] < ids1[0] )
+      return FALSE;
 
-         while( SCIPcliqueGetId(cliques1[i1]) < cliqueid )
-         {
-            ++i1;
-            assert(i1 < ncliques1);
-         }
-         cliqueid = SCIPcliqueGetId(cliques1[i1]);
+   i1 = 0;
+   i2 = 0;
 
-         /* if last item in clique2 has a smaller index than the actual clique in clique1, than cause of increasing order
-          * there will be no same item and we can stop */
-         if( SCIPcliqueGetId(cliques2[ncliques2 - 1]) < cliqueid )
-            break;
+   if( nids1 >= 16 * nids2 )
+   {
+      for( i2 = 0; i2 < nids2; ++i2 )
+      {
+         i1 = cliqueidsGallop(ids1, nids1, i1, ids2[i2]);
 
-         while( SCIPcliqueGetId(cliques2[i2]) < cliqueid )
-         {
-            ++i2;
-            assert(i2 < ncliques2);
-         }
-         if( SCIPcliqueGetId(cliques2[i2]) == cliqueid )
+         if( i1 == nids1 )
+            return FALSE;
+         if( ids1[i1] == ids2[i2] )
             return TRUE;
       }
+
+      return FALSE;
+   }
+
+   while( i1 < nids1 && i2 < nids2 )
+   {
+      if( ids1[i1] < ids2[i2] )
+         ++i1;
+      else if( ids1[i1] > ids2[i2] )
+         ++i2;
+      else
+         return TRUE;
    }
+
    return FALSE;
 }
 
@@ -3480,6 +3544,8 @@ void SCIPcliquelistCheck(
 
          clique = cliques[i];
          assert(clique != NULL);
+         assert(cliquelist->ids[value][i] == clique->id);
+         assert((cliquelist->signature[value] & cliquelistSignatureBit(clique->id)) != 0);
 
          pos = SCIPcliqueSearchVar(clique, var, (SCIP_Bool)value);
          assert(0 <= pos && pos < clique->nvars);
@@ -0,0 +1,386 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   instancepool.c
+ * @ingroup PARALLEL
+ * @brief  methods for pools of reusable SCIP instances
+ *
+ * The pool records the parameters that differ from their default values right after the initialization of an
+ * instance.  When an instance is released, only the parameters that are not on their default value are reset and the
+ * recorded values are set again, which touches a few parameters instead of all of them.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+#include <string.h>
+
+#include "blockmemshell/memory.h"
+#include "scip/instancepool.h"
+#include "scip/pub_message.h"
+#include "scip/pub_paramset.h"
+#include "scip/scip_general.h"
+#include "scip/scip_param.h"
+#include "scip/scipdefplugins.h"
+#include "scip/struct_instancepool.h"
+#include "tpi/tpi.h"
+
+
+/** creates and initializes a new instance of the pool */
+static
+SCIP_RETCODE poolCreateInstance(
+   SCIP_INSTANCEPOOL*    pool,               /**< pool of SCIP instances */
+   SCIP**                scip                /**< pointer to store the created instance */
+   )
+{
+   SCIP_RETCODE retcode;
+
+   assert(pool != NULL);
+   assert(scip != NULL);
+
+   SCIP_CALL( SCIPcreate(scip) );
+
+   if( pool->initscip != NULL )
+      retcode = pool->initscip(*scip, pool->userdata);
+   else
+      retcode = SCIPincludeDefaultPlugins(*scip);
+
+   if( retcode != SCIP_OKAY )
+   {
+      (void) SCIPfree(scip);
+      return retcode;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** records the parameters of an initialized instance that differ from their default values */
+static
+SCIP_RETCODE poolRecordParams(
+   SCIP_INSTANCEPOOL*    pool,               /**< pool of SCIP instances */
+   SCIP*                 scip                /**< initialized instance */
+   )
+{
+   SCIP_PARAM** params;
+   int nparams;
+   int i;
+
+   assert(pool != NULL);
+   assert(pool->params == NULL);
+   assert(scip != NULL);
+
+   params = SCIPgetParams(scip);
+   nparams = SCIPgetNParams(scip);
+
+   pool->nparams = 0;
+   for( i = 0; i < nparams; ++i )
+   {
+      if( !SCIPparamIsDefault(params[i]) )
+         ++pool->nparams;
+   }
+
+   SCIP_ALLOC( BMSallocClearMemoryArray(&pool->params, MAX(pool->nparams, 1)) );
+   pool->nparams = 0;
+
+   for( i = 0; i < nparams; ++i )
+   {
+      SCIP_POOLPARAM* poolparam;
+
+      if( SCIPparamIsDefault(params[i]) )
+         continue;
+
+      poolparam = &pool->params[pool->nparams];
+      SCIP_ALLOC( BMSduplicateMemoryArray(&poolparam->name, SCIPparamGetName(params[i]),
+            strlen(SCIPparamGetName(params[i])) + 1) );
+      poolparam->paramtype = SCIPparamGetType(params[i]);
+
+      switch( poolparam->paramtype )
+      {
+      case SCIP_PARAMTYPE_BOOL:
+         poolparam->longintval = (SCIP_Longint) SCIPparamGetBool(params[i]);
+         break;
+      case SCIP_PARAMTYPE_INT:
+         poolparam->longintval = (SCIP_Longint) SCIPparamGetInt(params[i]);
+         break;
+      case SCIP_PARAMTYPE_LONGINT:
+         poolparam->longintval = SCIPparamGetLongint(params[i]);
+         break;
+      case SCIP_PARAMTYPE_REAL:
+         poolparam->realval = SCIPparamGetReal(params[i]);
+         break;
+      case SCIP_PARAMTYPE_CHAR:
+         SCIP_ALLOC( BMSallocMemoryArray(&poolparam->stringval, 2) );
+         poolparam->stringval[0] = SCIPparamGetChar(params[i]);
+         poolparam->stringval[1] = '\0';
+         break;
+      case SCIP_PARAMTYPE_STRING:
+         SCIP_ALLOC( BMSduplicateMemoryArray(&poolparam->stringval, SCIPparamGetString(params[i]),
+               strlen(SCIPparamGetString(params[i])) + 1) );
+         break;
+      default:
+         SCIPerrorMessage("unknown parameter type %d\n", poolparam->paramtype);
+         return SCIP_INVALIDDATA;
+      }
+
+      ++pool->nparams;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** restores the parameters of an instance to the values right after the initialization */
+static
+SCIP_RETCODE poolRestoreParams(
+   SCIP_INSTANCEPOOL*    pool,               /**< pool of SCIP instances */
+   SCIP*                 scip                /**< instance to restore the parameters of */
+   )
+{
+   SCIP_PARAM** params;
+   int nparams;
+   int i;
+
+   assert(pool != NULL);
+   assert(scip != NULL);
+
+   params = SCIPgetParams(scip);
+   nparams = SCIPgetNParams(scip);
+
+   for( i = 0; i < nparams; ++i )
+   {
+      if( !SCIPparamIsDefault(params[i]) )
+      {
+         SCIP_CALL( SCIPresetParam(scip, SCIPparamGetName(params[i])) );
+      }
+   }
+
+   for( i = 0; i < pool->nparams; ++i )
+   {
+      SCIP_POOLPARAM* poolparam = &pool->params[i];
+
+      switch( poolparam->paramtype )
+      {
+      case SCIP_PARAMTYPE_BOOL:
+         SCIP_CALL( SCIPsetBoolParam(scip, poolparam->name, (SCIP_Bool) poolparam->longintval) );
+         break;
+      case SCIP_PARAMTYPE_INT:
+         SCIP_CALL( SCIPsetIntParam(scip, poolparam->name, (int) poolparam->longintval) );
+         break;
+      case SCIP_PARAMTYPE_LONGINT:
+         SCIP_CALL( SCIPsetLongintParam(scip, poolparam->name, poolparam->longintval) );
+         break;
+      case SCIP_PARAMTYPE_REAL:
+         SCIP_CALL( SCIPsetRealParam(scip, poolparam->name, poolparam->realval) );
+         break;
+      case SCIP_PARAMTYPE_CHAR:
+         SCIP_CALL( SCIPsetCharParam(scip, poolparam->name, poolparam->stringval[0]) );
+         break;
+      case SCIP_PARAMTYPE_STRING:
+         SCIP_CALL( SCIPsetStringParam(scip, poolparam->name, poolparam->stringval) );
+         break;
+      default:
+         SCIPerrorMessage("unknown parameter type %d\n", poolparam->paramtype);
+         return SCIP_INVALIDDATA;
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** creates a pool of SCIP instances
+ *
+ *  Every instance of the pool is created with SCIPcreate() and initialized with @p initscip, or with
+ *  SCIPincludeDefaultPlugins() if @p initscip is NULL.  One instance is created right away to record the parameter
+ *  settings after the initialization.
+ */
+SCIP_RETCODE SCIPinstancepoolCreate(
+   SCIP_INSTANCEPOOL**   pool,               /**< pointer to store the created pool */
+   SCIP_DECL_INSTANCEPOOLINIT((*initscip)),  /**< initialization method of new instances, or NULL */
+   void*                 userdata,           /**< user data passed to the initialization method */
+   int                   maxidle             /**< maximal number of idle instances that are kept by the pool */
+   )
+{
+   SCIP* scip;
+
+   assert(pool != NULL);
+   assert(maxidle >= 0);
+
+   SCIP_ALLOC( BMSallocMemory(pool) );
+
+   (*pool)->initscip = initscip;
+   (*pool)->userdata = userdata;
+   (*pool)->params = NULL;
+   (*pool)->nparams = 0;
+   (*pool)->ncreated = 0;
+   (*pool)->nreused = 0;
+   (*pool)->nidle = 0;
+   (*pool)->maxidle = maxidle;
+   (*pool)->nacquired = 0;
+   SCIP_ALLOC( BMSallocMemoryArray(&(*pool)->idle, MAX(maxidle, 1)) );
+   SCIP_CALL( SCIPtpiInitLock(&(*pool)->lock) );
+
+   /* the first instance records the parameter settings of initialized instances */
+   SCIP_CALL( poolCreateInstance(*pool, &scip) );
+   ++(*pool)->ncreated;
+   SCIP_CALL( poolRecordParams(*pool, scip) );
+
+   if( maxidle > 0 )
+      (*pool)->idle[(*pool)->nidle++] = scip;
+   else
+   {
+      SCIP_CALL( SCIPfree(&scip) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** frees a pool of SCIP instances and all its idle instances; all acquired instances must have been released */
+SCIP_RETCODE SCIPinstancepoolFree(
+   SCIP_INSTANCEPOOL**   pool                /**< pointer to the pool */
+   )
+{
+   int i;
+
+   assert(pool != NULL);
+
+   if( *pool == NULL )
+      return SCIP_OKAY;
+
+   if( (*pool)->nacquired > 0 )
+   {
+      SCIPerrorMessage("cannot free instance pool with %d acquired instances\n", (*pool)->nacquired);
+      return SCIP_INVALIDCALL;
+   }
+
+   for( i = 0; i < (*pool)->nidle; ++i )
+   {
+      SCIP_CALL( SCIPfree(&(*pool)->idle[i]) );
+   }
+
+   for( i = 0; i < (*pool)->nparams; ++i )
+   {
+      BMSfreeMemoryArrayNull(&(*pool)->params[i].stringval);
+      BMSfreeMemoryArray(&(*pool)->params[i].name);
+   }
+   BMSfreeMemoryArrayNull(&(*pool)->params);
+
+   SCIPtpiDestroyLock(&(*pool)->lock);
+   BMSfreeMemoryArray(&(*pool)->idle);
+   BMSfreeMemory(pool);
+
+   return SCIP_OKAY;
+}
+
+/** acquires an instance of the pool in stage \ref SCIP_STAGE_INIT, which is created if no idle instance is available */
+SCIP_RETCODE SCIPinstancepoolAcquire(
+   SCIP_INSTANCEPOOL*    pool,               /**< pool of SCIP instances */
+   SCIP**                scip                /**< pointer to store the acquired instance */
+   )
+{
+   assert(pool != NULL);
+   assert(scip != NULL);
+
+   *scip = NULL;
+
+   SCIP_CALL( SCIPtpiAcquireLock(&pool->lock) );
+   if( pool->nidle > 0 )
+   {
+      *scip = pool->idle[--pool->nidle];
+      ++pool->nreused;
+   }
+   else
+      ++pool->ncreated;
+   ++pool->nacquired;
+   SCIP_CALL( SCIPtpiReleaseLock(&pool->lock) );
+
+   /* create the instance outside of the lock, such that other threads can acquire idle instances meanwhile */
+   if( *scip == NULL )
+   {
+      SCIP_RETCODE retcode;
+
+      retcode = poolCreateInstance(pool, scip);
+
+      if( retcode != SCIP_OKAY )
+      {
+         SCIP_CALL( SCIPtpiAcquireLock(&pool->lock) );
+         --pool->nacquired;
+         SCIP_CALL( SCIPtpiReleaseLock(&pool->lock) );
+
+         return retcode;
+      }
+   }
+
+   assert(SCIPgetStage(*scip) == SCIP_STAGE_INIT);
+
+   return SCIP_OKAY;
+}
+
+/** releases an acquired instance of the pool
+ *
+ *  The instance is reset and kept for the next acquisition, or freed if the pool already keeps the maximal number of
+ *  idle instances.
+ */
+SCIP_RETCODE SCIPinstancepoolRelease(
+   SCIP_INSTANCEPOOL*    pool,               /**< pool of SCIP instances */
+   SCIP**                scip                /**< pointer to the acquired instance, which is set to NULL */
+   )
+{
+   SCIP_RETCODE retcode;
+   SCIP_Bool keep;
+
+   assert(pool != NULL);
+   assert(scip != NULL);
+   assert(*scip != NULL);
+
+   /* reset the instance outside of the lock; an instance that cannot be reset is not reused */
+   retcode = SCIPresetInstance(*scip, FALSE);
+   if( retcode == SCIP_OKAY )
+      retcode = poolRestoreParams(pool, *scip);
+
+   SCIP_CALL( SCIPtpiAcquireLock(&pool->lock) );
+   assert(pool->nacquired > 0);
+   --pool->nacquired;
+   keep = (retcode == SCIP_OKAY && pool->nidle < pool->maxidle);
+   if( keep )
+      pool->idle[pool->nidle++] = *scip;
+   SCIP_CALL( SCIPtpiReleaseLock(&pool->lock) );
+
+   if( !keep )
+   {
+      SCIP_CALL( SCIPfree(scip) );
+   }
+   *scip = NULL;
+
+   return retcode;
+}
+
+/** returns the number of instances that were created by the pool */
+SCIP_Longint SCIPinstancepoolGetNCreated(
+   SCIP_INSTANCEPOOL*    pool                /**< pool of SCIP instances */
+   )
+{
+   assert(pool != NULL);
+
+   return pool->ncreated;
+}
+
+/** returns the number of acquisitions that were served by an idle instance */
+SCIP_Longint SCIPinstancepoolGetNReused(
+   SCIP_INSTANCEPOOL*    pool                /**< pool of SCIP instances */
+   )
+{
+   assert(pool != NULL);
+
+   return pool->nreused;
+}
@@ -0,0 +1,97 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   instancepool.h
+ * @ingroup PARALLEL
+ * @brief  pool of reusable SCIP instances for solving many small problems
+ *
+ * Creating a SCIP instance and including the plugins costs much more than solving a tiny problem.  An instance pool
+ * keeps SCIP instances with included plugins and parameter settings and hands them out one at a time.  A released
+ * instance is reset with SCIPresetInstance() and the parameters are restored to the settings right after the
+ * initialization, such that the next user obtains an instance that behaves like a newly created one.
+ *
+ * The pool can be used from several threads at once if SCIP is compiled with a task processing interface other than
+ * "none"; each instance is used by one thread at a time.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_INSTANCEPOOL_H__
+#define __SCIP_INSTANCEPOOL_H__
+
+#include "scip/def.h"
+#include "scip/type_instancepool.h"
+#include "scip/type_retcode.h"
+#include "scip/type_scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** creates a pool of SCIP instances
+ *
+ *  Every instance of the pool is created with SCIPcreate() and initialized with @p initscip, or with
+ *  SCIPincludeDefaultPlugins() if @p initscip is NULL.  One instance is created right away to record the parameter
+ *  settings after the initialization.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPinstancepoolCreate(
+   SCIP_INSTANCEPOOL**   pool,               /**< pointer to store the created pool */
+   SCIP_DECL_INSTANCEPOOLINIT((*initscip)),  /**< initialization method of new instances, or NULL */
+   void*                 userdata,           /**< user data passed to the initialization method */
+   int                   maxidle             /**< maximal number of idle instances that are kept by the pool */
+   );
+
+/** frees a pool of SCIP instances and all its idle instances; all acquired instances must have been released */
+SCIP_EXPORT
+SCIP_RETCODE SCIPinstancepoolFree(
+   SCIP_INSTANCEPOOL**   pool                /**< pointer to the pool */
+   );
+
+/** acquires an instance of the pool in stage \ref SCIP_STAGE_INIT, which is created if no idle instance is available */
+SCIP_EXPORT
+SCIP_RETCODE SCIPinstancepoolAcquire(
+   SCIP_INSTANCEPOOL*    pool,               /**< pool of SCIP instances */
+   SCIP**                scip                /**< pointer to store the acquired instance */
+   );
+
+/** releases an acquired instance of the pool
+ *
+ *  The instance is reset and kept for the next acquisition, or freed if the pool already keeps the maximal number of
+ *  idle instances.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPinstancepoolRelease(
+   SCIP_INSTANCEPOOL*    pool,               /**< pool of SCIP instances */
+   SCIP**                scip                /**< pointer to the acquired instance, which is set to NULL */
+   );
+
+/** returns the number of instances that were created by the pool */
+SCIP_EXPORT
+SCIP_Longint SCIPinstancepoolGetNCreated(
+   SCIP_INSTANCEPOOL*    pool                /**< pool of SCIP instances */
+   );
+
+/** returns the number of acquisitions that were served by an idle instance */
+SCIP_EXPORT
+SCIP_Longint SCIPinstancepoolGetNReused(
+   SCIP_INSTANCEPOOL*    pool                /**< pool of SCIP instances */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -56,8 +56,18 @@
 #include "scip/struct_stat.h"
 #include "scip/struct_var.h"
 #include "scip/var.h"
+#include "tpi/tpi.h"
 #include <string.h>
 
+/* the SIMD kernels for row activities and scalar products are compiled for x86-64 with GCC-compatible compilers and
+ * selected at runtime depending on the instruction sets supported by the CPU; define DISABLE_SIMD to use only the
+ * scalar code
+ */
+#if !defined(DISABLE_SIMD) && defined(__x86_64__) && (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 6))
+#define SCIP_SIMD_X86
+#include <immintrin.h>
+#endif
+
 
 /* activate this to use the row activities as given by the LPI instead of recalculating
  * using the LP solver activity is potentially faster, but may not be consistent with the SCIP_ROW calculations
@@ -4694,6 +4704,447 @@ SCIP_RETCODE SCIPcolGetStrongbranches(
    return SCIP_OKAY;
 }
 
+/** data of a job that performs strong branching on a copy of the LP solver interface */
+struct SCIP_StrongbranchJob
+{
+   SCIP_LPI*             lpi;                /**< copy of the LP solver interface owned by the job */
+   int*                  lpipos;             /**< LPI positions of the columns to branch on */
+   SCIP_Real*            primsols;           /**< primal solution values of the columns */
+   SCIP_Real*            sbdown;             /**< array to store the dual bounds after branching columns down */
+   SCIP_Real*            sbup;               /**< array to store the dual bounds after branching columns up */
+   SCIP_Bool*            sbdownvalid;        /**< array to store whether the down values are valid dual bounds */
+   SCIP_Bool*            sbupvalid;          /**< array to store whether the up values are valid dual bounds */
+   int                   ncols;              /**< number of columns assigned to the job */
+   int                   firstcol;           /**< position of the first column of the job in the arrays */
+   int                   colstep;            /**< distance between two consecutive columns of the job in the arrays */
+   int                   itlim;              /**< iteration limit for strong branchings */
+   int                   iter;               /**< total number of strong branching iterations, or -1 if unknown */
+   SCIP_Bool             lperror;            /**< did an LP error occur? */
+};
+typedef struct SCIP_StrongbranchJob SCIP_STRONGBRANCHJOB;
+
+/** copies an integer parameter from one LP solver interface to another one; unknown parameters are ignored */
+static
+SCIP_RETCODE lpiCopyIntpar(
+   SCIP_LPI*             sourcelpi,          /**< source LP solver interface */
+   SCIP_LPI*             targetlpi,          /**< target LP solver interface */
+   SCIP_LPPARAM          lpparam             /**< LP parameter */
+   )
+{
+   SCIP_RETCODE retcode;
+   int value;
+
+   retcode = SCIPlpiGetIntpar(sourcelpi, lpparam, &value);
+   if( retcode == SCIP_PARAMETERUNKNOWN )
+      return SCIP_OKAY;
+   SCIP_CALL( retcode );
+
+   retcode = SCIPlpiSetIntpar(targetlpi, lpparam, value);
+   if( retcode == SCIP_PARAMETERUNKNOWN )
+      return SCIP_OKAY;
+
+   return retcode;
+}
+
+/** copies a real parameter from one LP solver interface to another one; unknown parameters are ignored */
+static
+SCIP_RETCODE lpiCopyRealpar(
+   SCIP_LPI*             sourcelpi,          /**< source LP solver interface */
+   SCIP_LPI*             targetlpi,          /**< target LP solver interface */
+   SCIP_LPPARAM          lpparam             /**< LP parameter */
+   )
+{
+   SCIP_RETCODE retcode;
+   SCIP_Real value;
+
+   retcode = SCIPlpiGetRealpar(sourcelpi, lpparam, &value);
+   if( retcode == SCIP_PARAMETERUNKNOWN )
+      return SCIP_OKAY;
+   SCIP_CALL( retcode );
+
+   retcode = SCIPlpiSetRealpar(targetlpi, lpparam, value);
+   if( retcode == SCIP_PARAMETERUNKNOWN )
+      return SCIP_OKAY;
+
+   return retcode;
+}
+
+/** creates a copy of the LP solver interface of the current LP that is warm started with the given LPI state
+ *
+ *  The copy is independent of the LP solver interface of the LP, such that it can be used on another thread.
+ */
+static
+SCIP_RETCODE lpCreateLpiCopy(
+   SCIP_LP*              lp,                 /**< LP data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_LPISTATE*        lpistate,           /**< LPI state to warm start the copy with */
+   SCIP_LPI**            lpicopy             /**< pointer to store the copy of the LP solver interface */
+   )
+{
+   SCIP_OBJSEN objsen;
+   SCIP_Real* obj;
+   SCIP_Real* lb;
+   SCIP_Real* ub;
+   SCIP_Real* lhs;
+   SCIP_Real* rhs;
+   SCIP_Real* val;
+   int* beg;
+   int* ind;
+   int ncols;
+   int nrows;
+   int nnonz;
+
+   assert(lp != NULL);
+   assert(lp->flushed);
+   assert(lpicopy != NULL);
+
+   SCIP_CALL( SCIPlpiGetNCols(lp->lpi, &ncols) );
+   SCIP_CALL( SCIPlpiGetNRows(lp->lpi, &nrows) );
+   SCIP_CALL( SCIPlpiGetNNonz(lp->lpi, &nnonz) );
+   SCIP_CALL( SCIPlpiGetObjsen(lp->lpi, &objsen) );
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &obj, ncols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &lb, ncols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &ub, ncols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &beg, ncols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &ind, nnonz) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &val, nnonz) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &lhs, nrows) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &rhs, nrows) );
+
+   if( ncols > 0 )
+   {
+      SCIP_CALL( SCIPlpiGetObj(lp->lpi, 0, ncols-1, obj) );
+      SCIP_CALL( SCIPlpiGetCols(lp->lpi, 0, ncols-1, lb, ub, &nnonz, beg, ind, val) );
+   }
+   if( nrows > 0 )
+   {
+      SCIP_CALL( SCIPlpiGetSides(lp->lpi, 0, nrows-1, lhs, rhs) );
+   }
+
+   SCIP_CALL( SCIPlpiCreate(lpicopy, messagehdlr, "strongbranching", objsen) );
+   SCIP_CALL( SCIPlpiLoadColLP(*lpicopy, objsen, ncols, obj, lb, ub, NULL, nrows, lhs, rhs, NULL, nnonz, beg, ind, val) );
+
+   /* use the same settings as the LP solver interface of the LP, but do not print and use only a single thread */
+   SCIP_CALL( lpiCopyRealpar(lp->lpi, *lpicopy, SCIP_LPPAR_FEASTOL) );
+   SCIP_CALL( lpiCopyRealpar(lp->lpi, *lpicopy, SCIP_LPPAR_DUALFEASTOL) );
+   SCIP_CALL( lpiCopyRealpar(lp->lpi, *lpicopy, SCIP_LPPAR_OBJLIM) );
+   SCIP_CALL( lpiCopyRealpar(lp->lpi, *lpicopy, SCIP_LPPAR_MARKOWITZ) );
+   SCIP_CALL( lpiCopyRealpar(lp->lpi, *lpicopy, SCIP_LPPAR_CONDITIONLIMIT) );
+   SCIP_CALL( lpiCopyIntpar(lp->lpi, *lpicopy, SCIP_LPPAR_SCALING) );
+   SCIP_CALL( lpiCopyIntpar(lp->lpi, *lpicopy, SCIP_LPPAR_PRESOLVING) );
+   SCIP_CALL( lpiCopyIntpar(lp->lpi, *lpicopy, SCIP_LPPAR_PRICING) );
+   SCIP_CALL( lpiCopyIntpar(lp->lpi, *lpicopy, SCIP_LPPAR_RANDOMSEED) );
+   (void) SCIPlpiSetIntpar(*lpicopy, SCIP_LPPAR_LPINFO, FALSE);
+   (void) SCIPlpiSetIntpar(*lpicopy, SCIP_LPPAR_THREADS, 1);
+
+   SCIP_CALL( SCIPlpiSetState(*lpicopy, blkmem, lpistate) );
+
+   SCIPsetFreeBufferArray(set, &rhs);
+   SCIPsetFreeBufferArray(set, &lhs);
+   SCIPsetFreeBufferArray(set, &val);
+   SCIPsetFreeBufferArray(set, &ind);
+   SCIPsetFreeBufferArray(set, &beg);
+   SCIPsetFreeBufferArray(set, &ub);
+   SCIPsetFreeBufferArray(set, &lb);
+   SCIPsetFreeBufferArray(set, &obj);
+
+   return SCIP_OKAY;
+}
+
+/** performs strong branching on the columns of a job on the job's copy of the LP solver interface */
+static
+SCIP_RETCODE execStrongbranchJob(
+   void*                 args                /**< strong branching job data passed in as a void pointer */
+   )
+{
+   SCIP_STRONGBRANCHJOB* sbjob;
+   SCIP_RETCODE retcode;
+   int j;
+
+   assert(args != NULL);
+
+   sbjob = (SCIP_STRONGBRANCHJOB*) args;
+   sbjob->iter = 0;
+   sbjob->lperror = FALSE;
+
+   /* the copy has been warm started from the optimal basis of the LP, hence resolving should not need iterations */
+   retcode = SCIPlpiSolveDual(sbjob->lpi);
+   if( retcode == SCIP_LPERROR || (retcode == SCIP_OKAY && !SCIPlpiIsOptimal(sbjob->lpi)) )
+   {
+      sbjob->lperror = TRUE;
+      return SCIP_OKAY;
+   }
+   SCIP_CALL( retcode );
+
+   SCIP_CALL( SCIPlpiStartStrongbranch(sbjob->lpi) );
+
+   for( j = sbjob->firstcol; j < sbjob->ncols; j += sbjob->colstep )
+   {
+      int iter;
+
+      retcode = SCIPlpiStrongbranchFrac(sbjob->lpi, sbjob->lpipos[j], sbjob->primsols[j], sbjob->itlim,
+         &sbjob->sbdown[j], &sbjob->sbup[j], &sbjob->sbdownvalid[j], &sbjob->sbupvalid[j], &iter);
+
+      if( retcode == SCIP_LPERROR )
+      {
+         sbjob->lperror = TRUE;
+         break;
+      }
+      SCIP_CALL( retcode );
+
+      if( iter == -1 || sbjob->iter == -1 )
+         sbjob->iter = -1;
+      else
+         sbjob->iter += iter;
+   }
+
+   SCIP_CALL( SCIPlpiEndStrongbranch(sbjob->lpi) );
+
+   return SCIP_OKAY;
+}
+
+/** gets strong branching information on column variables with fractional values by evaluating the columns in parallel
+ *  on copies of the LP solver interface that are warm started from the state of the current LP
+ *
+ *  The columns are distributed statically over the copies, such that the results only depend on the number of threads
+ *  but not on the order in which the jobs are processed. If the task processing interface is not available or only a
+ *  single thread should be used, then SCIPcolGetStrongbranches() is called instead.
+ */
+SCIP_RETCODE SCIPcolGetStrongbranchesParallel(
+   SCIP_COL**            cols,               /**< LP columns */
+   int                   ncols,              /**< number of columns */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   SCIP_PROB*            prob,               /**< problem data */
+   SCIP_LP*              lp,                 /**< LP data */
+   int                   itlim,              /**< iteration limit for strong branchings */
+   int                   nthreads,           /**< maximal number of threads to use */
+   SCIP_Real*            down,               /**< stores dual bounds after branching columns down */
+   SCIP_Real*            up,                 /**< stores dual bounds after branching columns up */
+   SCIP_Bool*            downvalid,          /**< stores whether the returned down values are valid dual bounds, or NULL;
+                                              *   otherwise, they can only be used as an estimate value */
+   SCIP_Bool*            upvalid,            /**< stores whether the returned up values are valid dual bounds, or NULL;
+                                              *   otherwise, they can only be used as an estimate value */
+   SCIP_Bool*            lperror             /**< pointer to store whether an unresolved LP error occurred */
+   )
+{
+   SCIP_STRONGBRANCHJOB* sbjobs;
+   SCIP_LPISTATE* lpistate;
+   SCIP_RETCODE retcode;
+   SCIP_Real* sbdown;
+   SCIP_Real* sbup;
+   SCIP_Bool* sbdownvalid;
+   SCIP_Bool* sbupvalid;
+   SCIP_Real* primsols;
+   SCIP_Real looseobjval;
+   int* lpipos;
+   int njobs;
+   int jobid;
+   int iter;
+   int j;
+
+   assert(cols != NULL);
+   assert(set != NULL);
+   assert(stat != NULL);
+   assert(lp != NULL);
+   assert(lp->flushed);
+   assert(lp->solved);
+   assert(lp->lpsolstat == SCIP_LPSOLSTAT_OPTIMAL);
+   assert(lp->validsollp == stat->lpcount);
+   assert(itlim >= 1);
+   assert(down != NULL);
+   assert(up != NULL);
+   assert(lperror != NULL);
+
+   *lperror = FALSE;
+
+   if( ncols <= 0 )
+      return SCIP_OKAY;
+
+   njobs = MIN(nthreads, ncols);
+
+   /* if a loose variable has an infinite best bound, no gain can be achieved; this is handled by the sequential code */
+   if( njobs <= 1 || !SCIPtpiIsAvailable() || lp->looseobjvalinf > 0 )
+   {
+      SCIP_CALL( SCIPcolGetStrongbranches(cols, ncols, FALSE, set, stat, prob, lp, itlim, down, up, downvalid, upvalid,
+            lperror) );
+      return SCIP_OKAY;
+   }
+
+   /* start timing */
+   SCIPclockStart(stat->strongbranchtime, set);
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &lpipos, ncols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &primsols, ncols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &sbdown, ncols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &sbup, ncols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &sbdownvalid, ncols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &sbupvalid, ncols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &sbjobs, njobs) );
+
+   for( j = 0; j < ncols; ++j )
+   {
+      SCIP_COL* col;
+
+      col = cols[j];
+      assert(col->lppos < lp->ncols);
+      assert(lp->cols[col->lppos] == col);
+      assert(SCIPcolIsIntegral(col));
+      assert(SCIPvarGetStatus(col->var) == SCIP_VARSTATUS_COLUMN);
+      assert(col->primsol < SCIP_INVALID);
+      assert(col->lpipos >= 0);
+      assert(!SCIPsetIsFeasIntegral(set, col->primsol));
+
+      lpipos[j] = col->lpipos;
+      primsols[j] = col->primsol;
+      sbdown[j] = lp->lpobjval;
+      sbup[j] = lp->lpobjval;
+      sbdownvalid[j] = FALSE;
+      sbupvalid[j] = FALSE;
+   }
+
+   SCIPsetDebugMsg(set, "performing strong branching on %d variables with %d iterations in %d parallel jobs\n", ncols,
+      itlim, njobs);
+
+   /* create the copies of the LP solver interface sequentially, since SCIP's memory is not thread-safe */
+   SCIP_CALL( SCIPlpiGetState(lp->lpi, blkmem, &lpistate) );
+
+   for( j = 0; j < njobs; ++j )
+   {
+      SCIP_CALL( lpCreateLpiCopy(lp, set, messagehdlr, blkmem, lpistate, &sbjobs[j].lpi) );
+      sbjobs[j].lpipos = lpipos;
+      sbjobs[j].primsols = primsols;
+      sbjobs[j].sbdown = sbdown;
+      sbjobs[j].sbup = sbup;
+      sbjobs[j].sbdownvalid = sbdownvalid;
+      sbjobs[j].sbupvalid = sbupvalid;
+      sbjobs[j].ncols = ncols;
+      sbjobs[j].firstcol = j;
+      sbjobs[j].colstep = njobs;
+      sbjobs[j].itlim = itlim;
+      sbjobs[j].iter = 0;
+      sbjobs[j].lperror = FALSE;
+   }
+
+   SCIP_CALL( SCIPlpiFreeState(lp->lpi, blkmem, &lpistate) );
+
+   /* submit one job per copy and wait until all of them have been finished */
+   jobid = SCIPtpiGetNewJobID();
+   retcode = SCIP_OKAY;
+
+   for( j = 0; j < njobs && retcode == SCIP_OKAY; ++j )
+   {
+      SCIP_SUBMITSTATUS status;
+      SCIP_JOB* job;
+
+      SCIP_CALL( SCIPtpiCreateJob(&job, jobid, execStrongbranchJob, (void*) &sbjobs[j]) );
+      retcode = SCIPtpiSumbitJob(job, &status);
+
+      if( retcode == SCIP_OKAY && status != SCIP_SUBMIT_SUCCESS )
+         retcode = SCIP_ERROR;
+   }
+
+   retcode = MIN(retcode, SCIPtpiCollectJobs(jobid));
+
+   /* free the copies and merge the results in the order of the columns */
+   iter = 0;
+   for( j = 0; j < njobs; ++j )
+   {
+      SCIP_CALL( SCIPlpiFree(&sbjobs[j].lpi) );
+
+      *lperror = *lperror || sbjobs[j].lperror;
+
+      if( iter == -1 || sbjobs[j].iter == -1 )
+         iter = -1;
+      else
+         iter += sbjobs[j].iter;
+   }
+
+   SCIP_CALL( retcode );
+
+   looseobjval = *lperror ? 0.0 : getFiniteLooseObjval(lp, set, prob);
+
+   for( j = 0; j < ncols; ++j )
+   {
+      SCIP_COL* col;
+
+      col = cols[j];
+
+      if( *lperror )
+      {
+         col->sbdown = SCIP_INVALID;
+         col->sbup = SCIP_INVALID;
+         col->sbdownvalid = FALSE;
+         col->sbupvalid = FALSE;
+         col->validsblp = -1;
+         col->sbsolval = SCIP_INVALID;
+         col->sblpobjval = SCIP_INVALID;
+         col->sbnode = -1;
+      }
+      else
+      {
+         col->sbdown = MIN(sbdown[j] + looseobjval, lp->cutoffbound);
+         col->sbup = MIN(sbup[j] + looseobjval, lp->cutoffbound);
+         col->sbdownvalid = sbdownvalid[j];
+         col->sbupvalid = sbupvalid[j];
+         col->validsblp = stat->nlps;
+         col->sbsolval = col->primsol;
+         col->sblpobjval = SCIPlpGetObjval(lp, set, prob);
+         col->sbnode = stat->nnodes;
+         col->sbitlim = itlim;
+         col->nsbcalls++;
+      }
+
+      down[j] = col->sbdown;
+      up[j] = col->sbup;
+      if( downvalid != NULL )
+         downvalid[j] = col->sbdownvalid;
+      if( upvalid != NULL )
+         upvalid[j] = col->sbupvalid;
+   }
+
+   /* update strong branching statistics */
+   if( !(*lperror) )
+   {
+      if( iter == -1 )
+      {
+         /* calculate average iteration number */
+         iter = stat->ndualresolvelps > 0 ? (int)(2*stat->ndualresolvelpiterations / stat->ndualresolvelps)
+            : stat->nduallps > 0 ? (int)((stat->nduallpiterations / stat->nduallps) / 5)
+            : stat->nprimalresolvelps > 0 ? (int)(2*stat->nprimalresolvelpiterations / stat->nprimalresolvelps)
+            : stat->nprimallps > 0 ? (int)((stat->nprimallpiterations / stat->nprimallps) / 5)
+            : 0;
+         if( iter/2 >= itlim )
+            iter = 2*itlim;
+      }
+      SCIPstatAdd(stat, set, nstrongbranchs, ncols);
+      SCIPstatAdd(stat, set, nsblpiterations, iter);
+      if( stat->nnodes == 1 )
+      {
+         SCIPstatAdd(stat, set, nrootstrongbranchs, ncols);
+         SCIPstatAdd(stat, set, nrootsblpiterations, iter);
+      }
+   }
+
+   SCIPsetFreeBufferArray(set, &sbjobs);
+   SCIPsetFreeBufferArray(set, &sbupvalid);
+   SCIPsetFreeBufferArray(set, &sbdownvalid);
+   SCIPsetFreeBufferArray(set, &sbup);
+   SCIPsetFreeBufferArray(set, &sbdown);
+   SCIPsetFreeBufferArray(set, &primsols);
+   SCIPsetFreeBufferArray(set, &lpipos);
+
+   /* stop timing */
+   SCIPclockStop(stat->strongbranchtime, set);
+
+   return SCIP_OKAY;
+}
+
 /** gets last strong branching information available for a column variable;
  *  returns values of SCIP_INVALID, if strong branching was not yet called on the given column;
  *  keep in mind, that the returned old values may have nothing to do with the current LP solution
@@ -6161,6 +6612,373 @@ void SCIProwForceSort(
    rowMerge(row, set);
 }
 
+/** minimal number of entries for which the SIMD kernels are used */
+#define SIMD_MINLEN 16
+
+/** computes the sum of vals[c] * cols[c]->primsol over the given columns (scalar version) */
+static
+SCIP_Real colsPrimsolProductScalar(
+   SCIP_COL**            cols,               /**< columns */
+   SCIP_Real*            vals,               /**< coefficients of the columns */
+   int                   ncols               /**< number of columns */
+   )
+{
+   SCIP_Real prod;
+   int c;
+
+   prod = 0.0;
+   for( c = 0; c < ncols; ++c )
+   {
+      assert(cols[c] != NULL);
+      assert(cols[c]->primsol < SCIP_INVALID);
+      prod += vals[c] * cols[c]->primsol;
+   }
+
+   return prod;
+}
+
+/** computes the scalar product of two sparse vectors with strictly increasing indices (scalar version)
+ *
+ *  If cols1 is not NULL, an entry of the first vector only contributes if its column is in the LP.
+ */
+static
+SCIP_Real sparseScalarProductScalar(
+   int*                  inds1,              /**< indices of the first vector */
+   SCIP_Real*            vals1,              /**< values of the first vector */
+   SCIP_COL**            cols1,              /**< columns of the first vector, or NULL if all entries count */
+   int                   len1,               /**< length of the first vector */
+   int*                  inds2,              /**< indices of the second vector */
+   SCIP_Real*            vals2,              /**< values of the second vector */
+   int                   len2                /**< length of the second vector */
+   )
+{
+   SCIP_Real prod;
+   int i1;
+   int i2;
+
+   prod = 0.0;
+   i1 = 0;
+   i2 = 0;
+   while( i1 < len1 && i2 < len2 )
+   {
+      if( inds1[i1] < inds2[i2] )
+         ++i1;
+      else if( inds1[i1] > inds2[i2] )
+         ++i2;
+      else
+      {
+         if( cols1 == NULL || cols1[i1]->lppos >= 0 )
+            prod += vals1[i1] * vals2[i2];
+         ++i1;
+         ++i2;
+      }
+   }
+
+   return prod;
+}
+
+#ifdef SCIP_SIMD_X86
+
+/* The primal solution values are gathered directly from the column structs: the addresses of the columns are loaded
+ * as 64 bit integers and used as offsets relative to the first column, so the columns do not have to be copied into
+ * a dense array first.
+ *
+ * The scalar products of two sparse vectors compare blocks of indices of both vectors against all rotations of each
+ * other; since the indices are strictly increasing within each vector, the block with the smaller maximal index can be
+ * skipped afterwards, and a bit mask of the matching lanes yields the positions of the common entries.
+ *
+ * The products are summed up with separate multiplications and additions (no fused multiply-add), only the order of
+ * the summation differs from the scalar code.
+ */
+
+/** computes the sum of vals[c] * cols[c]->primsol over the given columns (AVX2 version) */
+__attribute__((target("avx2")))
+static
+SCIP_Real colsPrimsolProductAVX2(
+   SCIP_COL**            cols,               /**< columns */
+   SCIP_Real*            vals,               /**< coefficients of the columns */
+   int                   ncols               /**< number of columns */
+   )
+{
+   double sums[4];
+   const double* base;
+   __m256i vbase;
+   __m256d sum0;
+   __m256d sum1;
+   int c;
+
+   assert(ncols >= 8);
+
+   base = &cols[0]->primsol;
+   vbase = _mm256_set1_epi64x((long long)(size_t)cols[0]);
+   sum0 = _mm256_setzero_pd();
+   sum1 = _mm256_setzero_pd();
+
+   for( c = 0; c + 8 <= ncols; c += 8 )
+   {
+      __m256i offsets0;
+      __m256i offsets1;
+
+      offsets0 = _mm256_sub_epi64(_mm256_loadu_si256((const __m256i*) &cols[c]), vbase);
+      offsets1 = _mm256_sub_epi64(_mm256_loadu_si256((const __m256i*) &cols[c + 4]), vbase);
+      sum0 = _mm256_add_pd(sum0, _mm256_mul_pd(_mm256_loadu_pd(&vals[c]), _mm256_i64gather_pd(base, offsets0, 1)));
+      sum1 = _mm256_add_pd(sum1, _mm256_mul_pd(_mm256_loadu_pd(&vals[c + 4]), _mm256_i64gather_pd(base, offsets1, 1)));
+   }
+
+   _mm256_storeu_pd(sums, _mm256_add_pd(sum0, sum1));
+
+   return (sums[0] + sums[1]) + (sums[2] + sums[3]) + colsPrimsolProductScalar(&cols[c], &vals[c], ncols - c);
+}
+
+/** computes the sum of vals[c] * cols[c]->primsol over the given columns (AVX-512 version) */
+__attribute__((target("avx512f")))
+static
+SCIP_Real colsPrimsolProductAVX512(
+   SCIP_COL**            cols,               /**< columns */
+   SCIP_Real*            vals,               /**< coefficients of the columns */
+   int                   ncols               /**< number of columns */
+   )
+{
+   double sums[8];
+   const double* base;
+   __m512i vbase;
+   __m512d sum0;
+   __m512d sum1;
+   int c;
+
+   assert(ncols >= 16);
+
+   base = &cols[0]->primsol;
+   vbase = _mm512_set1_epi64((long long)(size_t)cols[0]);
+   sum0 = _mm512_setzero_pd();
+   sum1 = _mm512_setzero_pd();
+
+   for( c = 0; c + 16 <= ncols; c += 16 )
+   {
+      __m512i offsets0;
+      __m512i offsets1;
+
+      offsets0 = _mm512_sub_epi64(_mm512_loadu_si512((const void*) &cols[c]), vbase);
+      offsets1 = _mm512_sub_epi64(_mm512_loadu_si512((const void*) &cols[c + 8]), vbase);
+      sum0 = _mm512_add_pd(sum0, _mm512_mul_pd(_mm512_loadu_pd(&vals[c]), _mm512_i64gather_pd(offsets0, base, 1)));
+      sum1 = _mm512_add_pd(sum1, _mm512_mul_pd(_mm512_loadu_pd(&vals[c + 8]), _mm512_i64gather_pd(offsets1, base, 1)));
+   }
+
+   _mm512_storeu_pd(sums, _mm512_add_pd(sum0, sum1));
+
+   return ((sums[0] + sums[1]) + (sums[2] + sums[3])) + ((sums[4] + sums[5]) + (sums[6] + sums[7]))
+      + colsPrimsolProductScalar(&cols[c], &vals[c], ncols - c);
+}
+
+/** computes the scalar product of two sparse vectors with strictly increasing indices (AVX2 version)
+ *
+ *  If cols1 is not NULL, an entry of the first vector only contributes if its column is in the LP.
+ */
+__attribute__((target("avx2")))
+static
+SCIP_Real sparseScalarProductAVX2(
+   int*                  inds1,              /**< indices of the first vector */
+   SCIP_Real*            vals1,              /**< values of the first vector */
+   SCIP_COL**            cols1,              /**< columns of the first vector, or NULL if all entries count */
+   int                   len1,               /**< length of the first vector */
+   int*                  inds2,              /**< indices of the second vector */
+   SCIP_Real*            vals2,              /**< values of the second vector */
+   int                   len2                /**< length of the second vector */
+   )
+{
+   __m256i rotations[8];
+   SCIP_Real prod;
+   int i1;
+   int i2;
+   int r;
+
+   for( r = 0; r < 8; ++r )
+      rotations[r] = _mm256_and_si256(_mm256_add_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(r)),
+         _mm256_set1_epi32(7));
+
+   prod = 0.0;
+   i1 = 0;
+   i2 = 0;
+   while( i1 + 8 <= len1 && i2 + 8 <= len2 )
+   {
+      int max1 = inds1[i1 + 7];
+      int max2 = inds2[i2 + 7];
+
+      /* compare the blocks only if their index ranges overlap */
+      if( max1 >= inds2[i2] && max2 >= inds1[i1] )
+      {
+         __m256i block1;
+         __m256i block2;
+
+         block1 = _mm256_loadu_si256((const __m256i*) &inds1[i1]);
+         block2 = _mm256_loadu_si256((const __m256i*) &inds2[i2]);
+
+         for( r = 0; r < 8; ++r )
+         {
+            __m256i rotated;
+            unsigned int mask;
+
+            rotated = _mm256_permutevar8x32_epi32(block2, rotations[r]);
+            mask = (unsigned int) _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block1, rotated)));
+
+            /* lane k of the first block matches entry (k + r) mod 8 of the second block */
+            while( mask != 0 )
+            {
+               int k = __builtin_ctz(mask);
+
+               if( cols1 == NULL || cols1[i1 + k]->lppos >= 0 )
+                  prod += vals1[i1 + k] * vals2[i2 + ((k + r) & 7)];
+               mask &= mask - 1;
+            }
+         }
+      }
+
+      if( max1 <= max2 )
+         i1 += 8;
+      if( max2 <= max1 )
+         i2 += 8;
+   }
+
+   return prod + sparseScalarProductScalar(&inds1[i1], &vals1[i1], cols1 == NULL ? NULL : &cols1[i1], len1 - i1,
+      &inds2[i2], &vals2[i2], len2 - i2);
+}
+
+/** computes the scalar product of two sparse vectors with strictly increasing indices (AVX-512 version)
+ *
+ *  If cols1 is not NULL, an entry of the first vector only contributes if its column is in the LP.
+ */
+__attribute__((target("avx512f")))
+static
+SCIP_Real sparseScalarProductAVX512(
+   int*                  inds1,              /**< indices of the first vector */
+   SCIP_Real*            vals1,              /**< values of the first vector */
+   SCIP_COL**            cols1,              /**< columns of the first vector, or NULL if all entries count */
+   int                   len1,               /**< length of the first vector */
+   int*                  inds2,              /**< indices of the second vector */
+   SCIP_Real*            vals2,              /**< values of the second vector */
+   int                   len2                /**< length of the second vector */
+   )
+{
+   __m512i rotations[16];
+   SCIP_Real prod;
+   int i1;
+   int i2;
+   int r;
+
+   for( r = 0; r < 16; ++r )
+      rotations[r] = _mm512_and_si512(_mm512_add_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+               14, 15), _mm512_set1_epi32(r)), _mm512_set1_epi32(15));
+
+   prod = 0.0;
+   i1 = 0;
+   i2 = 0;
+   while( i1 + 16 <= len1 && i2 + 16 <= len2 )
+   {
+      int max1 = inds1[i1 + 15];
+      int max2 = inds2[i2 + 15];
+
+      /* compare the blocks only if their index ranges overlap */
+      if( max1 >= inds2[i2] && max2 >= inds1[i1] )
+      {
+         __m512i block1;
+         __m512i block2;
+
+         block1 = _mm512_loadu_si512((const void*) &inds1[i1]);
+         block2 = _mm512_loadu_si512((const void*) &inds2[i2]);
+
+         for( r = 0; r < 16; ++r )
+         {
+            unsigned int mask;
+
+            mask = (unsigned int) _mm512_cmpeq_epi32_mask(block1, _mm512_permutexvar_epi32(rotations[r], block2));
+
+            /* lane k of the first block matches entry (k + r) mod 16 of the second block */
+            while( mask != 0 )
+            {
+               int k = __builtin_ctz(mask);
+
+               if( cols1 == NULL || cols1[i1 + k]->lppos >= 0 )
+                  prod += vals1[i1 + k] * vals2[i2 + ((k + r) & 15)];
+               mask &= mask - 1;
+            }
+         }
+      }
+
+      if( max1 <= max2 )
+         i1 += 16;
+      if( max2 <= max1 )
+         i2 += 16;
+   }
+
+   return prod + sparseScalarProductScalar(&inds1[i1], &vals1[i1], cols1 == NULL ? NULL : &cols1[i1], len1 - i1,
+      &inds2[i2], &vals2[i2], len2 - i2);
+}
+
+#endif
+
+/** computes the sum of vals[c] * cols[c]->primsol over the given columns, using SIMD instructions if available */
+static
+SCIP_Real colsPrimsolProduct(
+   SCIP_COL**            cols,               /**< columns */
+   SCIP_Real*            vals,               /**< coefficients of the columns */
+   int                   ncols               /**< number of columns */
+   )
+{
+#ifdef SCIP_SIMD_X86
+   if( ncols >= SIMD_MINLEN )
+   {
+#ifndef NDEBUG
+      int c;
+
+      for( c = 0; c < ncols; ++c )
+      {
+         assert(cols[c] != NULL);
+         assert(cols[c]->primsol < SCIP_INVALID);
+      }
+#endif
+
+      if( __builtin_cpu_supports("avx512f") )
+         return colsPrimsolProductAVX512(cols, vals, ncols);
+      if( __builtin_cpu_supports("avx2") )
+         return colsPrimsolProductAVX2(cols, vals, ncols);
+   }
+#endif
+
+   return colsPrimsolProductScalar(cols, vals, ncols);
+}
+
+/** computes the scalar product of two sparse vectors with strictly increasing indices, using SIMD instructions if
+ *  available
+ *
+ *  If cols1 is not NULL, an entry of the first vector only contributes if its column is in the LP.
+ */
+static
+SCIP_Real sparseScalarProduct(
+   int*                  inds1,              /**< indices of the first vector */
+   SCIP_Real*            vals1,              /**< values of the first vector */
+   SCIP_COL**            cols1,              /**< columns of the first vector, or NULL if all entries count */
+   int                   len1,               /**< length of the first vector */
+   int*                  inds2,              /**< indices of the second vector */
+   SCIP_Real*            vals2,              /**< values of the second vector */
+   int                   len2                /**< length of the second vector */
+   )
+{
+   assert(len1 == 0 || inds1 != NULL);
+   assert(len2 == 0 || inds2 != NULL);
+
+#ifdef SCIP_SIMD_X86
+   if( len1 >= SIMD_MINLEN && len2 >= SIMD_MINLEN )
+   {
+      if( __builtin_cpu_supports("avx512f") )
+         return sparseScalarProductAVX512(inds1, vals1, cols1, len1, inds2, vals2, len2);
+      if( __builtin_cpu_supports("avx2") )
+         return sparseScalarProductAVX2(inds1, vals1, cols1, len1, inds2, vals2, len2);
+   }
+#endif
+
+   return sparseScalarProductScalar(inds1, vals1, cols1, len1, inds2, vals2, len2);
+}
+
 /** recalculates the current activity of a row */
 void SCIProwRecalcLPActivity(
    SCIP_ROW*             row,                /**< LP row */
@@ -6173,16 +6991,17 @@ void SCIProwRecalcLPActivity(
    assert(row != NULL);
    assert(stat != NULL);
 
-   row->activity = row->constant;
+#ifndef NDEBUG
    for( c = 0; c < row->nlpcols; ++c )
    {
       col = row->cols[c];
       assert(col != NULL);
-      assert(col->primsol < SCIP_INVALID);
       assert(col->lppos >= 0);
       assert(row->linkpos[c] >= 0);
-      row->activity += row->vals[c] * col->primsol;
    }
+#endif
+
+   row->activity = row->constant + colsPrimsolProduct(row->cols, row->vals, row->nlpcols);
 
    if( row->nunlinked > 0 )
    {
@@ -7106,27 +7925,11 @@ SCIP_Real SCIProwGetScalarProduct(
       /* set the iterators to the last column we want to regard in the row: nunlinked is either 0 or row->len,
        * therefore, we get nlpcols if nunlinked is 0 and row->len if the row is completely unlinked
        */
-      i1 = MAX(row1->nlpcols, row1->nunlinked) - 1;
-      i2 = MAX(row2->nlpcols, row2->nunlinked) - 1;
-      scalarprod = 0.0;
+      i1 = MAX(row1->nlpcols, row1->nunlinked);
+      i2 = MAX(row2->nlpcols, row2->nunlinked);
 
       /* calculate the scalar product */
-      while( i1 >= 0 && i2 >= 0 )
-      {
-         assert(row1->cols[i1]->index == row1colsidx[i1]);
-         assert(row2->cols[i2]->index == row2colsidx[i2]);
-         assert((row1->cols[i1] == row2->cols[i2]) == (row1colsidx[i1] == row2colsidx[i2]));
-         if( row1colsidx[i1] < row2colsidx[i2] )
-            --i2;
-         else if( row1colsidx[i1] > row2colsidx[i2] )
-            --i1;
-         else
-         {
-            scalarprod += row1->vals[i1] * row2->vals[i2];
-            --i1;
-            --i2;
-         }
-      }
+      scalarprod = sparseScalarProduct(row1colsidx, row1->vals, NULL, i1, row2colsidx, row2->vals, i2);
    }
    /* the "harder" cases 3) - 5): start with four partitions and reduce their number iteratively */
    else
@@ -7327,25 +8130,13 @@ SCIP_Real SCIProwGetScalarProduct(
             end2 = row2->nlpcols;
          }
 
-         /* handle the case of two partitions (standard case 5, or case 1 or 2 due to partition reduction) */
-         while( i1 < end1 && i2 < end2 )
+         /* handle the case of two partitions (standard case 5, or case 1 or 2 due to partition reduction);
+          * unless the remaining section of row 1 consists of LP columns, only its LP columns are regarded
+          */
+         if( i1 < end1 && i2 < end2 )
          {
-            assert(row1->cols[i1]->index == row1colsidx[i1]);
-            assert(row2->cols[i2]->index == row2colsidx[i2]);
-            assert((row1->cols[i1] == row2->cols[i2]) == (row1colsidx[i1] == row2colsidx[i2]));
-
-            /* linked or unlinked LP column of row1 is the same as linked or unlinked LP column of row2 */
-            if( row1colsidx[i1] == row2colsidx[i2] && (lpcols || row1->cols[i1]->lppos >= 0) )
-            {
-               scalarprod += row1->vals[i1] * row2->vals[i2];
-               ++i1;
-               ++i2;
-            }
-            /* increase smallest counter */
-            else if( row1colsidx[i1] < row2colsidx[i2] )
-               ++i1;
-            else
-               ++i2;
+            scalarprod += sparseScalarProduct(&row1colsidx[i1], &row1->vals[i1], lpcols ? NULL : &row1->cols[i1],
+               end1 - i1, &row2colsidx[i2], &row2->vals[i2], end2 - i2);
          }
       }
    }
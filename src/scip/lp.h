@@ -264,6 +264,33 @@ SCIP_RETCODE SCIPcolGetStrongbranches(
    SCIP_Bool*            lperror             /**< pointer to store whether an unresolved LP error occurred */
    );
 
+/** gets strong branching information on column variables with fractional values by evaluating the columns in parallel
+ *  on copies of the LP solver interface that are warm started from the state of the current LP
+ *
+ *  The columns are distributed statically over the copies, such that the results only depend on the number of threads
+ *  but not on the order in which the jobs are processed. If the task processing interface is not available or only a
+ *  single thread should be used, then SCIPcolGetStrongbranches() is called instead.
+ */
+SCIP_RETCODE SCIPcolGetStrongbranchesParallel(
+   SCIP_COL**            cols,               /**< LP columns */
+   int                   ncols,              /**< number of columns */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   SCIP_PROB*            prob,               /**< problem data */
+   SCIP_LP*              lp,                 /**< LP data */
+   int                   itlim,              /**< iteration limit for strong branchings */
+   int                   nthreads,           /**< maximal number of threads to use */
+   SCIP_Real*            down,               /**< stores dual bounds after branching columns down */
+   SCIP_Real*            up,                 /**< stores dual bounds after branching columns up */
+   SCIP_Bool*            downvalid,          /**< stores whether the returned down values are valid dual bounds, or NULL;
+                                              *   otherwise, they can only be used as an estimate value */
+   SCIP_Bool*            upvalid,            /**< stores whether the returned up values are valid dual bounds, or NULL;
+                                              *   otherwise, they can only be used as an estimate value */
+   SCIP_Bool*            lperror             /**< pointer to store whether an unresolved LP error occurred */
+   );
+
 /** gets last strong branching information available for a column variable;
  *  returns values of SCIP_INVALID, if strong branching was not yet called on the given column;
  *  keep in mind, that the returned old values may have nothing to do with the current LP solution
@@ -44,6 +44,14 @@
 #include "scip/struct_misc.h"
 #endif
 
+/* the XOR of dense rows of matrices over GF(2) is compiled for x86-64 with GCC-compatible compilers and uses AVX2
+ * instructions if the CPU supports them; define DISABLE_SIMD to use only the scalar code
+ */
+#if !defined(DISABLE_SIMD) && defined(__x86_64__) && (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 6))
+#define SCIP_SIMD_X86
+#include <immintrin.h>
+#endif
+
 /*
  * methods for statistical tests
  */
@@ -11261,6 +11269,761 @@ int SCIPdisjointsetGetSize(
    return djset->size;
 }
 
+/*
+ * matrix over GF(2)
+ */
+
+#define GF2_WORDBITS        64  /**< number of bits of a word */
+#define GF2_SIMDMINWORDS    8   /**< minimal number of words for which the XOR uses SIMD instructions */
+
+/** returns the number of ones in a word */
+static
+int gf2WordPopcount(
+   uint64_t              word                /**< word */
+   )
+{
+#if defined(__GNUC__) || defined(__clang__)
+   return __builtin_popcountll(word);
+#else
+   int count = 0;
+
+   while( word != 0 )
+   {
+      word &= word - 1;
+      ++count;
+   }
+
+   return count;
+#endif
+}
+
+/** returns the position of the lowest one in a nonzero word */
+static
+int gf2WordLowestBit(
+   uint64_t              word                /**< nonzero word */
+   )
+{
+   assert(word != 0);
+
+#if defined(__GNUC__) || defined(__clang__)
+   return __builtin_ctzll(word);
+#else
+   {
+      int pos = 0;
+
+      while( (word & 1) == 0 )
+      {
+         word >>= 1;
+         ++pos;
+      }
+
+      return pos;
+   }
+#endif
+}
+
+/** XORs the source words into the target words (scalar version) */
+static
+void gf2XorWordsScalar(
+   uint64_t*             target,             /**< target words */
+   const uint64_t*       source,             /**< source words */
+   int                   nwords              /**< number of words */
+   )
+{
+   int i;
+
+   for( i = 0; i < nwords; ++i )
+      target[i] ^= source[i];
+}
+
+#ifdef SCIP_SIMD_X86
+/** XORs the source words into the target words (AVX2 version) */
+__attribute__((target("avx2")))
+static
+void gf2XorWordsAVX2(
+   uint64_t*             target,             /**< target words */
+   const uint64_t*       source,             /**< source words */
+   int                   nwords              /**< number of words */
+   )
+{
+   int i;
+
+   for( i = 0; i + 4 <= nwords; i += 4 )
+   {
+      __m256i t = _mm256_loadu_si256((const __m256i*) (target + i));
+      __m256i s = _mm256_loadu_si256((const __m256i*) (source + i));
+
+      _mm256_storeu_si256((__m256i*) (target + i), _mm256_xor_si256(t, s));
+   }
+
+   for( ; i < nwords; ++i )
+      target[i] ^= source[i];
+}
+#endif
+
+/** XORs the source words into the target words, using SIMD instructions if available */
+static
+void gf2XorWords(
+   uint64_t*             target,             /**< target words */
+   const uint64_t*       source,             /**< source words */
+   int                   nwords              /**< number of words */
+   )
+{
+#ifdef SCIP_SIMD_X86
+   if( nwords >= GF2_SIMDMINWORDS && __builtin_cpu_supports("avx2") )
+   {
+      gf2XorWordsAVX2(target, source, nwords);
+      return;
+   }
+#endif
+
+   gf2XorWordsScalar(target, source, nwords);
+}
+
+/** shrinks the range of possibly nonzero words of a dense row to its first and last nonzero word */
+static
+void gf2rowTrimWords(
+   SCIP_GF2ROW*          gf2row              /**< dense row */
+   )
+{
+   assert(gf2row->words != NULL);
+
+   while( gf2row->firstword < gf2row->lastword && gf2row->words[gf2row->firstword] == 0 )
+      ++gf2row->firstword;
+
+   while( gf2row->lastword > gf2row->firstword && gf2row->words[gf2row->lastword - 1] == 0 )
+      --gf2row->lastword;
+
+   if( gf2row->firstword == gf2row->lastword )
+   {
+      gf2row->firstword = 0;
+      gf2row->lastword = 0;
+   }
+}
+
+/** extends the range of possibly nonzero words of a dense row by the given range */
+static
+void gf2rowExtendWords(
+   SCIP_GF2ROW*          gf2row,             /**< dense row */
+   int                   firstword,          /**< first word of the range */
+   int                   lastword            /**< last word of the range, plus one */
+   )
+{
+   assert(gf2row->words != NULL);
+   assert(firstword < lastword);
+
+   if( gf2row->firstword == gf2row->lastword )
+   {
+      gf2row->firstword = firstword;
+      gf2row->lastword = lastword;
+   }
+   else
+   {
+      gf2row->firstword = MIN(gf2row->firstword, firstword);
+      gf2row->lastword = MAX(gf2row->lastword, lastword);
+   }
+}
+
+/** stores the nonzeros given by sorted column indices in a row as a bitset */
+static
+SCIP_RETCODE gf2rowSetDense(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   SCIP_GF2ROW*          gf2row,             /**< row */
+   int*                  inds,               /**< sorted column indices of the nonzeros */
+   int                   ninds               /**< number of nonzeros */
+   )
+{
+   int i;
+
+   if( gf2row->words == NULL )
+   {
+      SCIP_ALLOC( BMSallocClearBlockMemoryArray(gf2matrix->blkmem, &gf2row->words, gf2matrix->nwords) );
+   }
+   else
+   {
+      BMSclearMemoryArray(gf2row->words + gf2row->firstword, gf2row->lastword - gf2row->firstword);
+   }
+
+   for( i = 0; i < ninds; ++i )
+      gf2row->words[inds[i] / GF2_WORDBITS] |= (uint64_t)1 << (inds[i] % GF2_WORDBITS);
+
+   gf2row->nnonzs = ninds;
+   gf2row->firstword = 0;
+   gf2row->lastword = 0;
+
+   if( ninds > 0 )
+   {
+      gf2row->firstword = inds[0] / GF2_WORDBITS;
+      gf2row->lastword = inds[ninds - 1] / GF2_WORDBITS + 1;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** switches a sparse row to the dense representation */
+static
+SCIP_RETCODE gf2rowMakeDense(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   SCIP_GF2ROW*          gf2row              /**< sparse row */
+   )
+{
+   assert(gf2row->words == NULL);
+
+   SCIP_CALL( gf2rowSetDense(gf2matrix, gf2row, gf2row->inds, gf2row->nnonzs) );
+
+   BMSfreeBlockMemoryArrayNull(gf2matrix->blkmem, &gf2row->inds, gf2row->indssize);
+   gf2row->indssize = 0;
+
+   return SCIP_OKAY;
+}
+
+/** returns the column of the first nonzero of a row, or the number of columns if the row is zero */
+static
+int gf2rowGetFirstCol(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   SCIP_GF2ROW*          gf2row              /**< row */
+   )
+{
+   if( gf2row->nnonzs == 0 )
+      return gf2matrix->ncols;
+
+   if( gf2row->words == NULL )
+      return gf2row->inds[0];
+
+   assert(gf2row->words[gf2row->firstword] != 0);
+
+   return gf2row->firstword * GF2_WORDBITS + gf2WordLowestBit(gf2row->words[gf2row->firstword]);
+}
+
+/** creates a matrix over GF(2) with all entries and right hand sides zero */
+SCIP_RETCODE SCIPgf2matrixCreate(
+   SCIP_GF2MATRIX**      gf2matrix,          /**< pointer to store the matrix */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   int                   nrows,              /**< number of rows */
+   int                   ncols               /**< number of columns */
+   )
+{
+   assert(gf2matrix != NULL);
+   assert(blkmem != NULL);
+   assert(nrows >= 0);
+   assert(ncols >= 0);
+
+   SCIP_ALLOC( BMSallocBlockMemory(blkmem, gf2matrix) );
+   SCIP_ALLOC( BMSallocClearBlockMemoryArray(blkmem, &(*gf2matrix)->rows, nrows) );
+
+   (*gf2matrix)->blkmem = blkmem;
+   (*gf2matrix)->buffer = NULL;
+   (*gf2matrix)->nrows = nrows;
+   (*gf2matrix)->ncols = ncols;
+   (*gf2matrix)->nwords = (ncols + GF2_WORDBITS - 1) / GF2_WORDBITS;
+
+   /* a sparse row takes more memory than a dense row if it has more than twice as many nonzeros as a bitset has words */
+   (*gf2matrix)->densennonzs = 2 * (*gf2matrix)->nwords;
+
+   return SCIP_OKAY;
+}
+
+/** frees a matrix over GF(2) */
+void SCIPgf2matrixFree(
+   SCIP_GF2MATRIX**      gf2matrix           /**< pointer to the matrix */
+   )
+{
+   int i;
+
+   assert(gf2matrix != NULL);
+   assert(*gf2matrix != NULL);
+
+   for( i = 0; i < (*gf2matrix)->nrows; ++i )
+      SCIPgf2matrixClearRow(*gf2matrix, i);
+
+   BMSfreeBlockMemoryArrayNull((*gf2matrix)->blkmem, &(*gf2matrix)->buffer, (*gf2matrix)->ncols);
+   BMSfreeBlockMemoryArrayNull((*gf2matrix)->blkmem, &(*gf2matrix)->rows, (*gf2matrix)->nrows);
+   BMSfreeBlockMemory((*gf2matrix)->blkmem, gf2matrix);
+}
+
+/** returns the number of rows of a matrix over GF(2) */
+int SCIPgf2matrixGetNRows(
+   SCIP_GF2MATRIX*       gf2matrix           /**< matrix over GF(2) */
+   )
+{
+   assert(gf2matrix != NULL);
+
+   return gf2matrix->nrows;
+}
+
+/** returns the number of columns of a matrix over GF(2) */
+int SCIPgf2matrixGetNCols(
+   SCIP_GF2MATRIX*       gf2matrix           /**< matrix over GF(2) */
+   )
+{
+   assert(gf2matrix != NULL);
+
+   return gf2matrix->ncols;
+}
+
+/** adds one to an entry of a matrix over GF(2), i.e., flips the entry */
+SCIP_RETCODE SCIPgf2matrixFlipEntry(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   int                   row,                /**< row index */
+   int                   col                 /**< column index */
+   )
+{
+   SCIP_GF2ROW* gf2row;
+
+   assert(gf2matrix != NULL);
+   assert(0 <= row && row < gf2matrix->nrows);
+   assert(0 <= col && col < gf2matrix->ncols);
+
+   gf2row = &gf2matrix->rows[row];
+
+   if( gf2row->words == NULL )
+   {
+      int pos;
+
+      if( SCIPsortedvecFindInt(gf2row->inds, col, gf2row->nnonzs, &pos) )
+      {
+         --gf2row->nnonzs;
+         BMSmoveMemoryArray(gf2row->inds + pos, gf2row->inds + pos + 1, gf2row->nnonzs - pos); /*lint !e866*/
+
+         return SCIP_OKAY;
+      }
+
+      if( gf2row->nnonzs < gf2matrix->densennonzs )
+      {
+         if( gf2row->nnonzs == gf2row->indssize )
+         {
+            int newsize = MAX(4, 2 * gf2row->indssize);
+
+            newsize = MIN(newsize, gf2matrix->densennonzs);
+            SCIP_ALLOC( BMSreallocBlockMemoryArray(gf2matrix->blkmem, &gf2row->inds, gf2row->indssize, newsize) );
+            gf2row->indssize = newsize;
+         }
+
+         BMSmoveMemoryArray(gf2row->inds + pos + 1, gf2row->inds + pos, gf2row->nnonzs - pos); /*lint !e866*/
+         gf2row->inds[pos] = col;
+         ++gf2row->nnonzs;
+
+         return SCIP_OKAY;
+      }
+
+      SCIP_CALL( gf2rowMakeDense(gf2matrix, gf2row) );
+   }
+
+   gf2row->words[col / GF2_WORDBITS] ^= (uint64_t)1 << (col % GF2_WORDBITS);
+
+   if( (gf2row->words[col / GF2_WORDBITS] >> (col % GF2_WORDBITS)) & 1 )
+   {
+      ++gf2row->nnonzs;
+      gf2rowExtendWords(gf2row, col / GF2_WORDBITS, col / GF2_WORDBITS + 1);
+   }
+   else
+   {
+      --gf2row->nnonzs;
+      gf2rowTrimWords(gf2row);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** returns whether an entry of a matrix over GF(2) is one */
+SCIP_Bool SCIPgf2matrixGetEntry(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   int                   row,                /**< row index */
+   int                   col                 /**< column index */
+   )
+{
+   SCIP_GF2ROW* gf2row;
+   int pos;
+
+   assert(gf2matrix != NULL);
+   assert(0 <= row && row < gf2matrix->nrows);
+   assert(0 <= col && col < gf2matrix->ncols);
+
+   gf2row = &gf2matrix->rows[row];
+
+   if( gf2row->words != NULL )
+      return (gf2row->words[col / GF2_WORDBITS] >> (col % GF2_WORDBITS)) & 1;
+
+   return SCIPsortedvecFindInt(gf2row->inds, col, gf2row->nnonzs, &pos);
+}
+
+/** sets the right hand side of a row of a matrix over GF(2) */
+void SCIPgf2matrixSetRhs(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   int                   row,                /**< row index */
+   SCIP_Bool             rhs                 /**< right hand side */
+   )
+{
+   assert(gf2matrix != NULL);
+   assert(0 <= row && row < gf2matrix->nrows);
+
+   gf2matrix->rows[row].rhs = rhs;
+}
+
+/** returns the right hand side of a row of a matrix over GF(2) */
+SCIP_Bool SCIPgf2matrixGetRhs(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   int                   row                 /**< row index */
+   )
+{
+   assert(gf2matrix != NULL);
+   assert(0 <= row && row < gf2matrix->nrows);
+
+   return gf2matrix->rows[row].rhs;
+}
+
+/** returns the number of nonzeros of a row of a matrix over GF(2) */
+int SCIPgf2matrixGetRowNNonzs(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   int                   row                 /**< row index */
+   )
+{
+   assert(gf2matrix != NULL);
+   assert(0 <= row && row < gf2matrix->nrows);
+
+   return gf2matrix->rows[row].nnonzs;
+}
+
+/** stores the column indices of the nonzeros of a row of a matrix over GF(2) in increasing order */
+void SCIPgf2matrixGetRowNonzs(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   int                   row,                /**< row index */
+   int*                  cols                /**< array to store the column indices, of size at least the number of
+                                              *   nonzeros of the row */
+   )
+{
+   SCIP_GF2ROW* gf2row;
+   int ncols;
+   int w;
+
+   assert(gf2matrix != NULL);
+   assert(0 <= row && row < gf2matrix->nrows);
+   assert(cols != NULL);
+
+   gf2row = &gf2matrix->rows[row];
+
+   if( gf2row->words == NULL )
+   {
+      BMScopyMemoryArray(cols, gf2row->inds, gf2row->nnonzs);
+      return;
+   }
+
+   ncols = 0;
+   for( w = gf2row->firstword; w < gf2row->lastword; ++w )
+   {
+      uint64_t word = gf2row->words[w];
+
+      while( word != 0 )
+      {
+         cols[ncols++] = w * GF2_WORDBITS + gf2WordLowestBit(word);
+         word &= word - 1;
+      }
+   }
+   assert(ncols == gf2row->nnonzs);
+}
+
+/** sets all entries and the right hand side of a row of a matrix over GF(2) to zero and frees its memory */
+void SCIPgf2matrixClearRow(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   int                   row                 /**< row index */
+   )
+{
+   SCIP_GF2ROW* gf2row;
+
+   assert(gf2matrix != NULL);
+   assert(0 <= row && row < gf2matrix->nrows);
+
+   gf2row = &gf2matrix->rows[row];
+
+   BMSfreeBlockMemoryArrayNull(gf2matrix->blkmem, &gf2row->words, gf2matrix->nwords);
+   BMSfreeBlockMemoryArrayNull(gf2matrix->blkmem, &gf2row->inds, gf2row->indssize);
+
+   gf2row->indssize = 0;
+   gf2row->nnonzs = 0;
+   gf2row->firstword = 0;
+   gf2row->lastword = 0;
+   gf2row->rhs = FALSE;
+}
+
+/** adds a row of a matrix over GF(2) to another row, including the right hand side */
+SCIP_RETCODE SCIPgf2matrixAddRow(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   int                   row,                /**< index of the row that is changed */
+   int                   rowtoadd            /**< index of the row that is added, must differ from row */
+   )
+{
+   SCIP_GF2ROW* target;
+   SCIP_GF2ROW* source;
+   int w;
+
+   assert(gf2matrix != NULL);
+   assert(0 <= row && row < gf2matrix->nrows);
+   assert(0 <= rowtoadd && rowtoadd < gf2matrix->nrows);
+   assert(row != rowtoadd);
+
+   target = &gf2matrix->rows[row];
+   source = &gf2matrix->rows[rowtoadd];
+
+   target->rhs = (target->rhs != source->rhs);
+
+   if( source->nnonzs == 0 )
+      return SCIP_OKAY;
+
+   /* merge two sparse rows, the entries that are in both rows cancel */
+   if( target->words == NULL && source->words == NULL )
+   {
+      int* buffer;
+      int nmerged;
+      int i;
+      int j;
+
+      if( gf2matrix->buffer == NULL )
+      {
+         SCIP_ALLOC( BMSallocBlockMemoryArray(gf2matrix->blkmem, &gf2matrix->buffer, gf2matrix->ncols) );
+      }
+      buffer = gf2matrix->buffer;
+
+      i = 0;
+      j = 0;
+      nmerged = 0;
+      while( i < target->nnonzs && j < source->nnonzs )
+      {
+         if( target->inds[i] < source->inds[j] )
+            buffer[nmerged++] = target->inds[i++];
+         else if( target->inds[i] > source->inds[j] )
+            buffer[nmerged++] = source->inds[j++];
+         else
+         {
+            ++i;
+            ++j;
+         }
+      }
+      while( i < target->nnonzs )
+         buffer[nmerged++] = target->inds[i++];
+      while( j < source->nnonzs )
+         buffer[nmerged++] = source->inds[j++];
+
+      if( nmerged > gf2matrix->densennonzs )
+      {
+         SCIP_CALL( gf2rowSetDense(gf2matrix, target, buffer, nmerged) );
+         BMSfreeBlockMemoryArrayNull(gf2matrix->blkmem, &target->inds, target->indssize);
+         target->indssize = 0;
+
+         return SCIP_OKAY;
+      }
+
+      if( nmerged > target->indssize )
+      {
+         int newsize = MAX(nmerged, 2 * target->indssize);
+
+         newsize = MIN(newsize, gf2matrix->densennonzs);
+         SCIP_ALLOC( BMSreallocBlockMemoryArray(gf2matrix->blkmem, &target->inds, target->indssize, newsize) );
+         target->indssize = newsize;
+      }
+
+      BMScopyMemoryArray(target->inds, buffer, nmerged);
+      target->nnonzs = nmerged;
+
+      return SCIP_OKAY;
+   }
+
+   if( target->words == NULL )
+   {
+      SCIP_CALL( gf2rowMakeDense(gf2matrix, target) );
+   }
+
+   if( source->words == NULL )
+   {
+      int i;
+
+      /* flip the bits of the sparse row */
+      for( i = 0; i < source->nnonzs; ++i )
+      {
+         int col = source->inds[i];
+
+         target->words[col / GF2_WORDBITS] ^= (uint64_t)1 << (col % GF2_WORDBITS);
+
+         if( (target->words[col / GF2_WORDBITS] >> (col % GF2_WORDBITS)) & 1 )
+            ++target->nnonzs;
+         else
+            --target->nnonzs;
+      }
+
+      gf2rowExtendWords(target, source->inds[0] / GF2_WORDBITS, source->inds[source->nnonzs - 1] / GF2_WORDBITS + 1);
+      gf2rowTrimWords(target);
+
+      return SCIP_OKAY;
+   }
+
+   /* XOR the words in the range of the dense row to add and count the nonzeros in the new range */
+   gf2XorWords(target->words + source->firstword, source->words + source->firstword,
+      source->lastword - source->firstword);
+
+   gf2rowExtendWords(target, source->firstword, source->lastword);
+   gf2rowTrimWords(target);
+
+   target->nnonzs = 0;
+   for( w = target->firstword; w < target->lastword; ++w )
+      target->nnonzs += gf2WordPopcount(target->words[w]);
+
+   return SCIP_OKAY;
+}
+
+/** transforms a matrix over GF(2) into row echelon form by Gaussian elimination with row pivoting
+ *
+ *  On exit, the array @p perm contains the permutation of the rows, such that the rows perm[0], ..., perm[rank-1] form
+ *  the steps of the row echelon form and the rows perm[rank], ..., perm[nrows-1] are zero. The system is feasible if
+ *  and only if the right hand sides of the zero rows are zero. For i = 0, ..., rank-1, the entry steps[i] contains the
+ *  column index of the first nonzero of row perm[i]. The pivot of each step is the first row in the current
+ *  permutation whose first nonzero is in the smallest column.
+ */
+SCIP_RETCODE SCIPgf2matrixComputeRowEchelon(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   int*                  perm,               /**< array of size nrows to store the permutation of the rows */
+   int*                  steps,              /**< array of size nrows to store the columns of the steps */
+   int*                  rank                /**< pointer to store the rank of the matrix */
+   )
+{
+   int* firstcols;
+   int nrows;
+   int ncols;
+   int i;
+   int k;
+
+   assert(gf2matrix != NULL);
+   assert(perm != NULL || gf2matrix->nrows == 0);
+   assert(steps != NULL || gf2matrix->nrows == 0);
+   assert(rank != NULL);
+
+   nrows = gf2matrix->nrows;
+   ncols = gf2matrix->ncols;
+   *rank = 0;
+
+   if( nrows == 0 )
+      return SCIP_OKAY;
+
+   /* the first nonzero columns of the rows decide about the pivots */
+   SCIP_ALLOC( BMSallocBlockMemoryArray(gf2matrix->blkmem, &firstcols, nrows) );
+
+   for( i = 0; i < nrows; ++i )
+   {
+      perm[i] = i;
+      steps[i] = i;
+      firstcols[i] = gf2rowGetFirstCol(gf2matrix, &gf2matrix->rows[i]);
+   }
+
+   for( i = 0; i < nrows && i < ncols; ++i )
+   {
+      int pivotpos;
+      int pivot;
+      int col;
+
+      /* find the first row with the smallest first nonzero column */
+      pivotpos = i;
+      for( k = i + 1; k < nrows; ++k )
+      {
+         if( firstcols[perm[k]] < firstcols[perm[pivotpos]] )
+            pivotpos = k;
+      }
+
+      col = firstcols[perm[pivotpos]];
+
+      /* all remaining rows are zero */
+      if( col >= ncols )
+         break;
+
+      steps[i] = col;
+
+      pivot = perm[pivotpos];
+      perm[pivotpos] = perm[i];
+      perm[i] = pivot;
+
+      /* eliminate the pivot column from the remaining rows */
+      for( k = i + 1; k < nrows; ++k )
+      {
+         if( firstcols[perm[k]] == col )
+         {
+            SCIP_CALL( SCIPgf2matrixAddRow(gf2matrix, perm[k], pivot) );
+            firstcols[perm[k]] = gf2rowGetFirstCol(gf2matrix, &gf2matrix->rows[perm[k]]);
+            assert(firstcols[perm[k]] > col);
+         }
+      }
+   }
+
+   *rank = i;
+
+   BMSfreeBlockMemoryArray(gf2matrix->blkmem, &firstcols, nrows);
+
+   return SCIP_OKAY;
+}
+
+/** computes a solution of a system over GF(2) in row echelon form, where all variables that are not on a step are zero
+ *
+ *  The row echelon form has to be computed by SCIPgf2matrixComputeRowEchelon() and the system has to be feasible.
+ */
+SCIP_RETCODE SCIPgf2matrixSolveRowEchelon(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) in row echelon form */
+   int*                  perm,               /**< permutation of the rows */
+   int*                  steps,              /**< columns of the steps */
+   int                   rank,               /**< rank of the matrix */
+   SCIP_Bool*            x                   /**< array of size ncols to store the solution */
+   )
+{
+   uint64_t* xwords;
+   int i;
+
+   assert(gf2matrix != NULL);
+   assert(rank == 0 || perm != NULL);
+   assert(rank == 0 || steps != NULL);
+   assert(0 <= rank && rank <= gf2matrix->nrows && rank <= gf2matrix->ncols);
+   assert(x != NULL || gf2matrix->ncols == 0);
+
+   BMSclearMemoryArray(x, gf2matrix->ncols);
+
+   if( rank == 0 )
+      return SCIP_OKAY;
+
+   /* the solution is also stored as a bitset for the dense rows */
+   SCIP_ALLOC( BMSallocClearBlockMemoryArray(gf2matrix->blkmem, &xwords, gf2matrix->nwords) );
+
+   /* compute the values on the steps backwards; the row of a step is zero before the step, and the solution is zero on
+    * the step and all other columns that are not on a later step, such that the value on the step is the right hand
+    * side plus the scalar product of the row and the solution
+    */
+   for( i = rank - 1; i >= 0; --i )
+   {
+      SCIP_GF2ROW* gf2row;
+      int parity;
+      int k;
+
+      gf2row = &gf2matrix->rows[perm[i]];
+      assert(gf2rowGetFirstCol(gf2matrix, gf2row) == steps[i]);
+
+      parity = gf2row->rhs ? 1 : 0;
+
+      if( gf2row->words == NULL )
+      {
+         for( k = 0; k < gf2row->nnonzs; ++k )
+            parity ^= x[gf2row->inds[k]] ? 1 : 0;
+      }
+      else
+      {
+         for( k = gf2row->firstword; k < gf2row->lastword; ++k )
+            parity ^= gf2WordPopcount(gf2row->words[k] & xwords[k]) & 1;
+      }
+
+      if( parity != 0 )
+      {
+         x[steps[i]] = TRUE;
+         xwords[steps[i] / GF2_WORDBITS] |= (uint64_t)1 << (steps[i] % GF2_WORDBITS);
+      }
+   }
+
+   BMSfreeBlockMemoryArray(gf2matrix->blkmem, &xwords, gf2matrix->nwords);
+
+   return SCIP_OKAY;
+}
+
 /** checks whether a given string t appears at the beginning of the string s (up to spaces at beginning) */
 SCIP_Bool SCIPstrAtStart(
    const char*           s,                  /**< string to search in */
@@ -146,6 +146,8 @@
 #include <scip/prop_symmetry.h>
 #include <symmetry/compute_symmetry.h>
 #include <scip/symmetry.h>
+#include <scip/concurrent.h>
+#include <tpi/tpi.h>
 
 #include <string.h>
 
@@ -172,6 +174,8 @@
 #define DEFAULT_COMPRESSTHRESHOLD     0.5    /**< Compression is used if percentage of moved vars is at most the threshold. */
 #define DEFAULT_SYMFIXNONBINARYVARS FALSE    /**< Whether all non-binary variables shall be not affected by symmetries if OF is active? */
 #define DEFAULT_ONLYBINARYSYMMETRY   TRUE    /**< Is only symmetry on binary variables used? */
+#define DEFAULT_NTHREADS                1    /**< number of threads used for sorting the matrix coefficients */
+#define DEFAULT_CACHEFILE             "-"    /**< name of file to cache symmetries of structurally identical problems ("-": none) */
 
 /* default parameters for linear symmetry constraints */
 #define DEFAULT_CONSSADDLP           TRUE    /**< Should the symmetry breaking constraints be added to the LP? */
@@ -214,6 +218,7 @@
 #define MAXGENNUMERATOR          64000000    /**< determine maximal number of generators by dividing this number by the number of variables */
 #define SCIP_SPECIALVAL 1.12345678912345e+19 /**< special floating point value for handling zeros in bound disjunctions */
 #define COMPRESSNVARSLB             25000    /**< lower bound on the number of variables above which compression could be performed */
+#define MINPARALLELSORTSIZE        100000    /**< minimal number of matrix coefficients per thread for sorting in parallel */
 
 /* macros for getting activeness of symmetry handling methods */
 #define ISSYMRETOPESACTIVE(x)      (((unsigned) x & SYM_HANDLETYPE_SYMBREAK) != 0)
@@ -278,6 +283,9 @@ struct SCIP_PropData
    SCIP_Bool             doubleequations;    /**< Double equations to positive/negative version? */
    SCIP_Bool             symfixnonbinaryvars; /**< Whether all non-binary variables shall be not affected by symmetries if OF is active? */
    SCIP_Bool             onlybinarysymmetry; /**< Whether only symmetry on binary variables is used */
+   int                   nthreads;           /**< number of threads used for sorting the matrix coefficients */
+   char*                 cachefile;          /**< name of file to cache symmetries of structurally identical problems ("-": none) */
+   SCIP_Bool             tpiinitialized;     /**< was the task processing interface initialized by this propagator? */
 
    /* for symmetry constraints */
    SCIP_Bool             symconsenabled;     /**< Should symmetry constraints be added? */
@@ -593,6 +601,9 @@ SCIP_DECL_SORTINDCOMP(SYMsortRhsTypes)
 }
 
 /** sorts matrix coefficients
+ *
+ *  Coefficients with the same value are sorted by their index, such that the order is total and does not depend on
+ *  the sorting algorithm or on the number of threads used for sorting.
  *
  *  result:
  *    < 0: ind1 comes before (is better than) ind2
@@ -613,7 +624,7 @@ SCIP_DECL_SORTINDCOMP(SYMsortMatCoef)
    else if ( diffvals > 0.0 )
       return 1;
 
-   return 0;
+   return ind1 - ind2;
 }
 
 
@@ -1776,6 +1787,607 @@ SCIP_RETCODE setSymmetryData(
 }
 
 
+/** mixes a 64 bit value into a hash value */
+static
+uint64_t symHashMix(
+   uint64_t              hash,               /**< current hash value */
+   uint64_t              val                 /**< value to mix into the hash value */
+   )
+{
+   uint64_t x;
+
+   x = hash + val + 0x9e3779b97f4a7c15ULL;
+   x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+   x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+
+   return x ^ (x >> 31);
+}
+
+/** computes a fingerprint of the colored symmetry detection graph
+ *
+ *  The colors are renumbered in the order of their first appearance, such that the fingerprint only depends on which
+ *  variables, coefficients, and right hand sides are equivalent, but not on their values. Problems with the same
+ *  fingerprint have the same symmetry detection graph up to the values of the colors, unless the hash values collide.
+ */
+static
+SCIP_RETCODE computeSymmetryFingerprint(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SYM_MATRIXDATA*       matrixdata,         /**< matrix data with colors */
+   SYM_SPEC              fixedtype,          /**< variable types that must be fixed by symmetries */
+   int                   maxgenerators,      /**< maximal number of generators constructed (= 0 if unlimited) */
+   uint64_t*             fingerprint         /**< pointer to store the fingerprint */
+   )
+{
+   int* canonicalcolor;
+   int ncanonicalcolors;
+   int ncolors;
+   uint64_t hash;
+   int j;
+
+   assert( scip != NULL );
+   assert( matrixdata != NULL );
+   assert( fingerprint != NULL );
+
+   ncolors = MAX3(matrixdata->nuniquevars, matrixdata->nuniquemat, matrixdata->nuniquerhs);
+   SCIP_CALL( SCIPallocBufferArray(scip, &canonicalcolor, MAX(ncolors, 1)) );
+
+   hash = symHashMix(0, (uint64_t) matrixdata->npermvars);
+   hash = symHashMix(hash, (uint64_t) matrixdata->nmatcoef);
+   hash = symHashMix(hash, (uint64_t) matrixdata->nrhscoef);
+   hash = symHashMix(hash, (uint64_t) fixedtype);
+   hash = symHashMix(hash, (uint64_t) maxgenerators);
+
+   /* colors of the variables */
+   for (j = 0; j < matrixdata->nuniquevars; ++j)
+      canonicalcolor[j] = -1;
+   ncanonicalcolors = 0;
+   for (j = 0; j < matrixdata->npermvars; ++j)
+   {
+      int color;
+
+      color = matrixdata->permvarcolors[j];
+      assert( 0 <= color && color < matrixdata->nuniquevars );
+      if ( canonicalcolor[color] < 0 )
+         canonicalcolor[color] = ncanonicalcolors++;
+      hash = symHashMix(hash, (uint64_t) canonicalcolor[color]);
+   }
+
+   /* colors of the right hand sides */
+   for (j = 0; j < matrixdata->nuniquerhs; ++j)
+      canonicalcolor[j] = -1;
+   ncanonicalcolors = 0;
+   for (j = 0; j < matrixdata->nrhscoef; ++j)
+   {
+      int color;
+
+      color = matrixdata->rhscoefcolors[j];
+      assert( 0 <= color && color < matrixdata->nuniquerhs );
+      if ( canonicalcolor[color] < 0 )
+         canonicalcolor[color] = ncanonicalcolors++;
+      hash = symHashMix(hash, (uint64_t) canonicalcolor[color]);
+   }
+
+   /* matrix entries with their colors */
+   for (j = 0; j < matrixdata->nuniquemat; ++j)
+      canonicalcolor[j] = -1;
+   ncanonicalcolors = 0;
+   for (j = 0; j < matrixdata->nmatcoef; ++j)
+   {
+      int color;
+
+      color = matrixdata->matcoefcolors[j];
+      assert( 0 <= color && color < matrixdata->nuniquemat );
+      if ( canonicalcolor[color] < 0 )
+         canonicalcolor[color] = ncanonicalcolors++;
+      hash = symHashMix(hash, (uint64_t) matrixdata->matrhsidx[j]);
+      hash = symHashMix(hash, (uint64_t) matrixdata->matvaridx[j]);
+      hash = symHashMix(hash, (uint64_t) canonicalcolor[color]);
+   }
+
+   SCIPfreeBufferArray(scip, &canonicalcolor);
+
+   *fingerprint = hash;
+
+   return SCIP_OKAY;
+}
+
+/** sorts rows by their hash values */
+static
+SCIP_DECL_SORTINDCOMP(SYMsortRowHashes)
+{
+   uint64_t* rowhashes;
+
+   rowhashes = (uint64_t*) dataptr;
+
+   if ( rowhashes[ind1] < rowhashes[ind2] )
+      return -1;
+   else if ( rowhashes[ind1] > rowhashes[ind2] )
+      return 1;
+
+   return 0;
+}
+
+/** checks whether permutations are symmetries of the colored symmetry detection graph of linear constraints
+ *
+ *  A permutation is accepted if it maps every variable to a variable of the same color and every row to a row with
+ *  the same right hand side color and the same colored entries. Rows are looked up by a hash value that does not
+ *  depend on the order of the entries, and candidate rows with the same hash value are compared entrywise, such that
+ *  the check takes time linear in the number of matrix entries per permutation for most problems.
+ */
+static
+SCIP_RETCODE checkSymmetriesOfColoredMatrix(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SYM_MATRIXDATA*       matrixdata,         /**< matrix data with colors */
+   int                   nperms,             /**< number of permutations */
+   int**                 perms,              /**< permutations */
+   SCIP_Bool*            valid               /**< pointer to store whether all permutations are symmetries */
+   )
+{
+   uint64_t* rowhashes;
+   int* rowbeg;
+   int* sortedrows;
+   int* permrow;
+   SCIP_Bool* isimage;
+   int nrows;
+   int p;
+   int r;
+   int j;
+
+   assert( scip != NULL );
+   assert( matrixdata != NULL );
+   assert( perms != NULL || nperms == 0 );
+   assert( valid != NULL );
+
+   *valid = TRUE;
+   nrows = matrixdata->nrhscoef;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowbeg, nrows + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowhashes, nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sortedrows, nrows) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &permrow, matrixdata->npermvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &isimage, matrixdata->npermvars) );
+
+   /* the entries of a row are stored consecutively and the rows are stored in increasing order */
+   r = 0;
+   for (j = 0; j < matrixdata->nmatcoef; ++j)
+   {
+      if ( matrixdata->matrhsidx[j] != r - 1 )
+      {
+         if ( matrixdata->matrhsidx[j] != r )
+         {
+            *valid = FALSE;
+            break;
+         }
+         rowbeg[r++] = j;
+      }
+   }
+   if ( r != nrows )
+      *valid = FALSE;
+   rowbeg[nrows] = matrixdata->nmatcoef;
+
+   /* compute hash values of the rows, which do not depend on the order of the entries */
+   for (r = 0; r < nrows && *valid; ++r)
+   {
+      rowhashes[r] = symHashMix(0, (uint64_t) matrixdata->rhscoefcolors[r]);
+      for (j = rowbeg[r]; j < rowbeg[r + 1]; ++j)
+         rowhashes[r] += symHashMix((uint64_t) matrixdata->matvaridx[j], (uint64_t) matrixdata->matcoefcolors[j]);
+      sortedrows[r] = r;
+   }
+   SCIPsortInd(sortedrows, SYMsortRowHashes, (void*) rowhashes, nrows);
+
+   for (p = 0; p < nperms && *valid; ++p)
+   {
+      int* P;
+
+      P = perms[p];
+      assert( P != NULL );
+
+      /* the permutation has to be a bijection that respects the colors of the variables */
+      for (j = 0; j < matrixdata->npermvars; ++j)
+         isimage[j] = FALSE;
+
+      for (j = 0; j < matrixdata->npermvars && *valid; ++j)
+      {
+         if ( P[j] < 0 || P[j] >= matrixdata->npermvars || isimage[P[j]]
+            || matrixdata->permvarcolors[j] != matrixdata->permvarcolors[P[j]] )
+            *valid = FALSE;
+         else
+            isimage[P[j]] = TRUE;
+      }
+
+      /* every permuted row has to be a row of the matrix */
+      for (r = 0; r < nrows && *valid; ++r)
+      {
+         uint64_t hash;
+         SCIP_Bool found;
+         SCIP_Bool permuted;
+         int left;
+         int right;
+
+         permuted = FALSE;
+         for (j = rowbeg[r]; j < rowbeg[r + 1] && ! permuted; ++j)
+            permuted = (P[matrixdata->matvaridx[j]] != matrixdata->matvaridx[j]);
+
+         if ( ! permuted )
+            continue;
+
+         /* fill the colors of the permuted row into a dense array and compute its hash value */
+         hash = symHashMix(0, (uint64_t) matrixdata->rhscoefcolors[r]);
+         for (j = rowbeg[r]; j < rowbeg[r + 1]; ++j)
+         {
+            int varidx;
+
+            varidx = P[matrixdata->matvaridx[j]];
+            if ( permrow[varidx] != 0 )
+               *valid = FALSE;
+            permrow[varidx] = matrixdata->matcoefcolors[j] + 1;
+            hash += symHashMix((uint64_t) varidx, (uint64_t) matrixdata->matcoefcolors[j]);
+         }
+
+         /* find the first row with the same hash value */
+         left = 0;
+         right = nrows;
+         while ( left < right )
+         {
+            int mid;
+
+            mid = left + (right - left) / 2;
+            if ( rowhashes[sortedrows[mid]] < hash )
+               left = mid + 1;
+            else
+               right = mid;
+         }
+
+         /* compare the candidate rows entrywise */
+         found = FALSE;
+         for (; left < nrows && rowhashes[sortedrows[left]] == hash && ! found && *valid; ++left)
+         {
+            int r2;
+
+            r2 = sortedrows[left];
+            if ( matrixdata->rhscoefcolors[r2] != matrixdata->rhscoefcolors[r]
+               || rowbeg[r2 + 1] - rowbeg[r2] != rowbeg[r + 1] - rowbeg[r] )
+               continue;
+
+            for (j = rowbeg[r2]; j < rowbeg[r2 + 1]; ++j)
+            {
+               if ( permrow[matrixdata->matvaridx[j]] != matrixdata->matcoefcolors[j] + 1 )
+                  break;
+            }
+            found = (j == rowbeg[r2 + 1]);
+         }
+
+         if ( ! found )
+            *valid = FALSE;
+
+         /* reset the dense array */
+         for (j = rowbeg[r]; j < rowbeg[r + 1]; ++j)
+            permrow[P[matrixdata->matvaridx[j]]] = 0;
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &isimage);
+   SCIPfreeBufferArray(scip, &permrow);
+   SCIPfreeBufferArray(scip, &sortedrows);
+   SCIPfreeBufferArray(scip, &rowhashes);
+   SCIPfreeBufferArray(scip, &rowbeg);
+
+   return SCIP_OKAY;
+}
+
+/** reads the symmetries of a problem with the given fingerprint from the symmetry cache file
+ *
+ *  The cache file consists of entries that store the fingerprint, the number of variables and permutations, the
+ *  logarithm of the group size, and the permutations. If several entries have the given fingerprint, the last one is
+ *  used. The permutations are only used if they are symmetries of the colored matrix of the current problem.
+ */
+static
+SCIP_RETCODE readSymmetryCache(
+   SCIP*                 scip,               /**< SCIP pointer */
+   const char*           filename,           /**< name of cache file */
+   uint64_t              fingerprint,        /**< fingerprint of the symmetry detection graph */
+   SYM_MATRIXDATA*       matrixdata,         /**< matrix data with colors */
+   int*                  nperms,             /**< pointer to store number of permutations */
+   int*                  nmaxperms,          /**< pointer to store maximal number of permutations (needed for freeing storage) */
+   int***                perms,              /**< pointer to store permutation generators as (nperms x npermvars) matrix */
+   SCIP_Real*            log10groupsize,     /**< pointer to store log10 of size of group */
+   SCIP_Bool*            found               /**< pointer to store whether valid symmetries have been found */
+   )
+{
+   FILE* file;
+   long entrypos = -1;
+   uint64_t entryfingerprint;
+   SCIP_Real entrylog10groupsize = 0.0;
+   int entrynpermvars;
+   int entrynperms = 0;
+   int p;
+
+   assert( scip != NULL );
+   assert( filename != NULL );
+   assert( matrixdata != NULL );
+   assert( found != NULL );
+
+   *found = FALSE;
+
+   file = fopen(filename, "rb");
+   if ( file == NULL )
+      return SCIP_OKAY;
+
+   /* find the last entry with the given fingerprint */
+   while ( fread(&entryfingerprint, sizeof(entryfingerprint), 1, file) == 1 )
+   {
+      SCIP_Real log10size;
+      int npermsentry;
+
+      if ( fread(&entrynpermvars, sizeof(entrynpermvars), 1, file) != 1
+         || fread(&npermsentry, sizeof(npermsentry), 1, file) != 1
+         || fread(&log10size, sizeof(log10size), 1, file) != 1
+         || entrynpermvars <= 0 || npermsentry < 0 )
+         break;
+
+      if ( entryfingerprint == fingerprint && entrynpermvars == matrixdata->npermvars )
+      {
+         entrypos = ftell(file);
+         entrynperms = npermsentry;
+         entrylog10groupsize = log10size;
+      }
+
+      if ( fseek(file, (long) npermsentry * entrynpermvars * (long) sizeof(int), SEEK_CUR) != 0 )
+         break;
+   }
+
+   if ( entrypos < 0 || fseek(file, entrypos, SEEK_SET) != 0 )
+   {
+      (void) fclose(file);
+      return SCIP_OKAY;
+   }
+
+   /* the problem has no symmetries */
+   if ( entrynperms == 0 )
+   {
+      (void) fclose(file);
+      *nperms = 0;
+      *nmaxperms = 0;
+      *perms = NULL;
+      *log10groupsize = 0.0;
+      *found = TRUE;
+
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "reused absence of symmetries from <%s>\n", filename);
+
+      return SCIP_OKAY;
+   }
+
+   /* read the permutations */
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, perms, entrynperms) );
+   for (p = 0; p < entrynperms; ++p)
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*perms)[p], matrixdata->npermvars) );
+
+      if ( fread((*perms)[p], sizeof(int), (size_t) matrixdata->npermvars, file) != (size_t) matrixdata->npermvars )
+      {
+         SCIPwarningMessage(scip, "symmetry cache file <%s> is truncated\n", filename);
+         SCIPfreeBlockMemoryArray(scip, &(*perms)[p], matrixdata->npermvars);
+         break;
+      }
+   }
+   (void) fclose(file);
+
+   if ( p == entrynperms )
+   {
+      SCIP_CALL( checkSymmetriesOfColoredMatrix(scip, matrixdata, entrynperms, *perms, found) );
+
+      if ( ! *found )
+      {
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL,
+            "cached symmetries in <%s> are not symmetries of the problem, recomputing symmetries\n", filename);
+      }
+   }
+
+   if ( *found )
+   {
+      *nperms = entrynperms;
+      *nmaxperms = entrynperms;
+      *log10groupsize = entrylog10groupsize;
+
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "reused %d symmetry generators from <%s>\n", entrynperms, filename);
+   }
+   else
+   {
+      while ( p > 0 )
+      {
+         --p;
+         SCIPfreeBlockMemoryArray(scip, &(*perms)[p], matrixdata->npermvars);
+      }
+      SCIPfreeBlockMemoryArray(scip, perms, entrynperms);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** appends the symmetries of a problem with the given fingerprint to the symmetry cache file */
+static
+void writeSymmetryCache(
+   SCIP*                 scip,               /**< SCIP pointer */
+   const char*           filename,           /**< name of cache file */
+   uint64_t              fingerprint,        /**< fingerprint of the symmetry detection graph */
+   int                   npermvars,          /**< number of variables of the permutations */
+   int                   nperms,             /**< number of permutations */
+   int**                 perms,              /**< permutation generators as (nperms x npermvars) matrix */
+   SCIP_Real             log10groupsize      /**< log10 of size of group */
+   )
+{
+   FILE* file;
+   SCIP_Bool error;
+   int p;
+
+   assert( scip != NULL );
+   assert( filename != NULL );
+   assert( perms != NULL || nperms == 0 );
+
+   file = fopen(filename, "ab");
+   if ( file == NULL )
+   {
+      SCIPwarningMessage(scip, "cannot open symmetry cache file <%s> for writing\n", filename);
+      return;
+   }
+
+   error = fwrite(&fingerprint, sizeof(fingerprint), 1, file) != 1
+      || fwrite(&npermvars, sizeof(npermvars), 1, file) != 1
+      || fwrite(&nperms, sizeof(nperms), 1, file) != 1
+      || fwrite(&log10groupsize, sizeof(log10groupsize), 1, file) != 1;
+
+   for (p = 0; p < nperms && ! error; ++p)
+      error = fwrite(perms[p], sizeof(int), (size_t) npermvars, file) != (size_t) npermvars; /*lint !e613*/
+
+   if ( fclose(file) != 0 || error )
+      SCIPwarningMessage(scip, "error writing symmetry cache file <%s>\n", filename);
+}
+
+
+/** chunk of the matrix coefficient indices that is sorted by a job */
+struct SYM_SortMatCoefChunk
+{
+   int*                  inds;               /**< indices of the chunk */
+   SCIP_Real*            matcoef;            /**< matrix coefficients */
+   int                   len;                /**< number of indices in the chunk */
+};
+typedef struct SYM_SortMatCoefChunk SYM_SORTMATCOEFCHUNK;
+
+/** job that sorts a chunk of the matrix coefficient indices */
+static
+SCIP_RETCODE sortMatCoefChunk(
+   void*                 args                /**< chunk to sort */
+   )
+{
+   SYM_SORTMATCOEFCHUNK* chunk;
+
+   chunk = (SYM_SORTMATCOEFCHUNK*) args;
+   assert( chunk != NULL );
+
+   SCIPsortInd(chunk->inds, SYMsortMatCoef, (void*) chunk->matcoef, chunk->len);
+
+   return SCIP_OKAY;
+}
+
+/** sorts the indices of the matrix coefficients
+ *
+ *  The indices are split into chunks that are sorted by parallel jobs of the task processing interface and are merged
+ *  afterwards. Since SYMsortMatCoef() is a total order, the result is the same as the one of a sequential sort.
+ */
+static
+SCIP_RETCODE sortMatCoef(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SYM_MATRIXDATA*       matrixdata,         /**< matrix data whose matidx array is sorted */
+   int                   nthreads            /**< maximal number of threads to use */
+   )
+{
+   SYM_SORTMATCOEFCHUNK* chunks;
+   SCIP_RETCODE retcode;
+   int* source;
+   int* target;
+   int* buffer;
+   int nchunks;
+   int chunksize;
+   int runsize;
+   int jobid;
+   int c;
+
+   assert( scip != NULL );
+   assert( matrixdata != NULL );
+
+   nchunks = MIN(nthreads, matrixdata->nmatcoef / MINPARALLELSORTSIZE);
+
+   if ( nchunks <= 1 || ! SCIPtpiIsAvailable() )
+   {
+      SCIPsortInd(matrixdata->matidx, SYMsortMatCoef, (void*) matrixdata->matcoef, matrixdata->nmatcoef);
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &chunks, nchunks) );
+
+   /* sort the chunks in parallel */
+   chunksize = (matrixdata->nmatcoef + nchunks - 1) / nchunks;
+   jobid = SCIPtpiGetNewJobID();
+   retcode = SCIP_OKAY;
+
+   for (c = 0; c < nchunks && retcode == SCIP_OKAY; ++c)
+   {
+      SCIP_SUBMITSTATUS status;
+      SCIP_JOB* job;
+
+      chunks[c].inds = &matrixdata->matidx[c * chunksize];
+      chunks[c].matcoef = matrixdata->matcoef;
+      chunks[c].len = MIN(chunksize, matrixdata->nmatcoef - c * chunksize);
+
+      retcode = SCIPtpiCreateJob(&job, jobid, sortMatCoefChunk, (void*) &chunks[c]);
+
+      if ( retcode == SCIP_OKAY )
+      {
+         retcode = SCIPtpiSumbitJob(job, &status);
+
+         if ( retcode == SCIP_OKAY && status != SCIP_SUBMIT_SUCCESS )
+            retcode = SCIP_ERROR;
+      }
+   }
+
+   retcode = MIN(retcode, SCIPtpiCollectJobs(jobid));
+
+   SCIPfreeBufferArray(scip, &chunks);
+   SCIP_CALL( retcode );
+
+   /* merge pairs of sorted runs until one run is left */
+   SCIP_CALL( SCIPallocBufferArray(scip, &buffer, matrixdata->nmatcoef) );
+
+   source = matrixdata->matidx;
+   target = buffer;
+
+   for (runsize = chunksize; runsize < matrixdata->nmatcoef; runsize *= 2)
+   {
+      int start;
+
+      for (start = 0; start < matrixdata->nmatcoef; start += 2 * runsize)
+      {
+         int mid;
+         int end;
+         int i;
+         int j;
+         int k;
+
+         mid = MIN(start + runsize, matrixdata->nmatcoef);
+         end = MIN(start + 2 * runsize, matrixdata->nmatcoef);
+
+         i = start;
+         j = mid;
+         k = start;
+
+         while ( i < mid && j < end )
+         {
+            if ( SYMsortMatCoef((void*) matrixdata->matcoef, source[j], source[i]) < 0 )
+               target[k++] = source[j++];
+            else
+               target[k++] = source[i++];
+         }
+
+         while ( i < mid )
+            target[k++] = source[i++];
+         while ( j < end )
+            target[k++] = source[j++];
+      }
+
+      SCIPswapPointers((void**) &source, (void**) &target);
+   }
+
+   if ( source != matrixdata->matidx )
+   {
+      BMScopyMemoryArray(matrixdata->matidx, source, matrixdata->nmatcoef);
+   }
+
+   SCIPfreeBufferArray(scip, &buffer);
+
+   return SCIP_OKAY;
+}
+
+
 /** computes symmetry group of a MIP */
 static
 SCIP_RETCODE computeSymmetryGroup(
@@ -1789,6 +2401,8 @@ SCIP_RETCODE computeSymmetryGroup(
    SCIP_Bool             checksymmetries,    /**< Should all symmetries be checked after computation? */
    SCIP_Bool             usecolumnsparsity,  /**< Should the number of conss a variable is contained in be exploited in symmetry detection? */
    SCIP_CONSHDLR*        conshdlr_nonlinear, /**< Nonlinear constraint handler, if included */
+   int                   nthreads,           /**< number of threads used for sorting the matrix coefficients */
+   const char*           cachefile,          /**< name of symmetry cache file, or NULL if no cache is used */
    int*                  npermvars,          /**< pointer to store number of variables for permutations */
    int*                  nbinpermvars,       /**< pointer to store number of binary variables for permutations */
    SCIP_VAR***           permvars,           /**< pointer to store variables on which permutations act */
@@ -1828,6 +2442,7 @@ SCIP_RETCODE computeSymmetryGroup(
    int nbinvars;
    int nvarsorig;
    int nallvars;
+   int nconsvarstotal;
    int c;
    int j;
 
@@ -1903,8 +2518,33 @@ SCIP_RETCODE computeSymmetryGroup(
 
    /* fill matrixdata */
 
-   /* use a staggered scheme for allocating space for non-zeros of constraint matrix since it can become large */
-   if ( nvars <= 100000 )
+   /* estimate the number of non-zeros of the constraint matrix from the sizes of the active constraints, counting
+    * each variable twice for doubled equations and ranged rows; the arrays are enlarged in collectCoefficients() if
+    * the estimate is too small, e.g., for constraints that add auxiliary coefficients */
+   nconsvarstotal = 0;
+   for (c = 0; c < nconss && nconsvarstotal < INT_MAX / 10; ++c)
+   {
+      SCIP_Bool nvarssuccess;
+      int nconsvars;
+
+      if ( ! SCIPconsIsActive(conss[c]) )
+         continue;
+
+      SCIP_CALL( SCIPgetConsNVars(scip, conss[c], &nconsvars, &nvarssuccess) );
+
+      /* fall back to a staggered scheme if the size of some constraint is unknown */
+      if ( ! nvarssuccess )
+      {
+         nconsvarstotal = -1;
+         break;
+      }
+
+      nconsvarstotal += MIN(2 * nconsvars, INT_MAX / 10 - nconsvarstotal);
+   }
+
+   if ( nconsvarstotal >= 0 )
+      matrixdata.nmaxmatcoef = MAX(nconsvarstotal, 2 * nvars);
+   else if ( nvars <= 100000 )
       matrixdata.nmaxmatcoef = 100 * nvars;
    else if ( nvars <= 1000000 )
       matrixdata.nmaxmatcoef = 32 * nvars;
@@ -2345,7 +2985,7 @@ SCIP_RETCODE computeSymmetryGroup(
    }
 
    /* sort matrix coefficients (leave matrix array intact) */
-   SCIPsort(matrixdata.matidx, SYMsortMatCoef, (void*) matrixdata.matcoef, matrixdata.nmatcoef);
+   SCIP_CALL( sortMatCoef(scip, &matrixdata, nthreads) );
 
    /* sort rhs types (first by sense, then by value, leave rhscoef intact) */
    sortrhstype.vals = matrixdata.rhscoef;
@@ -2529,9 +3169,30 @@ SCIP_RETCODE computeSymmetryGroup(
    /* do not compute symmetry if all variables are non-equivalent (unique) or if all matrix coefficients are different */
    if ( matrixdata.nuniquevars < nvars && (matrixdata.nuniquemat == 0 || matrixdata.nuniquemat < matrixdata.nmatcoef) )
    {
+      uint64_t fingerprint = 0;
+      SCIP_Bool cached = FALSE;
+
+      /* try to reuse the generators of a problem with the same symmetry detection graph (only for linear problems,
+       * since the cached generators are verified on the matrix) */
+      if ( cachefile != NULL && nnlconss == 0 )
+      {
+         SCIP_CALL( computeSymmetryFingerprint(scip, &matrixdata, fixedtype, maxgenerators, &fingerprint) );
+         SCIP_CALL( readSymmetryCache(scip, cachefile, fingerprint, &matrixdata, nperms, nmaxperms, perms,
+               log10groupsize, &cached) );
+      }
+
       /* determine generators */
-      SCIP_CALL( SYMcomputeSymmetryGenerators(scip, maxgenerators, &matrixdata, &exprdata, nperms, nmaxperms,
-            perms, log10groupsize) );
+      if ( ! cached )
+      {
+         SCIP_CALL( SYMcomputeSymmetryGenerators(scip, maxgenerators, &matrixdata, &exprdata, nperms, nmaxperms,
+               perms, log10groupsize) );
+
+         /* do not cache generators of an interrupted computation; SCIPisStopped() might call SCIPgetGap() which is
+          * only available after initpresolve */
+         if ( cachefile != NULL && nnlconss == 0
+            && (SCIPgetStage(scip) <= SCIP_STAGE_INITPRESOLVE || ! SCIPisStopped(scip)) )
+            writeSymmetryCache(scip, cachefile, fingerprint, nvars, *nperms, *perms, *log10groupsize);
+      }
       assert( *nperms <= *nmaxperms );
 
       /* SCIPisStopped() might call SCIPgetGap() which is only available after initpresolve */
@@ -2784,6 +3445,7 @@ SCIP_RETCODE determineSymmetry(
    /* actually compute (global) symmetry */
    SCIP_CALL( computeSymmetryGroup(scip, propdata->doubleequations, propdata->compresssymmetries, propdata->compressthreshold,
 	 maxgenerators, symspecrequirefixed, FALSE, propdata->checksymmetries, propdata->usecolumnsparsity, propdata->conshdlr_nonlinear,
+         propdata->nthreads, strcmp(propdata->cachefile, "-") == 0 ? NULL : propdata->cachefile,
          &propdata->npermvars, &propdata->nbinpermvars, &propdata->permvars, &propdata->nperms, &propdata->nmaxperms,
          &propdata->perms, &propdata->log10groupsize, &propdata->nmovedvars, &propdata->isnonlinvar,
          &propdata->binvaraffected, &propdata->compressed, &successful) );
@@ -6986,6 +7648,29 @@ SCIP_RETCODE propagateOrbitalFixing(
  * Callback methods of propagator
  */
 
+/** initialization method of propagator (called after problem was transformed) */
+static
+SCIP_DECL_PROPINIT(propInitSymmetry)
+{  /*lint --e{715}*/
+   SCIP_PROPDATA* propdata;
+
+   assert( scip != NULL );
+   assert( prop != NULL );
+
+   propdata = SCIPpropGetData(prop);
+   assert( propdata != NULL );
+
+   /* start the task processing interface for sorting the matrix coefficients in parallel */
+   propdata->tpiinitialized = FALSE;
+   if ( propdata->nthreads > 1 )
+   {
+      SCIP_CALL( SCIPinitParallelJobs(scip, propdata->nthreads, &propdata->tpiinitialized) );
+   }
+
+   return SCIP_OKAY;
+}
+
+
 /** presolving initialization method of propagator (called when presolving is about to begin) */
 static
 SCIP_DECL_PROPINITPRE(propInitpreSymmetry)
@@ -7350,6 +8035,12 @@ SCIP_DECL_PROPEXIT(propExitSymmetry)
 
    SCIP_CALL( freeSymmetryData(scip, propdata) );
 
+   if ( propdata->tpiinitialized )
+   {
+      SCIP_CALL( SCIPexitParallelJobs(scip) );
+      propdata->tpiinitialized = FALSE;
+   }
+
    /* reset basic data */
    propdata->usesymmetry = -1;
    propdata->symconsenabled = FALSE;
@@ -7482,6 +8173,8 @@ SCIP_RETCODE SCIPincludePropSymmetry(
    propdata->nodenumber = -1;
    propdata->offoundreduction = FALSE;
 
+   propdata->tpiinitialized = FALSE;
+
    propdata->sstenabled = FALSE;
    propdata->sstconss = NULL;
    propdata->nsstconss = 0;
@@ -7502,6 +8195,7 @@ SCIP_RETCODE SCIPincludePropSymmetry(
    assert( prop != NULL );
 
    SCIP_CALL( SCIPsetPropFree(scip, prop, propFreeSymmetry) );
+   SCIP_CALL( SCIPsetPropInit(scip, prop, propInitSymmetry) );
    SCIP_CALL( SCIPsetPropExit(scip, prop, propExitSymmetry) );
    SCIP_CALL( SCIPsetPropInitpre(scip, prop, propInitpreSymmetry) );
    SCIP_CALL( SCIPsetPropExitpre(scip, prop, propExitpreSymmetry) );
@@ -7536,6 +8230,16 @@ SCIP_RETCODE SCIPincludePropSymmetry(
          "Double equations to positive/negative version?",
          &propdata->doubleequations, TRUE, DEFAULT_DOUBLEEQUATIONS, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "propagating/" PROP_NAME "/nthreads",
+         "number of threads used for sorting the coefficients of the symmetry detection graph",
+         &propdata->nthreads, TRUE, DEFAULT_NTHREADS, 1, 64, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddStringParam(scip,
+         "propagating/" PROP_NAME "/cachefile",
+         "name of file to cache symmetries of structurally identical problems (\"-\": no cache)",
+         &propdata->cachefile, FALSE, DEFAULT_CACHEFILE, NULL, NULL) );
+
    /* add parameters for adding symmetry handling constraints */
    SCIP_CALL( SCIPaddBoolParam(scip,
          "propagating/" PROP_NAME "/conssaddlp",
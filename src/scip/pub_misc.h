@@ -1746,6 +1746,142 @@ int SCIPdisjointsetGetSize(
 
 /** @} */
 
+/*
+ * Matrix over GF(2)
+ */
+
+/**@defgroup Gf2Matrix Matrix over GF(2)
+ * @ingroup DataStructures
+ * @brief matrix over GF(2) with Gaussian elimination
+ *
+ * The rows of the matrix are stored as sorted arrays of column indices as long as they are sparse, and as bitsets of
+ * 64 bit words once their number of nonzeros exceeds twice the number of words of a bitset. Adding a dense row to
+ * another one XORs the words between the first and last nonzero word of the added row. Rows that became dense stay
+ * dense.
+ *
+ * @{
+ */
+
+/** creates a matrix over GF(2) with all entries and right hand sides zero */
+SCIP_EXPORT
+SCIP_RETCODE SCIPgf2matrixCreate(
+   SCIP_GF2MATRIX**      gf2matrix,          /**< pointer to store the matrix */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   int                   nrows,              /**< number of rows */
+   int                   ncols               /**< number of columns */
+   );
+
+/** frees a matrix over GF(2) */
+SCIP_EXPORT
+void SCIPgf2matrixFree(
+   SCIP_GF2MATRIX**      gf2matrix           /**< pointer to the matrix */
+   );
+
+/** returns the number of rows of a matrix over GF(2) */
+SCIP_EXPORT
+int SCIPgf2matrixGetNRows(
+   SCIP_GF2MATRIX*       gf2matrix           /**< matrix over GF(2) */
+   );
+
+/** returns the number of columns of a matrix over GF(2) */
+SCIP_EXPORT
+int SCIPgf2matrixGetNCols(
+   SCIP_GF2MATRIX*       gf2matrix           /**< matrix over GF(2) */
+   );
+
+/** adds one to an entry of a matrix over GF(2), i.e., flips the entry */
+SCIP_EXPORT
+SCIP_RETCODE SCIPgf2matrixFlipEntry(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   int                   row,                /**< row index */
+   int                   col                 /**< column index */
+   );
+
+/** returns whether an entry of a matrix over GF(2) is one */
+SCIP_EXPORT
+SCIP_Bool SCIPgf2matrixGetEntry(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   int                   row,                /**< row index */
+   int                   col                 /**< column index */
+   );
+
+/** sets the right hand side of a row of a matrix over GF(2) */
+SCIP_EXPORT
+void SCIPgf2matrixSetRhs(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   int                   row,                /**< row index */
+   SCIP_Bool             rhs                 /**< right hand side */
+   );
+
+/** returns the right hand side of a row of a matrix over GF(2) */
+SCIP_EXPORT
+SCIP_Bool SCIPgf2matrixGetRhs(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   int                   row                 /**< row index */
+   );
+
+/** returns the number of nonzeros of a row of a matrix over GF(2) */
+SCIP_EXPORT
+int SCIPgf2matrixGetRowNNonzs(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   int                   row                 /**< row index */
+   );
+
+/** stores the column indices of the nonzeros of a row of a matrix over GF(2) in increasing order */
+SCIP_EXPORT
+void SCIPgf2matrixGetRowNonzs(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   int                   row,                /**< row index */
+   int*                  cols                /**< array to store the column indices, of size at least the number of
+                                              *   nonzeros of the row */
+   );
+
+/** sets all entries and the right hand side of a row of a matrix over GF(2) to zero and frees its memory */
+SCIP_EXPORT
+void SCIPgf2matrixClearRow(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   int                   row                 /**< row index */
+   );
+
+/** adds a row of a matrix over GF(2) to another row, including the right hand side */
+SCIP_EXPORT
+SCIP_RETCODE SCIPgf2matrixAddRow(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   int                   row,                /**< index of the row that is changed */
+   int                   rowtoadd            /**< index of the row that is added, must differ from row */
+   );
+
+/** transforms a matrix over GF(2) into row echelon form by Gaussian elimination with row pivoting
+ *
+ *  On exit, the array @p perm contains the permutation of the rows, such that the rows perm[0], ..., perm[rank-1] form
+ *  the steps of the row echelon form and the rows perm[rank], ..., perm[nrows-1] are zero. The system is feasible if
+ *  and only if the right hand sides of the zero rows are zero. For i = 0, ..., rank-1, the entry steps[i] contains the
+ *  column index of the first nonzero of row perm[i]. The pivot of each step is the first row in the current
+ *  permutation whose first nonzero is in the smallest column.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPgf2matrixComputeRowEchelon(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) */
+   int*                  perm,               /**< array of size nrows to store the permutation of the rows */
+   int*                  steps,              /**< array of size nrows to store the columns of the steps */
+   int*                  rank                /**< pointer to store the rank of the matrix */
+   );
+
+/** computes a solution of a system over GF(2) in row echelon form, where all variables that are not on a step are zero
+ *
+ *  The row echelon form has to be computed by SCIPgf2matrixComputeRowEchelon() and the system has to be feasible.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPgf2matrixSolveRowEchelon(
+   SCIP_GF2MATRIX*       gf2matrix,          /**< matrix over GF(2) in row echelon form */
+   int*                  perm,               /**< permutation of the rows */
+   int*                  steps,              /**< columns of the steps */
+   int                   rank,               /**< rank of the matrix */
+   SCIP_Bool*            x                   /**< array of size ncols to store the solution */
+   );
+
+/** @} */
+
 /*
  * Numerical methods
  */
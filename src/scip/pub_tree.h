@@ -261,7 +261,6 @@ SCIP_CONSSETCHG* SCIPnodeGetConssetchg(
 #define SCIPnodeGetDepth(node)          ((int) (node)->depth)
 #define SCIPnodeGetLowerbound(node)     ((node)->lowerbound)
 #define SCIPnodeGetEstimate(node)       ((node)->estimate)
-#define SCIPnodeGetDomchg(node)         ((node)->domchg)
 #define SCIPnodeGetParent(node)         ((node)->parent)
 #define SCIPnodeIsActive(node)          ((node)->active)
 #define SCIPnodeIsPropagatedAgain(node) ((node)->reprop)
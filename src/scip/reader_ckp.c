@@ -0,0 +1,1167 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   reader_ckp.c
+ * @ingroup DEFPLUGINS_READER
+ * @brief  CKP file reader for checkpoints of interrupted solves
+ *
+ * A checkpoint consists of two files.  The global transformed problem, including the globally valid constraints that
+ * were added during the search and the cuts of the global cut pool, is copied into a new problem whose objective
+ * function yields the same external objective values; this problem is written in CIP format to a companion file.  The
+ * checkpoint file itself is a text file with the following sections, each introduced by a keyword line:
+ *
+ *  - PROBLEM: name of the companion CIP file, relative to the directory of the checkpoint file
+ *  - SOLUTION: lines "\<variable name\> value" of the incumbent, if any
+ *  - HISTORY: lines "\<variable name\>" followed by the number of pseudo cost observations, the pseudo costs, the VSIDS,
+ *    the average conflict lengths, the average numbers of inferences and the average cutoff rates, each first for the
+ *    downwards and then for the upwards direction
+ *  - NODES: for each open node a line "NODE lowerbound estimate" with the external dual bound and estimate of the node,
+ *    followed by lines "\<variable name\> >= bound" or "\<variable name\> <= bound" giving the branching decisions on
+ *    the path from the root to the node
+ *  - END
+ *
+ * Since the transformed problem is written, the variable names carry the prefix "t_" of transformed variables; it is
+ * kept such that all sections refer to the variables of the companion problem.
+ *
+ * Reading a checkpoint reads the companion problem, adds the incumbent, and stores the history and the open nodes.
+ * When the root node of the next solve needs to be branched on, the branching rule "checkpoint", which is included
+ * together with the reader, initializes the branching statistics of the variables with the stored history and creates
+ * one child of the root for each open node.  Only the branching decisions of the nodes are restored; their subproblems
+ * are relaxations of the subproblems of the interrupted solve, which is why the stored dual bounds remain valid.
+ * Whatever was pruned before is covered by the stored incumbent.  If the root node is solved without branching, or a
+ * constraint handler branches before the branching rules are called, the stored nodes are not used and the problem is
+ * solved from the root.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "blockmemshell/memory.h"
+#include "scip/pub_branch.h"
+#include "scip/pub_fileio.h"
+#include "scip/pub_message.h"
+#include "scip/pub_misc.h"
+#include "scip/pub_reader.h"
+#include "scip/pub_tree.h"
+#include "scip/pub_var.h"
+#include "scip/reader_ckp.h"
+#include "scip/scip_branch.h"
+#include "scip/scip_copy.h"
+#include "scip/scip_general.h"
+#include "scip/scip_mem.h"
+#include "scip/scip_message.h"
+#include "scip/scip_numerics.h"
+#include "scip/scip_param.h"
+#include "scip/scip_prob.h"
+#include "scip/scip_reader.h"
+#include "scip/scip_sol.h"
+#include "scip/scip_solvingstats.h"
+#include "scip/scip_tree.h"
+#include "scip/scip_var.h"
+#include <stdio.h>
+#include <string.h>
+
+
+#define READER_NAME             "ckpreader"
+#define READER_DESC             "file reader for checkpoints of interrupted solves"
+#define READER_EXTENSION        "ckp"
+
+#define BRANCHRULE_NAME         "checkpoint"
+#define BRANCHRULE_DESC         "branching rule restoring the open nodes of a checkpoint at the root node"
+#define BRANCHRULE_PRIORITY     536870911
+#define BRANCHRULE_MAXDEPTH     0
+#define BRANCHRULE_MAXBOUNDDIST 1.0
+
+#define CKP_NHISTVALS           12           /**< number of history values stored per variable */
+#define CKP_PROBEXTENSION       ".cip"       /**< extension appended to the checkpoint file name for the problem file */
+
+
+/** CKP reader data, shared with the branching rule */
+struct SCIP_ReaderData
+{
+   char*                 probname;           /**< name of the problem the stored data belongs to, or NULL if empty */
+   int                   norigvars;          /**< number of original variables of that problem */
+   int*                  histvars;           /**< original variable indices of the variables with a stored history */
+   SCIP_Real*            histvals;           /**< history values, CKP_NHISTVALS for each variable */
+   int                   nhistvars;          /**< number of variables with a stored history */
+   int                   histvarssize;       /**< size of histvars array */
+   SCIP_Real*            nodelbs;            /**< external lower bounds of the open nodes */
+   SCIP_Real*            nodeests;           /**< external estimates of the open nodes */
+   int*                  nodebegs;           /**< start of the branching decisions of each node (size nnodes + 1) */
+   int                   nnodes;             /**< number of open nodes */
+   int                   nodessize;          /**< size of node arrays */
+   int*                  bdvars;             /**< original variable indices of the branching decisions */
+   SCIP_Real*            bdvals;             /**< bounds of the branching decisions */
+   SCIP_BOUNDTYPE*       bdtypes;            /**< types of the branching decisions */
+   int                   nbds;               /**< number of branching decisions */
+   int                   bdssize;            /**< size of branching decision arrays */
+};
+
+
+/*
+ * Local methods of reader
+ */
+
+/** frees the stored checkpoint data */
+static
+void readerdataClear(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_READERDATA*      readerdata          /**< reader data */
+   )
+{
+   assert(readerdata != NULL);
+
+   SCIPfreeBlockMemoryArrayNull(scip, &readerdata->bdtypes, readerdata->bdssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &readerdata->bdvals, readerdata->bdssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &readerdata->bdvars, readerdata->bdssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &readerdata->nodebegs, readerdata->nodessize + 1);
+   SCIPfreeBlockMemoryArrayNull(scip, &readerdata->nodeests, readerdata->nodessize);
+   SCIPfreeBlockMemoryArrayNull(scip, &readerdata->nodelbs, readerdata->nodessize);
+   SCIPfreeBlockMemoryArrayNull(scip, &readerdata->histvals, CKP_NHISTVALS * readerdata->histvarssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &readerdata->histvars, readerdata->histvarssize);
+
+   if( readerdata->probname != NULL )
+   {
+      SCIPfreeBlockMemoryArray(scip, &readerdata->probname, strlen(readerdata->probname) + 1);
+   }
+
+   BMSclearMemory(readerdata);
+}
+
+/** ensures that the history arrays can store at least num variables */
+static
+SCIP_RETCODE readerdataEnsureHistSize(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_READERDATA*      readerdata,         /**< reader data */
+   int                   num                 /**< minimal number of entries */
+   )
+{
+   if( num > readerdata->histvarssize )
+   {
+      int newsize;
+
+      newsize = SCIPcalcMemGrowSize(scip, num);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &readerdata->histvars, readerdata->histvarssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &readerdata->histvals, CKP_NHISTVALS * readerdata->histvarssize,
+            CKP_NHISTVALS * newsize) );
+      readerdata->histvarssize = newsize;
+   }
+   assert(num <= readerdata->histvarssize);
+
+   return SCIP_OKAY;
+}
+
+/** ensures that the node arrays can store at least num nodes */
+static
+SCIP_RETCODE readerdataEnsureNodesSize(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_READERDATA*      readerdata,         /**< reader data */
+   int                   num                 /**< minimal number of entries */
+   )
+{
+   if( num > readerdata->nodessize )
+   {
+      int newsize;
+
+      newsize = SCIPcalcMemGrowSize(scip, num);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &readerdata->nodelbs, readerdata->nodessize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &readerdata->nodeests, readerdata->nodessize, newsize) );
+      if( readerdata->nodebegs == NULL )
+      {
+         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &readerdata->nodebegs, newsize + 1) );
+         readerdata->nodebegs[0] = 0;
+      }
+      else
+      {
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &readerdata->nodebegs, readerdata->nodessize + 1, newsize + 1) );
+      }
+      readerdata->nodessize = newsize;
+   }
+   assert(num <= readerdata->nodessize);
+
+   return SCIP_OKAY;
+}
+
+/** ensures that the branching decision arrays can store at least num entries */
+static
+SCIP_RETCODE readerdataEnsureBdsSize(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_READERDATA*      readerdata,         /**< reader data */
+   int                   num                 /**< minimal number of entries */
+   )
+{
+   if( num > readerdata->bdssize )
+   {
+      int newsize;
+
+      newsize = SCIPcalcMemGrowSize(scip, num);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &readerdata->bdvars, readerdata->bdssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &readerdata->bdvals, readerdata->bdssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &readerdata->bdtypes, readerdata->bdssize, newsize) );
+      readerdata->bdssize = newsize;
+   }
+   assert(num <= readerdata->bdssize);
+
+   return SCIP_OKAY;
+}
+
+/** reads the companion problem file given in the PROBLEM line of a checkpoint */
+static
+SCIP_RETCODE readProblem(
+   SCIP*                 scip,               /**< SCIP data structure */
+   const char*           filename,           /**< name of the checkpoint file */
+   const char*           probfile,           /**< name of the problem file relative to the checkpoint file */
+   SCIP_READERDATA*      readerdata          /**< reader data */
+   )
+{
+   char path[SCIP_MAXSTRLEN];
+   const char* slash;
+
+   /* resolve the problem file relative to the directory of the checkpoint */
+   slash = strrchr(filename, '/');
+   if( slash != NULL && probfile[0] != '/' )
+      (void) SCIPsnprintf(path, SCIP_MAXSTRLEN, "%.*s%s", (int)(slash - filename + 1), filename, probfile);
+   else
+      (void) SCIPsnprintf(path, SCIP_MAXSTRLEN, "%s", probfile);
+
+   SCIP_CALL( SCIPreadProb(scip, path, "cip") );
+
+   readerdataClear(scip, readerdata);
+   SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &readerdata->probname, SCIPgetProbName(scip),
+         strlen(SCIPgetProbName(scip)) + 1) );
+   readerdata->norigvars = SCIPgetNOrigVars(scip);
+
+   return SCIP_OKAY;
+}
+
+/** reads a checkpoint file */
+static
+SCIP_RETCODE readCheckpoint(
+   SCIP*                 scip,               /**< SCIP data structure */
+   const char*           filename,           /**< name of the input file */
+   SCIP_READERDATA*      readerdata          /**< reader data */
+   )
+{
+   enum CkpSection
+   {
+      CKP_SECTION_START    = 0,
+      CKP_SECTION_SOLUTION = 1,
+      CKP_SECTION_HISTORY  = 2,
+      CKP_SECTION_NODES    = 3,
+      CKP_SECTION_END      = 4
+   };
+   typedef enum CkpSection CKPSECTION;
+
+   SCIP_RETCODE retcode;
+   SCIP_FILE* file;
+   SCIP_SOL* sol;
+   CKPSECTION section;
+   SCIP_Bool hasproblem;
+   SCIP_Bool error;
+   int lineno;
+
+   assert(scip != NULL);
+   assert(filename != NULL);
+   assert(readerdata != NULL);
+
+   file = SCIPfopen(filename, "r");
+   if( file == NULL )
+   {
+      SCIPerrorMessage("cannot open file <%s> for reading\n", filename);
+      SCIPprintSysError(filename);
+      return SCIP_NOFILE;
+   }
+
+   sol = NULL;
+   section = CKP_SECTION_START;
+   hasproblem = FALSE;
+   error = FALSE;
+   retcode = SCIP_OKAY;
+   lineno = 0;
+
+   while( !error && section != CKP_SECTION_END )
+   {
+      char buffer[SCIP_MAXSTRLEN];
+      char keyword[SCIP_MAXSTRLEN];
+      SCIP_VAR* var;
+      char* line;
+      char* endptr;
+
+      if( SCIPfgets(buffer, (int) sizeof(buffer), file) == NULL )
+         break;
+      lineno++;
+
+      /* skip empty lines and comments */
+      line = buffer;
+      while( *line == ' ' || *line == '\t' )
+         ++line;
+      if( *line == '\0' || *line == '\n' || *line == '\r' || *line == '#' )
+         continue;
+
+      if( *line != '<' )
+      {
+         char probfile[SCIP_MAXSTRLEN];
+
+         (void) sscanf(line, "%1023s", keyword);
+
+         if( !hasproblem )
+         {
+            if( strcmp(keyword, "PROBLEM") != 0 || sscanf(line + 7, " %1023s", probfile) != 1 )
+            {
+               SCIPerrorMessage("line %d of checkpoint file <%s>: expected PROBLEM line\n", lineno, filename);
+               error = TRUE;
+               break;
+            }
+
+            retcode = readProblem(scip, filename, probfile, readerdata);
+            if( retcode != SCIP_OKAY )
+               break;
+            hasproblem = TRUE;
+         }
+         else if( strcmp(keyword, "SOLUTION") == 0 && section == CKP_SECTION_START )
+         {
+            SCIP_CALL_TERMINATE( retcode, SCIPcreateOrigSol(scip, &sol, NULL), TERMINATE );
+            section = CKP_SECTION_SOLUTION;
+         }
+         else if( strcmp(keyword, "HISTORY") == 0 && section < CKP_SECTION_HISTORY )
+            section = CKP_SECTION_HISTORY;
+         else if( strcmp(keyword, "NODES") == 0 && section < CKP_SECTION_NODES )
+            section = CKP_SECTION_NODES;
+         else if( strcmp(keyword, "NODE") == 0 && section == CKP_SECTION_NODES )
+         {
+            SCIP_Real lowerbound;
+            SCIP_Real estimate;
+
+            if( sscanf(line + 4, "%lf %lf", &lowerbound, &estimate) != 2 )
+            {
+               SCIPerrorMessage("line %d of checkpoint file <%s>: invalid NODE line\n", lineno, filename);
+               error = TRUE;
+               break;
+            }
+
+            SCIP_CALL_TERMINATE( retcode, readerdataEnsureNodesSize(scip, readerdata, readerdata->nnodes + 1),
+               TERMINATE );
+            readerdata->nodelbs[readerdata->nnodes] = lowerbound;
+            readerdata->nodeests[readerdata->nnodes] = estimate;
+            ++readerdata->nnodes;
+            readerdata->nodebegs[readerdata->nnodes] = readerdata->nbds;
+         }
+         else if( strcmp(keyword, "END") == 0 )
+            section = CKP_SECTION_END;
+         else
+         {
+            SCIPerrorMessage("line %d of checkpoint file <%s>: unexpected keyword <%s>\n", lineno, filename, keyword);
+            error = TRUE;
+         }
+
+         continue;
+      }
+
+      /* the remaining lines start with a variable */
+      SCIP_CALL_TERMINATE( retcode, SCIPparseVarName(scip, line, &var, &endptr), TERMINATE );
+      if( var == NULL || section == CKP_SECTION_START )
+      {
+         SCIPerrorMessage("line %d of checkpoint file <%s>: unexpected line <%s>\n", lineno, filename, line);
+         error = TRUE;
+         break;
+      }
+
+      switch( section )
+      {
+      case CKP_SECTION_SOLUTION:
+      {
+         SCIP_Real val;
+
+         if( sscanf(endptr, "%lf", &val) != 1 )
+         {
+            SCIPerrorMessage("line %d of checkpoint file <%s>: invalid solution value\n", lineno, filename);
+            error = TRUE;
+            break;
+         }
+         SCIP_CALL_TERMINATE( retcode, SCIPsetSolVal(scip, sol, var, val), TERMINATE );
+         break;
+      }
+
+      case CKP_SECTION_HISTORY:
+      {
+         SCIP_Real* vals;
+
+         SCIP_CALL_TERMINATE( retcode, readerdataEnsureHistSize(scip, readerdata, readerdata->nhistvars + 1),
+            TERMINATE );
+         vals = &readerdata->histvals[CKP_NHISTVALS * readerdata->nhistvars];
+
+         if( sscanf(endptr, "%lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf", &vals[0], &vals[1], &vals[2], &vals[3],
+               &vals[4], &vals[5], &vals[6], &vals[7], &vals[8], &vals[9], &vals[10], &vals[11]) != CKP_NHISTVALS )
+         {
+            SCIPerrorMessage("line %d of checkpoint file <%s>: invalid history\n", lineno, filename);
+            error = TRUE;
+            break;
+         }
+         readerdata->histvars[readerdata->nhistvars] = SCIPvarGetProbindex(var);
+         ++readerdata->nhistvars;
+         break;
+      }
+
+      case CKP_SECTION_NODES:
+      {
+         char sense[3];
+         SCIP_Real bound;
+
+         if( readerdata->nnodes == 0 || sscanf(endptr, " %2s %lf", sense, &bound) != 2
+            || (strcmp(sense, ">=") != 0 && strcmp(sense, "<=") != 0) )
+         {
+            SCIPerrorMessage("line %d of checkpoint file <%s>: invalid branching decision\n", lineno, filename);
+            error = TRUE;
+            break;
+         }
+
+         SCIP_CALL_TERMINATE( retcode, readerdataEnsureBdsSize(scip, readerdata, readerdata->nbds + 1), TERMINATE );
+         readerdata->bdvars[readerdata->nbds] = SCIPvarGetProbindex(var);
+         readerdata->bdvals[readerdata->nbds] = bound;
+         readerdata->bdtypes[readerdata->nbds] = sense[0] == '>' ? SCIP_BOUNDTYPE_LOWER : SCIP_BOUNDTYPE_UPPER;
+         ++readerdata->nbds;
+         readerdata->nodebegs[readerdata->nnodes] = readerdata->nbds;
+         break;
+      }
+
+      case CKP_SECTION_START:
+      case CKP_SECTION_END:
+      default:
+         SCIPABORT();
+         break;
+      }
+   }
+
+   if( !error && retcode == SCIP_OKAY && section != CKP_SECTION_END )
+   {
+      SCIPerrorMessage("checkpoint file <%s> is incomplete\n", filename);
+      error = TRUE;
+   }
+
+   if( !error && retcode == SCIP_OKAY && sol != NULL )
+   {
+      SCIP_Bool stored;
+
+      SCIP_CALL_TERMINATE( retcode, SCIPaddSolFree(scip, &sol, &stored), TERMINATE );
+   }
+
+TERMINATE:
+   if( sol != NULL )
+   {
+      SCIP_CALL( SCIPfreeSol(scip, &sol) );
+   }
+
+   SCIPfclose(file);
+
+   if( error || retcode != SCIP_OKAY )
+   {
+      readerdataClear(scip, readerdata);
+      return retcode != SCIP_OKAY ? retcode : SCIP_READERROR;
+   }
+
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "checkpoint contains %d open nodes and the history of %d variables\n",
+      readerdata->nnodes, readerdata->nhistvars);
+
+   return SCIP_OKAY;
+}
+
+/** writes the companion problem of a checkpoint: the global transformed problem with the external objective */
+static
+SCIP_RETCODE writeProblem(
+   SCIP*                 scip,               /**< SCIP data structure */
+   const char*           probfilename,       /**< name of the problem file */
+   SCIP_HASHMAP*         varmap,             /**< hashmap to store the mapping of the variables */
+   SCIP*                 copy                /**< empty SCIP instance to copy the problem into */
+   )
+{
+   SCIP_VAR** vars;
+   SCIP_RETCODE retcode;
+   SCIP_Real scale;
+   SCIP_Bool valid;
+   int nvars;
+   int v;
+
+   SCIP_CALL( SCIPcopy(scip, copy, varmap, NULL, "", TRUE, FALSE, FALSE, FALSE, &valid) );
+
+   if( !valid )
+   {
+      SCIPerrorMessage("problem could not be copied completely, no checkpoint written\n");
+      return SCIP_WRITEERROR;
+   }
+
+   SCIP_CALL( SCIPcopyCuts(scip, copy, varmap, NULL, TRUE, NULL) );
+
+   /* the copy has the internal objective; transform it such that it yields the external objective values, i.e.,
+    * objsense * objscale * (intobj + transoffset) + origoffset
+    */
+   scale = (SCIP_Real)SCIPgetObjsense(scip) * SCIPgetTransObjscale(scip);
+   vars = SCIPgetOrigVars(copy);
+   nvars = SCIPgetNOrigVars(copy);
+
+   for( v = 0; v < nvars; ++v )
+   {
+      SCIP_CALL( SCIPchgVarObj(copy, vars[v], scale * SCIPvarGetObj(vars[v])) );
+   }
+
+   SCIP_CALL( SCIPsetObjsense(copy, SCIPgetObjsense(scip)) );
+   SCIP_CALL( SCIPaddOrigObjoffset(copy, scale * SCIPgetTransObjoffset(scip) + SCIPgetOrigObjoffset(scip)) );
+   SCIP_CALL( SCIPsetProbName(copy, SCIPgetProbName(scip)) );
+
+   retcode = SCIPwriteOrigProblem(copy, probfilename, "cip", FALSE);
+   if( retcode == SCIP_FILECREATEERROR || retcode == SCIP_WRITEERROR )
+      return retcode;
+   SCIP_CALL( retcode );
+
+   return SCIP_OKAY;
+}
+
+/** writes the branching history of the variables of the problem */
+static
+void writeHistory(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< output file */
+   SCIP_HASHMAP*         varmap              /**< mapping of the variables to the companion problem */
+   )
+{
+   SCIP_VAR** vars;
+   int nvars;
+   int v;
+
+   SCIPinfoMessage(scip, file, "HISTORY\n");
+
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+
+   for( v = 0; v < nvars; ++v )
+   {
+      SCIP_Real vals[CKP_NHISTVALS];
+      SCIP_BRANCHDIR dir;
+      int d;
+      int i;
+
+      if( !SCIPhashmapExists(varmap, vars[v]) )
+         continue;
+
+      /* only directions with pseudo cost observations are stored */
+      for( d = 0; d < 2; ++d )
+      {
+         dir = d == 0 ? SCIP_BRANCHDIR_DOWNWARDS : SCIP_BRANCHDIR_UPWARDS;
+
+         vals[d] = SCIPgetVarPseudocostCount(scip, vars[v], dir);
+         if( vals[d] > 0.0 )
+         {
+            vals[2 + d] = SCIPgetVarPseudocost(scip, vars[v], dir);
+            vals[4 + d] = SCIPgetVarVSIDS(scip, vars[v], dir);
+            vals[6 + d] = SCIPgetVarAvgConflictlength(scip, vars[v], dir);
+            vals[8 + d] = SCIPgetVarAvgInferences(scip, vars[v], dir);
+            vals[10 + d] = SCIPgetVarAvgCutoffs(scip, vars[v], dir);
+         }
+         else
+         {
+            for( i = 2 + d; i < CKP_NHISTVALS; i += 2 )
+               vals[i] = 0.0;
+         }
+      }
+
+      if( vals[0] == 0.0 && vals[1] == 0.0 ) /*lint !e777*/
+         continue;
+
+      SCIPinfoMessage(scip, file, "<%s>", SCIPvarGetName(vars[v]));
+      for( i = 0; i < CKP_NHISTVALS; ++i )
+         SCIPinfoMessage(scip, file, " %.15g", vals[i]);
+      SCIPinfoMessage(scip, file, "\n");
+   }
+}
+
+/** writes an open node given by its branching decisions */
+static
+SCIP_RETCODE writeNode(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< output file */
+   SCIP_HASHMAP*         varmap,             /**< mapping of the variables to the companion problem */
+   SCIP_NODE*            node,               /**< open node */
+   SCIP_VAR***           branchvars,         /**< pointer to buffer array for the branching variables */
+   SCIP_Real**           branchbounds,       /**< pointer to buffer array for the branching bounds */
+   SCIP_BOUNDTYPE**      boundtypes,         /**< pointer to buffer array for the branching bound types */
+   int*                  branchsize          /**< pointer to size of the buffer arrays */
+   )
+{
+   int nbranchvars;
+   int i;
+
+   SCIPnodeGetAncestorBranchings(node, *branchvars, *branchbounds, *boundtypes, &nbranchvars, *branchsize);
+
+   if( nbranchvars > *branchsize )
+   {
+      *branchsize = nbranchvars;
+      SCIP_CALL( SCIPreallocBufferArray(scip, branchvars, *branchsize) );
+      SCIP_CALL( SCIPreallocBufferArray(scip, branchbounds, *branchsize) );
+      SCIP_CALL( SCIPreallocBufferArray(scip, boundtypes, *branchsize) );
+
+      SCIPnodeGetAncestorBranchings(node, *branchvars, *branchbounds, *boundtypes, &nbranchvars, *branchsize);
+      assert(nbranchvars <= *branchsize);
+   }
+
+   SCIPinfoMessage(scip, file, "NODE %.15g %.15g\n", SCIPretransformObj(scip, SCIPnodeGetLowerbound(node)),
+      SCIPretransformObj(scip, SCIPnodeGetEstimate(node)));
+
+   /* the decisions are collected from the node upwards, but are written from the root downwards */
+   for( i = nbranchvars - 1; i >= 0; --i )
+   {
+      if( !SCIPhashmapExists(varmap, (*branchvars)[i]) )
+         continue;
+
+      SCIPinfoMessage(scip, file, "<%s> %s %.15g\n", SCIPvarGetName((*branchvars)[i]),
+         (*boundtypes)[i] == SCIP_BOUNDTYPE_LOWER ? ">=" : "<=", (*branchbounds)[i]);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** writes the open nodes of the search tree */
+static
+SCIP_RETCODE writeNodes(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< output file */
+   SCIP_HASHMAP*         varmap,             /**< mapping of the variables to the companion problem */
+   int*                  nwritten            /**< pointer to store the number of written nodes */
+   )
+{
+   SCIP_NODE** leaves;
+   SCIP_NODE** children;
+   SCIP_NODE** siblings;
+   SCIP_NODE* focusnode;
+   SCIP_VAR** branchvars;
+   SCIP_Real* branchbounds;
+   SCIP_BOUNDTYPE* boundtypes;
+   int nleaves;
+   int nchildren;
+   int nsiblings;
+   int branchsize;
+   int i;
+
+   *nwritten = 0;
+
+   SCIPinfoMessage(scip, file, "NODES\n");
+
+   if( SCIPgetStage(scip) != SCIP_STAGE_SOLVING )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPgetOpenNodesData(scip, &leaves, &children, &siblings, &nleaves, &nchildren, &nsiblings) );
+
+   branchsize = MAX(SCIPgetNVars(scip), 1);
+   SCIP_CALL( SCIPallocBufferArray(scip, &branchvars, branchsize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &branchbounds, branchsize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &boundtypes, branchsize) );
+
+   /* the focus node is still open if it was interrupted before it was branched on or pruned */
+   focusnode = SCIPgetFocusNode(scip);
+   if( focusnode != NULL && nchildren == 0 && SCIPisLT(scip, SCIPnodeGetLowerbound(focusnode), SCIPgetCutoffbound(scip))
+      && SCIPgetCutoffdepth(scip) > SCIPnodeGetDepth(focusnode) )
+   {
+      SCIP_CALL( writeNode(scip, file, varmap, focusnode, &branchvars, &branchbounds, &boundtypes, &branchsize) );
+      ++(*nwritten);
+   }
+
+   for( i = 0; i < nchildren; ++i )
+   {
+      SCIP_CALL( writeNode(scip, file, varmap, children[i], &branchvars, &branchbounds, &boundtypes, &branchsize) );
+   }
+   for( i = 0; i < nsiblings; ++i )
+   {
+      SCIP_CALL( writeNode(scip, file, varmap, siblings[i], &branchvars, &branchbounds, &boundtypes, &branchsize) );
+   }
+   for( i = 0; i < nleaves; ++i )
+   {
+      SCIP_CALL( writeNode(scip, file, varmap, leaves[i], &branchvars, &branchbounds, &boundtypes, &branchsize) );
+   }
+   *nwritten += nchildren + nsiblings + nleaves;
+
+   SCIPfreeBufferArray(scip, &boundtypes);
+   SCIPfreeBufferArray(scip, &branchbounds);
+   SCIPfreeBufferArray(scip, &branchvars);
+
+   return SCIP_OKAY;
+}
+
+/** writes all sections of a checkpoint file except for the problem */
+static
+SCIP_RETCODE writeCheckpoint(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< output file */
+   const char*           probfilename,       /**< name of the problem file */
+   SCIP_HASHMAP*         varmap,             /**< mapping of the variables to the companion problem */
+   int*                  nnodes              /**< pointer to store the number of written nodes */
+   )
+{
+   SCIP_SOL* bestsol;
+   const char* probfile;
+
+   /* the problem file is referenced relative to the checkpoint file */
+   probfile = strrchr(probfilename, '/');
+   probfile = probfile == NULL ? probfilename : probfile + 1;
+
+   SCIPinfoMessage(scip, file, "# SCIP checkpoint of problem <%s>\n", SCIPgetProbName(scip));
+   SCIPinfoMessage(scip, file, "PROBLEM %s\n", probfile);
+
+   bestsol = SCIPgetBestSol(scip);
+   if( bestsol != NULL )
+   {
+      SCIP_VAR** vars;
+      int nvars;
+      int v;
+
+      SCIPinfoMessage(scip, file, "SOLUTION\n");
+
+      vars = SCIPgetVars(scip);
+      nvars = SCIPgetNVars(scip);
+
+      for( v = 0; v < nvars; ++v )
+      {
+         if( !SCIPhashmapExists(varmap, vars[v]) )
+            continue;
+
+         SCIPinfoMessage(scip, file, "<%s> %.15g\n", SCIPvarGetName(vars[v]), SCIPgetSolVal(scip, bestsol, vars[v]));
+      }
+   }
+
+   writeHistory(scip, file, varmap);
+   SCIP_CALL( writeNodes(scip, file, varmap, nnodes) );
+
+   SCIPinfoMessage(scip, file, "END\n");
+
+   return SCIP_OKAY;
+}
+
+/** initializes the branching statistics of the variables with the stored history */
+static
+SCIP_RETCODE applyHistory(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_READERDATA*      readerdata          /**< reader data */
+   )
+{
+   SCIP_VAR** origvars;
+   int i;
+
+   origvars = SCIPgetOrigVars(scip);
+
+   for( i = 0; i < readerdata->nhistvars; ++i )
+   {
+      SCIP_Real* vals;
+      SCIP_Real oldcount[2];
+      SCIP_VAR* var;
+      int d;
+
+      var = SCIPvarGetTransVar(origvars[readerdata->histvars[i]]);
+      if( var == NULL || !SCIPvarIsActive(var) )
+         continue;
+
+      vals = &readerdata->histvals[CKP_NHISTVALS * i];
+
+      oldcount[0] = SCIPgetVarPseudocostCount(scip, var, SCIP_BRANCHDIR_DOWNWARDS);
+      oldcount[1] = SCIPgetVarPseudocostCount(scip, var, SCIP_BRANCHDIR_UPWARDS);
+
+      SCIP_CALL( SCIPinitVarBranchStats(scip, var, vals[2], vals[3], vals[4], vals[5], vals[6], vals[7], vals[8],
+            vals[9], vals[10], vals[11]) );
+
+      /* the statistics above count as one observation; restore the number of pseudo cost observations */
+      for( d = 0; d < 2; ++d )
+      {
+         SCIP_BRANCHDIR dir;
+         SCIP_Real missing;
+
+         dir = d == 0 ? SCIP_BRANCHDIR_DOWNWARDS : SCIP_BRANCHDIR_UPWARDS;
+         missing = oldcount[d] + vals[d] - SCIPgetVarPseudocostCount(scip, var, dir);
+
+         while( SCIPisPositive(scip, missing) )
+         {
+            SCIP_Real weight;
+
+            weight = MIN(missing, 1.0);
+            SCIP_CALL( SCIPupdateVarPseudocost(scip, var, d == 0 ? -1.0 : 1.0, vals[2 + d], weight) );
+            missing -= weight;
+         }
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** creates one child of the focus node for each stored open node */
+static
+SCIP_RETCODE createNodes(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_READERDATA*      readerdata,         /**< reader data */
+   SCIP_RESULT*          result              /**< pointer to store the result of the branching call */
+   )
+{
+   SCIP_VAR** origvars;
+   SCIP_VAR** vars;
+   SCIP_Real* lbs;
+   SCIP_Real* ubs;
+   int nvars;
+   int ncreated;
+   int n;
+
+   origvars = SCIPgetOrigVars(scip);
+
+   /* if some node has no branching decisions, the whole problem is still open and the search is not restricted */
+   for( n = 0; n < readerdata->nnodes; ++n )
+   {
+      if( readerdata->nodebegs[n] == readerdata->nodebegs[n + 1] )
+         return SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &vars, readerdata->nbds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lbs, readerdata->nbds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ubs, readerdata->nbds) );
+
+   ncreated = 0;
+
+   for( n = 0; n < readerdata->nnodes; ++n )
+   {
+      SCIP_NODE* child;
+      SCIP_Real lowerbound;
+      SCIP_Bool empty;
+      int b;
+      int i;
+
+      lowerbound = SCIPtransformObj(scip, readerdata->nodelbs[n]);
+      if( SCIPisGE(scip, lowerbound, SCIPgetCutoffbound(scip)) )
+         continue;
+
+      /* collect the tightest bounds of the active variables on the path to the node */
+      nvars = 0;
+      empty = FALSE;
+      for( b = readerdata->nodebegs[n]; b < readerdata->nodebegs[n + 1] && !empty; ++b )
+      {
+         SCIP_BOUNDTYPE boundtype;
+         SCIP_VAR* var;
+         SCIP_Real bound;
+
+         var = SCIPvarGetTransVar(origvars[readerdata->bdvars[b]]);
+         if( var == NULL )
+            continue;
+
+         bound = readerdata->bdvals[b];
+         boundtype = readerdata->bdtypes[b];
+         SCIP_CALL( SCIPvarGetProbvarBound(&var, &bound, &boundtype) );
+
+         /* decisions on variables that were fixed or multi-aggregated are dropped, which only relaxes the node */
+         if( var == NULL || !SCIPvarIsActive(var) )
+            continue;
+
+         for( i = 0; i < nvars && vars[i] != var; ++i )
+         {
+         }
+
+         if( i == nvars )
+         {
+            vars[i] = var;
+            lbs[i] = SCIPvarGetLbLocal(var);
+            ubs[i] = SCIPvarGetUbLocal(var);
+            ++nvars;
+         }
+
+         if( boundtype == SCIP_BOUNDTYPE_LOWER )
+            lbs[i] = MAX(lbs[i], bound);
+         else
+            ubs[i] = MIN(ubs[i], bound);
+
+         empty = SCIPisFeasGT(scip, lbs[i], ubs[i]);
+      }
+
+      /* the node is infeasible with respect to the bounds at the root */
+      if( empty )
+         continue;
+
+      SCIP_CALL( SCIPcreateChild(scip, &child, 0.0, SCIPtransformObj(scip, readerdata->nodeests[n])) );
+
+      for( i = 0; i < nvars; ++i )
+      {
+         if( SCIPisGT(scip, lbs[i], SCIPvarGetLbLocal(vars[i])) )
+         {
+            SCIP_CALL( SCIPchgVarLbNode(scip, child, vars[i], lbs[i]) );
+         }
+         if( SCIPisLT(scip, ubs[i], SCIPvarGetUbLocal(vars[i])) )
+         {
+            SCIP_CALL( SCIPchgVarUbNode(scip, child, vars[i], ubs[i]) );
+         }
+      }
+
+      if( !SCIPisInfinity(scip, -lowerbound) )
+      {
+         SCIP_CALL( SCIPupdateNodeLowerbound(scip, child, lowerbound) );
+      }
+
+      ++ncreated;
+   }
+
+   SCIPfreeBufferArray(scip, &ubs);
+   SCIPfreeBufferArray(scip, &lbs);
+   SCIPfreeBufferArray(scip, &vars);
+
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "restored %d of %d open nodes from checkpoint\n", ncreated,
+      readerdata->nnodes);
+
+   /* all open nodes are infeasible or worse than the incumbent, so nothing remains to be searched */
+   *result = ncreated > 0 ? SCIP_BRANCHED : SCIP_CUTOFF;
+
+   return SCIP_OKAY;
+}
+
+/** applies the stored checkpoint data at the root node and frees it */
+static
+SCIP_RETCODE applyCheckpoint(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_READERDATA*      readerdata,         /**< reader data */
+   SCIP_RESULT*          result              /**< pointer to store the result of the branching call */
+   )
+{
+   *result = SCIP_DIDNOTRUN;
+
+   if( readerdata->probname == NULL )
+      return SCIP_OKAY;
+
+   /* the stored data refers to the variables of the problem read with the checkpoint */
+   if( strcmp(readerdata->probname, SCIPgetProbName(scip)) == 0 && readerdata->norigvars == SCIPgetNOrigVars(scip) )
+   {
+      SCIP_CALL( applyHistory(scip, readerdata) );
+
+      if( readerdata->nnodes > 0 )
+      {
+         SCIP_CALL( createNodes(scip, readerdata, result) );
+      }
+   }
+
+   readerdataClear(scip, readerdata);
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * Callback methods of branching rule
+ */
+
+/** copy method for branchrule plugins (called when SCIP copies plugins) */
+static
+SCIP_DECL_BRANCHCOPY(branchCopyCheckpoint)
+{  /*lint --e{715}*/
+   assert(scip != NULL);
+   assert(branchrule != NULL);
+   assert(strcmp(SCIPbranchruleGetName(branchrule), BRANCHRULE_NAME) == 0);
+
+   /* the branching rule is included together with the reader */
+
+   return SCIP_OKAY;
+}
+
+/** deinitialization method of branching rule (called before transformed problem is freed) */
+static
+SCIP_DECL_BRANCHEXIT(branchExitCheckpoint)
+{  /*lint --e{715}*/
+   assert(branchrule != NULL);
+
+   readerdataClear(scip, (SCIP_READERDATA*) SCIPbranchruleGetData(branchrule));
+
+   return SCIP_OKAY;
+}
+
+/** branching execution method for fractional LP solutions */
+static
+SCIP_DECL_BRANCHEXECLP(branchExeclpCheckpoint)
+{  /*lint --e{715}*/
+   assert(branchrule != NULL);
+   assert(result != NULL);
+
+   SCIP_CALL( applyCheckpoint(scip, (SCIP_READERDATA*) SCIPbranchruleGetData(branchrule), result) );
+
+   return SCIP_OKAY;
+}
+
+/** branching execution method for external candidates */
+static
+SCIP_DECL_BRANCHEXECEXT(branchExecextCheckpoint)
+{  /*lint --e{715}*/
+   assert(branchrule != NULL);
+   assert(result != NULL);
+
+   SCIP_CALL( applyCheckpoint(scip, (SCIP_READERDATA*) SCIPbranchruleGetData(branchrule), result) );
+
+   return SCIP_OKAY;
+}
+
+/** branching execution method for not completely fixed pseudo solutions */
+static
+SCIP_DECL_BRANCHEXECPS(branchExecpsCheckpoint)
+{  /*lint --e{715}*/
+   assert(branchrule != NULL);
+   assert(result != NULL);
+
+   SCIP_CALL( applyCheckpoint(scip, (SCIP_READERDATA*) SCIPbranchruleGetData(branchrule), result) );
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * Callback methods of reader
+ */
+
+/** copy method for reader plugins (called when SCIP copies plugins) */
+static
+SCIP_DECL_READERCOPY(readerCopyCkp)
+{  /*lint --e{715}*/
+   assert(scip != NULL);
+   assert(reader != NULL);
+   assert(strcmp(SCIPreaderGetName(reader), READER_NAME) == 0);
+
+   /* call inclusion method of reader */
+   SCIP_CALL( SCIPincludeReaderCkp(scip) );
+
+   return SCIP_OKAY;
+}
+
+/** destructor of reader to free reader data (called when SCIP is exiting) */
+static
+SCIP_DECL_READERFREE(readerFreeCkp)
+{  /*lint --e{715}*/
+   SCIP_READERDATA* readerdata;
+
+   assert(strcmp(SCIPreaderGetName(reader), READER_NAME) == 0);
+
+   readerdata = SCIPreaderGetData(reader);
+   assert(readerdata != NULL);
+
+   readerdataClear(scip, readerdata);
+   SCIPfreeBlockMemory(scip, &readerdata);
+
+   return SCIP_OKAY;
+}
+
+/** problem reading method of reader */
+static
+SCIP_DECL_READERREAD(readerReadCkp)
+{  /*lint --e{715}*/
+   assert(reader != NULL);
+   assert(strcmp(SCIPreaderGetName(reader), READER_NAME) == 0);
+   assert(result != NULL);
+
+   *result = SCIP_DIDNOTRUN;
+
+   SCIP_CALL( readCheckpoint(scip, filename, SCIPreaderGetData(reader)) );
+
+   *result = SCIP_SUCCESS;
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * reader specific interface methods
+ */
+
+/** includes the ckp file reader and the branching rule that restores the open nodes of a checkpoint into SCIP */
+SCIP_RETCODE SCIPincludeReaderCkp(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_READERDATA* readerdata;
+   SCIP_BRANCHRULE* branchrule;
+   SCIP_READER* reader;
+
+   /* create reader data */
+   SCIP_CALL( SCIPallocClearBlockMemory(scip, &readerdata) );
+
+   /* include reader */
+   SCIP_CALL( SCIPincludeReaderBasic(scip, &reader, READER_NAME, READER_DESC, READER_EXTENSION, readerdata) );
+   assert(reader != NULL);
+
+   SCIP_CALL( SCIPsetReaderCopy(scip, reader, readerCopyCkp) );
+   SCIP_CALL( SCIPsetReaderRead(scip, reader, readerReadCkp) );
+   SCIP_CALL( SCIPsetReaderFree(scip, reader, readerFreeCkp) );
+
+   /* include branching rule sharing the reader data */
+   SCIP_CALL( SCIPincludeBranchruleBasic(scip, &branchrule, BRANCHRULE_NAME, BRANCHRULE_DESC, BRANCHRULE_PRIORITY,
+         BRANCHRULE_MAXDEPTH, BRANCHRULE_MAXBOUNDDIST, (SCIP_BRANCHRULEDATA*) readerdata) );
+   assert(branchrule != NULL);
+
+   SCIP_CALL( SCIPsetBranchruleCopy(scip, branchrule, branchCopyCheckpoint) );
+   SCIP_CALL( SCIPsetBranchruleExit(scip, branchrule, branchExitCheckpoint) );
+   SCIP_CALL( SCIPsetBranchruleExecLp(scip, branchrule, branchExeclpCheckpoint) );
+   SCIP_CALL( SCIPsetBranchruleExecExt(scip, branchrule, branchExecextCheckpoint) );
+   SCIP_CALL( SCIPsetBranchruleExecPs(scip, branchrule, branchExecpsCheckpoint) );
+
+   return SCIP_OKAY;
+}
+
+/** writes a checkpoint of the current solving process */
+SCIP_RETCODE SCIPwriteCkp(
+   SCIP*                 scip,               /**< SCIP data structure */
+   const char*           filename            /**< name of the checkpoint file */
+   )
+{
+   char probfilename[SCIP_MAXSTRLEN];
+   SCIP_HASHMAP* varmap;
+   SCIP_RETCODE retcode;
+   FILE* file;
+   SCIP* copy;
+   int nnodes;
+
+   assert(scip != NULL);
+   assert(filename != NULL);
+
+   if( SCIPgetStage(scip) < SCIP_STAGE_PRESOLVED || SCIPgetStage(scip) > SCIP_STAGE_SOLVED )
+   {
+      SCIPerrorMessage("checkpoints can only be written after presolving\n");
+      return SCIP_INVALIDCALL;
+   }
+
+   (void) SCIPsnprintf(probfilename, SCIP_MAXSTRLEN, "%s%s", filename, CKP_PROBEXTENSION);
+
+   /* write the global transformed problem */
+   SCIP_CALL( SCIPcreate(&copy) );
+   SCIPsetMessagehdlrQuiet(copy, TRUE);
+   SCIP_CALL( SCIPhashmapCreate(&varmap, SCIPblkmem(copy), SCIPgetNVars(scip)) );
+
+   retcode = writeProblem(scip, probfilename, varmap, copy);
+
+   if( retcode == SCIP_OKAY )
+   {
+      file = fopen(filename, "w");
+      if( file == NULL )
+      {
+         SCIPerrorMessage("cannot create file <%s> for writing\n", filename);
+         SCIPprintSysError(filename);
+         retcode = SCIP_FILECREATEERROR;
+      }
+      else
+      {
+         retcode = writeCheckpoint(scip, file, probfilename, varmap, &nnodes);
+         fclose(file);
+
+         if( retcode == SCIP_OKAY )
+         {
+            SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "written checkpoint with %d open nodes to file <%s>\n",
+               nnodes, filename);
+         }
+      }
+   }
+
+   SCIPhashmapFree(&varmap);
+   SCIP_CALL( SCIPfree(&copy) );
+
+   return retcode;
+}
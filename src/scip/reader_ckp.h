@@ -0,0 +1,80 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   reader_ckp.h
+ * @ingroup FILEREADERS
+ * @brief  CKP file reader for checkpoints of interrupted solves
+ *
+ * A checkpoint stores the state of an interrupted branch-and-bound solve: the global transformed problem, the
+ * incumbent, the branching history of the variables, and the open nodes of the search tree given by their
+ * branching decisions and dual bounds.  Reading a checkpoint file with extension "ckp" restores this state such that
+ * a subsequent call of SCIPsolve() continues the search instead of starting from scratch.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_READER_CKP_H__
+#define __SCIP_READER_CKP_H__
+
+#include "scip/def.h"
+#include "scip/type_retcode.h"
+#include "scip/type_scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** includes the ckp file reader and the branching rule that restores the open nodes of a checkpoint into SCIP
+ *
+ *  @ingroup FileReaderIncludes
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPincludeReaderCkp(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+/**@addtogroup FILEREADERS
+ *
+ * @{
+ */
+
+/** writes a checkpoint of the current solving process
+ *
+ *  Besides the checkpoint file itself, the global transformed problem is written in CIP format to a file with the
+ *  same name and the additional extension ".cip".  Local constraints and the bound changes of the current focus path
+ *  are not part of the checkpoint; the open nodes are stored by their branching decisions only.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked, \ref SCIP_FILECREATEERROR if a file could not be created,
+ *          and \ref SCIP_WRITEERROR if the problem could not be copied completely.  Otherwise a suitable error code is
+ *          passed.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPwriteCkp(
+   SCIP*                 scip,               /**< SCIP data structure */
+   const char*           filename            /**< name of the checkpoint file */
+   );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
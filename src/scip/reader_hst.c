@@ -0,0 +1,295 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   reader_hst.c
+ * @ingroup DEFPLUGINS_READER
+ * @brief  file reader for branching histories of variables
+ *
+ * This reader allows to read a file containing the branching history of variables of the current problem, e.g., to
+ * warm start the branching of a problem that is solved repeatedly with slightly different data.  Each line of the file
+ * should have format
+ *
+ *    \<variable name\> \<value 1\> ... \<value 20\>
+ *
+ * where the values are the ones returned by SCIPgetVarHistoryData(), i.e., the pseudo cost count, mean, and variance,
+ * the VSIDS, the conflict length sum, the inference sum, the cutoff sum, the number of active conflicts, the number of
+ * branchings, and the branching depth sum, each first for the downwards and then for the upwards direction.  Lines with
+ * unknown variable names are ignored.
+ *
+ * The values are added to the histories of the variables with SCIPaddVarHistoryData().  They are counted as
+ * observations of previous runs, such that they are used for the branching scores, but the reliability branching rule
+ * only regards them as reliable if parameter branching/relpscost/prevrunweight is positive.
+ *
+ * Writing is possible in problem and transformed stages.  Only variables with a nonzero history are written, and as for
+ * the bounds reader, the leading "t_" of transformed variables is stripped.  Writing the original problem after a solve
+ * gives the histories of the transformed variables under the names of the original variables.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/pub_fileio.h"
+#include "scip/pub_message.h"
+#include "scip/pub_misc.h"
+#include "scip/pub_reader.h"
+#include "scip/pub_var.h"
+#include "scip/reader_hst.h"
+#include "scip/scip_general.h"
+#include "scip/scip_message.h"
+#include "scip/scip_param.h"
+#include "scip/scip_reader.h"
+#include "scip/scip_var.h"
+#include <string.h>
+
+
+#define READER_NAME             "hstreader"
+#define READER_DESC             "file reader for branching histories of variables"
+#define READER_EXTENSION        "hst"
+
+
+/*
+ * Local methods of reader
+ */
+
+/** reads a given history file */
+static
+SCIP_RETCODE readHistory(
+   SCIP*                 scip,               /**< SCIP data structure */
+   const char*           fname               /**< name of the input file */
+   )
+{
+   SCIP_RETCODE retcode;
+   SCIP_FILE* file;
+   SCIP_Bool error;
+   SCIP_Bool unknownvariablemessage;
+   SCIP_Bool usevartable;
+   int nvars;
+   int lineno;
+
+   assert(scip != NULL);
+   assert(fname != NULL);
+
+   SCIP_CALL( SCIPgetBoolParam(scip, "misc/usevartable", &usevartable) );
+
+   if( !usevartable )
+   {
+      SCIPerrorMessage("Cannot read history file if vartable is disabled. Make sure parameter 'misc/usevartable' is set to TRUE.\n");
+      return SCIP_READERROR;
+   }
+
+   /* open input file */
+   file = SCIPfopen(fname, "r");
+   if( file == NULL )
+   {
+      SCIPerrorMessage("cannot open file <%s> for reading\n", fname);
+      SCIPprintSysError(fname);
+      return SCIP_NOFILE;
+   }
+
+   /* read the file */
+   error = FALSE;
+   unknownvariablemessage = FALSE;
+   nvars = 0;
+   lineno = 0;
+   while( !SCIPfeof(file) && !error )
+   {
+      char buffer[SCIP_MAXSTRLEN];
+      SCIP_Real data[SCIP_HISTORY_NDATA];
+      SCIP_VAR* var;
+      char* endptr;
+      char* str;
+      int i;
+
+      /* get next line */
+      if( SCIPfgets(buffer, (int) sizeof(buffer), file) == NULL )
+         break;
+      lineno++;
+
+      /* skip empty lines */
+      if( buffer[0] == '\n' || buffer[0] == '\r' || buffer[0] == '\0' )
+         continue;
+
+      retcode = SCIPparseVarName(scip, buffer, &var, &endptr);
+      if( retcode != SCIP_OKAY )
+      {
+         SCIPerrorMessage("Error parsing variable name in line %d of history file <%s>\n", lineno, fname);
+         error = TRUE;
+         break;
+      }
+
+      if( var == NULL )
+      {
+         if( !unknownvariablemessage )
+         {
+            SCIPwarningMessage(scip, "unable to parse variable name in line %d of history file <%s>:\n", lineno, fname);
+            SCIPwarningMessage(scip, "line is: %s", buffer);
+            SCIPwarningMessage(scip, "  (further unknown variables are ignored)\n");
+            unknownvariablemessage = TRUE;
+         }
+         continue;
+      }
+
+      /* parse the history values */
+      str = endptr;
+      for( i = 0; i < SCIP_HISTORY_NDATA; ++i )
+      {
+         if( !SCIPstrToRealValue(str, &data[i], &endptr) )
+            break;
+         str = endptr;
+      }
+
+      if( i < SCIP_HISTORY_NDATA )
+      {
+         SCIPerrorMessage("invalid input line %d in history file <%s>: <%s>\n", lineno, fname, buffer);
+         error = TRUE;
+         break;
+      }
+
+      retcode = SCIPaddVarHistoryData(scip, var, data);
+      if( retcode != SCIP_OKAY )
+      {
+         SCIPerrorMessage("Error adding history for variable <%s> in line %d of history file <%s>\n",
+            SCIPvarGetName(var), lineno, fname);
+         error = TRUE;
+         break;
+      }
+      ++nvars;
+   }
+
+   /* close input file */
+   SCIPfclose(file);
+
+   /* return error if necessary */
+   if ( error )
+      return SCIP_READERROR;
+
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "read branching history of %d variables\n", nvars);
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * Callback methods of reader
+ */
+
+/** copy method for reader plugins (called when SCIP copies plugins) */
+static
+SCIP_DECL_READERCOPY(readerCopyHst)
+{  /*lint --e{715}*/
+   assert(scip != NULL);
+   assert(reader != NULL);
+   assert(strcmp(SCIPreaderGetName(reader), READER_NAME) == 0);
+
+   /* call inclusion method of reader */
+   SCIP_CALL( SCIPincludeReaderHst(scip) );
+
+   return SCIP_OKAY;
+}
+
+/** problem reading method of reader */
+static
+SCIP_DECL_READERREAD(readerReadHst)
+{  /*lint --e{715}*/
+   assert(reader != NULL);
+   assert(strcmp(SCIPreaderGetName(reader), READER_NAME) == 0);
+   assert(result != NULL);
+
+   *result = SCIP_DIDNOTRUN;
+
+   if( SCIPgetStage(scip) < SCIP_STAGE_PROBLEM )
+   {
+      SCIPerrorMessage("reading of history file is only possible after a problem was created\n");
+      return SCIP_READERROR;
+   }
+
+   if( SCIPgetStage(scip) > SCIP_STAGE_SOLVING )
+   {
+      SCIPerrorMessage("reading of history file is not possible after the problem was solved\n");
+      return SCIP_READERROR;
+   }
+
+   /* read history file */
+   SCIP_CALL( readHistory(scip, filename) );
+
+   *result = SCIP_SUCCESS;
+
+   return SCIP_OKAY;
+}
+
+/** problem writing method of reader */
+static
+SCIP_DECL_READERWRITE(readerWriteHst)
+{  /*lint --e{715}*/
+   int v;
+
+   assert(reader != NULL);
+   assert(strcmp(SCIPreaderGetName(reader), READER_NAME) == 0);
+   assert(result != NULL);
+
+   for( v = 0; v < nvars; ++v )
+   {
+      SCIP_Real data[SCIP_HISTORY_NDATA];
+      const char* varname;
+      SCIP_Bool empty;
+      int i;
+
+      SCIP_CALL( SCIPgetVarHistoryData(scip, vars[v], data) );
+
+      empty = TRUE;
+      for( i = 0; i < SCIP_HISTORY_NDATA && empty; ++i )
+         empty = (data[i] == 0.0); /*lint !e777*/
+
+      if( empty )
+         continue;
+
+      varname = SCIPvarGetName(vars[v]);
+
+      /* strip 't_' from varname */
+      if( SCIPvarIsTransformedOrigvar(vars[v]) && strncmp(varname, "t_", 2) == 0 )
+         varname = varname + 2;
+
+      SCIPinfoMessage(scip, file, "<%s>", varname);
+      for( i = 0; i < SCIP_HISTORY_NDATA; ++i )
+         SCIPinfoMessage(scip, file, " %.15g", data[i]);
+      SCIPinfoMessage(scip, file, "\n");
+   }
+
+   *result = SCIP_SUCCESS;
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * hst file reader specific interface methods
+ */
+
+/** includes the hst file reader in SCIP */
+SCIP_RETCODE SCIPincludeReaderHst(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_READER* reader;
+
+   /* include reader */
+   SCIP_CALL( SCIPincludeReaderBasic(scip, &reader, READER_NAME, READER_DESC, READER_EXTENSION, NULL) );
+
+   /* set non fundamental callbacks via setter functions */
+   SCIP_CALL( SCIPsetReaderCopy(scip, reader, readerCopyHst) );
+   SCIP_CALL( SCIPsetReaderRead(scip, reader, readerReadHst) );
+   SCIP_CALL( SCIPsetReaderWrite(scip, reader, readerWriteHst) );
+
+   return SCIP_OKAY;
+}
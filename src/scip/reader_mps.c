@@ -28,6 +28,11 @@
  * name lengths and coefficients are considerably relaxed. The columns
  * in the format are then separated by whitespaces.
  *
+ * The file is read in large blocks. The lines of the COLUMNS section that are contained in a block are parsed in
+ * chunks, which can be processed in parallel, see parameter reading/mpsreader/nthreads. The coefficients are collected
+ * in a column-wise matrix and the linear constraints are created at once with all their coefficients at the end of
+ * the COLUMNS section. The problem that is read does not depend on the number of threads.
+ *
  * @todo Check whether constructing the names for aggregated constraint yields name clashes (aggrXXX).
  */
 
@@ -46,6 +51,7 @@
 #include "scip/cons_sos1.h"
 #include "scip/cons_sos2.h"
 #include "scip/cons_varbound.h"
+#include "scip/concurrent.h"
 #include "scip/pub_cons.h"
 #include "scip/pub_fileio.h"
 #include "scip/pub_message.h"
@@ -63,6 +69,7 @@
 #include "scip/scip_reader.h"
 #include "scip/scip_solvingstats.h"
 #include "scip/scip_var.h"
+#include "tpi/tpi.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -72,6 +79,7 @@
 
 #define DEFAULT_LINEARIZE_ANDS         TRUE  /**< should possible \"and\" constraint be linearized when writing the mps file? */
 #define DEFAULT_AGGRLINEARIZATION_ANDS TRUE  /**< should an aggregated linearization for and constraints be used? */
+#define DEFAULT_NTHREADS                  1  /**< number of threads used to parse the COLUMNS section */
 
 /*
  * mps reader internal methods
@@ -81,6 +89,12 @@
 #define MPS_MAX_NAMELEN   256
 #define MPS_MAX_VALUELEN   26
 #define MPS_MAX_FIELDLEN   20
+#define MPS_READBUFSIZE   (1 << 22)          /**< size of the buffer in which the file is read in blocks */
+#define MPS_MINCHUNKSIZE  (1 << 16)          /**< minimal number of bytes of the COLUMNS section parsed by one thread */
+
+#define MPS_ROW_OBJ       -1                 /**< row index of the objective function */
+#define MPS_ROW_NONE      -2                 /**< row index of a missing second entry in a line */
+#define MPS_ROW_UNKNOWN   -3                 /**< row index of a row that has not been declared */
 
 #define PATCH_CHAR    '_'
 #define BLANK         ' '
@@ -114,11 +128,34 @@ enum MpsSection
 };
 typedef enum MpsSection MPSSECTION;
 
+/** row declared in the ROWS, USERCUTS, or LAZYCONS section, for which a linear constraint is created after the
+ *  COLUMNS section
+ */
+struct MpsRow
+{
+   char*                 name;               /**< name of the row */
+   MPSSECTION            section;            /**< section in which the row was declared */
+   char                  type;               /**< type of the row: 'G', 'E', or 'L' */
+   int                   idx;                /**< index of the row */
+};
+typedef struct MpsRow MPSROW;
+
 /** mps input structure */
 struct MpsInput
 {
    MPSSECTION            section;
    SCIP_FILE*            fp;
+   char*                 readbuf;            /**< buffer in which the file is read in blocks */
+   int                   readbufsize;        /**< size of the read buffer */
+   int                   readbufend;         /**< end of the data in the read buffer */
+   int                   readbufpos;         /**< position of the next line in the read buffer */
+   SCIP_Bool             readbufeof;         /**< has the end of the data been read into the buffer? */
+   MPSROW**              rows;               /**< declared rows */
+   int                   nrows;              /**< number of declared rows */
+   int                   rowssize;           /**< size of rows array */
+   SCIP_HASHTABLE*       rowtable;           /**< hash table of the declared rows by name, or NULL */
+   int                   nthreads;           /**< number of threads used to parse the COLUMNS section */
+   int                   nmarkers;           /**< number of integrality markers read */
    int                   lineno;
    SCIP_OBJSENSE         objsense;
    SCIP_Bool             haserror;
@@ -151,6 +188,52 @@ struct SparseMatrix
 };
 typedef struct SparseMatrix SPARSEMATRIX;
 
+/** entry of a line of the COLUMNS section */
+struct MpsColEntry
+{
+   SCIP_Real             vals[2];            /**< coefficients of the line */
+   int                   rows[2];            /**< row indices of the coefficients, or MPS_ROW_OBJ, MPS_ROW_NONE, MPS_ROW_UNKNOWN */
+   int                   rownames[2];        /**< positions of the names of unknown rows in the name storage, or -1 */
+   int                   colname;            /**< position of the column name in the name storage */
+   int                   lineno;             /**< line number, relative to the start of the chunk */
+   SCIP_Bool             isinteger;          /**< is the column integer, if integrality markers were read before? */
+   SCIP_Bool             intmarked;          /**< were integrality markers read in the chunk before the line? */
+};
+typedef struct MpsColEntry MPSCOLENTRY;
+
+/** chunk of lines of the COLUMNS section that is parsed by one job */
+struct MpsColChunk
+{
+   MPSINPUT              mpsi;               /**< mps input structure that reads the lines of the chunk */
+   MPSCOLENTRY*          entries;            /**< entries of the lines */
+   char*                 names;              /**< storage for the names of the entries */
+   int                   nentries;           /**< number of entries */
+   int                   entriessize;        /**< size of entries array */
+   int                   namesend;           /**< end of the used part of the name storage */
+   int                   namessize;          /**< size of the name storage */
+   int                   startpos;           /**< position of the chunk in the read buffer */
+   int                   endpos;             /**< end of the chunk in the read buffer */
+   int                   stoppos;            /**< position of the line at which parsing stopped, or -1 */
+   SCIP_Bool             startnewformat;     /**< was the new format detected before the chunk? */
+};
+typedef struct MpsColChunk MPSCOLCHUNK;
+
+/** coefficient matrix of the COLUMNS section in column-wise order */
+struct MpsMatrix
+{
+   SCIP_VAR**            cols;               /**< variables of the columns */
+   int*                  rowidx;             /**< row indices of the coefficients */
+   SCIP_Real*            vals;               /**< coefficients */
+   int*                  colbeg;             /**< position of the first coefficient of each column */
+   int*                  rowlens;            /**< number of coefficients in each row */
+   int                   nrows;              /**< number of rows */
+   int                   ncols;              /**< number of columns */
+   int                   colssize;           /**< size of cols array */
+   int                   nentries;           /**< number of coefficients */
+   int                   entriessize;        /**< size of rowidx and vals arrays */
+};
+typedef struct MpsMatrix MPSMATRIX;
+
 /** struct for mapping cons names to numbers */
 struct ConsNameFreq
 {
@@ -172,8 +255,19 @@ SCIP_RETCODE mpsinputCreate(
 
    SCIP_CALL( SCIPallocBlockMemory(scip, mpsi) );
 
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*mpsi)->readbuf, MPS_READBUFSIZE) );
+
    (*mpsi)->section     = MPS_NAME;
    (*mpsi)->fp          = fp;
+   (*mpsi)->readbufsize = MPS_READBUFSIZE;
+   (*mpsi)->readbufend  = 0;
+   (*mpsi)->readbufpos  = 0;
+   (*mpsi)->readbufeof  = FALSE;
+   (*mpsi)->rows        = NULL;
+   (*mpsi)->nrows       = 0;
+   (*mpsi)->rowssize    = 0;
+   (*mpsi)->rowtable    = NULL;
+   (*mpsi)->nmarkers    = 0;
    (*mpsi)->lineno      = 0;
    (*mpsi)->objsense    = SCIP_OBJSENSE_MINIMIZE;
    (*mpsi)->haserror    = FALSE;
@@ -193,6 +287,7 @@ SCIP_RETCODE mpsinputCreate(
    SCIP_CALL( SCIPgetBoolParam(scip, "reading/dynamicconss", &((*mpsi)->dynamicconss)) );
    SCIP_CALL( SCIPgetBoolParam(scip, "reading/dynamiccols", &((*mpsi)->dynamiccols)) );
    SCIP_CALL( SCIPgetBoolParam(scip, "reading/dynamicrows", &((*mpsi)->dynamicrows)) );
+   SCIP_CALL( SCIPgetIntParam(scip, "reading/" READER_NAME "/nthreads", &((*mpsi)->nthreads)) );
 
    return SCIP_OKAY;
 }
@@ -204,9 +299,70 @@ void mpsinputFree(
    MPSINPUT**            mpsi                /**< mps input structure */
    )
 {
+   int i;
+
+   if( (*mpsi)->rowtable != NULL )
+      SCIPhashtableFree(&(*mpsi)->rowtable);
+
+   for( i = (*mpsi)->nrows - 1; i >= 0; --i )
+   {
+      SCIPfreeBlockMemoryArray(scip, &(*mpsi)->rows[i]->name, strlen((*mpsi)->rows[i]->name) + 1);
+      SCIPfreeBlockMemory(scip, &(*mpsi)->rows[i]);
+   }
+   SCIPfreeBlockMemoryArrayNull(scip, &(*mpsi)->rows, (*mpsi)->rowssize);
+   SCIPfreeBlockMemoryArray(scip, &(*mpsi)->readbuf, (*mpsi)->readbufsize);
    SCIPfreeBlockMemory(scip, mpsi);
 }
 
+/** gets the key (i.e. the name) of the given row */
+static
+SCIP_DECL_HASHGETKEY(hashGetKeyRow)
+{  /*lint --e{715}*/
+   MPSROW* row = (MPSROW*)elem;
+
+   assert(row != NULL);
+   assert(row->name != NULL);
+
+   return (void*)row->name;
+}
+
+/** declares a row, for which a linear constraint is created after the COLUMNS section */
+static
+SCIP_RETCODE mpsinputAddRow(
+   SCIP*                 scip,               /**< SCIP data structure */
+   MPSINPUT*             mpsi,               /**< mps input structure */
+   const char*           name,               /**< name of the row */
+   char                  type                /**< type of the row: 'G', 'E', or 'L' */
+   )
+{
+   MPSROW* row;
+
+   assert(mpsi != NULL);
+   assert(name != NULL);
+   assert(type == 'G' || type == 'E' || type == 'L');
+
+   if( mpsi->rowtable == NULL )
+   {
+      SCIP_CALL( SCIPhashtableCreate(&mpsi->rowtable, SCIPblkmem(scip), SCIP_HASHSIZE_NAMES,
+            hashGetKeyRow, SCIPhashKeyEqString, SCIPhashKeyValString, NULL) );
+   }
+
+   SCIP_CALL( SCIPensureBlockMemoryArray(scip, &mpsi->rows, &mpsi->rowssize, mpsi->nrows + 1) );
+
+   SCIP_CALL( SCIPallocBlockMemory(scip, &row) );
+   SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &row->name, name, strlen(name) + 1) );
+   row->section = mpsi->section;
+   row->type = type;
+   row->idx = mpsi->nrows;
+
+   mpsi->rows[mpsi->nrows] = row;
+   ++mpsi->nrows;
+
+   SCIP_CALL( SCIPhashtableInsert(mpsi->rowtable, (void*)row) );
+
+   return SCIP_OKAY;
+}
+
 /** returns the current section */
 static
 MPSSECTION mpsinputSection(
@@ -449,6 +605,73 @@ void patchField(
          buf[i] = PATCH_CHAR;
 }
 
+/** moves the unread data to the front of the read buffer and fills the rest of the buffer from the file */
+static
+void mpsinputFillBuffer(
+   MPSINPUT*             mpsi                /**< mps input structure */
+   )
+{
+   assert(mpsi != NULL);
+
+   if( mpsi->readbufeof )
+      return;
+
+   assert(mpsi->fp != NULL);
+
+   if( mpsi->readbufpos > 0 )
+   {
+      mpsi->readbufend -= mpsi->readbufpos;
+      memmove(mpsi->readbuf, &mpsi->readbuf[mpsi->readbufpos], (size_t)mpsi->readbufend);
+      mpsi->readbufpos = 0;
+   }
+
+   while( mpsi->readbufend < mpsi->readbufsize )
+   {
+      size_t nread;
+
+      nread = SCIPfread(&mpsi->readbuf[mpsi->readbufend], 1, (size_t)(mpsi->readbufsize - mpsi->readbufend), mpsi->fp);
+
+      if( nread == 0 )
+      {
+         mpsi->readbufeof = TRUE;
+         break;
+      }
+
+      mpsi->readbufend += (int)nread;
+   }
+}
+
+/** copies the next line from the read buffer into the line buffer; as fgets(), it reads at most
+ *  MPS_MAX_LINELEN - 1 characters and keeps the newline; returns FALSE if the end of the data is reached
+ */
+static
+SCIP_Bool mpsinputGetLine(
+   MPSINPUT*             mpsi                /**< mps input structure */
+   )
+{
+   const char* newline;
+   int len;
+
+   assert(mpsi != NULL);
+
+   if( mpsi->readbufend - mpsi->readbufpos < MPS_MAX_LINELEN - 1 )
+      mpsinputFillBuffer(mpsi);
+
+   len = MIN(mpsi->readbufend - mpsi->readbufpos, MPS_MAX_LINELEN - 1);
+   if( len <= 0 )
+      return FALSE;
+
+   newline = (const char*) memchr(&mpsi->readbuf[mpsi->readbufpos], '\n', (size_t)len);
+   if( newline != NULL )
+      len = (int)(newline - &mpsi->readbuf[mpsi->readbufpos]) + 1;
+
+   memcpy(mpsi->buf, &mpsi->readbuf[mpsi->readbufpos], (size_t)len);
+   mpsi->buf[len] = '\0';
+   mpsi->readbufpos += len;
+
+   return TRUE;
+}
+
 /** read a mps format data line and parse the fields. */
 static
 SCIP_Bool mpsinputReadLine(
@@ -471,8 +694,7 @@ SCIP_Bool mpsinputReadLine(
       /* Read until we have not a comment line. */
       do
       {
-         mpsi->buf[MPS_MAX_LINELEN-1] = '\0';
-         if( NULL == SCIPfgets(mpsi->buf, (int) sizeof(mpsi->buf), mpsi->fp) )
+         if( !mpsinputGetLine(mpsi) )
             return FALSE;
          mpsi->lineno++;
       }
@@ -594,6 +816,7 @@ SCIP_Bool mpsinputReadLine(
                mpsi->isinteger = FALSE;
             else
                break; /* unknown marker */
+            ++mpsi->nmarkers;
          }
          if( !strcmp(mpsi->f3, "'MARKER'") )
             is_marker = TRUE;
@@ -611,6 +834,7 @@ SCIP_Bool mpsinputReadLine(
                mpsi->isinteger = FALSE;
             else
                break; /* unknown marker */
+            ++mpsi->nmarkers;
          }
          if( (NULL == (mpsi->f5 = SCIPstrtok(NULL, " ", &nexttok))) || (*mpsi->f5 == '$') )
             mpsi->f5 = 0;
@@ -887,51 +1111,21 @@ SCIP_RETCODE readRows(
       }
       else
       {
-         SCIP_CONS* cons;
-         SCIP_Bool initial;
-         SCIP_Bool separate;
-         SCIP_Bool enforce;
-         SCIP_Bool check;
-         SCIP_Bool propagate;
-         SCIP_Bool local;
-         SCIP_Bool modifiable;
-         SCIP_Bool dynamic;
-         SCIP_Bool removable;
-
-         cons = SCIPfindCons(scip, mpsinputField2(mpsi));
-         if( cons != NULL )
+         if( mpsi->rowtable != NULL && SCIPhashtableRetrieve(mpsi->rowtable, (void*)mpsinputField2(mpsi)) != NULL )
             break;
 
-         initial = mpsi->initialconss && (mpsinputSection(mpsi) == MPS_ROWS);
-         separate = TRUE;
-         enforce = (mpsinputSection(mpsi) != MPS_USERCUTS);
-         check = (mpsinputSection(mpsi) != MPS_USERCUTS);
-         propagate = TRUE;
-         local = FALSE;
-         modifiable = FALSE;
-         dynamic = mpsi->dynamicconss;
-         removable = mpsi->dynamicrows || (mpsinputSection(mpsi) == MPS_USERCUTS);
-
          switch(*mpsinputField1(mpsi))
          {
          case 'G' :
-            SCIP_CALL( SCIPcreateConsLinear(scip, &cons, mpsinputField2(mpsi), 0, NULL, NULL, 0.0, SCIPinfinity(scip),
-                  initial, separate, enforce, check, propagate, local, modifiable, dynamic, removable, FALSE) );
-            break;
          case 'E' :
-            SCIP_CALL( SCIPcreateConsLinear(scip, &cons, mpsinputField2(mpsi), 0, NULL, NULL, 0.0, 0.0,
-                  initial, separate, enforce, check, propagate, local, modifiable, dynamic, removable, FALSE) );
-            break;
          case 'L' :
-            SCIP_CALL( SCIPcreateConsLinear(scip, &cons, mpsinputField2(mpsi), 0, NULL, NULL, -SCIPinfinity(scip), 0.0,
-                  initial, separate, enforce, check, propagate, local, modifiable, dynamic, removable, FALSE) );
+            /* the linear constraint is created with all its coefficients after the COLUMNS section */
+            SCIP_CALL( mpsinputAddRow(scip, mpsi, mpsinputField2(mpsi), *mpsinputField1(mpsi)) );
             break;
          default :
             mpsinputSyntaxerror(mpsi);
             return SCIP_OKAY;
          }
-         SCIP_CALL( SCIPaddCons(scip, cons) );
-         SCIP_CALL( SCIPreleaseCons(scip, &cons) );
 
          /* if the file is of type cor, then the constraint names must be stored */
          SCIP_CALL( addConsNameToStorage(scip, consnames, consnamessize, nconsnames, mpsinputField2(mpsi)) );
@@ -942,7 +1136,640 @@ SCIP_RETCODE readRows(
    return SCIP_OKAY;
 }
 
-/** Process COLUMNS section. */
+/** stores a name in the name storage of a chunk of the COLUMNS section */
+static
+SCIP_RETCODE colChunkStoreName(
+   MPSCOLCHUNK*          chunk,              /**< chunk of the COLUMNS section */
+   const char*           name,               /**< name to store */
+   int*                  pos                 /**< pointer to store the position of the name in the name storage */
+   )
+{
+   int len;
+
+   assert(chunk != NULL);
+   assert(name != NULL);
+   assert(pos != NULL);
+
+   len = (int)strlen(name) + 1;
+
+   if( chunk->namesend + len > chunk->namessize )
+   {
+      int newsize;
+
+      newsize = MAX(2 * chunk->namessize, chunk->namesend + len);
+      newsize = MAX(newsize, MPS_MAX_LINELEN);
+      SCIP_ALLOC( BMSreallocMemoryArray(&chunk->names, newsize) );
+      chunk->namessize = newsize;
+   }
+
+   BMScopyMemoryArray(&chunk->names[chunk->namesend], name, len);
+   *pos = chunk->namesend;
+   chunk->namesend += len;
+
+   return SCIP_OKAY;
+}
+
+/** determines the row of a coefficient in the COLUMNS section */
+static
+SCIP_RETCODE colChunkGetRow(
+   MPSCOLCHUNK*          chunk,              /**< chunk of the COLUMNS section */
+   MPSINPUT*             mpsi,               /**< mps input structure that has read the line */
+   const char*           rowname,            /**< name of the row */
+   int*                  row,                /**< pointer to store the row index, or MPS_ROW_OBJ, MPS_ROW_UNKNOWN */
+   int*                  rownamepos          /**< pointer to store the position of the name of an unknown row, or -1 */
+   )
+{
+   MPSROW* mpsrow;
+
+   assert(rowname != NULL);
+   assert(row != NULL);
+   assert(rownamepos != NULL);
+
+   *rownamepos = -1;
+
+   if( !strcmp(rowname, mpsinputObjname(mpsi)) )
+   {
+      *row = MPS_ROW_OBJ;
+      return SCIP_OKAY;
+   }
+
+   /* the hash table is not modified while the COLUMNS section is parsed, so it can be read by several threads */
+   mpsrow = NULL;
+   if( mpsi->rowtable != NULL )
+      mpsrow = (MPSROW*)SCIPhashtableRetrieve(mpsi->rowtable, (void*)rowname);
+
+   if( mpsrow == NULL )
+   {
+      *row = MPS_ROW_UNKNOWN;
+      SCIP_CALL( colChunkStoreName(chunk, rowname, rownamepos) );
+   }
+   else
+      *row = mpsrow->idx;
+
+   return SCIP_OKAY;
+}
+
+/** adds the entry of the line of the COLUMNS section that has been read last to a chunk */
+static
+SCIP_RETCODE colChunkAddEntry(
+   MPSCOLCHUNK*          chunk,              /**< chunk of the COLUMNS section */
+   MPSINPUT*             mpsi                /**< mps input structure that has read the line */
+   )
+{
+   MPSCOLENTRY* entry;
+
+   assert(chunk != NULL);
+   assert(mpsinputField1(mpsi) != NULL);
+   assert(mpsinputField2(mpsi) != NULL);
+   assert(mpsinputField3(mpsi) != NULL);
+
+   if( chunk->nentries == chunk->entriessize )
+   {
+      int newsize;
+
+      newsize = MAX(2 * chunk->entriessize, 64);
+      SCIP_ALLOC( BMSreallocMemoryArray(&chunk->entries, newsize) );
+      chunk->entriessize = newsize;
+   }
+   entry = &chunk->entries[chunk->nentries];
+
+   /* consecutive lines of the same column share the column name */
+   if( chunk->nentries > 0 && !strcmp(&chunk->names[entry[-1].colname], mpsinputField1(mpsi)) )
+      entry->colname = entry[-1].colname;
+   else
+   {
+      SCIP_CALL( colChunkStoreName(chunk, mpsinputField1(mpsi), &entry->colname) );
+   }
+
+   SCIP_CALL( colChunkGetRow(chunk, mpsi, mpsinputField2(mpsi), &entry->rows[0], &entry->rownames[0]) );
+   entry->vals[0] = atof(mpsinputField3(mpsi));
+
+   if( mpsinputField5(mpsi) != NULL )
+   {
+      assert(mpsinputField4(mpsi) != NULL);
+
+      SCIP_CALL( colChunkGetRow(chunk, mpsi, mpsinputField4(mpsi), &entry->rows[1], &entry->rownames[1]) );
+      entry->vals[1] = atof(mpsinputField5(mpsi));
+   }
+   else
+   {
+      entry->rows[1] = MPS_ROW_NONE;
+      entry->rownames[1] = -1;
+      entry->vals[1] = 0.0;
+   }
+
+   entry->lineno = mpsi->lineno;
+   entry->isinteger = mpsinputIsInteger(mpsi);
+   entry->intmarked = (mpsi->nmarkers > 0);
+   ++chunk->nentries;
+
+   return SCIP_OKAY;
+}
+
+/** parses the lines of a chunk of the COLUMNS section
+ *
+ *  Parsing stops at the end of the chunk or at the first line that is not a coefficient line, e.g., the header of the
+ *  next section. Such a line is left to be read again sequentially.
+ */
+static
+SCIP_RETCODE parseColChunk(
+   void*                 args                /**< chunk passed in as a void pointer */
+   )
+{
+   MPSCOLCHUNK* chunk;
+   MPSINPUT* mpsi;
+
+   assert(args != NULL);
+
+   chunk = (MPSCOLCHUNK*) args;
+   mpsi = &chunk->mpsi;
+
+   chunk->nentries = 0;
+   chunk->namesend = 0;
+   chunk->stoppos = -1;
+
+   /* the mps input structure of the chunk only reads from the chunk */
+   mpsi->fp = NULL;
+   mpsi->readbufpos = chunk->startpos;
+   mpsi->readbufend = chunk->endpos;
+   mpsi->readbufeof = TRUE;
+   mpsi->lineno = 0;
+   mpsi->nmarkers = 0;
+   mpsi->isnewformat = chunk->startnewformat;
+
+   while( TRUE ) /*lint !e716*/
+   {
+      SCIP_Bool isnewformat;
+      SCIP_Bool isinteger;
+      int nmarkers;
+      int lineno;
+      int pos;
+
+      isnewformat = mpsi->isnewformat;
+      isinteger = mpsi->isinteger;
+      nmarkers = mpsi->nmarkers;
+      lineno = mpsi->lineno;
+      pos = mpsi->readbufpos;
+
+      if( !mpsinputReadLine(mpsi) )
+         break;
+
+      if( mpsinputField0(mpsi) != NULL || mpsinputField1(mpsi) == NULL || mpsinputField2(mpsi) == NULL
+         || mpsinputField3(mpsi) == NULL )
+      {
+         /* restore the state before the line, such that the line can be read again */
+         mpsi->isnewformat = isnewformat;
+         mpsi->isinteger = isinteger;
+         mpsi->nmarkers = nmarkers;
+         mpsi->lineno = lineno;
+         chunk->stoppos = pos;
+         break;
+      }
+
+      SCIP_CALL( colChunkAddEntry(chunk, mpsi) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** parses the given chunks of the COLUMNS section, in parallel if the task processing interface is available */
+static
+SCIP_RETCODE runColChunks(
+   MPSCOLCHUNK*          chunks,             /**< chunks of the COLUMNS section */
+   int                   first,              /**< index of the first chunk to parse */
+   int                   last                /**< index after the last chunk to parse */
+   )
+{
+   int c;
+
+   if( last - first > 1 && SCIPtpiIsAvailable() )
+   {
+      SCIP_RETCODE retcode;
+      int jobid;
+
+      jobid = SCIPtpiGetNewJobID();
+      retcode = SCIP_OKAY;
+
+      for( c = first; c < last && retcode == SCIP_OKAY; ++c )
+      {
+         SCIP_SUBMITSTATUS status;
+         SCIP_JOB* job;
+
+         SCIP_CALL( SCIPtpiCreateJob(&job, jobid, parseColChunk, (void*) &chunks[c]) );
+         retcode = SCIPtpiSumbitJob(job, &status);
+
+         if( retcode == SCIP_OKAY && status != SCIP_SUBMIT_SUCCESS )
+            retcode = SCIP_ERROR;
+      }
+
+      retcode = MIN(retcode, SCIPtpiCollectJobs(jobid));
+
+      SCIP_CALL( retcode );
+   }
+   else
+   {
+      for( c = first; c < last; ++c )
+      {
+         SCIP_CALL( parseColChunk((void*) &chunks[c]) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** splits the complete lines in the read buffer into chunks and parses them
+ *
+ *  The chunks end after a newline, such that the lines are read in the same pieces as when reading sequentially. Each
+ *  chunk is parsed under the assumption that the format of the previous chunks is kept. Since the switch to the new
+ *  format happens at most once, the chunks after the one that switched are parsed once more in the new format.
+ */
+static
+SCIP_RETCODE parseColChunks(
+   MPSINPUT*             mpsi,               /**< mps input structure */
+   MPSCOLCHUNK*          chunks,             /**< chunks of the COLUMNS section */
+   int                   maxnchunks,         /**< maximal number of chunks */
+   int                   end,                /**< end of the complete lines in the read buffer */
+   int*                  nchunks             /**< pointer to store the number of chunks */
+   )
+{
+   int chunksize;
+   int pos;
+   int c;
+
+   assert(mpsi != NULL);
+   assert(chunks != NULL);
+   assert(nchunks != NULL);
+   assert(end > mpsi->readbufpos);
+
+   *nchunks = MIN((end - mpsi->readbufpos) / MPS_MINCHUNKSIZE, maxnchunks);
+   *nchunks = MAX(*nchunks, 1);
+   chunksize = (end - mpsi->readbufpos) / *nchunks;
+
+   pos = mpsi->readbufpos;
+   c = 0;
+   while( pos < end )
+   {
+      const char* newline;
+      int chunkend;
+
+      assert(c < maxnchunks);
+
+      chunkend = end;
+      if( c < *nchunks - 1 && pos + chunksize < end )
+      {
+         newline = (const char*) memchr(&mpsi->readbuf[pos + chunksize - 1], '\n', (size_t)(end - pos - chunksize + 1));
+         if( newline != NULL )
+            chunkend = (int)(newline - mpsi->readbuf) + 1;
+      }
+
+      chunks[c].mpsi = *mpsi;
+      chunks[c].startpos = pos;
+      chunks[c].endpos = chunkend;
+      chunks[c].startnewformat = mpsi->isnewformat;
+
+      pos = chunkend;
+      ++c;
+   }
+   *nchunks = c;
+
+   SCIP_CALL( runColChunks(chunks, 0, *nchunks) );
+
+   for( c = 0; c < *nchunks - 1 && chunks[c].stoppos < 0; ++c )
+   {
+      if( chunks[c].mpsi.isnewformat && !chunks[c+1].startnewformat )
+      {
+         int i;
+
+         for( i = c + 1; i < *nchunks; ++i )
+            chunks[i].startnewformat = TRUE;
+
+         SCIP_CALL( runColChunks(chunks, c + 1, *nchunks) );
+         break;
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** initializes the coefficient matrix of the COLUMNS section */
+static
+SCIP_RETCODE matrixCreate(
+   SCIP*                 scip,               /**< SCIP data structure */
+   MPSMATRIX*            matrix,             /**< coefficient matrix */
+   int                   nrows               /**< number of declared rows */
+   )
+{
+   assert(matrix != NULL);
+
+   matrix->cols = NULL;
+   matrix->colbeg = NULL;
+   matrix->rowidx = NULL;
+   matrix->vals = NULL;
+   matrix->nrows = nrows;
+   matrix->ncols = 0;
+   matrix->colssize = 0;
+   matrix->nentries = 0;
+   matrix->entriessize = 0;
+
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &matrix->rowlens, MAX(nrows, 1)) );
+
+   return SCIP_OKAY;
+}
+
+/** frees the coefficient matrix of the COLUMNS section */
+static
+void matrixFree(
+   SCIP*                 scip,               /**< SCIP data structure */
+   MPSMATRIX*            matrix              /**< coefficient matrix */
+   )
+{
+   assert(matrix != NULL);
+
+   SCIPfreeBlockMemoryArray(scip, &matrix->rowlens, MAX(matrix->nrows, 1));
+   SCIPfreeBlockMemoryArrayNull(scip, &matrix->vals, matrix->entriessize);
+   SCIPfreeBlockMemoryArrayNull(scip, &matrix->rowidx, matrix->entriessize);
+   SCIPfreeBlockMemoryArrayNull(scip, &matrix->colbeg, matrix->colssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &matrix->cols, matrix->colssize);
+}
+
+/** adds a column to the coefficient matrix */
+static
+SCIP_RETCODE matrixAddCol(
+   SCIP*                 scip,               /**< SCIP data structure */
+   MPSMATRIX*            matrix,             /**< coefficient matrix */
+   SCIP_VAR*             var                 /**< variable of the column */
+   )
+{
+   assert(matrix != NULL);
+   assert(var != NULL);
+
+   if( matrix->ncols == matrix->colssize )
+   {
+      int newsize;
+
+      newsize = SCIPcalcMemGrowSize(scip, matrix->ncols + 1);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &matrix->cols, matrix->colssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &matrix->colbeg, matrix->colssize, newsize) );
+      matrix->colssize = newsize;
+   }
+
+   matrix->cols[matrix->ncols] = var;
+   matrix->colbeg[matrix->ncols] = matrix->nentries;
+   ++matrix->ncols;
+
+   return SCIP_OKAY;
+}
+
+/** adds a coefficient of the last column to the coefficient matrix */
+static
+SCIP_RETCODE matrixAddEntry(
+   SCIP*                 scip,               /**< SCIP data structure */
+   MPSMATRIX*            matrix,             /**< coefficient matrix */
+   int                   row,                /**< row index of the coefficient */
+   SCIP_Real             val                 /**< coefficient */
+   )
+{
+   assert(matrix != NULL);
+   assert(matrix->ncols > 0);
+   assert(0 <= row && row < matrix->nrows);
+
+   if( matrix->nentries == matrix->entriessize )
+   {
+      int newsize;
+
+      newsize = SCIPcalcMemGrowSize(scip, matrix->nentries + 1);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &matrix->rowidx, matrix->entriessize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &matrix->vals, matrix->entriessize, newsize) );
+      matrix->entriessize = newsize;
+   }
+
+   matrix->rowidx[matrix->nentries] = row;
+   matrix->vals[matrix->nentries] = val;
+   ++matrix->nentries;
+   ++matrix->rowlens[row];
+
+   return SCIP_OKAY;
+}
+
+/** processes an entry of the COLUMNS section: creates the variable of a new column and stores the coefficients */
+static
+SCIP_RETCODE applyColEntry(
+   SCIP*                 scip,               /**< SCIP data structure */
+   MPSINPUT*             mpsi,               /**< mps input structure */
+   MPSMATRIX*            matrix,             /**< coefficient matrix */
+   const MPSCOLENTRY*    entry,              /**< entry of the COLUMNS section */
+   const char*           names,              /**< name storage of the chunk of the entry */
+   int                   baselineno,         /**< line number at the start of the chunk of the entry */
+   SCIP_Bool             usevartable,        /**< is the variable hash table used? */
+   char*                 colname,            /**< name of the current column */
+   SCIP_VAR**            var,                /**< pointer to the variable of the current column, or NULL */
+   const char***         varnames,           /**< storage for the variable names, or NULL */
+   int*                  varnamessize,       /**< the size of the variable names storage, or NULL */
+   int*                  nvarnames           /**< the number of stored variable names, or NULL */
+   )
+{
+   const char* name;
+   int k;
+
+   assert(entry != NULL);
+   assert(names != NULL);
+   assert(colname != NULL);
+   assert(var != NULL);
+
+   name = &names[entry->colname];
+   mpsi->lineno = baselineno + entry->lineno;
+
+   /* new column? */
+   if( strcmp(colname, name) )
+   {
+      SCIP_Bool isinteger;
+
+      /* add the last variable to the problem */
+      if( *var != NULL )
+      {
+         SCIP_CALL( SCIPaddVar(scip, *var) );
+         SCIP_CALL( SCIPreleaseVar(scip, var) );
+      }
+      assert(*var == NULL);
+
+      (void)SCIPmemccpy(colname, name, '\0', MPS_MAX_NAMELEN - 1);
+
+      /* check whether we have seen this variable before, this would not allowed */
+      if( usevartable && SCIPfindVar(scip, colname) != NULL )
+      {
+         SCIPerrorMessage("Coeffients of column <%s> don't appear consecutively (line: %d)\n",
+            colname, mpsi->lineno);
+
+         return SCIP_READERROR;
+      }
+
+      /* if the file type is a cor file, the the variable name must be stored */
+      SCIP_CALL( addVarNameToStorage(scip, varnames, varnamessize, nvarnames, colname) );
+
+      /* integrality markers that are read before the line in its chunk overrule the state of the previous chunks */
+      isinteger = entry->intmarked ? entry->isinteger : mpsinputIsInteger(mpsi);
+
+      if( isinteger )
+      {
+         /* for integer variables, default bounds are 0 <= x < 1(not +infinity, like it is for continuous variables), and default cost is 0 */
+         SCIP_CALL( SCIPcreateVar(scip, var, colname, 0.0, 1.0, 0.0, SCIP_VARTYPE_BINARY,
+               !mpsi->dynamiccols, mpsi->dynamiccols, NULL, NULL, NULL, NULL, NULL) );
+      }
+      else
+      {
+         /* for continuous variables, default bounds are 0 <= x, and default cost is 0 */
+         SCIP_CALL( SCIPcreateVar(scip, var, colname, 0.0, SCIPinfinity(scip), 0.0, SCIP_VARTYPE_CONTINUOUS,
+               !mpsi->dynamiccols, mpsi->dynamiccols, NULL, NULL, NULL, NULL, NULL) );
+      }
+
+      SCIP_CALL( matrixAddCol(scip, matrix, *var) );
+   }
+   assert(*var != NULL);
+
+   for( k = 0; k < 2 && entry->rows[k] != MPS_ROW_NONE; ++k )
+   {
+      if( entry->rows[k] == MPS_ROW_OBJ )
+      {
+         SCIP_CALL( SCIPchgVarObj(scip, *var, entry->vals[k]) );
+      }
+      else if( entry->rows[k] == MPS_ROW_UNKNOWN )
+         mpsinputEntryIgnored(scip, mpsi, "Column", name, "row", &names[entry->rownames[k]], SCIP_VERBLEVEL_FULL);
+      else if( !SCIPisZero(scip, entry->vals[k]) )
+      {
+         /* warn the user in case the coefficient of the first entry is infinite */
+         if( k == 0 && SCIPisInfinity(scip, REALABS(entry->vals[k])) )
+         {
+            SCIPwarningMessage(scip, "Coefficient of variable <%s> in constraint <%s> contains infinite value <%e>,"
+               " consider adjusting SCIP infinity.\n", SCIPvarGetName(*var), mpsi->rows[entry->rows[k]]->name,
+               entry->vals[k]);
+         }
+         SCIP_CALL( matrixAddEntry(scip, matrix, entry->rows[k], entry->vals[k]) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** creates the linear constraints of the declared rows with all their coefficients from the matrix */
+static
+SCIP_RETCODE createRowConss(
+   SCIP*                 scip,               /**< SCIP data structure */
+   MPSINPUT*             mpsi,               /**< mps input structure */
+   MPSMATRIX*            matrix              /**< coefficient matrix */
+   )
+{
+   SCIP_VAR** rowvars;
+   SCIP_Real* rowvals;
+   int* rowbeg;
+   int r;
+   int c;
+   int i;
+
+   assert(mpsi != NULL);
+   assert(matrix != NULL);
+   assert(matrix->nrows == mpsi->nrows);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowbeg, mpsi->nrows + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowvars, MAX(matrix->nentries, 1)) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowvals, MAX(matrix->nentries, 1)) );
+
+   /* transpose the matrix; the coefficients of each row keep the order in which they were read, and the row lengths
+    * are used as insertion positions
+    */
+   rowbeg[0] = 0;
+   for( r = 0; r < mpsi->nrows; ++r )
+   {
+      rowbeg[r+1] = rowbeg[r] + matrix->rowlens[r];
+      matrix->rowlens[r] = rowbeg[r];
+   }
+
+   for( c = 0; c < matrix->ncols; ++c )
+   {
+      int colend;
+
+      colend = (c < matrix->ncols - 1 ? matrix->colbeg[c+1] : matrix->nentries);
+
+      for( i = matrix->colbeg[c]; i < colend; ++i )
+      {
+         r = matrix->rowidx[i];
+         rowvars[matrix->rowlens[r]] = matrix->cols[c];
+         rowvals[matrix->rowlens[r]] = matrix->vals[i];
+         ++matrix->rowlens[r];
+      }
+   }
+
+   /* the column-wise coefficients are not needed anymore */
+   SCIPfreeBlockMemoryArrayNull(scip, &matrix->vals, matrix->entriessize);
+   SCIPfreeBlockMemoryArrayNull(scip, &matrix->rowidx, matrix->entriessize);
+   matrix->entriessize = 0;
+   matrix->nentries = 0;
+
+   for( r = 0; r < mpsi->nrows; ++r )
+   {
+      SCIP_CONS* cons;
+      MPSROW* row;
+      SCIP_Real lhs;
+      SCIP_Real rhs;
+      SCIP_Bool initial;
+      SCIP_Bool separate;
+      SCIP_Bool enforce;
+      SCIP_Bool check;
+      SCIP_Bool propagate;
+      SCIP_Bool local;
+      SCIP_Bool modifiable;
+      SCIP_Bool dynamic;
+      SCIP_Bool removable;
+
+      row = mpsi->rows[r];
+      assert(row->idx == r);
+
+      initial = mpsi->initialconss && (row->section == MPS_ROWS);
+      separate = TRUE;
+      enforce = (row->section != MPS_USERCUTS);
+      check = (row->section != MPS_USERCUTS);
+      propagate = TRUE;
+      local = FALSE;
+      modifiable = FALSE;
+      dynamic = mpsi->dynamicconss;
+      removable = mpsi->dynamicrows || (row->section == MPS_USERCUTS);
+
+      switch( row->type )
+      {
+      case 'G' :
+         lhs = 0.0;
+         rhs = SCIPinfinity(scip);
+         break;
+      case 'E' :
+         lhs = 0.0;
+         rhs = 0.0;
+         break;
+      default :
+         assert(row->type == 'L');
+         lhs = -SCIPinfinity(scip);
+         rhs = 0.0;
+         break;
+      }
+
+      SCIP_CALL( SCIPcreateConsLinear(scip, &cons, row->name, rowbeg[r+1] - rowbeg[r], &rowvars[rowbeg[r]],
+            &rowvals[rowbeg[r]], lhs, rhs, initial, separate, enforce, check, propagate, local, modifiable, dynamic,
+            removable, FALSE) );
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+
+   SCIPfreeBufferArray(scip, &rowvals);
+   SCIPfreeBufferArray(scip, &rowvars);
+   SCIPfreeBufferArray(scip, &rowbeg);
+
+   return SCIP_OKAY;
+}
+
+/** Process COLUMNS section.
+ *
+ *  The complete lines in the read buffer are parsed in chunks, possibly in parallel, and the parsed entries are
+ *  processed in the order of the lines. Lines that end a chunk early, e.g., the header of the next section, are read
+ *  again sequentially.
+ */
 static
 SCIP_RETCODE readCols(
    MPSINPUT*             mpsi,               /**< mps input structure */
@@ -953,124 +1780,141 @@ SCIP_RETCODE readCols(
    )
 {
    char          colname[MPS_MAX_NAMELEN] = { '\0' };
-   SCIP_CONS*    cons;
+   MPSCOLCHUNK*  chunks;
+   MPSMATRIX     matrix;
    SCIP_VAR*     var;
-   SCIP_Real     val;
+   SCIP_RETCODE  retcode;
    SCIP_Bool     usevartable;
+   SCIP_Bool     tpiinitialized;
+   int           maxnchunks;
+   int           c;
 
    SCIPdebugMsg(scip, "read columns\n");
 
    var = NULL;
    SCIP_CALL( SCIPgetBoolParam(scip, "misc/usevartable", &usevartable) );
 
-   while( mpsinputReadLine(mpsi) )
+   maxnchunks = MAX(mpsi->nthreads, 1);
+   SCIP_CALL( SCIPinitParallelJobs(scip, maxnchunks, &tpiinitialized) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &chunks, maxnchunks) );
+   SCIP_CALL( matrixCreate(scip, &matrix, mpsi->nrows) );
+
+   retcode = SCIP_OKAY;
+
+   while( TRUE ) /*lint !e716*/
    {
-      if( mpsinputField0(mpsi) != 0 )
-      {
-         if( strcmp(mpsinputField0(mpsi), "RHS") )
-            break;
+      SCIP_Bool stopped;
+      int end;
 
-         /* add the last variable to the problem */
-         if( var != NULL )
-         {
-            SCIP_CALL( SCIPaddVar(scip, var) );
-            SCIP_CALL( SCIPreleaseVar(scip, &var) );
-         }
-         assert(var == NULL);
+      /* determine the end of the complete lines in the read buffer */
+      mpsinputFillBuffer(mpsi);
 
-         mpsinputSetSection(mpsi, MPS_RHS);
-         return SCIP_OKAY;
+      end = mpsi->readbufend;
+      if( !mpsi->readbufeof )
+      {
+         while( end > mpsi->readbufpos && mpsi->readbuf[end-1] != '\n' )
+            --end;
       }
-      if( mpsinputField1(mpsi) == NULL || mpsinputField2(mpsi) == NULL || mpsinputField3(mpsi) == NULL )
-         break;
 
-      /* new column? */
-      if( strcmp(colname, mpsinputField1(mpsi)) )
+      stopped = FALSE;
+
+      if( end > mpsi->readbufpos )
       {
-         /* add the last variable to the problem */
-         if( var != NULL )
-         {
-            SCIP_CALL( SCIPaddVar(scip, var) );
-            SCIP_CALL( SCIPreleaseVar(scip, &var) );
-         }
-         assert(var == NULL);
+         int nchunks;
 
-         (void)SCIPmemccpy(colname, mpsinputField1(mpsi), '\0', MPS_MAX_NAMELEN - 1);
+         SCIP_CALL_TERMINATE( retcode, parseColChunks(mpsi, chunks, maxnchunks, end, &nchunks), TERMINATE );
 
-         /* check whether we have seen this variable before, this would not allowed */
-         if( usevartable && SCIPfindVar(scip, colname) != NULL )
+         /* process the entries in the order of the lines */
+         for( c = 0; c < nchunks && !stopped; ++c )
          {
-            SCIPerrorMessage("Coeffients of column <%s> don't appear consecutively (line: %d)\n",
-               colname, mpsi->lineno);
+            int baselineno;
+            int i;
 
-            return SCIP_READERROR;
-         }
+            baselineno = mpsi->lineno;
 
-         /* if the file type is a cor file, the the variable name must be stored */
-         SCIP_CALL( addVarNameToStorage(scip, varnames, varnamessize, nvarnames, colname) );
+            for( i = 0; i < chunks[c].nentries; ++i )
+            {
+               SCIP_CALL_TERMINATE( retcode, applyColEntry(scip, mpsi, &matrix, &chunks[c].entries[i], chunks[c].names,
+                     baselineno, usevartable, colname, &var, varnames, varnamessize, nvarnames), TERMINATE );
+            }
 
-         if( mpsinputIsInteger(mpsi) )
-         {
-            /* for integer variables, default bounds are 0 <= x < 1(not +infinity, like it is for continuous variables), and default cost is 0 */
-            SCIP_CALL( SCIPcreateVar(scip, &var, colname, 0.0, 1.0, 0.0, SCIP_VARTYPE_BINARY,
-                  !mpsi->dynamiccols, mpsi->dynamiccols, NULL, NULL, NULL, NULL, NULL) );
+            /* continue with the state at the end of the chunk */
+            mpsi->lineno = baselineno + chunks[c].mpsi.lineno;
+            mpsi->isnewformat = chunks[c].mpsi.isnewformat;
+            if( chunks[c].mpsi.nmarkers > 0 )
+            {
+               mpsi->isinteger = chunks[c].mpsi.isinteger;
+               mpsi->nmarkers += chunks[c].mpsi.nmarkers;
+            }
+
+            if( chunks[c].stoppos >= 0 )
+            {
+               mpsi->readbufpos = chunks[c].stoppos;
+               stopped = TRUE;
+            }
          }
-         else
+
+         if( !stopped )
          {
-            /* for continuous variables, default bounds are 0 <= x, and default cost is 0 */
-            SCIP_CALL( SCIPcreateVar(scip, &var, colname, 0.0, SCIPinfinity(scip), 0.0, SCIP_VARTYPE_CONTINUOUS,
-                  !mpsi->dynamiccols, mpsi->dynamiccols, NULL, NULL, NULL, NULL, NULL) );
+            mpsi->readbufpos = end;
+            continue;
          }
       }
-      assert(var != NULL);
 
-      val = atof(mpsinputField3(mpsi));
+      /* read the next line sequentially; it either ends the section or is longer than the read buffer */
+      if( !mpsinputReadLine(mpsi) )
+         break;
 
-      if( !strcmp(mpsinputField2(mpsi), mpsinputObjname(mpsi)) )
-      {
-         SCIP_CALL( SCIPchgVarObj(scip, var, val) );
-      }
-      else
+      if( mpsinputField0(mpsi) != 0 )
       {
-         cons = SCIPfindCons(scip, mpsinputField2(mpsi));
-         if( cons == NULL )
-            mpsinputEntryIgnored(scip, mpsi, "Column", mpsinputField1(mpsi), "row", mpsinputField2(mpsi), SCIP_VERBLEVEL_FULL);
-         else if( !SCIPisZero(scip, val) )
+         if( strcmp(mpsinputField0(mpsi), "RHS") )
+            break;
+
+         /* add the last variable to the problem */
+         if( var != NULL )
          {
-            /* warn the user in case the coefficient is infinite */
-            if( SCIPisInfinity(scip, REALABS(val)) )
-            {
-               SCIPwarningMessage(scip, "Coefficient of variable <%s> in constraint <%s> contains infinite value <%e>,"
-                  " consider adjusting SCIP infinity.\n", SCIPvarGetName(var), SCIPconsGetName(cons), val);
-            }
-            SCIP_CALL( SCIPaddCoefLinear(scip, cons, var, val) );
+            SCIP_CALL_TERMINATE( retcode, SCIPaddVar(scip, var), TERMINATE );
+            SCIP_CALL_TERMINATE( retcode, SCIPreleaseVar(scip, &var), TERMINATE );
          }
-      }
-      if( mpsinputField5(mpsi) != NULL )
-      {
-         assert(mpsinputField4(mpsi) != NULL);
+         assert(var == NULL);
 
-         val = atof(mpsinputField5(mpsi));
+         SCIP_CALL_TERMINATE( retcode, createRowConss(scip, mpsi, &matrix), TERMINATE );
 
-         if( !strcmp(mpsinputField4(mpsi), mpsinputObjname(mpsi)) )
-         {
-            SCIP_CALL( SCIPchgVarObj(scip, var, val) );
-         }
-         else
-         {
-            cons = SCIPfindCons(scip, mpsinputField4(mpsi));
-            if( cons == NULL )
-               mpsinputEntryIgnored(scip, mpsi, "Column", mpsinputField1(mpsi), "row", mpsinputField4(mpsi), SCIP_VERBLEVEL_FULL);
-            else if( !SCIPisZero(scip, val) )
-            {
-               SCIP_CALL( SCIPaddCoefLinear(scip, cons, var, val) );
-            }
-         }
+         mpsinputSetSection(mpsi, MPS_RHS);
+         goto TERMINATE;
       }
+      if( mpsinputField1(mpsi) == NULL || mpsinputField2(mpsi) == NULL || mpsinputField3(mpsi) == NULL )
+         break;
+
+      chunks[0].nentries = 0;
+      chunks[0].namesend = 0;
+      SCIP_CALL_TERMINATE( retcode, colChunkAddEntry(&chunks[0], mpsi), TERMINATE );
+      SCIP_CALL_TERMINATE( retcode, applyColEntry(scip, mpsi, &matrix, &chunks[0].entries[0], chunks[0].names, 0,
+            usevartable, colname, &var, varnames, varnamessize, nvarnames), TERMINATE );
    }
    mpsinputSyntaxerror(mpsi);
 
-   return SCIP_OKAY;
+ TERMINATE:
+   if( var != NULL )
+   {
+      (void) SCIPreleaseVar(scip, &var);
+   }
+
+   matrixFree(scip, &matrix);
+
+   for( c = maxnchunks - 1; c >= 0; --c )
+   {
+      BMSfreeMemoryArrayNull(&chunks[c].names);
+      BMSfreeMemoryArrayNull(&chunks[c].entries);
+   }
+   SCIPfreeBufferArray(scip, &chunks);
+
+   if( tpiinitialized )
+   {
+      SCIP_CALL( SCIPexitParallelJobs(scip) );
+   }
+
+   return retcode;
 }
 
 /** Process RHS section. */
@@ -3818,6 +4662,10 @@ SCIP_RETCODE SCIPincludeReaderMps(
          "reading/" READER_NAME "/aggrlinearization-ands",
          "should an aggregated linearization for and constraints be used?",
          &readerdata->aggrlinearizationands, TRUE, DEFAULT_AGGRLINEARIZATION_ANDS, NULL, NULL) );
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "reading/" READER_NAME "/nthreads",
+         "number of threads used to parse the COLUMNS section (the problem read does not depend on it)",
+         NULL, TRUE, DEFAULT_NTHREADS, 1, 64, NULL, NULL) );
 
    return SCIP_OKAY;
 }
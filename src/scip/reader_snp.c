@@ -0,0 +1,1518 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   reader_snp.c
+ * @ingroup DEFPLUGINS_READER
+ * @brief  SNP file reader for binary problem snapshots
+ *
+ * A snapshot consists of the following blocks, where all numbers are stored in native byte order, strings are
+ * terminated by '\\0', and each block of strings is preceded by its total size in bytes:
+ *
+ *  - header: magic string, format version, byte order mark, size of SCIP_Real, whether the problem is transformed
+ *  - objective: sense, scale, offset, and the problem name
+ *  - variables: numbers of active and fixed variables, names, types, flags, global bounds, and objective coefficients;
+ *    the active variables come first
+ *  - aggregations: for each fixed variable, the constant and the terms of its representation by active variables
+ *  - constraints: number of constraints and terms, names, types, flags, subtypes, start of the terms of each constraint,
+ *    variable indices and coefficients of the terms, left and right hand sides
+ *  - texts: the constraints that are not stored as terms, in CIP format
+ *  - trailer: the magic string again
+ *
+ * Terms refer to variables by their index in the snapshot; the negation of the variable with index \f$i\f$ is
+ * referred to by index \f$-i-1\f$.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "blockmemshell/memory.h"
+#include "scip/cons_knapsack.h"
+#include "scip/cons_linear.h"
+#include "scip/cons_logicor.h"
+#include "scip/cons_setppc.h"
+#include "scip/cons_varbound.h"
+#include "scip/pub_cons.h"
+#include "scip/pub_fileio.h"
+#include "scip/pub_message.h"
+#include "scip/pub_misc.h"
+#include "scip/pub_reader.h"
+#include "scip/pub_var.h"
+#include "scip/reader_snp.h"
+#include "scip/scip_cons.h"
+#include "scip/scip_mem.h"
+#include "scip/scip_message.h"
+#include "scip/scip_numerics.h"
+#include "scip/scip_prob.h"
+#include "scip/scip_reader.h"
+#include "scip/scip_var.h"
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+#define READER_NAME             "snpreader"
+#define READER_DESC             "file reader for binary problem snapshots"
+#define READER_EXTENSION        "snp"
+
+#define SNP_MAGIC               "SCIPSNP"       /**< magic string at the beginning and at the end of a snapshot */
+#define SNP_MAGICLEN            8               /**< length of the magic string including the terminating '\\0' */
+#define SNP_VERSION             1               /**< version of the snapshot format */
+#define SNP_BYTEORDER           0x01020304      /**< number to detect snapshots written with a different byte order */
+#define SNP_NOVAR               INT_MAX         /**< index of variables that are not part of the snapshot */
+#define SNP_MAXEXACTWEIGHT      ((SCIP_Longint)1 << 53) /**< largest knapsack weight that is exact as SCIP_Real */
+
+/* flags of variables */
+#define SNP_VAR_INITIAL         0x0001          /**< should the column of the variable be in the initial LP? */
+#define SNP_VAR_REMOVABLE       0x0002          /**< is the column of the variable removable from the LP? */
+
+/* flags of constraints */
+#define SNP_CONS_INITIAL        0x0001          /**< should the LP relaxation be in the initial LP? */
+#define SNP_CONS_SEPARATE       0x0002          /**< should the constraint be separated? */
+#define SNP_CONS_ENFORCE        0x0004          /**< should the constraint be enforced? */
+#define SNP_CONS_CHECK          0x0008          /**< should the constraint be checked for feasibility? */
+#define SNP_CONS_PROPAGATE      0x0010          /**< should the constraint be propagated? */
+#define SNP_CONS_LOCAL          0x0020          /**< is the constraint only locally valid? */
+#define SNP_CONS_MODIFIABLE     0x0040          /**< is the constraint modifiable? */
+#define SNP_CONS_DYNAMIC        0x0080          /**< is the constraint subject to aging? */
+#define SNP_CONS_REMOVABLE      0x0100          /**< should the relaxation be removed from the LP due to aging or cleanup? */
+#define SNP_CONS_STICKING       0x0200          /**< should the constraint always be kept at the node where it was added? */
+
+
+/** types of constraints in a snapshot */
+enum SnpConsType
+{
+   SNP_CONSTYPE_LINEAR   = 0,                /**< linear constraint lhs <= sum of the terms <= rhs */
+   SNP_CONSTYPE_SETPPC   = 1,                /**< set partitioning/packing/covering constraint, subtype is the SCIP_SETPPCTYPE */
+   SNP_CONSTYPE_LOGICOR  = 2,                /**< logic or constraint */
+   SNP_CONSTYPE_KNAPSACK = 3,                /**< knapsack constraint with the weights as coefficients and the capacity as rhs */
+   SNP_CONSTYPE_VARBOUND = 4,                /**< variable bound constraint lhs <= x + c*y <= rhs with terms x and c*y */
+   SNP_CONSTYPE_TEXT     = 5                 /**< any other constraint, stored in CIP format */
+};
+typedef enum SnpConsType SNPCONSTYPE;
+
+
+/*
+ * Local methods for reading
+ */
+
+/** reads an array from a snapshot */
+static
+SCIP_RETCODE readArray(
+   SCIP_FILE*            file,               /**< input file */
+   void*                 data,               /**< array to store the data */
+   size_t                size,               /**< size of an array element */
+   int                   n                   /**< number of array elements */
+   )
+{
+   assert(file != NULL);
+   assert(data != NULL || n == 0);
+
+   /* read bytes, since SCIPfread() returns the number of bytes instead of elements for compressed files */
+   if( n > 0 && SCIPfread(data, sizeof(char), size * (size_t)n, file) != size * (size_t)n )
+   {
+      SCIPerrorMessage("unexpected end of snapshot\n");
+      return SCIP_READERROR;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** reads a nonnegative number from a snapshot */
+static
+SCIP_RETCODE readCount(
+   SCIP_FILE*            file,               /**< input file */
+   int*                  count               /**< pointer to store the number */
+   )
+{
+   assert(count != NULL);
+
+   SCIP_CALL( readArray(file, count, sizeof(int), 1) );
+
+   if( *count < 0 )
+   {
+      SCIPerrorMessage("invalid number <%d> in snapshot\n", *count);
+      return SCIP_READERROR;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** reads a block of strings from a snapshot; the strings point into the block and are valid until it is freed */
+static
+SCIP_RETCODE readStrings(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_FILE*            file,               /**< input file */
+   int                   nstrs,              /**< number of strings in the block */
+   char**                blob,               /**< pointer to store the block, must be freed with SCIPfreeBufferArray() */
+   char**                strs                /**< array to store the nstrs strings */
+   )
+{
+   SCIP_RETCODE retcode;
+   int size;
+   int pos;
+   int i;
+
+   assert(blob != NULL);
+   assert(strs != NULL || nstrs == 0);
+
+   SCIP_CALL( readCount(file, &size) );
+   SCIP_CALL( SCIPallocBufferArray(scip, blob, size) );
+
+   SCIP_CALL_TERMINATE( retcode, readArray(file, *blob, sizeof(char), size), TERMINATE );
+
+   /* split the block at the terminating zeros */
+   pos = 0;
+   for( i = 0; i < nstrs && pos < size; ++i )
+   {
+      strs[i] = &(*blob)[pos]; /*lint !e613*/
+      while( pos < size && (*blob)[pos] != '\0' )
+         ++pos;
+      ++pos;
+   }
+
+   if( i < nstrs || pos != size )
+   {
+      SCIPerrorMessage("invalid block of strings in snapshot\n");
+      retcode = SCIP_READERROR;
+   }
+
+TERMINATE:
+   if( retcode != SCIP_OKAY )
+      SCIPfreeBufferArray(scip, blob);
+
+   return retcode;
+}
+
+/** checks that the terms in a snapshot are stored consecutively and refer to existing variables */
+static
+SCIP_Bool termsAreValid(
+   int*                  beg,                /**< start of the terms of each entry, and total number of terms */
+   int                   nentries,           /**< number of entries */
+   int*                  termvars,           /**< variable indices of the terms */
+   int                   nterms,             /**< total number of terms */
+   int                   nallvars            /**< number of variables in the snapshot */
+   )
+{
+   int i;
+
+   if( beg[0] != 0 || beg[nentries] != nterms )
+      return FALSE;
+
+   for( i = 0; i < nentries; ++i )
+   {
+      if( beg[i] > beg[i+1] )
+         return FALSE;
+   }
+
+   for( i = 0; i < nterms; ++i )
+   {
+      if( termvars[i] >= nallvars || termvars[i] < -nallvars )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+/** gets the variables of a number of terms */
+static
+SCIP_RETCODE getTermVars(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR**            vars,               /**< variables of the snapshot */
+   int*                  termvars,           /**< variable indices of the terms */
+   int                   nterms,             /**< number of terms */
+   SCIP_VAR**            consvars            /**< array to store the variables of the terms */
+   )
+{
+   int i;
+
+   for( i = 0; i < nterms; ++i )
+   {
+      if( termvars[i] >= 0 )
+         consvars[i] = vars[termvars[i]];
+      else
+      {
+         SCIP_CALL( SCIPgetNegatedVar(scip, vars[-termvars[i] - 1], &consvars[i]) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** reads the variables and the aggregations of the fixed variables, and adds them to the problem */
+static
+SCIP_RETCODE readVariables(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_FILE*            file,               /**< input file */
+   SCIP_Real             objscale,           /**< objective scale */
+   SCIP_VAR***           vars,               /**< pointer to store the variables, must be freed with SCIPfreeBufferArray() */
+   int*                  nallvars            /**< pointer to store the number of active and fixed variables */
+   )
+{
+   SCIP_RETCODE retcode;
+   char* nameblob = NULL;
+   char** names = NULL;
+   int* types = NULL;
+   int* flags = NULL;
+   SCIP_Real* lbs = NULL;
+   SCIP_Real* ubs = NULL;
+   SCIP_Real* objs = NULL;
+   int* aggrbeg = NULL;
+   int* aggrvars = NULL;
+   SCIP_Real* aggrvals = NULL;
+   SCIP_Real* constants = NULL;
+   SCIP_VAR** consvars = NULL;
+   SCIP_Real* consvals = NULL;
+   int nvars;
+   int nfixedvars;
+   int naggrterms;
+   int maxnterms;
+   int i;
+
+   assert(vars != NULL);
+   assert(nallvars != NULL);
+
+   SCIP_CALL( readCount(file, &nvars) );
+   SCIP_CALL( readCount(file, &nfixedvars) );
+
+   if( nvars > INT_MAX - nfixedvars - 1 )
+   {
+      SCIPerrorMessage("invalid number of variables in snapshot\n");
+      return SCIP_READERROR;
+   }
+
+   *nallvars = nvars + nfixedvars;
+   SCIP_CALL( SCIPallocBufferArray(scip, vars, *nallvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &names, *nallvars) );
+
+   SCIP_CALL_TERMINATE( retcode, readStrings(scip, file, *nallvars, &nameblob, names), TERMINATE );
+
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &types, *nallvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &flags, *nallvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &lbs, *nallvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &ubs, *nallvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &objs, *nallvars), TERMINATE );
+
+   SCIP_CALL_TERMINATE( retcode, readArray(file, types, sizeof(int), *nallvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, readArray(file, flags, sizeof(int), *nallvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, readArray(file, lbs, sizeof(SCIP_Real), *nallvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, readArray(file, ubs, sizeof(SCIP_Real), *nallvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, readArray(file, objs, sizeof(SCIP_Real), *nallvars), TERMINATE );
+
+   /* read the representation of the fixed variables by the active variables */
+   SCIP_CALL_TERMINATE( retcode, readCount(file, &naggrterms), TERMINATE );
+
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &aggrbeg, nfixedvars + 1), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &aggrvars, naggrterms), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &aggrvals, naggrterms), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &constants, nfixedvars), TERMINATE );
+
+   SCIP_CALL_TERMINATE( retcode, readArray(file, aggrbeg, sizeof(int), nfixedvars + 1), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, readArray(file, aggrvars, sizeof(int), naggrterms), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, readArray(file, aggrvals, sizeof(SCIP_Real), naggrterms), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, readArray(file, constants, sizeof(SCIP_Real), nfixedvars), TERMINATE );
+
+   if( !termsAreValid(aggrbeg, nfixedvars, aggrvars, naggrterms, *nallvars) )
+   {
+      SCIPerrorMessage("invalid aggregations in snapshot\n");
+      retcode = SCIP_READERROR;
+      goto TERMINATE;
+   }
+
+   /* create the variables */
+   for( i = 0; i < *nallvars; ++i )
+   {
+      SCIP_VAR* var;
+      SCIP_Real lb;
+      SCIP_Real ub;
+
+      if( types[i] < (int)SCIP_VARTYPE_BINARY || types[i] > (int)SCIP_VARTYPE_CONTINUOUS )
+      {
+         SCIPerrorMessage("invalid type <%d> of variable <%s> in snapshot\n", types[i], names[i]);
+         retcode = SCIP_READERROR;
+         goto TERMINATE;
+      }
+
+      lb = lbs[i];
+      ub = ubs[i];
+
+      /* fixed variables without terms are fixed to their constant */
+      if( i >= nvars && aggrbeg[i - nvars] == aggrbeg[i - nvars + 1] )
+      {
+         lb = constants[i - nvars];
+         ub = constants[i - nvars];
+      }
+
+      SCIP_CALL_TERMINATE( retcode, SCIPcreateVar(scip, &var, names[i], lb, ub, objs[i] * objscale,
+            (SCIP_VARTYPE)types[i], (flags[i] & SNP_VAR_INITIAL) != 0, (flags[i] & SNP_VAR_REMOVABLE) != 0,
+            NULL, NULL, NULL, NULL, NULL), TERMINATE );
+      SCIP_CALL_TERMINATE( retcode, SCIPaddVar(scip, var), TERMINATE );
+
+      /* the problem keeps the variable alive */
+      (*vars)[i] = var;
+      SCIP_CALL_TERMINATE( retcode, SCIPreleaseVar(scip, &var), TERMINATE );
+   }
+
+   /* add linear coupling constraints -x + sum of the terms = -constant for the aggregated variables */
+   maxnterms = 0;
+   for( i = 0; i < nfixedvars; ++i )
+      maxnterms = MAX(maxnterms, aggrbeg[i + 1] - aggrbeg[i]);
+
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &consvars, maxnterms + 1), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &consvals, maxnterms + 1), TERMINATE );
+
+   for( i = 0; i < nfixedvars; ++i )
+   {
+      SCIP_CONS* cons;
+      SCIP_VAR* var;
+      int nterms;
+
+      nterms = aggrbeg[i + 1] - aggrbeg[i];
+      if( nterms == 0 )
+         continue;
+
+      var = (*vars)[nvars + i];
+      consvars[0] = var;
+      consvals[0] = -1.0;
+      SCIP_CALL_TERMINATE( retcode, getTermVars(scip, *vars, &aggrvars[aggrbeg[i]], nterms, &consvars[1]), TERMINATE );
+      BMScopyMemoryArray(&consvals[1], &aggrvals[aggrbeg[i]], nterms);
+
+      SCIP_CALL_TERMINATE( retcode, SCIPcreateConsLinear(scip, &cons, SCIPvarGetName(var), nterms + 1, consvars,
+            consvals, -constants[i], -constants[i], TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, FALSE, TRUE, FALSE),
+         TERMINATE );
+      SCIP_CALL_TERMINATE( retcode, SCIPaddCons(scip, cons), TERMINATE );
+      SCIP_CALL_TERMINATE( retcode, SCIPreleaseCons(scip, &cons), TERMINATE );
+   }
+
+TERMINATE:
+   SCIPfreeBufferArrayNull(scip, &consvals);
+   SCIPfreeBufferArrayNull(scip, &consvars);
+   SCIPfreeBufferArrayNull(scip, &constants);
+   SCIPfreeBufferArrayNull(scip, &aggrvals);
+   SCIPfreeBufferArrayNull(scip, &aggrvars);
+   SCIPfreeBufferArrayNull(scip, &aggrbeg);
+   SCIPfreeBufferArrayNull(scip, &objs);
+   SCIPfreeBufferArrayNull(scip, &ubs);
+   SCIPfreeBufferArrayNull(scip, &lbs);
+   SCIPfreeBufferArrayNull(scip, &flags);
+   SCIPfreeBufferArrayNull(scip, &types);
+   SCIPfreeBufferArrayNull(scip, &nameblob);
+   SCIPfreeBufferArray(scip, &names);
+
+   return retcode;
+}
+
+/** creates a constraint that is stored by its terms */
+static
+SCIP_RETCODE createConsTerms(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS**           cons,               /**< pointer to store the constraint */
+   const char*           name,               /**< name of the constraint */
+   int                   type,               /**< type of the constraint */
+   int                   subtype,            /**< subtype of the constraint */
+   int                   flags,              /**< flags of the constraint */
+   SCIP_VAR**            consvars,           /**< variables of the terms */
+   SCIP_Real*            consvals,           /**< coefficients of the terms */
+   int                   nterms,             /**< number of terms */
+   SCIP_Real             lhs,                /**< left hand side */
+   SCIP_Real             rhs                 /**< right hand side */
+   )
+{
+   SCIP_Bool initial;
+   SCIP_Bool separate;
+   SCIP_Bool enforce;
+   SCIP_Bool check;
+   SCIP_Bool propagate;
+   SCIP_Bool local;
+   SCIP_Bool modifiable;
+   SCIP_Bool dynamic;
+   SCIP_Bool removable;
+   SCIP_Bool stickingatnode;
+
+   assert(cons != NULL);
+
+   *cons = NULL;
+
+   initial = (flags & SNP_CONS_INITIAL) != 0;
+   separate = (flags & SNP_CONS_SEPARATE) != 0;
+   enforce = (flags & SNP_CONS_ENFORCE) != 0;
+   check = (flags & SNP_CONS_CHECK) != 0;
+   propagate = (flags & SNP_CONS_PROPAGATE) != 0;
+   local = (flags & SNP_CONS_LOCAL) != 0;
+   modifiable = (flags & SNP_CONS_MODIFIABLE) != 0;
+   dynamic = (flags & SNP_CONS_DYNAMIC) != 0;
+   removable = (flags & SNP_CONS_REMOVABLE) != 0;
+   stickingatnode = (flags & SNP_CONS_STICKING) != 0;
+
+   switch( type )
+   {
+   case SNP_CONSTYPE_LINEAR:
+      SCIP_CALL( SCIPcreateConsLinear(scip, cons, name, nterms, consvars, consvals, lhs, rhs, initial, separate,
+            enforce, check, propagate, local, modifiable, dynamic, removable, stickingatnode) );
+      break;
+
+   case SNP_CONSTYPE_SETPPC:
+      switch( subtype )
+      {
+      case SCIP_SETPPCTYPE_PARTITIONING:
+         SCIP_CALL( SCIPcreateConsSetpart(scip, cons, name, nterms, consvars, initial, separate, enforce, check,
+               propagate, local, modifiable, dynamic, removable, stickingatnode) );
+         break;
+      case SCIP_SETPPCTYPE_PACKING:
+         SCIP_CALL( SCIPcreateConsSetpack(scip, cons, name, nterms, consvars, initial, separate, enforce, check,
+               propagate, local, modifiable, dynamic, removable, stickingatnode) );
+         break;
+      case SCIP_SETPPCTYPE_COVERING:
+         SCIP_CALL( SCIPcreateConsSetcover(scip, cons, name, nterms, consvars, initial, separate, enforce, check,
+               propagate, local, modifiable, dynamic, removable, stickingatnode) );
+         break;
+      default:
+         break;
+      }
+      break;
+
+   case SNP_CONSTYPE_LOGICOR:
+      SCIP_CALL( SCIPcreateConsLogicor(scip, cons, name, nterms, consvars, initial, separate, enforce, check,
+            propagate, local, modifiable, dynamic, removable, stickingatnode) );
+      break;
+
+   case SNP_CONSTYPE_KNAPSACK:
+   {
+      SCIP_Longint* weights;
+      int i;
+
+      SCIP_CALL( SCIPallocBufferArray(scip, &weights, nterms) );
+      for( i = 0; i < nterms; ++i )
+         weights[i] = (SCIP_Longint)consvals[i];
+
+      SCIP_CALL( SCIPcreateConsKnapsack(scip, cons, name, nterms, consvars, weights, (SCIP_Longint)rhs, initial,
+            separate, enforce, check, propagate, local, modifiable, dynamic, removable, stickingatnode) );
+
+      SCIPfreeBufferArray(scip, &weights);
+      break;
+   }
+
+   case SNP_CONSTYPE_VARBOUND:
+      if( nterms == 2 )
+      {
+         SCIP_CALL( SCIPcreateConsVarbound(scip, cons, name, consvars[0], consvars[1], consvals[1], lhs, rhs, initial,
+               separate, enforce, check, propagate, local, modifiable, dynamic, removable, stickingatnode) );
+      }
+      break;
+
+   default:
+      break;
+   }
+
+   if( *cons == NULL )
+   {
+      SCIPerrorMessage("invalid constraint <%s> of type <%d> in snapshot\n", name, type);
+      return SCIP_READERROR;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** reads the constraints and adds them to the problem */
+static
+SCIP_RETCODE readConstraints(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_FILE*            file,               /**< input file */
+   SCIP_VAR**            vars,               /**< variables of the snapshot */
+   int                   nallvars            /**< number of variables of the snapshot */
+   )
+{
+   SCIP_RETCODE retcode;
+   char* nameblob = NULL;
+   char** names = NULL;
+   char* textblob = NULL;
+   char** texts = NULL;
+   int* types = NULL;
+   int* flags = NULL;
+   int* subtypes = NULL;
+   int* beg = NULL;
+   int* termvars = NULL;
+   SCIP_Real* termvals = NULL;
+   SCIP_Real* lhss = NULL;
+   SCIP_Real* rhss = NULL;
+   SCIP_VAR** consvars = NULL;
+   int nconss;
+   int nterms;
+   int ntexts;
+   int maxnterms;
+   int t;
+   int i;
+
+   SCIP_CALL( readCount(file, &nconss) );
+   SCIP_CALL( readCount(file, &nterms) );
+
+   if( nconss == INT_MAX )
+   {
+      SCIPerrorMessage("invalid number of constraints in snapshot\n");
+      return SCIP_READERROR;
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &names, nconss) );
+
+   SCIP_CALL_TERMINATE( retcode, readStrings(scip, file, nconss, &nameblob, names), TERMINATE );
+
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &types, nconss), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &flags, nconss), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &subtypes, nconss), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &beg, nconss + 1), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &termvars, nterms), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &termvals, nterms), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &lhss, nconss), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &rhss, nconss), TERMINATE );
+
+   SCIP_CALL_TERMINATE( retcode, readArray(file, types, sizeof(int), nconss), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, readArray(file, flags, sizeof(int), nconss), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, readArray(file, subtypes, sizeof(int), nconss), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, readArray(file, beg, sizeof(int), nconss + 1), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, readArray(file, termvars, sizeof(int), nterms), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, readArray(file, termvals, sizeof(SCIP_Real), nterms), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, readArray(file, lhss, sizeof(SCIP_Real), nconss), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, readArray(file, rhss, sizeof(SCIP_Real), nconss), TERMINATE );
+
+   if( !termsAreValid(beg, nconss, termvars, nterms, nallvars) )
+   {
+      SCIPerrorMessage("invalid constraints in snapshot\n");
+      retcode = SCIP_READERROR;
+      goto TERMINATE;
+   }
+
+   /* read the constraints that are stored in CIP format */
+   ntexts = 0;
+   maxnterms = 0;
+   for( i = 0; i < nconss; ++i )
+   {
+      if( types[i] == (int)SNP_CONSTYPE_TEXT )
+         ++ntexts;
+      maxnterms = MAX(maxnterms, beg[i + 1] - beg[i]);
+   }
+
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &texts, ntexts), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, readStrings(scip, file, ntexts, &textblob, texts), TERMINATE );
+
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &consvars, maxnterms), TERMINATE );
+
+   /* create the constraints in their original order */
+   t = 0;
+   for( i = 0; i < nconss; ++i )
+   {
+      SCIP_CONS* cons;
+
+      if( types[i] == (int)SNP_CONSTYPE_TEXT )
+      {
+         SCIP_Bool success;
+
+         SCIP_CALL_TERMINATE( retcode, SCIPparseCons(scip, &cons, texts[t], (flags[i] & SNP_CONS_INITIAL) != 0,
+               (flags[i] & SNP_CONS_SEPARATE) != 0, (flags[i] & SNP_CONS_ENFORCE) != 0,
+               (flags[i] & SNP_CONS_CHECK) != 0, (flags[i] & SNP_CONS_PROPAGATE) != 0,
+               (flags[i] & SNP_CONS_LOCAL) != 0, (flags[i] & SNP_CONS_MODIFIABLE) != 0,
+               (flags[i] & SNP_CONS_DYNAMIC) != 0, (flags[i] & SNP_CONS_REMOVABLE) != 0,
+               (flags[i] & SNP_CONS_STICKING) != 0, &success), TERMINATE );
+
+         if( !success )
+         {
+            SCIPerrorMessage("syntax error when parsing constraint <%s> in snapshot:\n%s\n", names[i], texts[t]);
+            retcode = SCIP_READERROR;
+            goto TERMINATE;
+         }
+         ++t;
+      }
+      else
+      {
+         int nconsterms;
+
+         nconsterms = beg[i + 1] - beg[i];
+         SCIP_CALL_TERMINATE( retcode, getTermVars(scip, vars, &termvars[beg[i]], nconsterms, consvars), TERMINATE );
+         SCIP_CALL_TERMINATE( retcode, createConsTerms(scip, &cons, names[i], types[i], subtypes[i], flags[i], consvars,
+               &termvals[beg[i]], nconsterms, lhss[i], rhss[i]), TERMINATE );
+      }
+
+      SCIP_CALL_TERMINATE( retcode, SCIPaddCons(scip, cons), TERMINATE );
+      SCIP_CALL_TERMINATE( retcode, SCIPreleaseCons(scip, &cons), TERMINATE );
+   }
+
+TERMINATE:
+   SCIPfreeBufferArrayNull(scip, &consvars);
+   SCIPfreeBufferArrayNull(scip, &textblob);
+   SCIPfreeBufferArrayNull(scip, &texts);
+   SCIPfreeBufferArrayNull(scip, &rhss);
+   SCIPfreeBufferArrayNull(scip, &lhss);
+   SCIPfreeBufferArrayNull(scip, &termvals);
+   SCIPfreeBufferArrayNull(scip, &termvars);
+   SCIPfreeBufferArrayNull(scip, &beg);
+   SCIPfreeBufferArrayNull(scip, &subtypes);
+   SCIPfreeBufferArrayNull(scip, &flags);
+   SCIPfreeBufferArrayNull(scip, &types);
+   SCIPfreeBufferArrayNull(scip, &nameblob);
+   SCIPfreeBufferArray(scip, &names);
+
+   return retcode;
+}
+
+/** reads a snapshot and creates the problem */
+static
+SCIP_RETCODE readSnapshot(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_FILE*            file                /**< input file */
+   )
+{
+   SCIP_RETCODE retcode;
+   SCIP_VAR** vars = NULL;
+   SCIP_Real objdata[2];
+   char magic[SNP_MAGICLEN];
+   char* probname;
+   int header[4];
+   int objsense;
+   int nallvars;
+
+   /* check that the snapshot was written by a compatible machine and version */
+   SCIP_CALL( readArray(file, magic, sizeof(char), SNP_MAGICLEN) );
+   if( memcmp(magic, SNP_MAGIC, SNP_MAGICLEN) != 0 )
+   {
+      SCIPerrorMessage("file is not a SCIP snapshot\n");
+      return SCIP_READERROR;
+   }
+
+   SCIP_CALL( readArray(file, header, sizeof(int), 4) );
+   if( header[0] != SNP_VERSION )
+   {
+      SCIPerrorMessage("snapshot version <%d> is not supported\n", header[0]);
+      return SCIP_READERROR;
+   }
+   if( header[1] != SNP_BYTEORDER || header[2] != (int)sizeof(SCIP_Real) )
+   {
+      SCIPerrorMessage("snapshot was written on a machine with a different number representation\n");
+      return SCIP_READERROR;
+   }
+   SCIPdebugMsg(scip, "reading snapshot of %s problem\n", header[3] ? "transformed" : "original");
+
+   /* objective sense, scale, offset, and problem name */
+   SCIP_CALL( readArray(file, &objsense, sizeof(int), 1) );
+   SCIP_CALL( readArray(file, objdata, sizeof(SCIP_Real), 2) );
+   if( objsense != (int)SCIP_OBJSENSE_MINIMIZE && objsense != (int)SCIP_OBJSENSE_MAXIMIZE )
+   {
+      SCIPerrorMessage("invalid objective sense <%d> in snapshot\n", objsense);
+      return SCIP_READERROR;
+   }
+
+   {
+      char* nameblob;
+
+      SCIP_CALL( readStrings(scip, file, 1, &nameblob, &probname) );
+      retcode = SCIPcreateProb(scip, probname, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+      SCIPfreeBufferArray(scip, &nameblob);
+      SCIP_CALL( retcode );
+   }
+
+   SCIP_CALL( SCIPsetObjsense(scip, (SCIP_OBJSENSE)objsense) );
+   if( objdata[1] != 0.0 ) /*lint !e777*/
+   {
+      SCIP_CALL( SCIPaddOrigObjoffset(scip, objdata[0] * objdata[1]) );
+   }
+
+   SCIP_CALL_TERMINATE( retcode, readVariables(scip, file, objdata[0], &vars, &nallvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, readConstraints(scip, file, vars, nallvars), TERMINATE );
+
+   /* a complete snapshot ends with the magic string */
+   SCIP_CALL_TERMINATE( retcode, readArray(file, magic, sizeof(char), SNP_MAGICLEN), TERMINATE );
+   if( memcmp(magic, SNP_MAGIC, SNP_MAGICLEN) != 0 )
+   {
+      SCIPerrorMessage("snapshot is corrupted\n");
+      retcode = SCIP_READERROR;
+   }
+
+TERMINATE:
+   SCIPfreeBufferArrayNull(scip, &vars);
+
+   return retcode;
+}
+
+
+/*
+ * Local methods for writing
+ */
+
+/** writes an array to a snapshot */
+static
+SCIP_RETCODE writeArray(
+   FILE*                 file,               /**< output file */
+   const void*           data,               /**< array to write */
+   size_t                size,               /**< size of an array element */
+   int                   n                   /**< number of array elements */
+   )
+{
+   assert(file != NULL);
+   assert(data != NULL || n == 0);
+
+   if( n > 0 && fwrite(data, size, (size_t)n, file) != (size_t)n )
+   {
+      SCIPerrorMessage("error while writing snapshot\n");
+      return SCIP_WRITEERROR;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** writes a number to a snapshot */
+static
+SCIP_RETCODE writeInt(
+   FILE*                 file,               /**< output file */
+   int                   val                 /**< number to write */
+   )
+{
+   return writeArray(file, &val, sizeof(int), 1);
+}
+
+/** writes a block of strings to a snapshot */
+static
+SCIP_RETCODE writeStrings(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< output file */
+   const char**          strs,               /**< strings to write */
+   int                   nstrs               /**< number of strings */
+   )
+{
+   SCIP_RETCODE retcode;
+   char* blob;
+   size_t size;
+   int pos;
+   int i;
+
+   size = 0;
+   for( i = 0; i < nstrs; ++i )
+      size += strlen(strs[i]) + 1;
+
+   if( size > (size_t)INT_MAX )
+   {
+      SCIPerrorMessage("names are too long to be written to snapshot\n");
+      return SCIP_WRITEERROR;
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &blob, (int)size) );
+
+   pos = 0;
+   for( i = 0; i < nstrs; ++i )
+   {
+      int len;
+
+      len = (int)strlen(strs[i]) + 1;
+      BMScopyMemoryArray(&blob[pos], strs[i], len);
+      pos += len;
+   }
+   assert(pos == (int)size);
+
+   SCIP_CALL_TERMINATE( retcode, writeInt(file, (int)size), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, blob, sizeof(char), (int)size), TERMINATE );
+
+TERMINATE:
+   SCIPfreeBufferArray(scip, &blob);
+
+   return retcode;
+}
+
+/** returns the index of a variable in the snapshot, or SNP_NOVAR if the variable is not part of it */
+static
+int getVarIndex(
+   SCIP_HASHMAP*         varmap,             /**< map from the variables to their index */
+   SCIP_VAR*             var                 /**< variable */
+   )
+{
+   if( SCIPhashmapExists(varmap, (void*)var) )
+      return SCIPhashmapGetImageInt(varmap, (void*)var);
+
+   /* negated variables are referred to by the negative index of their negation variable */
+   if( SCIPvarIsNegated(var) && SCIPhashmapExists(varmap, (void*)SCIPvarGetNegationVar(var)) )
+      return -SCIPhashmapGetImageInt(varmap, (void*)SCIPvarGetNegationVar(var)) - 1;
+
+   return SNP_NOVAR;
+}
+
+/** writes the variables */
+static
+SCIP_RETCODE writeVariables(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< output file */
+   SCIP_VAR**            vars,               /**< active variables */
+   int                   nvars,              /**< number of active variables */
+   SCIP_VAR**            fixedvars,          /**< fixed and aggregated variables */
+   int                   nfixedvars          /**< number of fixed and aggregated variables */
+   )
+{
+   SCIP_RETCODE retcode;
+   const char** names;
+   int* types;
+   int* flags;
+   SCIP_Real* lbs;
+   SCIP_Real* ubs;
+   SCIP_Real* objs;
+   int nallvars;
+   int i;
+
+   nallvars = nvars + nfixedvars;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &names, nallvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &types, nallvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &flags, nallvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lbs, nallvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ubs, nallvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &objs, nallvars) );
+
+   for( i = 0; i < nallvars; ++i )
+   {
+      SCIP_VAR* var;
+
+      var = i < nvars ? vars[i] : fixedvars[i - nvars];
+
+      names[i] = SCIPvarGetName(var);
+      types[i] = (int)SCIPvarGetType(var);
+      flags[i] = (SCIPvarIsInitial(var) ? SNP_VAR_INITIAL : 0) | (SCIPvarIsRemovable(var) ? SNP_VAR_REMOVABLE : 0);
+      lbs[i] = SCIPvarGetLbGlobal(var);
+      ubs[i] = SCIPvarGetUbGlobal(var);
+      objs[i] = SCIPvarGetObj(var);
+   }
+
+   SCIP_CALL_TERMINATE( retcode, writeInt(file, nvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeInt(file, nfixedvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeStrings(scip, file, names, nallvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, types, sizeof(int), nallvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, flags, sizeof(int), nallvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, lbs, sizeof(SCIP_Real), nallvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, ubs, sizeof(SCIP_Real), nallvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, objs, sizeof(SCIP_Real), nallvars), TERMINATE );
+
+TERMINATE:
+   SCIPfreeBufferArray(scip, &objs);
+   SCIPfreeBufferArray(scip, &ubs);
+   SCIPfreeBufferArray(scip, &lbs);
+   SCIPfreeBufferArray(scip, &flags);
+   SCIPfreeBufferArray(scip, &types);
+   SCIPfreeBufferArray(scip, &names);
+
+   return retcode;
+}
+
+/** writes the representation of the fixed and aggregated variables by the active variables */
+static
+SCIP_RETCODE writeAggregations(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< output file */
+   SCIP_HASHMAP*         varmap,             /**< map from the variables to their index */
+   SCIP_VAR**            fixedvars,          /**< fixed and aggregated variables */
+   int                   nfixedvars          /**< number of fixed and aggregated variables */
+   )
+{
+   SCIP_RETCODE retcode;
+   SCIP_VAR** sumvars;
+   SCIP_Real* sumvals;
+   SCIP_Real* constants;
+   int* aggrbeg;
+   int* aggrvars;
+   SCIP_Real* aggrvals;
+   int sumsize;
+   int termssize;
+   int nterms;
+   int i;
+
+   sumsize = 16;
+   termssize = nfixedvars;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &aggrbeg, nfixedvars + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &constants, nfixedvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &aggrvars, termssize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &aggrvals, termssize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sumvars, sumsize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sumvals, sumsize) );
+
+   nterms = 0;
+   for( i = 0; i < nfixedvars; ++i )
+   {
+      int nsumvars;
+      int requiredsize;
+      int j;
+
+      aggrbeg[i] = nterms;
+
+      sumvars[0] = fixedvars[i];
+      sumvals[0] = 1.0;
+      nsumvars = 1;
+      constants[i] = 0.0;
+      SCIP_CALL_TERMINATE( retcode, SCIPgetProbvarLinearSum(scip, sumvars, sumvals, &nsumvars, sumsize, &constants[i],
+            &requiredsize, TRUE), TERMINATE );
+
+      if( requiredsize > sumsize )
+      {
+         sumsize = SCIPcalcMemGrowSize(scip, requiredsize);
+         SCIP_CALL_TERMINATE( retcode, SCIPreallocBufferArray(scip, &sumvars, sumsize), TERMINATE );
+         SCIP_CALL_TERMINATE( retcode, SCIPreallocBufferArray(scip, &sumvals, sumsize), TERMINATE );
+
+         sumvars[0] = fixedvars[i];
+         sumvals[0] = 1.0;
+         nsumvars = 1;
+         constants[i] = 0.0;
+         SCIP_CALL_TERMINATE( retcode, SCIPgetProbvarLinearSum(scip, sumvars, sumvals, &nsumvars, sumsize,
+               &constants[i], &requiredsize, TRUE), TERMINATE );
+         assert(requiredsize <= sumsize);
+      }
+
+      if( nterms + nsumvars > termssize )
+      {
+         termssize = SCIPcalcMemGrowSize(scip, nterms + nsumvars);
+         SCIP_CALL_TERMINATE( retcode, SCIPreallocBufferArray(scip, &aggrvars, termssize), TERMINATE );
+         SCIP_CALL_TERMINATE( retcode, SCIPreallocBufferArray(scip, &aggrvals, termssize), TERMINATE );
+      }
+
+      for( j = 0; j < nsumvars; ++j )
+      {
+         aggrvars[nterms] = getVarIndex(varmap, sumvars[j]);
+         aggrvals[nterms] = sumvals[j];
+
+         if( aggrvars[nterms] == SNP_NOVAR )
+         {
+            SCIPerrorMessage("variable <%s> in the aggregation of <%s> is not part of the problem\n",
+               SCIPvarGetName(sumvars[j]), SCIPvarGetName(fixedvars[i]));
+            retcode = SCIP_INVALIDDATA;
+            goto TERMINATE;
+         }
+         ++nterms;
+      }
+   }
+   aggrbeg[nfixedvars] = nterms;
+
+   SCIP_CALL_TERMINATE( retcode, writeInt(file, nterms), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, aggrbeg, sizeof(int), nfixedvars + 1), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, aggrvars, sizeof(int), nterms), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, aggrvals, sizeof(SCIP_Real), nterms), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, constants, sizeof(SCIP_Real), nfixedvars), TERMINATE );
+
+TERMINATE:
+   SCIPfreeBufferArray(scip, &sumvals);
+   SCIPfreeBufferArray(scip, &sumvars);
+   SCIPfreeBufferArray(scip, &aggrvals);
+   SCIPfreeBufferArray(scip, &aggrvars);
+   SCIPfreeBufferArray(scip, &constants);
+   SCIPfreeBufferArray(scip, &aggrbeg);
+
+   return retcode;
+}
+
+/** determines the type of a constraint in the snapshot and its number of terms */
+static
+SNPCONSTYPE getConsType(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS*            cons,               /**< constraint */
+   SCIP_HASHMAP*         varmap,             /**< map from the variables to their index */
+   int*                  nterms              /**< pointer to store the number of terms of the constraint */
+   )
+{
+   const char* conshdlrname;
+   SCIP_VAR** consvars;
+   SNPCONSTYPE type;
+   int nconsvars;
+   int i;
+
+   assert(nterms != NULL);
+
+   conshdlrname = SCIPconshdlrGetName(SCIPconsGetHdlr(cons));
+   *nterms = 0;
+
+   if( strcmp(conshdlrname, "linear") == 0 )
+   {
+      type = SNP_CONSTYPE_LINEAR;
+      consvars = SCIPgetVarsLinear(scip, cons);
+      nconsvars = SCIPgetNVarsLinear(scip, cons);
+   }
+   else if( strcmp(conshdlrname, "setppc") == 0 )
+   {
+      type = SNP_CONSTYPE_SETPPC;
+      consvars = SCIPgetVarsSetppc(scip, cons);
+      nconsvars = SCIPgetNVarsSetppc(scip, cons);
+   }
+   else if( strcmp(conshdlrname, "logicor") == 0 )
+   {
+      type = SNP_CONSTYPE_LOGICOR;
+      consvars = SCIPgetVarsLogicor(scip, cons);
+      nconsvars = SCIPgetNVarsLogicor(scip, cons);
+   }
+   else if( strcmp(conshdlrname, "knapsack") == 0 )
+   {
+      SCIP_Longint* weights;
+
+      type = SNP_CONSTYPE_KNAPSACK;
+      consvars = SCIPgetVarsKnapsack(scip, cons);
+      nconsvars = SCIPgetNVarsKnapsack(scip, cons);
+
+      /* the weights and the capacity are stored as SCIP_Real */
+      weights = SCIPgetWeightsKnapsack(scip, cons);
+      for( i = 0; i < nconsvars; ++i )
+      {
+         if( weights[i] > SNP_MAXEXACTWEIGHT || weights[i] < -SNP_MAXEXACTWEIGHT )
+            return SNP_CONSTYPE_TEXT;
+      }
+      if( SCIPgetCapacityKnapsack(scip, cons) > SNP_MAXEXACTWEIGHT )
+         return SNP_CONSTYPE_TEXT;
+   }
+   else if( strcmp(conshdlrname, "varbound") == 0 )
+   {
+      if( getVarIndex(varmap, SCIPgetVarVarbound(scip, cons)) == SNP_NOVAR
+         || getVarIndex(varmap, SCIPgetVbdvarVarbound(scip, cons)) == SNP_NOVAR )
+         return SNP_CONSTYPE_TEXT;
+
+      *nterms = 2;
+      return SNP_CONSTYPE_VARBOUND;
+   }
+   else
+      return SNP_CONSTYPE_TEXT;
+
+   /* constraints on variables that are not part of the snapshot are left to the constraint handler */
+   for( i = 0; i < nconsvars; ++i )
+   {
+      if( getVarIndex(varmap, consvars[i]) == SNP_NOVAR )
+         return SNP_CONSTYPE_TEXT;
+   }
+
+   *nterms = nconsvars;
+
+   return type;
+}
+
+/** collects the terms, sides, and subtype of a constraint that is stored by its terms */
+static
+void getConsTerms(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS*            cons,               /**< constraint */
+   SNPCONSTYPE           type,               /**< type of the constraint in the snapshot */
+   SCIP_HASHMAP*         varmap,             /**< map from the variables to their index */
+   int*                  termvars,           /**< array to store the variable indices of the terms */
+   SCIP_Real*            termvals,           /**< array to store the coefficients of the terms */
+   SCIP_Real*            lhs,                /**< pointer to store the left hand side */
+   SCIP_Real*            rhs,                /**< pointer to store the right hand side */
+   int*                  subtype             /**< pointer to store the subtype */
+   )
+{
+   SCIP_VAR** consvars;
+   int nconsvars;
+   int i;
+
+   *subtype = 0;
+
+   switch( type )
+   {
+   case SNP_CONSTYPE_LINEAR:
+   {
+      SCIP_Real* consvals;
+
+      consvars = SCIPgetVarsLinear(scip, cons);
+      consvals = SCIPgetValsLinear(scip, cons);
+      nconsvars = SCIPgetNVarsLinear(scip, cons);
+
+      for( i = 0; i < nconsvars; ++i )
+      {
+         termvars[i] = getVarIndex(varmap, consvars[i]);
+         termvals[i] = consvals[i];
+      }
+      *lhs = SCIPgetLhsLinear(scip, cons);
+      *rhs = SCIPgetRhsLinear(scip, cons);
+      break;
+   }
+
+   case SNP_CONSTYPE_SETPPC:
+   case SNP_CONSTYPE_LOGICOR:
+      if( type == SNP_CONSTYPE_SETPPC )
+      {
+         consvars = SCIPgetVarsSetppc(scip, cons);
+         nconsvars = SCIPgetNVarsSetppc(scip, cons);
+         *subtype = (int)SCIPgetTypeSetppc(scip, cons);
+      }
+      else
+      {
+         consvars = SCIPgetVarsLogicor(scip, cons);
+         nconsvars = SCIPgetNVarsLogicor(scip, cons);
+         *subtype = (int)SCIP_SETPPCTYPE_COVERING;
+      }
+
+      for( i = 0; i < nconsvars; ++i )
+      {
+         termvars[i] = getVarIndex(varmap, consvars[i]);
+         termvals[i] = 1.0;
+      }
+      *lhs = *subtype == (int)SCIP_SETPPCTYPE_PACKING ? -SCIPinfinity(scip) : 1.0;
+      *rhs = *subtype == (int)SCIP_SETPPCTYPE_COVERING ? SCIPinfinity(scip) : 1.0;
+      break;
+
+   case SNP_CONSTYPE_KNAPSACK:
+   {
+      SCIP_Longint* weights;
+
+      consvars = SCIPgetVarsKnapsack(scip, cons);
+      weights = SCIPgetWeightsKnapsack(scip, cons);
+      nconsvars = SCIPgetNVarsKnapsack(scip, cons);
+
+      for( i = 0; i < nconsvars; ++i )
+      {
+         termvars[i] = getVarIndex(varmap, consvars[i]);
+         termvals[i] = (SCIP_Real)weights[i];
+      }
+      *lhs = -SCIPinfinity(scip);
+      *rhs = (SCIP_Real)SCIPgetCapacityKnapsack(scip, cons);
+      break;
+   }
+
+   case SNP_CONSTYPE_VARBOUND:
+      termvars[0] = getVarIndex(varmap, SCIPgetVarVarbound(scip, cons));
+      termvals[0] = 1.0;
+      termvars[1] = getVarIndex(varmap, SCIPgetVbdvarVarbound(scip, cons));
+      termvals[1] = SCIPgetVbdcoefVarbound(scip, cons);
+      *lhs = SCIPgetLhsVarbound(scip, cons);
+      *rhs = SCIPgetRhsVarbound(scip, cons);
+      break;
+
+   case SNP_CONSTYPE_TEXT:
+   default:
+      SCIPABORT();
+   }
+}
+
+/** writes the constraints that are not stored by their terms in CIP format */
+static
+SCIP_RETCODE writeConsTexts(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< output file */
+   SCIP_CONS**           conss,              /**< constraints */
+   int*                  types,              /**< types of the constraints in the snapshot */
+   int                   nconss,             /**< number of constraints */
+   int                   ntexts              /**< number of constraints to write in CIP format */
+   )
+{
+   SCIP_RETCODE retcode;
+   FILE* tmpfp;
+   char* blob = NULL;
+   long size;
+   int nwritten;
+   int i;
+
+   if( ntexts == 0 )
+      return writeInt(file, 0);
+
+   /* constraint handlers print constraints to a file, so collect them in a temporary file first */
+   tmpfp = tmpfile();
+   if( tmpfp == NULL )
+   {
+      SCIPerrorMessage("cannot create temporary file for writing constraints to snapshot\n");
+      return SCIP_FILECREATEERROR;
+   }
+
+   for( i = 0; i < nconss; ++i )
+   {
+      if( types[i] != (int)SNP_CONSTYPE_TEXT )
+         continue;
+
+      SCIP_CALL_TERMINATE( retcode, SCIPprintCons(scip, conss[i], tmpfp), TERMINATE );
+      if( fputc('\0', tmpfp) == EOF )
+      {
+         retcode = SCIP_WRITEERROR;
+         goto TERMINATE;
+      }
+   }
+
+   size = ftell(tmpfp);
+   if( size < 0 || size > (long)INT_MAX )
+   {
+      SCIPerrorMessage("constraints are too large to be written to snapshot\n");
+      retcode = SCIP_WRITEERROR;
+      goto TERMINATE;
+   }
+   rewind(tmpfp);
+
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &blob, (int)size), TERMINATE );
+   if( fread(blob, sizeof(char), (size_t)size, tmpfp) != (size_t)size )
+   {
+      retcode = SCIP_WRITEERROR;
+      goto TERMINATE;
+   }
+
+   /* every constraint has to be printed as a string of its own */
+   nwritten = 0;
+   for( i = 0; i < (int)size; ++i )
+   {
+      if( blob[i] == '\0' )
+         ++nwritten;
+   }
+   if( nwritten != ntexts )
+   {
+      SCIPerrorMessage("constraints could not be printed to snapshot\n");
+      retcode = SCIP_WRITEERROR;
+      goto TERMINATE;
+   }
+
+   SCIP_CALL_TERMINATE( retcode, writeInt(file, (int)size), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, blob, sizeof(char), (int)size), TERMINATE );
+
+TERMINATE:
+   SCIPfreeBufferArrayNull(scip, &blob);
+   (void) fclose(tmpfp);
+
+   return retcode;
+}
+
+/** writes the constraints */
+static
+SCIP_RETCODE writeConstraints(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< output file */
+   SCIP_HASHMAP*         varmap,             /**< map from the variables to their index */
+   SCIP_CONS**           conss,              /**< constraints */
+   int                   nconss              /**< number of constraints */
+   )
+{
+   SCIP_RETCODE retcode;
+   const char** names;
+   int* types;
+   int* flags;
+   int* subtypes;
+   int* beg;
+   SCIP_Real* lhss;
+   SCIP_Real* rhss;
+   int* termvars = NULL;
+   SCIP_Real* termvals = NULL;
+   int nterms;
+   int ntexts;
+   int i;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &names, nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &types, nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &flags, nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &subtypes, nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &beg, nconss + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lhss, nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rhss, nconss) );
+
+   /* determine the types and the number of terms of the constraints */
+   nterms = 0;
+   ntexts = 0;
+   for( i = 0; i < nconss; ++i )
+   {
+      SCIP_CONS* cons;
+      int nconsterms;
+
+      cons = conss[i];
+      names[i] = SCIPconsGetName(cons);
+      types[i] = (int)getConsType(scip, cons, varmap, &nconsterms);
+      flags[i] = (SCIPconsIsInitial(cons) ? SNP_CONS_INITIAL : 0)
+         | (SCIPconsIsSeparated(cons) ? SNP_CONS_SEPARATE : 0)
+         | (SCIPconsIsEnforced(cons) ? SNP_CONS_ENFORCE : 0)
+         | (SCIPconsIsChecked(cons) ? SNP_CONS_CHECK : 0)
+         | (SCIPconsIsPropagated(cons) ? SNP_CONS_PROPAGATE : 0)
+         | (SCIPconsIsLocal(cons) ? SNP_CONS_LOCAL : 0)
+         | (SCIPconsIsModifiable(cons) ? SNP_CONS_MODIFIABLE : 0)
+         | (SCIPconsIsDynamic(cons) ? SNP_CONS_DYNAMIC : 0)
+         | (SCIPconsIsRemovable(cons) ? SNP_CONS_REMOVABLE : 0)
+         | (SCIPconsIsStickingAtNode(cons) ? SNP_CONS_STICKING : 0);
+      subtypes[i] = 0;
+      lhss[i] = 0.0;
+      rhss[i] = 0.0;
+      beg[i] = nterms;
+
+      if( types[i] == (int)SNP_CONSTYPE_TEXT )
+         ++ntexts;
+
+      if( nconsterms > INT_MAX - nterms )
+      {
+         SCIPerrorMessage("constraints are too large to be written to snapshot\n");
+         retcode = SCIP_WRITEERROR;
+         goto TERMINATE;
+      }
+      nterms += nconsterms;
+   }
+   beg[nconss] = nterms;
+
+   /* collect the terms */
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &termvars, nterms), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &termvals, nterms), TERMINATE );
+
+   for( i = 0; i < nconss; ++i )
+   {
+      if( types[i] != (int)SNP_CONSTYPE_TEXT )
+      {
+         getConsTerms(scip, conss[i], (SNPCONSTYPE)types[i], varmap, &termvars[beg[i]], &termvals[beg[i]], &lhss[i],
+            &rhss[i], &subtypes[i]);
+      }
+   }
+
+   SCIP_CALL_TERMINATE( retcode, writeInt(file, nconss), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeInt(file, nterms), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeStrings(scip, file, names, nconss), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, types, sizeof(int), nconss), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, flags, sizeof(int), nconss), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, subtypes, sizeof(int), nconss), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, beg, sizeof(int), nconss + 1), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, termvars, sizeof(int), nterms), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, termvals, sizeof(SCIP_Real), nterms), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, lhss, sizeof(SCIP_Real), nconss), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, rhss, sizeof(SCIP_Real), nconss), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeConsTexts(scip, file, conss, types, nconss, ntexts), TERMINATE );
+
+TERMINATE:
+   SCIPfreeBufferArrayNull(scip, &termvals);
+   SCIPfreeBufferArrayNull(scip, &termvars);
+   SCIPfreeBufferArray(scip, &rhss);
+   SCIPfreeBufferArray(scip, &lhss);
+   SCIPfreeBufferArray(scip, &beg);
+   SCIPfreeBufferArray(scip, &subtypes);
+   SCIPfreeBufferArray(scip, &flags);
+   SCIPfreeBufferArray(scip, &types);
+   SCIPfreeBufferArray(scip, &names);
+
+   return retcode;
+}
+
+
+/*
+ * Callback methods of reader
+ */
+
+/** copy method for reader plugins (called when SCIP copies plugins) */
+static
+SCIP_DECL_READERCOPY(readerCopySnp)
+{  /*lint --e{715}*/
+   assert(scip != NULL);
+   assert(reader != NULL);
+   assert(strcmp(SCIPreaderGetName(reader), READER_NAME) == 0);
+
+   /* call inclusion method of reader */
+   SCIP_CALL( SCIPincludeReaderSnp(scip) );
+
+   return SCIP_OKAY;
+}
+
+/** problem reading method of reader */
+static
+SCIP_DECL_READERREAD(readerReadSnp)
+{  /*lint --e{715}*/
+   SCIP_FILE* file;
+   SCIP_RETCODE retcode;
+
+   assert(reader != NULL);
+   assert(strcmp(SCIPreaderGetName(reader), READER_NAME) == 0);
+   assert(result != NULL);
+
+   *result = SCIP_DIDNOTRUN;
+
+   file = SCIPfopen(filename, "rb");
+   if( file == NULL )
+   {
+      SCIPerrorMessage("cannot open file <%s> for reading\n", filename);
+      SCIPprintSysError(filename);
+      return SCIP_NOFILE;
+   }
+
+   retcode = readSnapshot(scip, file);
+
+   SCIPfclose(file);
+
+   SCIP_CALL( retcode );
+
+   *result = SCIP_SUCCESS;
+
+   return SCIP_OKAY;
+}
+
+/** problem writing method of reader */
+static
+SCIP_DECL_READERWRITE(readerWriteSnp)
+{  /*lint --e{715}*/
+   SCIP_RETCODE retcode;
+   SCIP_HASHMAP* varmap;
+   SCIP_Real objdata[2];
+   int header[4];
+   int i;
+
+   assert(reader != NULL);
+   assert(strcmp(SCIPreaderGetName(reader), READER_NAME) == 0);
+   assert(transformed || nfixedvars == 0);
+
+   if( file == NULL )
+      file = stdout;
+
+#if defined(_WIN32) || defined(_WIN64)
+   /* the snapshot must not be subject to newline conversion */
+   (void) _setmode(_fileno(file), _O_BINARY);
+#endif
+
+   /* map the variables to their index in the snapshot */
+   SCIP_CALL( SCIPhashmapCreate(&varmap, SCIPblkmem(scip), MAX(nvars + nfixedvars, 1)) );
+   for( i = 0; i < nvars; ++i )
+   {
+      SCIP_CALL( SCIPhashmapInsertInt(varmap, (void*)vars[i], i) );
+   }
+   for( i = 0; i < nfixedvars; ++i )
+   {
+      SCIP_CALL( SCIPhashmapInsertInt(varmap, (void*)fixedvars[i], nvars + i) );
+   }
+
+   header[0] = SNP_VERSION;
+   header[1] = SNP_BYTEORDER;
+   header[2] = (int)sizeof(SCIP_Real);
+   header[3] = transformed ? 1 : 0;
+   objdata[0] = objscale;
+   objdata[1] = objoffset;
+
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, SNP_MAGIC, sizeof(char), SNP_MAGICLEN), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, header, sizeof(int), 4), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeInt(file, (int)objsense), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, objdata, sizeof(SCIP_Real), 2), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeStrings(scip, file, &name, 1), TERMINATE );
+
+   SCIP_CALL_TERMINATE( retcode, writeVariables(scip, file, vars, nvars, fixedvars, nfixedvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeAggregations(scip, file, varmap, fixedvars, nfixedvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, writeConstraints(scip, file, varmap, conss, nconss), TERMINATE );
+
+   SCIP_CALL_TERMINATE( retcode, writeArray(file, SNP_MAGIC, sizeof(char), SNP_MAGICLEN), TERMINATE );
+
+   *result = SCIP_SUCCESS;
+
+TERMINATE:
+   SCIPhashmapFree(&varmap);
+
+   return retcode;
+}
+
+
+/*
+ * reader specific interface methods
+ */
+
+/** includes the snp file reader in SCIP */
+SCIP_RETCODE SCIPincludeReaderSnp(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_READER* reader;
+
+   /* include reader */
+   SCIP_CALL( SCIPincludeReaderBasic(scip, &reader, READER_NAME, READER_DESC, READER_EXTENSION, NULL) );
+
+   /* set non fundamental callbacks via setter functions */
+   SCIP_CALL( SCIPsetReaderCopy(scip, reader, readerCopySnp) );
+   SCIP_CALL( SCIPsetReaderRead(scip, reader, readerReadSnp) );
+   SCIP_CALL( SCIPsetReaderWrite(scip, reader, readerWriteSnp) );
+
+   return SCIP_OKAY;
+}
@@ -0,0 +1,59 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   reader_snp.h
+ * @ingroup FILEREADERS
+ * @brief  SNP file reader for binary problem snapshots
+ *
+ * The SNP format is a versioned binary format to store a problem such that it can be reloaded without parsing any
+ * text. Variables and the linear, set partitioning/packing/covering, logic or, knapsack, and variable bound
+ * constraints are stored as blocks of arrays that are read in bulk, and constraints refer to variables by their index
+ * in the snapshot instead of by name. All other constraints are stored in CIP format and parsed when reading.
+ *
+ * Writing the transformed problem (e.g., with "write transproblem" after presolving) stores the presolved problem
+ * together with the fixed and aggregated variables, each expressed in terms of the active variables. As for the CIP
+ * format, the latter are read as variables that are linked to the active variables by linear coupling constraints.
+ *
+ * A snapshot stores numbers in the native byte order of the machine that wrote it and can only be read on machines
+ * with the same byte order and floating point representation.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_READER_SNP_H__
+#define __SCIP_READER_SNP_H__
+
+#include "scip/def.h"
+#include "scip/type_retcode.h"
+#include "scip/type_scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** includes the snp file reader into SCIP
+ *
+ *  @ingroup FileReaderIncludes
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPincludeReaderSnp(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -386,6 +386,79 @@ SCIP_RETCODE SCIPcopyBenders(
    return SCIP_OKAY;
 }
 
+/** starts to mirror the variable hash map of a copy process by a dense array indexed by the source variables
+ *
+ *  The copies of the variables are looked up for every coefficient of the copied constraints, which is considerably
+ *  faster in an array than in the hash map. The hash map is still filled, since constraint handlers and user plugins
+ *  may access it directly, and its entries are taken over when they are looked up for the first time, e.g., when the
+ *  user supplied a partial variable map. Nested copy methods that use the same hash map share the dense map.
+ */
+static
+SCIP_RETCODE copymapCapture(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP*                 targetscip,         /**< target SCIP data structure */
+   SCIP_HASHMAP*         varmap,             /**< variable hash map of the copy process */
+   SCIP_Bool*            captured            /**< pointer to store whether the dense map was captured */
+   )
+{
+   SCIP_COPYMAP* copymap;
+
+   assert(sourcescip != NULL);
+   assert(targetscip != NULL);
+   assert(varmap != NULL);
+   assert(captured != NULL);
+
+   copymap = targetscip->copymap;
+
+   /* a copy process with a different hash map is running, which keeps its dense map */
+   if( copymap != NULL )
+   {
+      *captured = (copymap->sourcescip == sourcescip && copymap->varmap == varmap);
+      if( *captured )
+         ++copymap->nuses;
+
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPallocBlockMemory(targetscip, &copymap) );
+   copymap->sourcescip = sourcescip;
+   copymap->varmap = varmap;
+   copymap->varssize = MAX(sourcescip->stat->nvaridx, 1);
+   copymap->nuses = 1;
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(targetscip, &copymap->vars, copymap->varssize) );
+
+   targetscip->copymap = copymap;
+   *captured = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/** releases the dense map of the variable hash map of a copy process */
+static
+void copymapRelease(
+   SCIP*                 targetscip,         /**< target SCIP data structure */
+   SCIP_Bool             captured            /**< was the dense map captured by the copy method? */
+   )
+{
+   SCIP_COPYMAP* copymap;
+
+   assert(targetscip != NULL);
+
+   if( !captured )
+      return;
+
+   copymap = targetscip->copymap;
+   assert(copymap != NULL);
+   assert(copymap->nuses > 0);
+
+   if( --copymap->nuses == 0 )
+   {
+      SCIPfreeBlockMemoryArray(targetscip, &copymap->vars, copymap->varssize);
+      SCIPfreeBlockMemory(targetscip, &copymap);
+      targetscip->copymap = NULL;
+   }
+}
+
 /** create a problem by copying the problem data of the source SCIP */
 static
 SCIP_RETCODE copyProb(
@@ -714,9 +787,11 @@ SCIP_RETCODE SCIPgetVarCopy(
 {
    SCIP_HASHMAP* localvarmap;
    SCIP_HASHMAP* localconsmap;
+   SCIP_VAR** densevars;
    SCIP_VAR* var;
    SCIP_Bool uselocalvarmap;
    SCIP_Bool uselocalconsmap;
+   int denseidx;
 
    assert(sourcescip != NULL);
    assert(targetscip != NULL);
@@ -724,6 +799,22 @@ SCIP_RETCODE SCIPgetVarCopy(
    assert(targetvar != NULL);
    assert(sourcevar->scip == sourcescip);
 
+   /* look up the copy in the dense map of a running copy process that uses the given hash map */
+   densevars = NULL;
+   denseidx = SCIPvarGetIndex(sourcevar);
+   if( varmap != NULL && targetscip->copymap != NULL && targetscip->copymap->varmap == varmap
+      && targetscip->copymap->sourcescip == sourcescip && denseidx < targetscip->copymap->varssize )
+   {
+      densevars = targetscip->copymap->vars;
+      if( densevars[denseidx] != NULL )
+      {
+         *targetvar = densevars[denseidx];
+         *success = TRUE;
+
+         return SCIP_OKAY;
+      }
+   }
+
    /* check stages for both, the source and the target SCIP data structure */
    SCIP_CALL( SCIPcheckStage(sourcescip, "SCIPgetVarCopy", FALSE, TRUE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, FALSE) );
    SCIP_CALL( SCIPcheckStage(targetscip, "SCIPgetVarCopy", FALSE, TRUE, FALSE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE) );
@@ -737,7 +828,12 @@ SCIP_RETCODE SCIPgetVarCopy(
    {
       *targetvar = (SCIP_VAR*) SCIPhashmapGetImage(varmap, sourcevar);
       if( *targetvar != NULL )
+      {
+         if( densevars != NULL )
+            densevars[denseidx] = *targetvar;
+
          return SCIP_OKAY;
+      }
    }
 
    /* reject copying of relaxation-only variables */
@@ -891,6 +987,10 @@ SCIP_RETCODE SCIPgetVarCopy(
       SCIP_CALL( SCIPgetNegatedVar(targetscip, targetnegatedvar, targetvar) );
       assert(SCIPvarGetStatus(*targetvar) == SCIP_VARSTATUS_NEGATED);
 
+      /* negated variables are not stored in the hash map, but their copies can be remembered in the dense map */
+      if( densevars != NULL )
+         densevars[denseidx] = *targetvar;
+
       /* free local hash maps if necessary */
       if( uselocalvarmap )
          SCIPhashmapFree(&localvarmap);
@@ -914,6 +1014,9 @@ SCIP_RETCODE SCIPgetVarCopy(
 
    *targetvar = var;
 
+   if( densevars != NULL )
+      densevars[denseidx] = var;
+
    /* remove the variable capture which was done due to the creation of the variable */
    SCIP_CALL( SCIPreleaseVar(targetscip, &var) );
 
@@ -953,6 +1056,7 @@ SCIP_RETCODE copyVars(
    SCIP_HASHMAP* localconsmap;
    SCIP_Bool uselocalvarmap;
    SCIP_Bool uselocalconsmap;
+   SCIP_Bool copymapcaptured;
    int nsourcevars;
 #ifndef NDEBUG
    int nrelaxonlybinvars = 0;
@@ -997,6 +1101,9 @@ SCIP_RETCODE copyVars(
    else
       localconsmap = consmap;
 
+   /* mirror the variable map by a dense map for the lookups of the variable copies */
+   SCIP_CALL( copymapCapture(sourcescip, targetscip, localvarmap, &copymapcaptured) );
+
    /* create the variables of the target SCIP */
    for( i = 0; i < nsourcevars; ++i )
    {
@@ -1116,6 +1223,8 @@ SCIP_RETCODE copyVars(
    }
 #endif
 
+   copymapRelease(targetscip, copymapcaptured);
+
    if( uselocalvarmap )
    {
       /* free hash map */
@@ -1731,6 +1840,7 @@ SCIP_RETCODE SCIPcopyConss(
    SCIP_HASHMAP* localconsmap;
    SCIP_Bool uselocalvarmap;
    SCIP_Bool uselocalconsmap;
+   SCIP_Bool copymapcaptured;
    int nsourceconshdlrs;
    int i;
 
@@ -1762,6 +1872,9 @@ SCIP_RETCODE SCIPcopyConss(
    else
       localconsmap = consmap;
 
+   /* mirror the variable map by a dense map for the lookups of the variable copies */
+   SCIP_CALL( copymapCapture(sourcescip, targetscip, localvarmap, &copymapcaptured) );
+
    nsourceconshdlrs = SCIPgetNConshdlrs(sourcescip);
    sourceconshdlrs = SCIPgetConshdlrs(sourcescip);
    assert(nsourceconshdlrs == 0 || sourceconshdlrs != NULL);
@@ -1866,6 +1979,8 @@ SCIP_RETCODE SCIPcopyConss(
       }
    }
 
+   copymapRelease(targetscip, copymapcaptured);
+
    if( uselocalvarmap )
    {
       /* free hash map */
@@ -1935,6 +2050,7 @@ SCIP_RETCODE SCIPcopyOrigConss(
    SCIP_HASHMAP* localconsmap;
    SCIP_Bool uselocalvarmap;
    SCIP_Bool uselocalconsmap;
+   SCIP_Bool copymapcaptured;
    int nsourceconss;
    int c;
 
@@ -1966,6 +2082,9 @@ SCIP_RETCODE SCIPcopyOrigConss(
    else
       localconsmap = consmap;
 
+   /* mirror the variable map by a dense map for the lookups of the variable copies */
+   SCIP_CALL( copymapCapture(sourcescip, targetscip, localvarmap, &copymapcaptured) );
+
    sourceconss = SCIPgetOrigConss(sourcescip);
    nsourceconss = SCIPgetNOrigConss(sourcescip);
 
@@ -2015,6 +2134,8 @@ SCIP_RETCODE SCIPcopyOrigConss(
       }
    }
 
+   copymapRelease(targetscip, copymapcaptured);
+
    if( uselocalvarmap )
    {
       /* free hash map */
@@ -2223,6 +2344,7 @@ SCIP_RETCODE SCIPcopyConflicts(
    SCIP_HASHMAP* localconsmap;
    SCIP_Bool uselocalvarmap;
    SCIP_Bool uselocalconsmap;
+   SCIP_Bool copymapcaptured;
    SCIP_Bool success;
    int sourceconfssize;
    int nsourceconfs;
@@ -2255,6 +2377,9 @@ SCIP_RETCODE SCIPcopyConflicts(
    else
       localconsmap = consmap;
 
+   /* mirror the variable map by a dense map for the lookups of the variable copies */
+   SCIP_CALL( copymapCapture(sourcescip, targetscip, localvarmap, &copymapcaptured) );
+
    /* get number of conflicts stored in the conflict pool */
    sourceconfssize = SCIPconflictstoreGetNConflictsInStore(sourcescip->conflictstore);
 
@@ -2312,6 +2437,8 @@ SCIP_RETCODE SCIPcopyConflicts(
       }
    }
 
+   copymapRelease(targetscip, copymapcaptured);
+
    if( uselocalvarmap )
    {
       /* free hash map */
@@ -2663,6 +2790,7 @@ SCIP_RETCODE doCopy(
    SCIP_Real copytime;
    SCIP_Bool uselocalvarmap;
    SCIP_Bool uselocalconsmap;
+   SCIP_Bool copymapcaptured;
    SCIP_Bool consscopyvalid;
    SCIP_Bool benderscopyvalid;
    SCIP_Bool localvalid;
@@ -2715,6 +2843,9 @@ SCIP_RETCODE doCopy(
    else
       localconsmap = consmap;
 
+   /* mirror the variable map by a dense map for the lookups of the variable copies */
+   SCIP_CALL( copymapCapture(sourcescip, targetscip, localvarmap, &copymapcaptured) );
+
    /* construct name for the target SCIP using the source problem name and the given suffix string */
    (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "%s_%s", SCIPgetProbName(sourcescip), suffix);
 
@@ -2773,6 +2904,8 @@ SCIP_RETCODE doCopy(
 
    localvalid = localvalid && benderscopyvalid;
 
+   copymapRelease(targetscip, copymapcaptured);
+
    if( uselocalvarmap )
    {
       /* free hash map */
@@ -183,6 +183,35 @@ SCIP_RETCODE SCIPfree(
    SCIP**                scip                /**< pointer to SCIP data structure */
    );
 
+/** resets SCIP to an empty problem such that the data structure can be reused for solving another problem
+ *
+ *  In contrast to freeing and recreating SCIP, the included plugins, the parameter settings, the dialogs, the message
+ *  handler, and the block memory of the parameter settings and the problem are kept.  The problem data and the problem
+ *  statistics are freed as in SCIPfreeProb() and the total time clock is restarted.  If @p resetparams is TRUE, all
+ *  parameters are set to their default values.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_INIT
+ *       - \ref SCIP_STAGE_PROBLEM
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ *
+ *  @post After calling this method \SCIP reached the solving stage \ref SCIP_STAGE_INIT
+ *
+ *  See \ref SCIP_Stage "SCIP_STAGE" for a complete list of all possible solving stages.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPresetInstance(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Bool             resetparams         /**< should all parameters be reset to their default values? */
+   );
+
 /** returns current stage of SCIP
  *
  *  @return the current SCIP stage
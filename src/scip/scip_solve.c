@@ -3086,13 +3086,29 @@ SCIP_RETCODE SCIPsolveConcurrent(
        */
       SCIPselectDownRealInt(prios, solvertypes, nthreads, ncandsolvertypes);
 
+      /* if the tree is split among the solvers, all solvers need to build the identical tree until the split, so they
+       * must use the same solver type and the same seeds
+       */
+      if( scip->set->concurrent_splittree )
+      {
+         if( SCIPisConcurrentTreeSplit(scip) )
+         {
+            for( i = 1; i < nthreads; ++i )
+               solvertypes[i] = solvertypes[0];
+         }
+         else
+         {
+            SCIPwarningMessage(scip, "splitting the tree requires the deterministic parallel mode, solvers are racing instead\n");
+         }
+      }
+
       SCIP_CALL( SCIPcreateRandom(scip, &rndgen, (unsigned) scip->set->concurrent_initseed, TRUE) );
       for( i = 0; i < nthreads; ++i )
       {
          SCIP_CONCSOLVER* concsolver;
 
          SCIP_CALL( SCIPconcsolverCreateInstance(scip->set, concsolvertypes[solvertypes[i]], &concsolver) );
-         if( scip->set->concurrent_changeseeds && SCIPgetNConcurrentSolvers(scip) > 1 )
+         if( scip->set->concurrent_changeseeds && SCIPgetNConcurrentSolvers(scip) > 1 && !SCIPisConcurrentTreeSplit(scip) )
             SCIP_CALL( SCIPconcsolverInitSeeds(concsolver, SCIPrandomGetInt(rndgen, 0, INT_MAX)) );
       }
       SCIPfreeRandom(scip, &rndgen);
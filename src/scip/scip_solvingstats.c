@@ -3744,14 +3744,15 @@ void SCIPprintConcsolverStatistics(
 
    if( nconcsolvers > 0 )
    {
-      SCIPmessageFPrintInfo(scip->messagehdlr, file, "Concurrent Solvers : SolvingTime    SyncTime       Nodes    LP Iters SolsShared   SolsRecvd TighterBnds TighterIntBnds\n");
+      SCIPmessageFPrintInfo(scip->messagehdlr, file, "Concurrent Solvers : SolvingTime    SyncTime    WaitTime       Nodes    LP Iters SolsShared   SolsRecvd TighterBnds TighterIntBnds\n");
       for( i = 0; i < nconcsolvers; ++i )
       {
-         SCIPmessageFPrintInfo(scip->messagehdlr, file, "  %c%-16s: %11.2f %11.2f %11" SCIP_LONGINT_FORMAT " %11" SCIP_LONGINT_FORMAT "%11" SCIP_LONGINT_FORMAT " %11" SCIP_LONGINT_FORMAT " %11" SCIP_LONGINT_FORMAT " %14" SCIP_LONGINT_FORMAT "\n",
+         SCIPmessageFPrintInfo(scip->messagehdlr, file, "  %c%-16s: %11.2f %11.2f %11.2f %11" SCIP_LONGINT_FORMAT " %11" SCIP_LONGINT_FORMAT "%11" SCIP_LONGINT_FORMAT " %11" SCIP_LONGINT_FORMAT " %11" SCIP_LONGINT_FORMAT " %14" SCIP_LONGINT_FORMAT "\n",
             winner == i ? '*' : ' ',
             SCIPconcsolverGetName(concsolvers[i]),
             SCIPconcsolverGetSolvingTime(concsolvers[i]),
             SCIPconcsolverGetSyncTime(concsolvers[i]),
+            SCIPconcsolverGetWaitTime(concsolvers[i]),
             SCIPconcsolverGetNNodes(concsolvers[i]),
             SCIPconcsolverGetNLPIterations(concsolvers[i]),
             SCIPconcsolverGetNSolsShared(concsolvers[i]),
@@ -3869,6 +3869,128 @@ SCIP_RETCODE SCIPgetVarsStrongbranchesFrac(
    return SCIP_OKAY;
 }
 
+/** gets strong branching information on column variables with fractional values, where the candidates are distributed
+ *  over the given number of threads, each solving the strong branching LPs on its own copy of the LP solver interface
+ *
+ *  The candidates are assigned to the threads in a fixed round-robin order and the results are merged in the order of
+ *  the candidates, such that the outcome does not depend on the timing of the threads. If the task processing interface
+ *  is not available, see SCIPtpiIsAvailable(), the strong branching LPs are solved sequentially as in
+ *  SCIPgetVarsStrongbranchesFracParallel().
+ *
+ *  @note Since the copies do not share the warm start information of the LP solver, the results may differ slightly
+ *        from the sequential strong branching.
+ *
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_SOLVING
+ */
+SCIP_RETCODE SCIPgetVarsStrongbranchesFracParallel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR**            vars,               /**< variables to get strong branching values for */
+   int                   nvars,              /**< number of variables */
+   int                   itlim,              /**< iteration limit for strong branchings */
+   int                   nthreads,           /**< number of threads to use */
+   SCIP_Real*            down,               /**< stores dual bounds after branching variables down */
+   SCIP_Real*            up,                 /**< stores dual bounds after branching variables up */
+   SCIP_Bool*            downvalid,          /**< stores whether the returned down values are valid dual bounds, or NULL;
+                                              *   otherwise, they can only be used as an estimate value */
+   SCIP_Bool*            upvalid,            /**< stores whether the returned up values are valid dual bounds, or NULL;
+                                              *   otherwise, they can only be used as an estimate value */
+   SCIP_Bool*            downinf,            /**< array to store whether the downward branches are infeasible, or NULL */
+   SCIP_Bool*            upinf,              /**< array to store whether the upward branches are infeasible, or NULL */
+   SCIP_Bool*            downconflict,       /**< array to store whether conflict constraints were created for
+                                              *   infeasible downward branches, or NULL */
+   SCIP_Bool*            upconflict,         /**< array to store whether conflict constraints were created for
+                                              *   infeasible upward branches, or NULL */
+   SCIP_Bool*            lperror             /**< pointer to store whether an unresolved LP error occurred or the
+                                              *   solving process should be stopped (e.g., due to a time limit) */
+   )
+{
+   SCIP_COL** cols;
+   int j;
+
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPgetVarsStrongbranchesFracParallel", FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE) );
+
+   assert( lperror != NULL );
+   assert( vars != NULL );
+
+   /* set up data */
+   cols = NULL;
+   SCIP_CALL( SCIPallocBufferArray(scip, &cols, nvars) );
+   assert(cols != NULL);
+   for( j = 0; j < nvars; ++j )
+   {
+      SCIP_VAR* var;
+      SCIP_COL* col;
+
+      if( downvalid != NULL )
+         downvalid[j] = FALSE;
+      if( upvalid != NULL )
+         upvalid[j] = FALSE;
+      if( downinf != NULL )
+         downinf[j] = FALSE;
+      if( upinf != NULL )
+         upinf[j] = FALSE;
+      if( downconflict != NULL )
+         downconflict[j] = FALSE;
+      if( upconflict != NULL )
+         upconflict[j] = FALSE;
+
+      var = vars[j];
+      assert( var != NULL );
+      if( SCIPvarGetStatus(var) != SCIP_VARSTATUS_COLUMN )
+      {
+         SCIPerrorMessage("cannot get strong branching information on non-COLUMN variable <%s>\n", SCIPvarGetName(var));
+         SCIPfreeBufferArray(scip, &cols);
+         return SCIP_INVALIDDATA;
+      }
+
+      col = SCIPvarGetCol(var);
+      assert(col != NULL);
+      cols[j] = col;
+
+      if( !SCIPcolIsInLP(col) )
+      {
+         SCIPerrorMessage("cannot get strong branching information on variable <%s> not in current LP\n", SCIPvarGetName(var));
+         SCIPfreeBufferArray(scip, &cols);
+         return SCIP_INVALIDDATA;
+      }
+   }
+
+   /* check if the solving process should be aborted */
+   if( SCIPsolveIsStopped(scip->set, scip->stat, FALSE) )
+   {
+      /* mark this as if the LP failed */
+      *lperror = TRUE;
+   }
+   else
+   {
+      /* call strong branching for columns with fractional value in parallel */
+      SCIP_CALL( SCIPcolGetStrongbranchesParallel(cols, nvars, scip->set, scip->messagehdlr, scip->mem->probmem,
+            scip->stat, scip->transprob, scip->lp, itlim, nthreads, down, up, downvalid, upvalid, lperror) );
+
+      /* check, if the branchings are infeasible; in exact solving mode, we cannot trust the strong branching enough to
+       * declare the sub nodes infeasible
+       */
+      if( !(*lperror) && SCIPprobAllColsInLP(scip->transprob, scip->set, scip->lp) && !scip->set->misc_exactsolve )
+      {
+         for( j = 0; j < nvars; ++j )
+         {
+            SCIP_CALL( analyzeStrongbranch(scip, vars[j], (downinf != NULL) ? (&(downinf[j])) : NULL,
+                  (upinf != NULL) ? (&(upinf[j])) : NULL, (downconflict != NULL) ? (&(downconflict[j])) : NULL,
+                  (upconflict != NULL) ? (&(upconflict[j])) : NULL) );
+         }
+      }
+   }
+   SCIPfreeBufferArray(scip, &cols);
+
+   return SCIP_OKAY;
+}
+
 /** gets strong branching information on column variables with integral values
  *
  *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
@@ -9652,6 +9774,82 @@ SCIP_RETCODE SCIPinitVarValueBranchStats(
    return SCIP_OKAY;
 }
 
+/** stores the branching history of a variable in an array of SCIP_HISTORY_NDATA values, e.g., to transfer it to another
+ *  solve of a similar problem with SCIPaddVarHistoryData()
+ *
+ *  For each of the pseudo cost count, mean, and variance, the VSIDS, the conflict length sum, the inference sum, the
+ *  cutoff sum, the number of active conflicts, the number of branchings, and the branching depth sum, the value of the
+ *  downwards direction is followed by the value of the upwards direction.  The history of an original variable is the
+ *  one of its transformed variable, if existing.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_PROBLEM
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ */
+SCIP_RETCODE SCIPgetVarHistoryData(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR*             var,                /**< problem variable */
+   SCIP_Real*            data                /**< array of size SCIP_HISTORY_NDATA to store the history values */
+   )
+{
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPgetVarHistoryData", FALSE, TRUE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, FALSE) );
+
+   assert(var != NULL);
+   assert(var->scip == scip);
+   assert(data != NULL);
+
+   SCIPvarGetHistoryData(var, data);
+
+   return SCIP_OKAY;
+}
+
+/** adds history values given by an array of SCIP_HISTORY_NDATA values, see SCIPgetVarHistoryData(), to the branching
+ *  history of a variable
+ *
+ *  The values are added to the history of all runs, but not to the history of the current run.  If the variable is an
+ *  original variable and the problem is not yet transformed, the values are transferred to the transformed variable
+ *  when the problem is transformed.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_PROBLEM
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ */
+SCIP_RETCODE SCIPaddVarHistoryData(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR*             var,                /**< problem variable */
+   const SCIP_Real*      data                /**< array of SCIP_HISTORY_NDATA history values to add */
+   )
+{
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPaddVarHistoryData", FALSE, TRUE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, FALSE, FALSE) );
+
+   assert(var != NULL);
+   assert(var->scip == scip);
+   assert(data != NULL);
+
+   SCIPvarAddHistoryData(var, scip->stat, data);
+
+   return SCIP_OKAY;
+}
+
 /** returns the average number of cutoffs found after branching on the variable in given direction;
  *  if branching on the variable in the given direction was yet evaluated, the average number of cutoffs
  *  over all variables for branching in the given direction is returned
@@ -101,6 +101,7 @@
 #include "scip/heur_dps.h"
 #include "scip/heur_dualval.h"
 #include "scip/heur_farkasdiving.h"
+#include "scip/heur_feasjump.h"
 #include "scip/heur_feaspump.h"
 #include "scip/heur_fixandinfer.h"
 #include "scip/heur_fracdiving.h"
@@ -190,6 +191,7 @@
 #include "scip/reader_bnd.h"
 #include "scip/reader_ccg.h"
 #include "scip/reader_cip.h"
+#include "scip/reader_ckp.h"
 #include "scip/reader_cnf.h"
 #include "scip/reader_cor.h"
 #include "scip/reader_dec.h"
@@ -197,6 +199,7 @@
 #include "scip/reader_fix.h"
 #include "scip/reader_fzn.h"
 #include "scip/reader_gms.h"
+#include "scip/reader_hst.h"
 #include "scip/reader_lp.h"
 #include "scip/reader_mps.h"
 #include "scip/reader_mst.h"
@@ -208,6 +211,7 @@
 #include "scip/reader_pbm.h"
 #include "scip/reader_rlp.h"
 #include "scip/reader_smps.h"
+#include "scip/reader_snp.h"
 #include "scip/reader_sol.h"
 #include "scip/reader_sto.h"
 #include "scip/reader_tim.h"
@@ -36,6 +36,7 @@
 
 #include "blockmemshell/memory.h"
 #include "dijkstra/dijkstra.h"
+#include "scip/concurrent.h"
 #include "scip/pub_implics.h"
 #include "scip/pub_lp.h"
 #include "scip/pub_message.h"
@@ -59,6 +60,7 @@
 #include "scip/scip_tree.h"
 #include "scip/scip_var.h"
 #include "scip/sepa_oddcycle.h"
+#include "tpi/tpi.h"
 #include <string.h>
 
 #define SEPA_NAME              "oddcycle"
@@ -98,6 +100,7 @@
 #define DEFAULT_MAXCUTSLEVEL         50      /**< maximal number of cuts produced per level */
 #define DEFAULT_MAXUNSUCESSFULL       3      /**< maximal number of unsuccessful calls at each node */
 #define DEFAULT_CUTTHRESHOLD         -1      /**< maximal number of other cuts s.t. separation is applied (-1 for direct call) */
+#define DEFAULT_NTHREADS              1      /**< number of threads used for the shortest path searches of the GLS method */
 
 
 /*
@@ -173,6 +176,24 @@ struct GraphData
 };
 typedef struct GraphData GRAPHDATA;
 
+/** data of a job that searches a shortest path from a start node to its copy in the bipartite graph of the GLS method
+ *
+ *  Each job has its own Dijkstra arrays, which keep the result until it is used by the separator.
+ */
+struct PathJob
+{
+   const DIJKSTRA_GRAPH* graph;              /**< Dijkstra graph, which is only read */
+   unsigned int*         incut;              /**< nodes that are covered by a cut, which are only read, or NULL */
+   unsigned long long    cutoff;             /**< cutoff value for Dijkstra algorithm */
+   unsigned int          startnode;          /**< start node of the search */
+   unsigned int          endnode;            /**< target node of the search */
+   unsigned long long*   dist;               /**< distance array of the job */
+   unsigned int*         pred;               /**< predecessor array of the job */
+   unsigned int*         entry;              /**< heap storage of the job */
+   unsigned int*         order;              /**< heap storage of the job */
+};
+typedef struct PathJob PATHJOB;
+
 /** separator data */
 struct SCIP_SepaData
 {
@@ -215,6 +236,8 @@ struct SCIP_SepaData
    int                   nunsucessfull;      /**< number of unsuccessful calls at current node */
    int                   cutthreshold;       /**< maximal number of other cuts s.t. separation is applied (-1 for direct call) */
    SCIP_Longint          lastnode;           /**< number of last node */
+   int                   nthreads;           /**< number of threads used for the shortest path searches of the GLS method */
+   SCIP_Bool             tpiinitialized;     /**< was the task processing interface initialized by the separator? */
 };
 
 
@@ -2952,6 +2975,64 @@ SCIP_RETCODE addGLSCliques(
    return SCIP_OKAY;
 }
 
+/** searches the shortest path from the start node of a job to its copy in the bipartite graph of the GLS method */
+static
+SCIP_RETCODE searchPathJob(
+   void*                 args                /**< the job data */
+   )
+{
+   PATHJOB* job;
+
+   job = (PATHJOB*) args;
+   assert(job != NULL);
+
+   if( job->incut != NULL )
+      (void) dijkstraPairCutoffIgnore(job->graph, job->startnode, job->endnode, job->incut, job->cutoff, job->dist,
+         job->pred, job->entry, job->order);
+   else
+      (void) dijkstraPairCutoff(job->graph, job->startnode, job->endnode, job->cutoff, job->dist, job->pred,
+         job->entry, job->order);
+
+   return SCIP_OKAY;
+}
+
+/** searches the shortest paths of the given jobs in parallel */
+static
+SCIP_RETCODE searchPathsParallel(
+   PATHJOB*              jobs,               /**< jobs to process */
+   int                   njobs               /**< number of jobs */
+   )
+{
+   SCIP_RETCODE retcode;
+   int jobid;
+   int j;
+
+   assert(jobs != NULL);
+
+   jobid = SCIPtpiGetNewJobID();
+   retcode = SCIP_OKAY;
+
+   for( j = 0; j < njobs && retcode == SCIP_OKAY; ++j )
+   {
+      SCIP_SUBMITSTATUS status;
+      SCIP_JOB* job;
+
+      retcode = SCIPtpiCreateJob(&job, jobid, searchPathJob, (void*) &jobs[j]);
+
+      if( retcode == SCIP_OKAY )
+      {
+         retcode = SCIPtpiSumbitJob(job, &status);
+
+         if( retcode == SCIP_OKAY && status != SCIP_SUBMIT_SUCCESS )
+            retcode = SCIP_ERROR;
+      }
+   }
+
+   retcode = MIN(retcode, SCIPtpiCollectJobs(jobid));
+
+   return retcode;
+}
+
 /** The classical method for finding odd cycles by Groetschel, Lovasz, Schrijver uses a bipartite graph
  *  which contains in each partition a node for every node in the original graph.
  *  All arcs uv of the original graph are copied to arcs from u of the first partition to v' of the second partition
@@ -2973,6 +3054,11 @@ SCIP_RETCODE addGLSCliques(
  *  Since the implication graph of SCIP is (normally) incomplete,
  *  it is possible to use arcs between an original variable and its negated
  *  to obtain more cycles which are valid but not found due to missing links.
+ *
+ *  If several threads are available, the shortest paths of the next start nodes are searched in parallel jobs, each
+ *  with its own Dijkstra arrays. The paths are then turned into cuts in the order of the start nodes. If the search
+ *  ignores nodes covered by cuts, the paths of the remaining start nodes are searched again after a cut was generated,
+ *  such that the cuts are the same as for the sequential search.
  */
 static
 SCIP_RETCODE separateGLS(
@@ -3012,12 +3098,21 @@ SCIP_RETCODE separateGLS(
    unsigned int* pred;                       /* predecessor list for found cycle */
    unsigned int* entry;                      /* storage for Dijkstra algorithm */
    unsigned int* order;                      /* storage for Dijkstra algorithm */
+   unsigned long long* pathdist;             /* distance array holding the result of the current search */
+   unsigned int* pathpred;                   /* predecessor array holding the result of the current search */
    unsigned int dijkindex;
    SCIP_Bool success;                        /* flag for check for several errors */
 
    SCIP_Bool* incycle;                       /* flag array if variable is contained in the found cycle */
    unsigned int* pred2;                      /* temporary predecessor list for backprojection of found cycle */
 
+   PATHJOB* jobs;                            /* jobs for the parallel search of shortest paths */
+   int njobs;                                /* maximal number of parallel searches */
+   int nbatch;                               /* number of start nodes searched in the current batch */
+   int batchpos;                             /* position of the current start node in the batch */
+   unsigned int ngenerated;                  /* number of cut generations so far */
+   unsigned int batchngenerated;             /* number of cut generations when the batch was searched */
+
    int nscipbinvars;
    int nscipintvars;
    int nscipimplvars;
@@ -3346,8 +3441,33 @@ SCIP_RETCODE separateGLS(
    SCIP_CALL( SCIPallocBufferArray(scip, &pred2, (int) (2 * nbinvars)) );
    SCIP_CALL( SCIPallocBufferArray(scip, &incycle, (int) (2 * nbinvars)) );
 
-   /* separate odd cycle inequalities by GLS method */
    cutoff = (unsigned long long) (0.5 * sepadata->scale);
+
+   /* prepare the jobs for searching the shortest paths in parallel */
+   jobs = NULL;
+   njobs = 0;
+   if( sepadata->nthreads > 1 && SCIPtpiIsAvailable() )
+   {
+      njobs = sepadata->nthreads;
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobs, njobs) );
+
+      for( k = 0; k < njobs; ++k )
+      {
+         jobs[k].graph = &graph;
+         jobs[k].incut = sepadata->allowmultiplecuts ? incut : NULL;
+         jobs[k].cutoff = cutoff;
+         SCIP_CALL( SCIPallocBufferArray(scip, &jobs[k].dist, (int) graph.nodes) );
+         SCIP_CALL( SCIPallocBufferArray(scip, &jobs[k].pred, (int) graph.nodes) );
+         SCIP_CALL( SCIPallocBufferArray(scip, &jobs[k].entry, (int) graph.nodes) );
+         SCIP_CALL( SCIPallocBufferArray(scip, &jobs[k].order, (int) graph.nodes) );
+      }
+   }
+   nbatch = 0;
+   batchpos = 0;
+   ngenerated = 0;
+   batchngenerated = 0;
+
+   /* separate odd cycle inequalities by GLS method */
    for( i = (unsigned int) sepadata->lastroot; i < 2 * nbinvars
            && startcounter < maxstarts
            && sepadata->ncuts - sepadata->oldncuts < (unsigned int) sepadata->maxsepacutsround
@@ -3379,17 +3499,63 @@ SCIP_RETCODE separateGLS(
 
       ++startcounter;
 
-      if ( sepadata->allowmultiplecuts )
-         (void) dijkstraPairCutoffIgnore(&graph, startnode, endnode, incut, cutoff, dist, pred, entry, order);
+      if( njobs > 0 )
+      {
+         /* skip start nodes of the batch that have been covered by a cut in the meantime */
+         while( batchpos < nbatch && jobs[batchpos].startnode < startnode )
+            ++batchpos;
+
+         /* search the paths of the next start nodes in parallel, unless the results of the current batch are still
+          * valid; the search depends on the nodes covered by cuts only if these nodes are ignored
+          */
+         if( batchpos == nbatch || (sepadata->allowmultiplecuts && ngenerated != batchngenerated) )
+         {
+            unsigned int s;
+
+            nbatch = 0;
+            for( s = i; s < 2 * nbinvars && nbatch < njobs && startcounter + (unsigned int) nbatch <= maxstarts; ++s )
+            {
+               /* apply the same tests as for the current start node */
+               if( graph.head[graph.outbeg[s]] == DIJKSTRA_UNUSED || graph.head[graph.outbeg[s]+1] == DIJKSTRA_UNUSED )
+                  continue;
+
+               if( incut[s] && ! sepadata->multiplecuts )
+                  continue;
+
+               jobs[nbatch].startnode = s;
+               jobs[nbatch].endnode = s + 2 * nbinvars;
+               ++nbatch;
+            }
+            assert(nbatch >= 1);
+            assert(jobs[0].startnode == startnode);
+
+            SCIP_CALL( searchPathsParallel(jobs, nbatch) );
+
+            batchpos = 0;
+            batchngenerated = ngenerated;
+         }
+         assert(batchpos < nbatch && jobs[batchpos].startnode == startnode);
+
+         pathdist = jobs[batchpos].dist;
+         pathpred = jobs[batchpos].pred;
+      }
       else
-         (void) dijkstraPairCutoff(&graph, startnode, endnode, cutoff, dist, pred, entry, order);
+      {
+         if ( sepadata->allowmultiplecuts )
+            (void) dijkstraPairCutoffIgnore(&graph, startnode, endnode, incut, cutoff, dist, pred, entry, order);
+         else
+            (void) dijkstraPairCutoff(&graph, startnode, endnode, cutoff, dist, pred, entry, order);
+
+         pathdist = dist;
+         pathpred = pred;
+      }
 
       /* no odd cycle cut found */
-      if( dist[endnode] == DIJKSTRA_FARAWAY )
+      if( pathdist[endnode] == DIJKSTRA_FARAWAY )
          continue;
 
       /* skip check if cutoff has been exceeded */
-      if ( dist[endnode] >= cutoff )
+      if ( pathdist[endnode] >= cutoff )
          continue;
 
       /* detect cycle including:
@@ -3408,15 +3574,15 @@ SCIP_RETCODE separateGLS(
       success = TRUE;
 
       /* construct odd cycle in implication graph from shortest path on bipartite graph */
-      for( dijkindex = endnode; dijkindex != startnode && success; dijkindex = pred[dijkindex], edgedirection = !edgedirection )
+      for( dijkindex = endnode; dijkindex != startnode && success; dijkindex = pathpred[dijkindex], edgedirection = !edgedirection )
       {
          if( edgedirection )
          {
             /* check that current node is in second partition and next node is in first partition */
             assert(dijkindex >= 2 * nbinvars && dijkindex < 4 * nbinvars);
-            assert(pred[dijkindex] < 2*nbinvars);
+            assert(pathpred[dijkindex] < 2*nbinvars);
 
-            pred2[dijkindex - 2 * nbinvars] = pred[dijkindex];
+            pred2[dijkindex - 2 * nbinvars] = pathpred[dijkindex];
 
             /* check whether the object found is really a cycle without sub-cycles
              * (sub-cycles may occur in case there is not violated odd cycle inequality)
@@ -3429,9 +3595,9 @@ SCIP_RETCODE separateGLS(
          {
             /* check that current node is in first partition and next node is in second partition */
             assert(dijkindex < 2 * nbinvars);
-            assert(pred[dijkindex] >= 2 * nbinvars && pred[dijkindex] < 4 * nbinvars);
+            assert(pathpred[dijkindex] >= 2 * nbinvars && pathpred[dijkindex] < 4 * nbinvars);
 
-            pred2[dijkindex] = pred[dijkindex] - 2 * nbinvars;
+            pred2[dijkindex] = pathpred[dijkindex] - 2 * nbinvars;
 
             /* check whether the object found is really a cycle without sub-cycles
              * (sub-cycles may occur in case there is not violated odd cycle inequality)
@@ -3451,11 +3617,23 @@ SCIP_RETCODE separateGLS(
          graphdata.dijkstragraph = &graph;
          graphdata.levelgraph = NULL;
 
+         /* the cut may cover further nodes */
+         ++ngenerated;
+
          SCIP_CALL( generateOddCycleCut(scip, sepa, sol, vars, nbinvars, startnode, pred2, ncyclevars, incut, vals, sepadata, &graphdata, result) );
       }
    }
 
    /* free temporary memory */
+   for( k = njobs - 1; k >= 0; --k )
+   {
+      assert(jobs != NULL);
+      SCIPfreeBufferArray(scip, &jobs[k].order);
+      SCIPfreeBufferArray(scip, &jobs[k].entry);
+      SCIPfreeBufferArray(scip, &jobs[k].pred);
+      SCIPfreeBufferArray(scip, &jobs[k].dist);
+   }
+   SCIPfreeBufferArrayNull(scip, &jobs);
    SCIPfreeBufferArray(scip, &incycle);
    SCIPfreeBufferArray(scip, &pred2);
 
@@ -3683,6 +3861,34 @@ SCIP_DECL_SEPAINITSOL(sepaInitsolOddcycle)
    sepadata->nunsucessfull = 0;
    sepadata->lastnode = -1;
 
+   /* make sure that jobs can be submitted if the shortest path searches should be parallelized */
+   sepadata->tpiinitialized = FALSE;
+   if( sepadata->usegls && sepadata->nthreads > 1 )
+   {
+      SCIP_CALL( SCIPinitParallelJobs(scip, sepadata->nthreads, &sepadata->tpiinitialized) );
+   }
+
+   return SCIP_OKAY;
+}
+
+
+/** solving process deinitialization method of separator (called before branch and bound process data is freed) */
+static
+SCIP_DECL_SEPAEXITSOL(sepaExitsolOddcycle)
+{
+   SCIP_SEPADATA* sepadata;
+
+   assert(sepa != NULL);
+
+   sepadata = SCIPsepaGetData(sepa);
+   assert(sepadata != NULL);
+
+   if( sepadata->tpiinitialized )
+   {
+      SCIP_CALL( SCIPexitParallelJobs(scip) );
+      sepadata->tpiinitialized = FALSE;
+   }
+
    return SCIP_OKAY;
 }
 
@@ -3732,6 +3938,7 @@ SCIP_RETCODE SCIPincludeSepaOddcycle(
    SCIP_CALL( SCIPallocBlockMemory(scip, &sepadata) );
    sepadata->nunsucessfull = 0;
    sepadata->lastnode = -1;
+   sepadata->tpiinitialized = FALSE;
 
    /* include separator */
    SCIP_CALL( SCIPincludeSepaBasic(scip, &sepa, SEPA_NAME, SEPA_DESC, SEPA_PRIORITY, SEPA_FREQ, SEPA_MAXBOUNDDIST,
@@ -3746,6 +3953,7 @@ SCIP_RETCODE SCIPincludeSepaOddcycle(
    SCIP_CALL( SCIPsetSepaFree(scip, sepa, sepaFreeOddcycle) );
    SCIP_CALL( SCIPsetSepaInit(scip, sepa, sepaInitOddcycle) );
    SCIP_CALL( SCIPsetSepaInitsol(scip, sepa, sepaInitsolOddcycle) );
+   SCIP_CALL( SCIPsetSepaExitsol(scip, sepa, sepaExitsolOddcycle) );
 
    /* add oddcycle separator parameters */
    SCIP_CALL( SCIPaddBoolParam(scip, "separating/" SEPA_NAME "/usegls",
@@ -3853,5 +4061,9 @@ SCIP_RETCODE SCIPincludeSepaOddcycle(
          "maximal number of other cuts s.t. separation is applied (-1 for direct call)",
          &sepadata->cutthreshold, TRUE, DEFAULT_CUTTHRESHOLD, -1, INT_MAX, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddIntParam(scip, "separating/" SEPA_NAME "/nthreads",
+         "number of threads used for the shortest path searches of the GLS method",
+         &sepadata->nthreads, TRUE, DEFAULT_NTHREADS, 1, 64, NULL, NULL) );
+
    return SCIP_OKAY;
 }
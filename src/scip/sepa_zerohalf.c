@@ -92,25 +92,21 @@ typedef struct Mod2Col MOD2_COL;
 typedef struct Mod2Row MOD2_ROW;
 typedef struct Mod2Matrix MOD2_MATRIX;
 typedef struct TransIntRow TRANSINTROW;
-typedef struct RowIndex ROWINDEX;
 
-/** enum for different types of row indices in ROWINDEX structure */
+/** enum for different types of row indices in the aggregation sets of the mod 2 rows */
 
 #define ROWIND_TYPE unsigned int
 #define ORIG_RHS    0u
 #define ORIG_LHS    1u
 #define TRANSROW    2u
 
-/* macro to get a unique index from the rowindex */
-#define UNIQUE_INDEX(rowind) (3*(rowind).index + (rowind).type)
-
-struct RowIndex
-{
-   unsigned int          type:2;             /**< type of row index; 0 means lp row using the right hand side,
-                                              *   1 means lp row using the left hand side, and 2 means a
-                                              *   transformed integral row */
-   unsigned int          index:30;           /**< lp position of original row, or index of transformed integral row */
-};
+/* macros to get a unique index from the type and index of a row index and back; the type is ORIG_RHS for an lp row
+ * using the right hand side, ORIG_LHS for an lp row using the left hand side, and TRANSROW for a transformed integral
+ * row, and the index is the lp position of the original row or the index of the transformed integral row
+ */
+#define UNIQUE_INDEX(type, index)     (3*(int)(index) + (int)(type))
+#define UNIQUE_INDEX_TYPE(uniqueind)  ((ROWIND_TYPE)((uniqueind) % 3))
+#define UNIQUE_INDEX_INDEX(uniqueind) ((uniqueind) / 3)
 
 /** structure containing a transformed integral row obtained by relaxing an lp row */
 struct TransIntRow
@@ -128,15 +124,12 @@ struct TransIntRow
 /** structure representing a row in the mod 2 system */
 struct Mod2Row
 {
-   ROWINDEX*             rowinds;            /**< index set of rows associated with the mod 2 row */
    MOD2_COL**            nonzcols;           /**< sorted array of non-zero mod 2 columns in this mod 2 row */
    SCIP_Real             slack;              /**< slack of mod 2 row */
    SCIP_Real             maxsolval;          /**< maximum solution value of columns in mod 2 row */
    int                   index;              /**< unique index of mod 2 row */
    int                   pos;                /**< position of mod 2 row in mod 2 matrix rows array */
    int                   rhs;                /**< rhs of row */
-   int                   nrowinds;           /**< number of elements in rowinds */
-   int                   rowindssize;        /**< size of rowinds array */
    int                   nnonzcols;          /**< number of columns in nonzcols */
    int                   nonzcolssize;       /**< size of nonzcols array */
 };
@@ -155,6 +148,9 @@ struct Mod2Matrix
 {
    MOD2_COL**            cols;               /**< columns of the matrix */
    MOD2_ROW**            rows;               /**< rows of the matrix */
+   SCIP_GF2MATRIX*       rowinds;            /**< index sets of the rows associated with the mod 2 rows; row i of this matrix
+                                              *   contains the unique indices of the rows aggregated into the mod 2 row
+                                              *   with index i */
    TRANSINTROW*          transintrows;       /**< transformed integral rows obtained from non-integral lp rows */
    int                   ntransintrows;      /**< number of transformed integral rows obtained from non-integral lp rows */
    int                   nzeroslackrows;     /**< number of rows with zero slack */
@@ -838,16 +834,11 @@ SCIP_RETCODE mod2MatrixAddOrigRow(
    row->slack = MAX(0.0, slack);
    row->maxsolval = 0.0;
    row->rhs = rhsmod2;
-   row->nrowinds = 1;
-   row->rowinds = NULL;
-   row->rowindssize = 0;
 
    if( SCIPisZero(scip, row->slack) )
       ++mod2matrix->nzeroslackrows;
 
-   SCIP_CALL( SCIPensureBlockMemoryArray(scip, &row->rowinds, &row->rowindssize, row->nrowinds) );
-   row->rowinds[0].type = side;
-   row->rowinds[0].index = (unsigned int)SCIProwGetLPPos(origrow);
+   SCIP_CALL( SCIPgf2matrixFlipEntry(mod2matrix->rowinds, row->index, UNIQUE_INDEX(side, SCIProwGetLPPos(origrow))) );
 
    row->nnonzcols = 0;
    row->nonzcolssize = 0;
@@ -922,17 +913,12 @@ SCIP_RETCODE mod2MatrixAddTransRow(
 
    row->slack = MAX(0.0, introw->slack);
    row->rhs = mod2(scip, introw->rhs);
-   row->nrowinds = 1;
-   row->rowinds = NULL;
-   row->rowindssize = 0;
    row->maxsolval = 0.0;
 
    if( SCIPisZero(scip, row->slack) )
       ++mod2matrix->nzeroslackrows;
 
-   SCIP_CALL( SCIPensureBlockMemoryArray(scip, &row->rowinds, &row->rowindssize, row->nrowinds) );
-   row->rowinds[0].type = TRANSROW;
-   row->rowinds[0].index = (unsigned int)transrowind;
+   SCIP_CALL( SCIPgf2matrixFlipEntry(mod2matrix->rowinds, row->index, UNIQUE_INDEX(TRANSROW, transrowind)) );
 
    row->nnonzcols = 0;
    row->nonzcolssize = 0;
@@ -994,7 +980,6 @@ void destroyMod2Matrix(
    for( i = 0; i < mod2matrix->nrows; ++i )
    {
       SCIPfreeBlockMemoryArrayNull(scip, &mod2matrix->rows[i]->nonzcols, mod2matrix->rows[i]->nonzcolssize);
-      SCIPfreeBlockMemoryArrayNull(scip, &mod2matrix->rows[i]->rowinds, mod2matrix->rows[i]->rowindssize);
       SCIPfreeBlockMemory(scip, &mod2matrix->rows[i]); /*lint !e866*/
    }
 
@@ -1006,6 +991,8 @@ void destroyMod2Matrix(
 
    SCIPfreeBlockMemoryArray(scip, &mod2matrix->transintrows, 2*SCIPgetNLPRows(scip)); /*lint !e647*/
 
+   SCIPgf2matrixFree(&mod2matrix->rowinds);
+
    SCIPfreeBlockMemoryArrayNull(scip, &mod2matrix->rows, mod2matrix->rowssize);
    SCIPfreeBlockMemoryArrayNull(scip, &mod2matrix->cols, mod2matrix->colssize);
 }
@@ -1103,6 +1090,15 @@ SCIP_RETCODE buildMod2Matrix(
       }
    }
 
+   /* transform non-integral rows */
+   SCIP_CALL( mod2MatrixTransformContRows(scip, sol, sepadata, mod2matrix, allowlocal, maxslack) );
+
+   /* each lp row gives at most two mod 2 rows and each transformed integral row one, and the unique indices of the
+    * rows are less than three times the maximal lp position or transformed integral row index
+    */
+   SCIP_CALL( SCIPgf2matrixCreate(&mod2matrix->rowinds, blkmem, 2 * nrows + mod2matrix->ntransintrows,
+         3 * MAX(nrows, mod2matrix->ntransintrows)) );
+
    maxnonzeros = (int)(SCIPgetNLPCols(scip) * sepadata->maxrowdensity) + sepadata->densityoffset;
 
    /* add all integral rows using the created columns */
@@ -1181,9 +1177,6 @@ SCIP_RETCODE buildMod2Matrix(
       }
    }
 
-   /* transform non-integral rows */
-   SCIP_CALL( mod2MatrixTransformContRows(scip, sol, sepadata, mod2matrix, allowlocal, maxslack) );
-
    /* add all transformed integral rows using the created columns */
    for( i = 0; i < mod2matrix->ntransintrows; ++i )
    {
@@ -1323,8 +1316,8 @@ SCIP_RETCODE mod2matrixRemoveRow(
    }
 
    /* free row */
+   SCIPgf2matrixClearRow(mod2matrix->rowinds, row->index);
    SCIPfreeBlockMemoryArrayNull(scip, &row->nonzcols, row->nonzcolssize);
-   SCIPfreeBlockMemoryArray(scip, &row->rowinds, row->rowindssize);
    SCIPfreeBlockMemory(scip, &row);
 
    return SCIP_OKAY;
@@ -1625,6 +1618,8 @@ SCIP_RETCODE generateZerohalfCut(
    int nvars;
    int maxaggrlen;
    int nchgcoefs;
+   int nrowinds;
+   int* rowinds;
    int* cutinds;
    SCIP_ROW** rows;
    SCIP_VAR** vars;
@@ -1659,19 +1654,25 @@ SCIP_RETCODE generateZerohalfCut(
    cutislocal = FALSE;
 
    /* compute the aggregation of the rows with weight 0.5 */
-   for( i = 0; i < row->nrowinds; ++i )
+   nrowinds = SCIPgf2matrixGetRowNNonzs(mod2matrix->rowinds, row->index);
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowinds, nrowinds) );
+   SCIPgf2matrixGetRowNonzs(mod2matrix->rowinds, row->index, rowinds);
+
+   for( i = 0; i < nrowinds; ++i )
    {
-      switch( row->rowinds[i].type )
+      int index = UNIQUE_INDEX_INDEX(rowinds[i]);
+
+      switch( UNIQUE_INDEX_TYPE(rowinds[i]) )
       {
          case ORIG_RHS:
-            addOrigRow(scip, tmpcoefs, &cutrhs, cutinds, &cutnnz, &cutrank, &cutislocal, rows[row->rowinds[i].index], 1);
+            addOrigRow(scip, tmpcoefs, &cutrhs, cutinds, &cutnnz, &cutrank, &cutislocal, rows[index], 1);
             break;
          case ORIG_LHS:
-            addOrigRow(scip, tmpcoefs, &cutrhs, cutinds, &cutnnz, &cutrank, &cutislocal, rows[row->rowinds[i].index], -1);
+            addOrigRow(scip, tmpcoefs, &cutrhs, cutinds, &cutnnz, &cutrank, &cutislocal, rows[index], -1);
             break;
          case TRANSROW: {
-            TRANSINTROW* introw = &mod2matrix->transintrows[row->rowinds[i].index];
-            SCIPdebugMsg(scip, "using transformed row %i of length %i with slack %f and rhs %f for cut\n", row->rowinds[i].index, introw->len, introw->slack, introw->rhs);
+            TRANSINTROW* introw = &mod2matrix->transintrows[index];
+            SCIPdebugMsg(scip, "using transformed row %i of length %i with slack %f and rhs %f for cut\n", index, introw->len, introw->slack, introw->rhs);
             addTransRow(tmpcoefs, &cutrhs, cutinds, &cutnnz, &cutrank, &cutislocal, introw);
             break;
          }
@@ -1680,6 +1681,8 @@ SCIP_RETCODE generateZerohalfCut(
       }
    }
 
+   SCIPfreeBufferArray(scip, &rowinds);
+
    /* abort if aggregation is too long */
    if( cutnnz > maxaggrlen )
    {
@@ -1959,12 +1962,9 @@ SCIP_RETCODE mod2rowAddRow(
    MOD2_ROW*             rowtoadd            /**< mod 2 row that is added to the other mod 2 row */
    )
 {
-   SCIP_Shortbool* contained;
    int i;
    int j;
    int k;
-   int nnewentries;
-   int nlprows;
    MOD2_COL** newnonzcols;
    SCIP_Real newslack;
 
@@ -1974,7 +1974,6 @@ SCIP_RETCODE mod2rowAddRow(
    assert(row->nnonzcols == 0 || row->nonzcols != NULL);
    assert(rowtoadd->nnonzcols == 0 || rowtoadd->nonzcols != NULL);
 
-   nlprows = SCIPgetNLPRows(scip);
    row->rhs ^= rowtoadd->rhs;
 
    newslack = row->slack + rowtoadd->slack;
@@ -1985,53 +1984,8 @@ SCIP_RETCODE mod2rowAddRow(
 
    row->slack = newslack;
 
-   {
-      /* the maximum index return by the UNIQUE_INDEX macro is 3 times
-       * the maximum index value in the ROWINDEX struct. The index value could
-       * be the lp position of an original row or the index of a transformed row.
-       * Hence we need to allocate 3 times the maximum of these two possible
-       * index types.
-       */
-      int allocsize = 3 * MAX(nlprows, mod2matrix->ntransintrows);
-      SCIP_CALL( SCIPallocCleanBufferArray(scip, &contained, allocsize) );
-   }
-
-   /* remember entries that are in the row to add */
-   for( i = 0; i < rowtoadd->nrowinds; ++i )
-   {
-      contained[UNIQUE_INDEX(rowtoadd->rowinds[i])] = 1;
-   }
-
-   /* remove the entries that are in both rows from the row (1 + 1 = 0 (mod 2)) */
-   nnewentries = rowtoadd->nrowinds;
-   for( i = 0; i < row->nrowinds; )
-   {
-      if( contained[UNIQUE_INDEX(row->rowinds[i])] )
-      {
-         --nnewentries;
-         contained[UNIQUE_INDEX(row->rowinds[i])] = 0;
-         --row->nrowinds;
-         row->rowinds[i] = row->rowinds[row->nrowinds];
-      }
-      else
-      {
-         ++i;
-      }
-   }
-
-   SCIP_CALL( SCIPensureBlockMemoryArray(scip, &row->rowinds, &row->rowindssize, row->nrowinds + nnewentries) );
-
-   /* add remaining entries of row to add */
-   for ( i = 0; i < rowtoadd->nrowinds; ++i )
-   {
-      if( contained[UNIQUE_INDEX(rowtoadd->rowinds[i])] )
-      {
-         contained[UNIQUE_INDEX(rowtoadd->rowinds[i])] = 0;
-         row->rowinds[row->nrowinds++] = rowtoadd->rowinds[i];
-      }
-   }
-
-   SCIPfreeCleanBufferArray(scip, &contained);
+   /* the rows that are in both index sets cancel (1 + 1 = 0 (mod 2)) */
+   SCIP_CALL( SCIPgf2matrixAddRow(mod2matrix->rowinds, row->index, rowtoadd->index) );
 
    SCIP_CALL( SCIPallocBufferArray(scip, &newnonzcols, row->nnonzcols + rowtoadd->nnonzcols) );
 
@@ -265,6 +265,8 @@
 /* Memory */
 
 #define SCIP_DEFAULT_MEM_SAVEFAC            0.8 /**< fraction of maximal mem usage when switching to memory saving mode */
+#define SCIP_DEFAULT_MEM_SPILLFAC           1.0 /**< fraction of maximal mem usage when writing bound changes of open
+                                                 *   nodes to a temporary file (1.0: never) */
 #define SCIP_DEFAULT_MEM_TREEGROWFAC        2.0 /**< memory growing factor for tree array */
 #define SCIP_DEFAULT_MEM_PATHGROWFAC        2.0 /**< memory growing factor for path array */
 #define SCIP_DEFAULT_MEM_TREEGROWINIT     65536 /**< initial size of tree array */
@@ -459,6 +461,8 @@
 #define SCIP_DEFAULT_CONCURRENT_CHANGECHILDSEL  TRUE /**< should the concurrent solvers use different child selection rules? */
 #define SCIP_DEFAULT_CONCURRENT_COMMVARBNDS     TRUE /**< should the concurrent solvers communicate variable bounds? */
 #define SCIP_DEFAULT_CONCURRENT_PRESOLVEBEFORE  TRUE /**< should the problem be presolved before it is copied to the concurrent solvers? */
+#define SCIP_DEFAULT_CONCURRENT_SPLITTREE      FALSE /**< should the concurrent solvers split the branch-and-bound tree instead of racing? */
+#define SCIP_DEFAULT_CONCURRENT_SPLITNODES        10 /**< number of open nodes per concurrent solver at which the tree is split */
 #define SCIP_DEFAULT_CONCURRENT_INITSEED     5131912 /**< the seed used to initialize the random seeds for the concurrent solvers */
 #define SCIP_DEFAULT_CONCURRENT_FREQINIT        10.0 /**< initial frequency of synchronization with other threads
                                                       *   (fraction of time required for solving the root LP) */
@@ -1884,6 +1888,11 @@ SCIP_RETCODE SCIPsetCreate(
          "fraction of maximal memory usage resulting in switch to memory saving mode",
          &(*set)->mem_savefac, FALSE, SCIP_DEFAULT_MEM_SAVEFAC, 0.0, 1.0,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
+         "memory/spillfac",
+         "fraction of maximal memory usage resulting in writing the bound changes of open nodes to a temporary file (1.0: never)",
+         &(*set)->mem_spillfac, FALSE, SCIP_DEFAULT_MEM_SPILLFAC, 0.0, 1.0,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
          "memory/arraygrowfac",
          "memory growing factor for dynamically allocated arrays",
@@ -2546,6 +2555,16 @@ SCIP_RETCODE SCIPsetCreate(
          "should the problem be presolved before it is copied to the concurrent solvers?",
          &(*set)->concurrent_presolvebefore, FALSE, SCIP_DEFAULT_CONCURRENT_PRESOLVEBEFORE,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "concurrent/splittree",
+         "should the concurrent solvers split the branch-and-bound tree among each other instead of racing (requires deterministic parallel mode)?",
+         &(*set)->concurrent_splittree, FALSE, SCIP_DEFAULT_CONCURRENT_SPLITTREE,
+         NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "concurrent/splitnodes",
+         "number of open nodes per concurrent solver at which the identically solved tree is split among the solvers",
+         &(*set)->concurrent_splitnodes, FALSE, SCIP_DEFAULT_CONCURRENT_SPLITNODES, 1, INT_MAX,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
          "concurrent/initseed",
          "maximum number of solutions that will be shared in a one synchronization",
@@ -37,6 +37,7 @@
 #include "scip/heur.h"
 #include "scip/interrupt.h"
 #include "scip/lp.h"
+#include "scip/mem.h"
 #include "scip/nodesel.h"
 #include "scip/pricer.h"
 #include "scip/pricestore.h"
@@ -4916,6 +4917,9 @@ SCIP_RETCODE SCIPsolveCIP(
          /* update the memory saving flag, switch algorithms respectively */
          SCIPstatUpdateMemsaveMode(stat, set, messagehdlr, mem);
 
+         /* write the bound changes of open nodes to a temporary file if memory gets scarce */
+         SCIP_CALL( SCIPtreeSpillLeaves(tree, set, stat, messagehdlr, SCIPmemGetTotal(mem)) );
+
          /* get the current node selector */
          nodesel = SCIPsetGetNodesel(set, stat);
 
@@ -74,6 +74,7 @@ struct SCIP_ConcSolver
    SCIP_Longint                        ntighterintbnds;           /**< number of tighter global variable bounds the concurrent solver received
                                                                    *   on integer variables */
    SCIP_CLOCK*                         totalsynctime;             /**< total time used for synchronization, including idle time */
+   SCIP_CLOCK*                         totalwaittime;             /**< total time spent waiting for other solvers during synchronization */
 };
 
 #ifdef __cplusplus
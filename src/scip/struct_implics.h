@@ -80,6 +80,10 @@ struct SCIP_Clique
 struct SCIP_CliqueList
 {
    SCIP_CLIQUE**         cliques[2];         /**< cliques the variable fixed to FALSE/TRUE is member of */
+   unsigned int*         ids[2];             /**< ids of the cliques in the cliques arrays, such that clique lists can be
+                                              *   intersected without accessing the cliques */
+   uint64_t              signature[2];       /**< bitmaps of the ids of the cliques modulo 64; clique lists whose bitmaps
+                                              *   are disjoint do not have a common clique */
    int                   ncliques[2];        /**< number of cliques the variable fixed to FALSE/TRUE is member of */
    int                   size[2];            /**< size of cliques arrays */
 };
@@ -0,0 +1,67 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   struct_instancepool.h
+ * @ingroup INTERNALAPI
+ * @brief  data structures for pools of reusable SCIP instances
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_STRUCT_INSTANCEPOOL_H__
+#define __SCIP_STRUCT_INSTANCEPOOL_H__
+
+#include "scip/def.h"
+#include "scip/type_instancepool.h"
+#include "scip/type_paramset.h"
+#include "scip/type_scip.h"
+#include "tpi/type_tpi.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** parameter value that an initialized instance of the pool has and that differs from the default value */
+struct SCIP_PoolParam
+{
+   char*                 name;               /**< name of the parameter */
+   SCIP_PARAMTYPE        paramtype;          /**< type of the parameter */
+   SCIP_Longint          longintval;         /**< value of bool, int, and longint parameters */
+   SCIP_Real             realval;            /**< value of real parameters */
+   char*                 stringval;          /**< value of char and string parameters */
+};
+typedef struct SCIP_PoolParam SCIP_POOLPARAM;
+
+/** pool of reusable SCIP instances */
+struct SCIP_InstancePool
+{
+   SCIP_DECL_INSTANCEPOOLINIT((*initscip));  /**< initialization method of new instances, or NULL */
+   void*                 userdata;           /**< user data passed to the initialization method */
+   SCIP**                idle;               /**< instances that are ready to be acquired */
+   SCIP_POOLPARAM*       params;             /**< parameters of initialized instances that differ from the default */
+   SCIP_Longint          ncreated;           /**< number of instances created by the pool */
+   SCIP_Longint          nreused;            /**< number of acquisitions that were served by an idle instance */
+   int                   nidle;              /**< number of idle instances */
+   int                   maxidle;            /**< maximal number of idle instances that are kept */
+   int                   nacquired;          /**< number of instances that are currently acquired */
+   int                   nparams;            /**< number of parameters that differ from the default */
+   SCIP_LOCK             lock;               /**< lock to protect the pool from data races */
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
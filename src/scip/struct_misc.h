@@ -273,6 +273,30 @@ struct SCIP_DisjointSet
    int                   componentcount;     /**< counter for the number of connected components of the graph */
 };
 
+/** row of a matrix over GF(2), stored sparse as sorted column indices or dense as a bitset */
+struct SCIP_Gf2Row
+{
+   uint64_t*             words;              /**< bitset of a dense row, NULL if the row is sparse */
+   int*                  inds;               /**< sorted column indices of the nonzeros of a sparse row */
+   int                   indssize;           /**< size of inds array */
+   int                   nnonzs;             /**< number of nonzeros of the row */
+   int                   firstword;          /**< first word of a dense row that may be nonzero */
+   int                   lastword;           /**< last word of a dense row that may be nonzero, plus one */
+   SCIP_Bool             rhs;                /**< right hand side of the row */
+};
+
+/** matrix over GF(2) whose rows switch from the sparse to the dense representation when they fill in */
+struct SCIP_Gf2Matrix
+{
+   BMS_BLKMEM*           blkmem;             /**< block memory */
+   SCIP_GF2ROW*          rows;               /**< rows of the matrix */
+   int*                  buffer;             /**< buffer of size ncols for merging sparse rows, or NULL */
+   int                   nrows;              /**< number of rows */
+   int                   ncols;              /**< number of columns */
+   int                   nwords;             /**< number of words of a dense row */
+   int                   densennonzs;        /**< number of nonzeros above which a row is stored dense */
+};
+
 /** a linear inequality row in preparation to become a SCIP_ROW */
 struct SCIP_RowPrep
 {
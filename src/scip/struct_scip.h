@@ -50,11 +50,25 @@
 #include "scip/type_reopt.h"
 #include "scip/type_concurrent.h"
 #include "scip/type_syncstore.h"
+#include "scip/type_misc.h"
+#include "scip/type_var.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** dense map from the variables of a source SCIP to their copies in the target SCIP, which mirrors the variable hash
+ *  map of a running copy process
+ */
+struct SCIP_CopyMap
+{
+   SCIP*                 sourcescip;         /**< source SCIP of the copy process */
+   SCIP_HASHMAP*         varmap;             /**< variable hash map of the copy process that is mirrored */
+   SCIP_VAR**            vars;               /**< copies of the source variables indexed by their variable index, or NULL */
+   int                   varssize;           /**< size of vars array */
+   int                   nuses;              /**< number of nested copy methods that use the map */
+};
+
 /** SCIP main data structure */
 struct Scip
 {
@@ -99,6 +113,9 @@ struct Scip
    /* PARALLEL */
    SCIP_SYNCSTORE*       syncstore;          /**< the data structure for storing synchronization information */
    SCIP_CONCURRENT*      concurrent;         /**< data required for concurrent solve */
+
+   /* COPYING */
+   SCIP_COPYMAP*         copymap;            /**< dense variable map while this SCIP is the target of a copy, or NULL */
 };
 
 #ifdef __cplusplus
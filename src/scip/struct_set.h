@@ -369,6 +369,8 @@ struct SCIP_Set
 
    /* memory settings */
    SCIP_Real             mem_savefac;        /**< fraction of maximal memory usage resulting in switch to memory saving mode */
+   SCIP_Real             mem_spillfac;       /**< fraction of maximal memory usage resulting in writing the bound changes of
+                                              *   open nodes to a temporary file */
    SCIP_Real             mem_arraygrowfac;   /**< memory growing factor for dynamically allocated arrays */
    SCIP_Real             mem_treegrowfac;    /**< memory growing factor for tree array */
    SCIP_Real             mem_pathgrowfac;    /**< memory growing factor for path array */
@@ -567,6 +569,8 @@ struct SCIP_Set
    SCIP_Bool             concurrent_changechildsel; /**< change the child selection rule in different solvers? */
    SCIP_Bool             concurrent_commvarbnds;    /**< should the concurrent solvers communicate global variable bound changes? */
    SCIP_Bool             concurrent_presolvebefore; /**< should the problem be presolved before it is copied to the concurrent solvers? */
+   SCIP_Bool             concurrent_splittree;      /**< should the concurrent solvers split the branch-and-bound tree instead of racing? */
+   int                   concurrent_splitnodes;     /**< number of open nodes per concurrent solver at which the tree is split */
    int                   concurrent_initseed;       /**< the seed for computing the concurrent solver seeds */
    SCIP_Real             concurrent_freqinit;       /**< initial frequency of synchronization */
    SCIP_Real             concurrent_freqmax;        /**< maximal frequency of synchronization */
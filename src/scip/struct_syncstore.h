@@ -41,6 +41,7 @@ struct SCIP_SyncStore
    int                   nuses;              /**< number of uses of the synchronization store */
    SCIP_PARALLELMODE     mode;               /**< the mode for the parallel solving */
    SCIP_Bool             initialized;        /**< flag to indicate whether the syncstore has been initialized */
+   SCIP_Bool             splittree;          /**< do the solvers split the branch-and-bound tree instead of racing? */
    int                   ninitvars;          /**< number of variables it has been initialized for */
    SCIP_SYNCDATA*        syncdata;           /**< array of size nsyncdata, containing the synchronization data
                                               *   for each active synchroization */
@@ -48,7 +49,7 @@ struct SCIP_SyncStore
                                               *   by all threads */
 
    SCIP*                 mainscip;           /**< the SCIP instance that was used for initializing the syncstore */
-   SCIP_Bool             stopped;            /**< flag to indicate if the solving is stopped */
+   int                   stopped;            /**< flag to indicate if the solving is stopped, which is accessed atomically */
    SCIP_LOCK             lock;               /**< lock to protect the syncstore data structure from data races */
 
    /* SPI settings */
@@ -76,10 +77,15 @@ struct SCIP_SyncData
    SCIP_Real             bestupperbound;     /**< smalles upper bound on the objective value that was stored in this
                                               *   synchroization data */
    SCIP_Longint          syncnum;            /**< the synchronization number of this synchronization data */
-   int                   winner;             /**< the solverid of the solver with the best status */
+   int                   winner;             /**< the solverid of the solver with the best status, or with the smallest
+                                              *   lower bound if the solvers split the tree */
+   int                   nfinished;          /**< number of solvers that finished their part of the split tree */
+   SCIP_STATUS           finishedstatus;     /**< status of the whole tree if all solvers finished their part of it */
    SCIP_STATUS           status;             /**< the best status that was stored in this synchronization data */
    SCIP_LOCK             lock;               /**< a lock to protect this synchronization data */
-   int                   syncedcount;        /**< a counter of how many solvers have finished writing to this synchronization data */
+   int                   syncedcount;        /**< a counter of how many solvers have finished writing to this synchronization data,
+                                              *   which is modified atomically while holding the lock, such that it can be
+                                              *   read without the lock */
    SCIP_CONDITION        allsynced;          /**< a condition variable to signal when the last solver has finished writing to this
                                               *   synchronization data */
    SCIP_BOUNDSTORE*      boundstore;         /**< a boundstore for storing all the bound changes that were added to this
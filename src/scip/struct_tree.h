@@ -25,6 +25,9 @@
 #define __SCIP_STRUCT_TREE_H__
 
 
+#include <stdio.h>
+
+#include "blockmemshell/memory.h"
 #include "lpi/type_lpi.h"
 #include "scip/def.h"
 #include "scip/type_cons.h"
@@ -171,11 +174,39 @@ struct SCIP_PendingBdchg
    SCIP_Bool             probingchange;      /**< is the bound change a temporary setting due to probing? */
 };
 
+/** temporary file to which the static bound changes of open leaves are written if memory gets scarce; the bound
+ *  changes are stored as raw SCIP_BOUNDCHG records, the captures of their variables and inference data are kept
+ *  while they reside in the file, and they are read back as soon as the node is accessed again
+ */
+struct SCIP_NodeSpill
+{
+   FILE*                 file;               /**< temporary file, or NULL if not yet opened */
+   BMS_BLKMEM*           blkmem;             /**< block memory used for the domain changes of the tree's nodes */
+   SCIP_Longint          filesize;           /**< end of the used part of the file */
+   SCIP_Longint          nnodes;             /**< number of nodes whose bound changes currently reside in the file */
+   SCIP_Longint          lastpassnode;       /**< value of the node counter at the last spilling pass, or -1 */
+   SCIP_Longint          nspilled;           /**< total number of nodes whose bound changes were written to the file */
+   SCIP_Longint          nreloaded;          /**< total number of nodes whose bound changes were read back */
+   SCIP_Bool             disabled;           /**< could the temporary file not be created? */
+};
+
+/** placeholder for the static bound changes of a node that were written to the spill file; the first entries coincide
+ *  with the ones of SCIP_DOMCHGBOUND, such that the number of bound changes can be queried without reloading them
+ */
+struct SCIP_DomChgSpilled
+{
+   unsigned int          nboundchgs:30;      /**< number of bound changes (must be first structure entry!) */
+   unsigned int          domchgtype:2;       /**< type of domain change data (must be first structure entry!) */
+   SCIP_NODESPILL*       nodespill;          /**< spill file containing the bound changes */
+   SCIP_Longint          pos;                /**< position of the bound changes in the spill file */
+};
+
 /** branch and bound tree */
 struct SCIP_Tree
 {
    SCIP_NODE*            root;               /**< root node of the tree */
    SCIP_NODEPQ*          leaves;             /**< leaves of the tree */
+   SCIP_NODESPILL*       nodespill;          /**< temporary file storing bound changes of leaves if memory gets scarce */
    SCIP_NODE**           path;               /**< array of nodes storing the active path from root to current node, which
                                               *   is usually the focus or a probing node; in case of a cut off, the path
                                               *   may already end earlier */
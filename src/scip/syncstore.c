@@ -66,6 +66,7 @@ SCIP_RETCODE SCIPsyncstoreCreate(
 
    (*syncstore)->mode = SCIP_PARA_DETERMINISTIC;                      /* initialising the mode */
    (*syncstore)->initialized = FALSE;
+   (*syncstore)->splittree = FALSE;
    (*syncstore)->syncdata = NULL;
    (*syncstore)->stopped = FALSE;
    (*syncstore)->nuses = 1;
@@ -171,6 +172,7 @@ SCIP_RETCODE SCIPsyncstoreInit(
 
    SCIP_CALL( SCIPgetIntParam(scip, "parallel/mode", &paramode) );
    syncstore->mode = (SCIP_PARALLELMODE) paramode;
+   syncstore->splittree = SCIPisConcurrentTreeSplit(scip);
 
    SCIP_CALL( SCIPtpiInit(syncstore->nsolvers, INT_MAX, FALSE) );
    SCIP_CALL( SCIPautoselectDisps(scip) );
@@ -224,20 +226,17 @@ SCIP_RETCODE SCIPsyncstoreExit(
    return SCIP_OKAY;
 }
 
-/** checks whether the solve-is-stopped flag in the syncstore has been set by any thread */
+/** checks whether the solve-is-stopped flag in the syncstore has been set by any thread
+ *
+ *  This function is called whenever a solver checks its limits, so the flag is read atomically without a lock.
+ */
 SCIP_Bool SCIPsyncstoreSolveIsStopped(
    SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
    )
 {
-   SCIP_Bool stopped;
-
-   SCIP_CALL_ABORT( SCIPtpiAcquireLock(&syncstore->lock) );
-
-   stopped = syncstore->stopped;
-
-   SCIP_CALL_ABORT( SCIPtpiReleaseLock(&syncstore->lock) );
+   assert(syncstore != NULL);
 
-   return stopped;
+   return SCIPtpiAtomicLoadInt(&syncstore->stopped) != 0;
 }
 
 /** sets the solve-is-stopped flag in the syncstore so that subsequent calls to
@@ -248,11 +247,9 @@ void SCIPsyncstoreSetSolveIsStopped(
    SCIP_Bool             stopped             /**< flag if the solve is stopped */
    )
 {
-   SCIP_CALL_ABORT( SCIPtpiAcquireLock(&syncstore->lock) );
-
-   syncstore->stopped = stopped;
+   assert(syncstore != NULL);
 
-   SCIP_CALL_ABORT( SCIPtpiReleaseLock(&syncstore->lock) );
+   SCIPtpiAtomicStoreInt(&syncstore->stopped, stopped ? 1 : 0);
 }
 
 /** gets the upperbound from the last synchronization */
@@ -385,6 +382,13 @@ SCIP_SYNCDATA* SCIPsyncstoreGetNextSyncdata(
    if( newdelay < syncstore->minsyncdelay && nextsyncnum >= writenum - syncstore->maxnsyncdelay )
       return NULL;
 
+   /* in opportunistic mode the solvers do not wait for each other: a synchronization data that has not been written by
+    * all solvers yet is skipped for now, unless it needs to be read before it is reused
+    */
+   if( syncstore->mode == SCIP_PARA_OPPORTUNISTIC && nextsyncnum >= writenum - syncstore->maxnsyncdelay
+      && SCIPtpiAtomicLoadInt(&syncstore->syncdata[nextsyncnum % syncstore->nsyncdata].syncedcount) < syncstore->nsolvers )
+      return NULL;
+
    *delay = newdelay;
    assert(syncstore->syncdata[nextsyncnum % syncstore->nsyncdata].syncnum == nextsyncnum);
 
@@ -402,6 +406,10 @@ SCIP_RETCODE SCIPsyncstoreEnsureAllSynced(
    assert(syncstore != NULL);
    assert(syncstore->initialized);
 
+   /* the counter is only increased, so no lock is needed if all solvers have written already */
+   if( SCIPtpiAtomicLoadInt(&syncdata->syncedcount) == syncstore->nsolvers )
+      return SCIP_OKAY;
+
    /* check if waiting is required, make sure to hold the lock */
    SCIP_CALL( SCIPtpiAcquireLock(&syncdata->lock) );
 
@@ -452,13 +460,22 @@ SCIP_RETCODE SCIPsyncstoreStartSync(
       SCIPboundstoreClear((*syncdata)->boundstore);
       (*syncdata)->nsols = 0;
       (*syncdata)->memtotal = SCIPgetMemTotal(syncstore->mainscip);
-      (*syncdata)->syncedcount = 0;
+      SCIPtpiAtomicStoreInt(&(*syncdata)->syncedcount, 0);
       (*syncdata)->bestupperbound = SCIPinfinity(syncstore->mainscip);
       (*syncdata)->bestlowerbound = -(*syncdata)->bestupperbound;
       (*syncdata)->status = SCIP_STATUS_UNKNOWN;
       (*syncdata)->winner = 0;
+      (*syncdata)->nfinished = 0;
+      (*syncdata)->finishedstatus = SCIP_STATUS_UNKNOWN;
       (*syncdata)->syncnum = syncnum;
       (*syncdata)->syncfreq = 0.0;
+
+      /* if the tree is split, the dual bound is the smallest lower bound of all solvers */
+      if( syncstore->splittree )
+      {
+         (*syncdata)->bestlowerbound = (*syncdata)->bestupperbound;
+         (*syncdata)->winner = -1;
+      }
    }
 
    return SCIP_OKAY;
@@ -477,9 +494,7 @@ SCIP_RETCODE SCIPsyncstoreFinishSync(
    assert(syncstore != NULL);
    assert(syncstore->initialized);
 
-   ++(*syncdata)->syncedcount;
-
-   if( (*syncdata)->syncedcount == syncstore->nsolvers )
+   if( SCIPtpiAtomicFetchAddInt(&(*syncdata)->syncedcount, 1) == syncstore->nsolvers - 1 )
    {
       if( (*syncdata)->status != SCIP_STATUS_UNKNOWN )
          SCIPsyncstoreSetSolveIsStopped(syncstore, TRUE);
@@ -512,6 +527,20 @@ SCIP_STATUS SCIPsyncdataGetStatus(
    return syncdata->status;
 }
 
+/** gets the final status of the concurrent solve, or SCIP_STATUS_UNKNOWN if solve is not stopped yet */
+SCIP_STATUS SCIPsyncstoreGetStatus(
+   SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
+   )
+{
+   assert(syncstore != NULL);
+   assert(syncstore->initialized);
+
+   if( syncstore->lastsync == NULL )
+      return SCIP_STATUS_UNKNOWN;
+
+   return syncstore->lastsync->status;
+}
+
 /** gets the solver that had the best status, or -1 if solve is not stopped yet */
 int SCIPsyncstoreGetWinner(
    SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
@@ -533,7 +562,7 @@ int SCIPsyncdataGetNSynced(
 {
    assert(syncdata != NULL);
 
-   return syncdata->syncedcount;
+   return SCIPtpiAtomicLoadInt(&syncdata->syncedcount);
 }
 
 /** how many solvers have are running concurrently */
@@ -660,6 +689,64 @@ void SCIPsyncdataSetStatus(
    }
 }
 
+/** set status and lower bound of a solver that works on a part of the split tree in the synchronization data
+ *
+ *  The solving process is only stopped if all solvers have finished their part of the tree, or if one solver was
+ *  interrupted, e.g., by a limit. The solver with the smallest lower bound is the winner, such that its dual bound
+ *  is valid for the whole tree.
+ */
+void SCIPsyncdataSetSubtreeStatus(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   SCIP_SYNCDATA*        syncdata,           /**< the synchronization data */
+   SCIP_STATUS           status,             /**< the status of the solver */
+   SCIP_Real             lowerbound,         /**< the lower bound of the solver */
+   int                   solverid            /**< identifier of the solver that has this status */
+   )
+{
+   assert(syncstore != NULL);
+   assert(syncstore->initialized);
+   assert(syncstore->splittree);
+   assert(syncdata != NULL);
+
+   /* break ties by the solverid, such that the winner is selected deterministically */
+   if( syncdata->winner == -1 || lowerbound < syncdata->bestlowerbound
+      || (lowerbound == syncdata->bestlowerbound && solverid < syncdata->winner) ) /*lint !e777*/
+   {
+      syncdata->bestlowerbound = lowerbound;
+      syncdata->winner = solverid;
+   }
+
+   switch( status )
+   {
+   case SCIP_STATUS_UNKNOWN:
+      break;
+   case SCIP_STATUS_GAPLIMIT:
+   case SCIP_STATUS_OPTIMAL:
+   case SCIP_STATUS_INFEASIBLE:
+      /* the solver has finished its part of the tree; the status of the whole tree is the smallest of these statuses,
+       * since a gap limit or an optimal solution in one part dominates the infeasibility of another part
+       */
+      if( syncdata->nfinished == 0 || status < syncdata->finishedstatus )
+         syncdata->finishedstatus = status;
+      ++syncdata->nfinished;
+      break;
+   default:
+      /* the solver has been interrupted, so all solvers are stopped; keep the status closest to a finished solve */
+      if( syncdata->status == SCIP_STATUS_UNKNOWN || (syncdata->status < SCIP_STATUS_OPTIMAL && status > syncdata->status) )
+         syncdata->status = status;
+      break;
+   }
+
+   /* if this is the last solver writing to this synchronization data and all solvers have finished their part of the
+    * tree, the solving process is finished
+    */
+   if( syncdata->status == SCIP_STATUS_UNKNOWN && syncdata->nfinished == syncstore->nsolvers )
+   {
+      assert(syncdata->syncedcount == syncstore->nsolvers - 1);
+      syncdata->status = syncdata->finishedstatus;
+   }
+}
+
 /** adds memory used to the synchronization data */
 void SCIPsyncdataAddMemTotal(
    SCIP_SYNCDATA*        syncdata,           /**< the synchronization data the solution should be added to */
@@ -781,6 +868,16 @@ SCIP_Bool SCIPsyncstoreIsInitialized(
    return syncstore->initialized;
 }
 
+/** returns whether the solvers split the branch-and-bound tree instead of racing */
+SCIP_Bool SCIPsyncstoreIsTreeSplit(
+   SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
+   )
+{
+   assert(syncstore != NULL);
+
+   return syncstore->splittree;
+}
+
 /** returns the mode of the synchronization store */
 SCIP_PARALLELMODE SCIPsyncstoreGetMode(
    SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
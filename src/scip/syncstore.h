@@ -164,6 +164,12 @@ SCIP_STATUS SCIPsyncdataGetStatus(
    SCIP_SYNCDATA*        syncdata            /**< the synchronization data */
    );
 
+/** gets the final status of the concurrent solve, or SCIP_STATUS_UNKNOWN if solve is not stopped yet */
+SCIP_EXPORT
+SCIP_STATUS SCIPsyncstoreGetStatus(
+   SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
+   );
+
 /** gets the solver that had the best status, or -1 if solve is not stopped yet */
 SCIP_EXPORT
 int SCIPsyncstoreGetWinner(
@@ -237,6 +243,21 @@ void SCIPsyncdataSetStatus(
    int                   solverid            /**< identifier of te solver that has this status */
    );
 
+/** set status and lower bound of a solver that works on a part of the split tree in the synchronization data
+ *
+ *  The solving process is only stopped if all solvers have finished their part of the tree, or if one solver was
+ *  interrupted, e.g., by a limit. The solver with the smallest lower bound is the winner, such that its dual bound
+ *  is valid for the whole tree.
+ */
+SCIP_EXPORT
+void SCIPsyncdataSetSubtreeStatus(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   SCIP_SYNCDATA*        syncdata,           /**< the synchronization data */
+   SCIP_STATUS           status,             /**< the status of the solver */
+   SCIP_Real             lowerbound,         /**< the lower bound of the solver */
+   int                   solverid            /**< identifier of the solver that has this status */
+   );
+
 /** adds memory used to the synchronization data */
 SCIP_EXPORT
 void SCIPsyncdataAddMemTotal(
@@ -285,6 +306,12 @@ SCIP_Bool SCIPsyncstoreIsInitialized(
    SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
    );
 
+/** returns whether the solvers split the branch-and-bound tree instead of racing */
+SCIP_EXPORT
+SCIP_Bool SCIPsyncstoreIsTreeSplit(
+   SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
+   );
+
 /** returns the mode of the synchronization store */
 SCIP_EXPORT
 SCIP_PARALLELMODE SCIPsyncstoreGetMode(
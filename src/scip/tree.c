@@ -53,6 +53,8 @@
 
 
 #define MAXREPROPMARK       511  /**< maximal subtree repropagation marker; must correspond to node data structure */
+#define SPILL_MINNODES     1000  /**< minimal number of processed nodes between two passes writing leaves to the spill file */
+#define SPILL_QUEUEFRAC     0.1  /**< minimal fraction of the node queue processed between two spilling passes */
 
 
 /*
@@ -137,6 +139,182 @@ SCIP_RETCODE treeEnsurePendingbdchgsMem(
 
 
 
+/*
+ * Node spilling
+ */
+
+/** creates the node spill data of the tree; the temporary file itself is only opened on first use */
+static
+SCIP_RETCODE nodespillCreate(
+   SCIP_NODESPILL**      nodespill,          /**< pointer to node spill data */
+   BMS_BLKMEM*           blkmem              /**< block memory used for the domain changes of the nodes */
+   )
+{
+   assert(nodespill != NULL);
+   assert(blkmem != NULL);
+
+   SCIP_ALLOC( BMSallocMemory(nodespill) );
+
+   (*nodespill)->file = NULL;
+   (*nodespill)->blkmem = blkmem;
+   (*nodespill)->filesize = 0;
+   (*nodespill)->nnodes = 0;
+   (*nodespill)->lastpassnode = -1;
+   (*nodespill)->nspilled = 0;
+   (*nodespill)->nreloaded = 0;
+   (*nodespill)->disabled = FALSE;
+
+   return SCIP_OKAY;
+}
+
+/** frees the node spill data of the tree and closes the temporary file */
+static
+void nodespillFree(
+   SCIP_NODESPILL**      nodespill           /**< pointer to node spill data */
+   )
+{
+   assert(nodespill != NULL);
+   assert(*nodespill != NULL);
+   assert((*nodespill)->nnodes == 0);
+
+   if( (*nodespill)->file != NULL )
+      (void) fclose((*nodespill)->file);
+
+   BMSfreeMemory(nodespill);
+}
+
+/** returns whether the bound changes of the node currently reside in the spill file */
+static
+SCIP_Bool nodeIsSpilled(
+   SCIP_NODE*            node                /**< node */
+   )
+{
+   assert(node != NULL);
+
+   return (node->domchg != NULL && node->domchg->domchgdyn.domchgtype == SCIP_DOMCHGTYPE_SPILLED); /*lint !e641*/
+}
+
+/** writes the static bound changes of the node to the spill file and frees their memory; the captures of the
+ *  variables and inference data are kept, such that the raw records stay valid until they are read back
+ */
+static
+SCIP_RETCODE nodeSpillDomchg(
+   SCIP_NODE*            node,               /**< node whose bound changes should be spilled */
+   SCIP_NODESPILL*       nodespill           /**< node spill data */
+   )
+{
+   SCIP_DOMCHGSPILLED* domchgspilled;
+   SCIP_BOUNDCHG* boundchgs;
+   int nboundchgs;
+
+   assert(node != NULL);
+   assert(!node->active);
+   assert(node->domchg != NULL);
+   assert(node->domchg->domchgbound.domchgtype == SCIP_DOMCHGTYPE_BOUND); /*lint !e641*/
+   assert(nodespill != NULL);
+   assert(nodespill->file != NULL);
+
+   nboundchgs = (int)node->domchg->domchgbound.nboundchgs;
+   boundchgs = node->domchg->domchgbound.boundchgs;
+   assert(nboundchgs > 0);
+   assert(boundchgs != NULL);
+
+   if( fseek(nodespill->file, (long)nodespill->filesize, SEEK_SET) != 0
+      || fwrite(boundchgs, sizeof(SCIP_BOUNDCHG), (size_t)nboundchgs, nodespill->file) != (size_t)nboundchgs )
+   {
+      SCIPerrorMessage("could not write bound changes of node #%" SCIP_LONGINT_FORMAT " to the node spill file\n",
+         node->number);
+      return SCIP_WRITEERROR;
+   }
+
+   SCIP_ALLOC( BMSallocBlockMemory(nodespill->blkmem, &domchgspilled) );
+   domchgspilled->nboundchgs = (unsigned int)nboundchgs; /*lint !e732*/
+   domchgspilled->domchgtype = SCIP_DOMCHGTYPE_SPILLED; /*lint !e641*/
+   domchgspilled->nodespill = nodespill;
+   domchgspilled->pos = nodespill->filesize;
+
+   BMSfreeBlockMemoryArray(nodespill->blkmem, &boundchgs, nboundchgs);
+   BMSfreeBlockMemorySize(nodespill->blkmem, &node->domchg, sizeof(SCIP_DOMCHGBOUND));
+   node->domchg = (SCIP_DOMCHG*)domchgspilled;
+
+   nodespill->filesize += (SCIP_Longint)nboundchgs * (SCIP_Longint)sizeof(SCIP_BOUNDCHG);
+   nodespill->nnodes++;
+   nodespill->nspilled++;
+
+   return SCIP_OKAY;
+}
+
+/** reads the bound changes of the node back from the spill file, if they were written to it */
+static
+SCIP_RETCODE nodeReloadDomchg(
+   SCIP_NODE*            node                /**< node */
+   )
+{
+   SCIP_DOMCHGSPILLED* domchgspilled;
+   SCIP_NODESPILL* nodespill;
+   SCIP_DOMCHG* domchg;
+   int nboundchgs;
+
+   assert(node != NULL);
+
+   if( !nodeIsSpilled(node) )
+      return SCIP_OKAY;
+
+   domchgspilled = (SCIP_DOMCHGSPILLED*)node->domchg;
+   nodespill = domchgspilled->nodespill;
+   nboundchgs = (int)domchgspilled->nboundchgs;
+   assert(nodespill != NULL);
+   assert(nodespill->file != NULL);
+   assert(nodespill->nnodes > 0);
+   assert(nboundchgs > 0);
+
+   SCIP_ALLOC( BMSallocBlockMemorySize(nodespill->blkmem, &domchg, sizeof(SCIP_DOMCHGBOUND)) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(nodespill->blkmem, &domchg->domchgbound.boundchgs, nboundchgs) );
+
+   if( fseek(nodespill->file, (long)domchgspilled->pos, SEEK_SET) != 0
+      || fread(domchg->domchgbound.boundchgs, sizeof(SCIP_BOUNDCHG), (size_t)nboundchgs, nodespill->file) != (size_t)nboundchgs )
+   {
+      SCIPerrorMessage("could not read bound changes of node #%" SCIP_LONGINT_FORMAT " from the node spill file\n",
+         node->number);
+      BMSfreeBlockMemoryArray(nodespill->blkmem, &domchg->domchgbound.boundchgs, nboundchgs);
+      BMSfreeBlockMemorySize(nodespill->blkmem, &domchg, sizeof(SCIP_DOMCHGBOUND));
+      return SCIP_READERROR;
+   }
+
+   domchg->domchgbound.nboundchgs = (unsigned int)nboundchgs; /*lint !e732*/
+   domchg->domchgbound.domchgtype = SCIP_DOMCHGTYPE_BOUND; /*lint !e641*/
+
+   BMSfreeBlockMemory(nodespill->blkmem, &domchgspilled);
+   node->domchg = domchg;
+
+   nodespill->nreloaded++;
+   nodespill->nnodes--;
+
+   /* reuse the file from its beginning if no records are left */
+   if( nodespill->nnodes == 0 )
+      nodespill->filesize = 0;
+
+   return SCIP_OKAY;
+}
+
+/** reads the bound changes of the node back from the spill file in functions that cannot return an error code */
+static
+void nodeEnsureDomchgLoaded(
+   SCIP_NODE*            node                /**< node */
+   )
+{
+   assert(node != NULL);
+
+   if( nodeIsSpilled(node) && nodeReloadDomchg(node) != SCIP_OKAY )
+   {
+      SCIPerrorMessage("domain changes of node #%" SCIP_LONGINT_FORMAT " are lost\n", node->number);
+      SCIPABORT();
+   }
+}
+
+
+
+
 /*
  * Node methods
  */
@@ -1154,7 +1332,8 @@ SCIP_RETCODE SCIPnodeFree(
       return SCIP_INVALIDDATA;
    }
 
-   /* free common data */
+   /* free common data; spilled bound changes have to be read back to release their captures */
+   SCIP_CALL( nodeReloadDomchg(*node) );
    SCIP_CALL( SCIPconssetchgFree(&(*node)->conssetchg, blkmem, set) );
    SCIP_CALL( SCIPdomchgFree(&(*node)->domchg, blkmem, set, eventqueue, lp) );
    SCIP_CALL( nodeReleaseParent(*node, blkmem, set, stat, eventfilter, eventqueue, tree, lp) );
@@ -1485,6 +1664,7 @@ SCIP_RETCODE nodeActivate(
       SCIPnodeGetNumber(node), SCIPnodeGetDepth(node), SCIPnodeGetType(node), node->repropsubtreemark);
 
    /* apply domain and constraint set changes */
+   SCIP_CALL( nodeReloadDomchg(node) );
    SCIP_CALL( SCIPconssetchgApply(node->conssetchg, blkmem, set, stat, (int) node->depth,
          (SCIPnodeGetType(node) == SCIP_NODETYPE_FOCUSNODE)) );
    SCIP_CALL( SCIPdomchgApply(node->domchg, blkmem, set, stat, lp, branchcand, eventqueue, (int) node->depth, cutoff) );
@@ -4341,6 +4521,12 @@ SCIP_RETCODE SCIPnodeFocus(
    assert(conflictstore != NULL);
    assert(cutoff != NULL);
 
+   /* read the bound changes of the new focus node back from the spill file */
+   if( *node != NULL )
+   {
+      SCIP_CALL( nodeReloadDomchg(*node) );
+   }
+
    /* check global lower bound w.r.t. debugging solution */
    SCIP_CALL( SCIPdebugCheckGlobalLowerbound(blkmem, set) );
 
@@ -4780,6 +4966,7 @@ SCIP_RETCODE SCIPtreeCreate(
    (*tree)->root = NULL;
 
    SCIP_CALL( SCIPnodepqCreate(&(*tree)->leaves, set, nodesel) );
+   SCIP_CALL( nodespillCreate(&(*tree)->nodespill, blkmem) );
 
    /* allocate one slot for the prioritized and the unprioritized bound change */
    for( p = 0; p <= 1; ++p )
@@ -4868,6 +5055,9 @@ SCIP_RETCODE SCIPtreeFree(
    /* free node queue */
    SCIP_CALL( SCIPnodepqFree(&(*tree)->leaves, blkmem, set, stat, eventfilter, eventqueue, *tree, lp) );
 
+   /* close the node spill file after all spilled nodes were freed */
+   nodespillFree(&(*tree)->nodespill);
+
    /* free diving bound change storage */
    for( p = 0; p <= 1; ++p )
    {
@@ -4953,6 +5143,87 @@ SCIP_RETCODE SCIPtreeClear(
    return SCIP_OKAY;
 }
 
+/** writes the static bound changes of the open leaves to a temporary file if the memory usage exceeds the fraction
+ *  memory/spillfac of the memory limit; the bound changes of a leaf are read back as soon as it is accessed again
+ */
+SCIP_RETCODE SCIPtreeSpillLeaves(
+   SCIP_TREE*            tree,               /**< branch and bound tree */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   SCIP_Longint          memused             /**< total memory currently used by SCIP */
+   )
+{
+   SCIP_NODESPILL* nodespill;
+   SCIP_NODE** leaves;
+   int nleaves;
+   int nspilled;
+   int i;
+
+   assert(tree != NULL);
+   assert(set != NULL);
+   assert(stat != NULL);
+
+   nodespill = tree->nodespill;
+   assert(nodespill != NULL);
+
+   /* the reoptimization data refers to the bound changes of stored nodes, thus we do not spill them in this case */
+   if( set->mem_spillfac >= 1.0 || set->reopt_enable || nodespill->disabled )
+      return SCIP_OKAY;
+
+   if( memused < set->mem_spillfac * set->limit_memory * 1024.0 * 1024.0 )
+      return SCIP_OKAY;
+
+   /* scan the node queue only again after a reasonable part of it was exchanged since the last pass */
+   nleaves = SCIPnodepqLen(tree->leaves);
+   if( nodespill->lastpassnode >= 0
+      && stat->nnodes - nodespill->lastpassnode < MAX(SPILL_MINNODES, (SCIP_Longint)(SPILL_QUEUEFRAC * nleaves)) )
+      return SCIP_OKAY;
+
+   nodespill->lastpassnode = stat->nnodes;
+
+   if( nodespill->file == NULL )
+   {
+      nodespill->file = tmpfile();
+
+      if( nodespill->file == NULL )
+      {
+         SCIPmessagePrintWarning(messagehdlr, "could not create temporary file for open nodes, disabling node spilling\n");
+         nodespill->disabled = TRUE;
+         return SCIP_OKAY;
+      }
+   }
+
+   leaves = SCIPnodepqNodes(tree->leaves);
+   nspilled = 0;
+
+   for( i = 0; i < nleaves; ++i )
+   {
+      SCIP_NODE* node;
+
+      node = leaves[i];
+      assert(SCIPnodeGetType(node) == SCIP_NODETYPE_LEAF);
+
+      /* only static bound changes are spilled, hole changes and already spilled nodes are skipped */
+      if( node->domchg == NULL || node->domchg->domchgdyn.domchgtype != SCIP_DOMCHGTYPE_BOUND /*lint !e641*/
+         || node->domchg->domchgbound.nboundchgs == 0 )
+         continue;
+
+      SCIP_CALL( nodeSpillDomchg(node, nodespill) );
+      ++nspilled;
+   }
+
+   if( nspilled > 0 )
+   {
+      SCIPmessagePrintVerbInfo(messagehdlr, set->disp_verblevel, SCIP_VERBLEVEL_HIGH,
+         "(node %" SCIP_LONGINT_FORMAT ") wrote bound changes of %d open nodes to temporary file (mem: %.1fM/%.1fM, %.1fM on disk)\n",
+         stat->nnodes, nspilled, (SCIP_Real)memused/(1024.0*1024.0), set->limit_memory,
+         (SCIP_Real)nodespill->filesize/(1024.0*1024.0));
+   }
+
+   return SCIP_OKAY;
+}
+
 /** creates the root node of the tree and puts it into the leaves queue */
 SCIP_RETCODE SCIPtreeCreateRoot(
    SCIP_TREE*            tree,               /**< tree data structure */
@@ -7530,6 +7801,9 @@ SCIP_DOMCHG* SCIPnodeGetDomchg(
 {
    assert(node != NULL);
 
+   /* read the bound changes back if they were written to the node spill file */
+   nodeEnsureDomchgLoaded(node);
+
    return node->domchg;
 }
 
@@ -7560,6 +7834,8 @@ void SCIPnodeGetNDomchg(
    if( count_prop )
       *nprop = 0;
 
+   nodeEnsureDomchgLoaded(node);
+
    if( node->domchg != NULL )
    {
       for( i = 0; i < (int) node->domchg->domchgbound.nboundchgs; i++ )
@@ -7597,6 +7873,8 @@ int SCIPnodeGetNDualBndchgs(
 
    assert(node != NULL);
 
+   nodeEnsureDomchgLoaded(node);
+
    if( node->domchg == NULL )
       return 0;
 
@@ -7655,6 +7933,8 @@ void SCIPnodeGetDualBoundchgs(
 
    (*nvars) = 0;
 
+   nodeEnsureDomchgLoaded(node);
+
    if( SCIPnodeGetDepth(node) == 0 || node->domchg == NULL )
       return;
 
@@ -7743,6 +8023,8 @@ void SCIPnodeGetParentBranchings(
 
    (*nbranchvars) = 0;
 
+   nodeEnsureDomchgLoaded(node);
+
    if( SCIPnodeGetDepth(node) == 0 || node->domchg == NULL )
       return;
 
@@ -7887,6 +8169,8 @@ void SCIPnodeGetConsProps(
 
    (*nconspropvars) = 0;
 
+   nodeEnsureDomchgLoaded(node);
+
    if( SCIPnodeGetDepth(node) == 0 || node->domchg == NULL )
       return;
 
@@ -7975,6 +8259,8 @@ void SCIPnodeGetBdChgsAfterDual(
 
    (*nbranchvars) = 0;
 
+   nodeEnsureDomchgLoaded(node);
+
    if( SCIPnodeGetDepth(node) == 0 || node->domchg == NULL )
       return;
 
@@ -8047,6 +8333,7 @@ SCIP_RETCODE SCIPnodePrintAncestorBranchings(
       int nboundchgs;
       int i;
 
+      SCIP_CALL( nodeReloadDomchg(node) );
       nboundchgs = (int)node->domchg->domchgbound.nboundchgs;
       boundchgs = node->domchg->domchgbound.boundchgs;
 
@@ -412,6 +412,17 @@ SCIP_RETCODE SCIPtreeClear(
    SCIP_LP*              lp                  /**< current LP data */
    );
 
+/** writes the static bound changes of the open leaves to a temporary file if the memory usage exceeds the fraction
+ *  memory/spillfac of the memory limit; the bound changes of a leaf are read back as soon as it is accessed again
+ */
+SCIP_RETCODE SCIPtreeSpillLeaves(
+   SCIP_TREE*            tree,               /**< branch and bound tree */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   SCIP_Longint          memused             /**< total memory currently used by SCIP */
+   );
+
 /** creates the root node of the tree and puts it into the leaves queue */
 SCIP_RETCODE SCIPtreeCreateRoot(
    SCIP_TREE*            tree,               /**< tree data structure */
@@ -40,6 +40,9 @@ typedef enum SCIP_BranchDir SCIP_BRANCHDIR;       /**< branching direction for b
 
 typedef struct SCIP_History SCIP_HISTORY;         /**< branching and inference history information for single variable */
 
+/** number of values that describe the history of a variable, see SCIPgetVarHistoryData() */
+#define SCIP_HISTORY_NDATA 20
+
 /** Value history data structure
  *
  *  branching and inference history informations for single variable dependent on the domain value
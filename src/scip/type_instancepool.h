@@ -0,0 +1,49 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   type_instancepool.h
+ * @ingroup TYPEDEFINITIONS
+ * @brief  type definitions for pools of reusable SCIP instances
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_TYPE_INSTANCEPOOL_H__
+#define __SCIP_TYPE_INSTANCEPOOL_H__
+
+#include "scip/type_retcode.h"
+#include "scip/type_scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct SCIP_InstancePool SCIP_INSTANCEPOOL;      /**< pool of reusable SCIP instances */
+
+/** initialization method of the instances of a pool, e.g., to include plugins and to set parameters
+ *
+ *  The method is called once for every newly created instance of the pool. It must not create a problem.
+ *
+ *  input:
+ *  - scip            : SCIP data structure of the new instance
+ *  - userdata        : user data given at the creation of the pool
+ */
+#define SCIP_DECL_INSTANCEPOOLINIT(x) SCIP_RETCODE x (SCIP* scip, void* userdata)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -155,6 +155,15 @@ typedef struct SCIP_Regression SCIP_REGRESSION;
  */
 typedef struct SCIP_DisjointSet SCIP_DISJOINTSET;
 
+/** row of a matrix over GF(2) */
+typedef struct SCIP_Gf2Row SCIP_GF2ROW;
+
+/** matrix over GF(2) whose rows are stored as sorted column indices or as bitsets
+ *
+ *  - \ref Gf2Matrix "List of available methods"
+ */
+typedef struct SCIP_Gf2Matrix SCIP_GF2MATRIX;
+
 /** a linear inequality row in preparation to become a SCIP_ROW
  *
  * Used to assemble data that could eventually make a SCIP_ROW.
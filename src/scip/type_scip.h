@@ -29,6 +29,8 @@ extern "C" {
 
 typedef struct Scip SCIP;               /**< SCIP main data structure */
 
+typedef struct SCIP_CopyMap SCIP_COPYMAP; /**< dense map from the variables of a source SCIP to their copies */
+
 #ifdef __cplusplus
 }
 #endif
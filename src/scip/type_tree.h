@@ -54,6 +54,8 @@ typedef struct SCIP_Subroot SCIP_SUBROOT;         /**< data for subroot nodes */
 typedef struct SCIP_Node SCIP_NODE;               /**< node data structure */
 typedef struct SCIP_PendingBdchg SCIP_PENDINGBDCHG; /**< bound change information for pending bound changes */
 typedef struct SCIP_Tree SCIP_TREE;               /**< branch and bound tree */
+typedef struct SCIP_NodeSpill SCIP_NODESPILL;     /**< temporary file storing domain changes of open nodes */
+typedef struct SCIP_DomChgSpilled SCIP_DOMCHGSPILLED; /**< placeholder for domain changes stored in the spill file */
 
 #ifdef __cplusplus
 }
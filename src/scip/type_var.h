@@ -64,7 +64,9 @@ enum SCIP_DomchgType
 {
    SCIP_DOMCHGTYPE_DYNAMIC = 0,         /**< dynamic bound changes with size information of arrays */
    SCIP_DOMCHGTYPE_BOTH    = 1,         /**< static domain changes: number of entries equals size of arrays */
-   SCIP_DOMCHGTYPE_BOUND   = 2          /**< static domain changes without any hole changes */
+   SCIP_DOMCHGTYPE_BOUND   = 2,         /**< static domain changes without any hole changes */
+   SCIP_DOMCHGTYPE_SPILLED = 3          /**< static bound changes of an open node that were written to the node spill
+                                         *   file of the tree (see struct_tree.h) */
 };
 typedef enum SCIP_DomchgType SCIP_DOMCHGTYPE;
 
@@ -4528,6 +4528,120 @@ void SCIPvarSetHistory(
    SCIPhistoryUnite(stat->glbhistory, history, FALSE);
 }
 
+/** stores the branching history of the variable in an array, possibly with switched directions */
+static
+void varGetHistoryData(
+   SCIP_VAR*             var,                /**< problem variable */
+   SCIP_Real*            data,               /**< array of size SCIP_HISTORY_NDATA to store the values */
+   SCIP_Bool             switcheddirs        /**< should the directions be switched */
+   )
+{
+   assert(var != NULL);
+   assert(data != NULL);
+
+   switch( SCIPvarGetStatus(var) )
+   {
+   case SCIP_VARSTATUS_ORIGINAL:
+      if( var->data.original.transvar != NULL )
+      {
+         varGetHistoryData(var->data.original.transvar, data, switcheddirs);
+         return;
+      }
+      break;
+
+   case SCIP_VARSTATUS_AGGREGATED:
+      varGetHistoryData(var->data.aggregate.var, data, (var->data.aggregate.scalar < 0.0) != switcheddirs);
+      return;
+
+   case SCIP_VARSTATUS_NEGATED:
+      varGetHistoryData(var->negatedvar, data, !switcheddirs);
+      return;
+
+   case SCIP_VARSTATUS_LOOSE:
+   case SCIP_VARSTATUS_COLUMN:
+   case SCIP_VARSTATUS_FIXED:
+   case SCIP_VARSTATUS_MULTAGGR:
+      break;
+
+   default:
+      SCIPerrorMessage("unknown variable status\n");
+      SCIPABORT();
+   }
+
+   SCIPhistoryGetData(var->history, data, switcheddirs);
+}
+
+/** stores the branching history of the variable in an array of SCIP_HISTORY_NDATA values, see SCIPhistoryGetData();
+ *  the history of an original variable is the one of its transformed variable, if existing, and the history of an
+ *  aggregated or negated variable is the one of the active variable with switched directions if necessary
+ */
+void SCIPvarGetHistoryData(
+   SCIP_VAR*             var,                /**< problem variable */
+   SCIP_Real*            data                /**< array of size SCIP_HISTORY_NDATA to store the values */
+   )
+{
+   varGetHistoryData(var, data, FALSE);
+}
+
+/** adds history values to the history of the variable, possibly with switched directions */
+static
+void varAddHistoryData(
+   SCIP_VAR*             var,                /**< problem variable */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   const SCIP_Real*      data,               /**< array of SCIP_HISTORY_NDATA values to add */
+   SCIP_Bool             switcheddirs        /**< should the directions be switched */
+   )
+{
+   assert(var != NULL);
+   assert(data != NULL);
+
+   switch( SCIPvarGetStatus(var) )
+   {
+   case SCIP_VARSTATUS_ORIGINAL:
+      /* the history of an original variable is transferred to its transformed variable in SCIPvarTransform() */
+      if( var->data.original.transvar != NULL )
+         varAddHistoryData(var->data.original.transvar, stat, data, switcheddirs);
+      else
+         SCIPhistoryAddData(var->history, data, switcheddirs);
+      break;
+
+   case SCIP_VARSTATUS_LOOSE:
+   case SCIP_VARSTATUS_COLUMN:
+      SCIPhistoryAddData(var->history, data, switcheddirs);
+      SCIPhistoryAddData(stat->glbhistory, data, switcheddirs);
+      break;
+
+   case SCIP_VARSTATUS_AGGREGATED:
+      varAddHistoryData(var->data.aggregate.var, stat, data, (var->data.aggregate.scalar < 0.0) != switcheddirs);
+      break;
+
+   case SCIP_VARSTATUS_NEGATED:
+      varAddHistoryData(var->negatedvar, stat, data, !switcheddirs);
+      break;
+
+   case SCIP_VARSTATUS_FIXED:
+   case SCIP_VARSTATUS_MULTAGGR:
+      break;
+
+   default:
+      SCIPerrorMessage("unknown variable status\n");
+      SCIPABORT();
+   }
+}
+
+/** adds history values given by an array of SCIP_HISTORY_NDATA values to the history of the variable; for an original
+ *  variable without transformed variable, the values are transferred to the transformed variable when the problem is
+ *  transformed
+ */
+void SCIPvarAddHistoryData(
+   SCIP_VAR*             var,                /**< problem variable */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   const SCIP_Real*      data                /**< array of SCIP_HISTORY_NDATA values to add */
+   )
+{
+   varAddHistoryData(var, stat, data, FALSE);
+}
+
 /** tightens the bounds of both variables in aggregation x = a*y + c */
 static
 SCIP_RETCODE varUpdateAggregationBounds(
@@ -1214,6 +1214,25 @@ void SCIPvarMergeHistories(
    SCIP_STAT*            stat                /**< problem statistics */
    );
 
+/** stores the branching history of the variable in an array of SCIP_HISTORY_NDATA values, see SCIPhistoryGetData();
+ *  the history of an original variable is the one of its transformed variable, if existing, and the history of an
+ *  aggregated or negated variable is the one of the active variable with switched directions if necessary
+ */
+void SCIPvarGetHistoryData(
+   SCIP_VAR*             var,                /**< problem variable */
+   SCIP_Real*            data                /**< array of size SCIP_HISTORY_NDATA to store the values */
+   );
+
+/** adds history values given by an array of SCIP_HISTORY_NDATA values to the history of the variable; for an original
+ *  variable without transformed variable, the values are transferred to the transformed variable when the problem is
+ *  transformed
+ */
+void SCIPvarAddHistoryData(
+   SCIP_VAR*             var,                /**< problem variable */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   const SCIP_Real*      data                /**< array of SCIP_HISTORY_NDATA values to add */
+   );
+
 /** sets the history of a variable; this method is typacally used within reoptimization to keep and update the variable
  *  history over several iteraions
  */
@@ -53,6 +53,7 @@ void getBranchInfo(
    SCIP_Real*            bound               /**< pointer to store the new bound of the branching variable */
    )
 {
+   SCIP_DOMCHG* domchg;
    SCIP_DOMCHGBOUND* domchgbound;
 
    (*var) = NULL;
@@ -60,10 +61,11 @@ void getBranchInfo(
    (*boundtype) = SCIP_BOUNDTYPE_LOWER;
 
    assert(node != NULL);
-   if( node->domchg == NULL )
+   domchg = SCIPnodeGetDomchg(node);
+   if( domchg == NULL )
       return;
 
-   domchgbound = &node->domchg->domchgbound;
+   domchgbound = &domchg->domchgbound;
    if( domchgbound->nboundchgs == 0 )
       return;
 
@@ -87,6 +87,28 @@ SCIP_RETCODE SCIPtpiWaitCondition(
    SCIP_LOCK*            lock                /**< the lock that is held by the caller */
    );
 
+/** atomically reads the value of the given integer; all writes that happened before a corresponding atomic write of
+ *  this value by another thread are visible after the read
+ */
+SCIP_EXPORT
+int SCIPtpiAtomicLoadInt(
+   int*                  ptr                 /**< pointer to the integer */
+   );
+
+/** atomically sets the given integer to the given value */
+SCIP_EXPORT
+void SCIPtpiAtomicStoreInt(
+   int*                  ptr,                /**< pointer to the integer */
+   int                   val                 /**< the new value */
+   );
+
+/** atomically adds the given value to the integer and returns the previous value of the integer */
+SCIP_EXPORT
+int SCIPtpiAtomicFetchAddInt(
+   int*                  ptr,                /**< pointer to the integer */
+   int                   val                 /**< the value to add */
+   );
+
 /** returns the number of threads */
 SCIP_EXPORT
 int SCIPtpiGetNumThreads(
@@ -144,6 +166,12 @@ SCIP_RETCODE SCIPtpiExit(
    void
    );
 
+/** returns whether the tpi has been initialized, i.e., whether jobs can be submitted */
+SCIP_EXPORT
+SCIP_Bool SCIPtpiIsAvailable(
+   void
+   );
+
 #endif
 
 #include "tpi/tpi_openmp.h"
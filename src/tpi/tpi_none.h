@@ -42,12 +42,19 @@
 #define SCIPtpiBroadcastCondition(condition)  (SCIP_UNUSED(condition), SCIP_OKAY)
 #define SCIPtpiWaitCondition(condition, lock) /*lint -e505*/ (SCIP_UNUSED(condition), SCIP_UNUSED(lock), SCIP_OKAY)
 
+/* atomic operations */
+#define SCIPtpiAtomicLoadInt(ptr)             (*(ptr))
+#define SCIPtpiAtomicStoreInt(ptr, val)       (*(ptr) = (val))
+#define SCIPtpiAtomicFetchAddInt(ptr, val)    ((*(ptr) += (val)) - (val))
+
 
 #define SCIPtpiGetNumThreads()                1
 #define SCIPtpiGetThreadNum()                 0
 
 #define SCIPtpiGetNewJobID()                  0
 
+#define SCIPtpiIsAvailable()                  FALSE
+
 #endif
 
 #endif
@@ -329,6 +329,60 @@ SCIP_RETCODE SCIPtpiWaitCondition(
    return SCIP_OKAY;
 }
 
+/** atomically reads the value of the given integer; all writes that happened before a corresponding atomic write of
+ *  this value by another thread are visible after the read
+ */
+int SCIPtpiAtomicLoadInt(
+   int*                  ptr                 /**< pointer to the integer */
+   )
+{
+   int val;
+
+   assert(ptr != NULL);
+
+#pragma omp atomic read
+   val = *ptr;
+#pragma omp flush
+
+   return val;
+}
+
+/** atomically sets the given integer to the given value */
+void SCIPtpiAtomicStoreInt(
+   int*                  ptr,                /**< pointer to the integer */
+   int                   val                 /**< the new value */
+   )
+{
+   int oldval;
+
+   assert(ptr != NULL);
+
+   /* an atomic exchange is used, since some compilers consider the value of an atomic write as unused */
+#pragma omp flush
+#pragma omp atomic capture
+   { oldval = *ptr; *ptr = val; }
+
+   SCIP_UNUSED(oldval);
+}
+
+/** atomically adds the given value to the integer and returns the previous value of the integer */
+int SCIPtpiAtomicFetchAddInt(
+   int*                  ptr,                /**< pointer to the integer */
+   int                   val                 /**< the value to add */
+   )
+{
+   int oldval;
+
+   assert(ptr != NULL);
+
+#pragma omp flush
+#pragma omp atomic capture
+   { oldval = *ptr; *ptr += val; }
+#pragma omp flush
+
+   return oldval;
+}
+
 /** returns the number of threads */
 int SCIPtpiGetNumThreads(
    )
@@ -538,3 +592,11 @@ SCIP_RETCODE SCIPtpiExit(
 
    return SCIP_OKAY;
 }
+
+/** returns whether the tpi has been initialized, i.e., whether jobs can be submitted */
+SCIP_Bool SCIPtpiIsAvailable(
+   void
+   )
+{
+   return _jobqueues != NULL;
+}
@@ -18,6 +18,19 @@
  * @brief  a TPI implementation using tinycthreads
  * @author Stephen J. Maher
  * @author Leona Gottwald
+ *
+ * The thread pool schedules jobs by work stealing. Every worker thread owns a deque of jobs. Jobs that are submitted
+ * from within a worker thread (child jobs) are pushed to the bottom of the worker's own deque, and the worker pops
+ * jobs from the bottom of its deque, i.e., in LIFO order. Jobs that are submitted from outside of the pool are
+ * pushed to an additional injection deque. A worker that runs out of jobs steals from the top of the other deques,
+ * i.e., it takes the oldest jobs first. Each deque is protected by its own lock, such that workers only contend for
+ * the same lock while stealing.
+ *
+ * The pool lock is only held for a short time to register submitted jobs in their job group, to account for finished
+ * jobs, and to put idle threads to sleep. A worker thread that collects the jobs of a job id does not block but
+ * processes pending child jobs until all jobs of the job id have been finished. Hence, jobs can submit and collect
+ * child jobs without blocking a worker thread. Jobs from the injection deque are never processed by a collecting
+ * worker, such that each job submitted from outside of the pool runs on a thread of its own.
  */
 
 /*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
@@ -25,6 +38,13 @@
 #include "tpi/tpi.h"
 #include "blockmemshell/memory.h"
 
+/* the tinycthread library does not provide atomic operations, so the compiler intrinsics are used */
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#define DEQUE_INITSIZE           16          /**< initial size of the array of a job deque */
+
 typedef struct SCIP_ThreadPool SCIP_THREADPOOL;
 static SCIP_THREADPOOL* _threadpool = NULL;
 _Thread_local int _threadnumber; /*lint !e129*/
@@ -33,35 +53,54 @@ _Thread_local int _threadnumber; /*lint !e129*/
 struct SCIP_Job
 {
    int                   jobid;              /**< id to identify jobs from a common process */
-   struct                SCIP_Job* nextjob;  /**< pointer to the next job in the queue */
+   struct SCIP_JobGroup* jobgroup;           /**< group of jobs with the same id, set when the job is submitted */
    SCIP_RETCODE          (*jobfunc)(void* args);/**< pointer to the job function */
    void*                 args;               /**< pointer to the function arguments */
    SCIP_RETCODE          retcode;            /**< return code of the job */
 };
 
-/** the thread pool job queue */
-struct SCIP_JobQueue
+/** the jobs that have been submitted with a common job id and have not been collected yet */
+struct SCIP_JobGroup
 {
-   SCIP_JOB*             firstjob;           /**< pointer to the first job in the queue */
-   SCIP_JOB*             lastjob;            /**< pointer to the last job in the queue */
-   int                   njobs;              /**< number of jobs in the queue */
+   int                   jobid;              /**< id of the jobs in the group */
+   int                   npending;           /**< number of submitted jobs that have not been finished */
+   SCIP_RETCODE          retcode;            /**< smallest return code of the finished jobs */
+   struct SCIP_JobGroup* nextgroup;          /**< pointer to the next job group */
 };
-typedef struct SCIP_JobQueue SCIP_JOBQUEUE;
+typedef struct SCIP_JobGroup SCIP_JOBGROUP;
+
+/** a double-ended queue of jobs stored in a circular array
+ *
+ *  The owner of the deque pushes and pops jobs at the bottom, other threads steal jobs from the top.
+ */
+struct SCIP_JobDeque
+{
+   SCIP_JOB**            jobs;               /**< circular array of jobs */
+   int                   size;               /**< size of the jobs array */
+   int                   top;                /**< position of the oldest job in the array */
+   int                   njobs;              /**< number of jobs in the deque */
+   SCIP_LOCK             lock;               /**< mutex to allow read and write of the deque */
+};
+typedef struct SCIP_JobDeque SCIP_JOBDEQUE;
+
+/** deque of the current worker thread, or NULL if the current thread does not belong to the thread pool */
+static _Thread_local SCIP_JOBDEQUE* _workerdeque = NULL; /*lint !e129*/
 
 /** The thread pool */
 struct SCIP_ThreadPool
 {
    /* Pool Characteristics */
    int                   nthreads;           /**< number of threads in the pool */
-   int                   queuesize;          /**< the total number of items to enter the queue */
+   int                   queuesize;          /**< the maximal number of submitted jobs that have not been finished */
 
    /* Current pool state */
    thrd_t*               threads;            /**< the threads included in the pool */
-   SCIP_JOBQUEUE*        jobqueue;           /**< the job queue */
-   SCIP_JOBQUEUE*        currentjobs;        /**< the jobs currently being processed on a thread;
-                                              *   only a single job is allowed per thread. */
-   SCIP_JOBQUEUE*        finishedjobs;       /**< finished jobs that are not yet collected */
-   int                   currworkingthreads; /**< the threads currently processing jobs */
+   SCIP_JOBDEQUE*        deques;             /**< job deques of the threads; the deque with index nthreads receives
+                                              *   the jobs that are submitted from outside of the pool */
+   SCIP_JOBGROUP*        jobgroups;          /**< list of job groups that have not been collected */
+   int                   npendingjobs;       /**< number of submitted jobs that have not been finished */
+   int                   nidlethreads;       /**< number of threads that wait for new jobs */
+   int                   nwaitingcollectors; /**< number of threads that wait for a job to be finished */
    SCIP_Bool             blockwhenfull;      /**< indicates that the queue can only be as large as nthreads */
    int                   currentid;          /**< current job id */
 
@@ -77,128 +116,267 @@ struct SCIP_ThreadPool
    SCIP_CONDITION        jobfinished;        /**< condition to broadcast that a job has been finished */
 };
 
-/** this function controls the execution of each of the threads */
+/** initializes a job deque */
 static
-SCIP_RETCODE threadPoolThreadRetcode(
-   void*                 threadnum           /**< thread number is passed in as argument stored inside a void pointer */
+SCIP_RETCODE jobDequeInit(
+   SCIP_JOBDEQUE*        deque               /**< the job deque */
    )
 {
-   SCIP_JOB* newjob;
-   SCIP_JOB* prevjob;
-   SCIP_JOB* currjob;
+   assert(deque != NULL);
 
-   _threadnumber = (int)(uintptr_t) threadnum;
+   SCIP_ALLOC( BMSallocMemoryArray(&deque->jobs, DEQUE_INITSIZE) );
+   deque->size = DEQUE_INITSIZE;
+   deque->top = 0;
+   deque->njobs = 0;
 
-   /* Increase the number of active threads */
-   SCIP_CALL( SCIPtpiAcquireLock(&(_threadpool->poollock)) );
-   _threadpool->currworkingthreads += 1;
-   SCIP_CALL( SCIPtpiReleaseLock(&(_threadpool->poollock)) );
+   SCIP_CALL( SCIPtpiInitLock(&deque->lock) ); /*lint !e2482*/
 
-   /* this is an endless loop that runs until the thrd_exit function is called */
-   while( TRUE ) /*lint !e716*/
+   return SCIP_OKAY;
+}
+
+/** frees a job deque together with all jobs that are still stored in it */
+static
+void jobDequeFree(
+   SCIP_JOBDEQUE*        deque               /**< the job deque */
+   )
+{
+   assert(deque != NULL);
+
+   while( deque->njobs > 0 )
    {
-      SCIP_CALL( SCIPtpiAcquireLock(&(_threadpool->poollock)) );
+      BMSfreeMemory(&deque->jobs[deque->top]);
+      deque->top = (deque->top + 1) % deque->size;
+      --deque->njobs;
+   }
 
-      /* the queue is empty but the shutdown command has not been given */
-      while( _threadpool->jobqueue->njobs == 0 && !_threadpool->shutdown )
-      {
-         SCIP_CALL( SCIPtpiWaitCondition(&(_threadpool->queuenotempty), &(_threadpool->poollock)) );
-      }
+   SCIPtpiDestroyLock(&deque->lock);
+   BMSfreeMemoryArray(&deque->jobs);
+}
 
-      /* if the shutdown command has been given, then exit the thread */
-      if( _threadpool->shutdown )
-      {
-         /* Decrease the thread count when execution of job queue has completed */
-         _threadpool->currworkingthreads -= 1;
-         SCIP_CALL( SCIPtpiReleaseLock(&(_threadpool->poollock)) );
+/** pushes a job to the bottom of a deque */
+static
+SCIP_RETCODE jobDequePush(
+   SCIP_JOBDEQUE*        deque,              /**< the job deque */
+   SCIP_JOB*             job                 /**< the job to push */
+   )
+{
+   assert(deque != NULL);
+   assert(job != NULL);
 
-         thrd_exit((int)SCIP_OKAY);
-      }
+   SCIP_CALL( SCIPtpiAcquireLock(&deque->lock) );
 
-      /* getting the next job in the queue */
-      newjob = _threadpool->jobqueue->firstjob;
-      _threadpool->jobqueue->njobs--;            /* decreasing the number of jobs in the queue */
+   /* enlarge the circular array such that the jobs are stored contiguously starting at position 0 */
+   if( deque->njobs == deque->size )
+   {
+      SCIP_JOB** newjobs;
+      int i;
 
-      if( _threadpool->jobqueue->njobs == 0 )
-      {
-         _threadpool->jobqueue->firstjob = NULL;
-         _threadpool->jobqueue->lastjob = NULL;
-      }
-      else
-         _threadpool->jobqueue->firstjob = newjob->nextjob;     /* updating the queue */
+      SCIP_ALLOC( BMSallocMemoryArray(&newjobs, 2 * deque->size) );
 
-      /* if we want to wait when the queue is full, then we broadcast that the queue can now take new jobs */
-      if( _threadpool->blockwhenfull &&
-          _threadpool->jobqueue->njobs == _threadpool->queuesize - 1 )
-      {
-         SCIP_CALL( SCIPtpiBroadcastCondition(&(_threadpool->queuenotfull)) );
-      }
+      for( i = 0; i < deque->njobs; ++i )
+         newjobs[i] = deque->jobs[(deque->top + i) % deque->size];
 
-      /* indicating that the queue is empty */
-      if( _threadpool->jobqueue->njobs == 0 )
-      {
-         SCIP_CALL( SCIPtpiBroadcastCondition(&(_threadpool->queueempty)) );
-      }
+      BMSfreeMemoryArray(&deque->jobs);
+      deque->jobs = newjobs;
+      deque->size *= 2;
+      deque->top = 0;
+   }
 
-      /* updating the current job list */
-      if( _threadpool->currentjobs->njobs == 0 )
-      {
-         _threadpool->currentjobs->firstjob = newjob;
-         _threadpool->currentjobs->lastjob = newjob;
-      }
-      else
-      {
-         _threadpool->currentjobs->lastjob->nextjob = newjob;
-         _threadpool->currentjobs->lastjob = newjob;
-      }
+   deque->jobs[(deque->top + deque->njobs) % deque->size] = job;
+   ++deque->njobs;
 
-      _threadpool->currentjobs->njobs++;
+   SCIP_CALL( SCIPtpiReleaseLock(&deque->lock) );
 
-      SCIP_CALL( SCIPtpiReleaseLock(&(_threadpool->poollock)) );
+   return SCIP_OKAY;
+}
 
-      /* setting the job to run on this thread */
-      newjob->retcode = (*(newjob->jobfunc))(newjob->args);
+/** removes a job from a deque; the owner takes the newest job from the bottom, a thief the oldest job from the top
+ *
+ *  Returns NULL if the deque is empty.
+ */
+static
+SCIP_JOB* jobDequePop(
+   SCIP_JOBDEQUE*        deque,              /**< the job deque */
+   SCIP_Bool             steal               /**< should the oldest instead of the newest job be taken? */
+   )
+{
+   SCIP_JOB* job;
 
-      /* setting the current job on this thread to NULL */
-      SCIP_CALL( SCIPtpiAcquireLock(&(_threadpool->poollock)) );
+   assert(deque != NULL);
 
-      /* finding the location of the processed job in the currentjobs queue */
-      currjob = _threadpool->currentjobs->firstjob;
-      prevjob = NULL;
+   SCIP_CALL_ABORT( SCIPtpiAcquireLock(&deque->lock) );
 
-      while( currjob != newjob )
-      {
-         prevjob = currjob;
-         currjob = prevjob->nextjob;
-      }
+   if( deque->njobs == 0 )
+      job = NULL;
+   else if( steal )
+   {
+      job = deque->jobs[deque->top];
+      deque->top = (deque->top + 1) % deque->size;
+      --deque->njobs;
+   }
+   else
+   {
+      --deque->njobs;
+      job = deque->jobs[(deque->top + deque->njobs) % deque->size];
+   }
 
-      /* removing the processed job from current jobs list */
-      if( currjob == _threadpool->currentjobs->firstjob )
-         _threadpool->currentjobs->firstjob = currjob->nextjob;
-      else
-         prevjob->nextjob = currjob->nextjob; /*lint !e794*/
+   SCIP_CALL_ABORT( SCIPtpiReleaseLock(&deque->lock) );
+
+   return job;
+}
+
+/** returns whether any deque of the thread pool contains a job; this function needs to be called from within the pool
+ *  lock such that no job can be submitted concurrently
+ */
+static
+SCIP_Bool threadPoolHasQueuedJobs(
+   SCIP_THREADPOOL*      threadpool,         /**< the thread pool */
+   SCIP_Bool             childjobsonly       /**< should only the deques of the worker threads be checked? */
+   )
+{
+   int ndeques;
+   int i;
+
+   ndeques = childjobsonly ? threadpool->nthreads : threadpool->nthreads + 1;
+
+   for( i = 0; i < ndeques; ++i )
+   {
+      int njobs;
+
+      SCIP_CALL_ABORT( SCIPtpiAcquireLock(&threadpool->deques[i].lock) );
+      njobs = threadpool->deques[i].njobs;
+      SCIP_CALL_ABORT( SCIPtpiReleaseLock(&threadpool->deques[i].lock) );
+
+      if( njobs > 0 )
+         return TRUE;
+   }
+
+   return FALSE;
+}
+
+/** takes the next job that should be processed by the current worker thread
+ *
+ *  The worker first pops from its own deque and then tries to steal from the other deques, starting with the deque of
+ *  the next thread. If only child jobs should be taken, the injection deque is skipped, such that jobs submitted from
+ *  outside of the pool are never nested into another job and each of them starts on a thread of its own. Returns NULL
+ *  if no job is available.
+ */
+static
+SCIP_JOB* threadPoolGetJob(
+   SCIP_THREADPOOL*      threadpool,         /**< the thread pool */
+   SCIP_Bool             childjobsonly       /**< should jobs from the injection deque be skipped? */
+   )
+{
+   SCIP_JOB* job;
+   int ndeques;
+   int i;
+
+   assert(_workerdeque != NULL);
+
+   job = jobDequePop(_workerdeque, FALSE);
+   if( job != NULL )
+      return job;
+
+   ndeques = threadpool->nthreads + 1;
+
+   for( i = 1; i < ndeques && job == NULL; ++i )
+   {
+      int d = (_threadnumber + i) % ndeques;
+
+      if( !childjobsonly || d < threadpool->nthreads )
+         job = jobDequePop(&threadpool->deques[d], TRUE);
+   }
+
+   return job;
+}
+
+/** processes a job on the current thread and stores its return code in the job group */
+static
+SCIP_RETCODE threadPoolRunJob(
+   SCIP_THREADPOOL*      threadpool,         /**< the thread pool */
+   SCIP_JOB*             job                 /**< the job to run */
+   )
+{
+   SCIP_JOBGROUP* jobgroup;
+
+   assert(job != NULL);
+   assert(job->jobgroup != NULL);
+
+   job->retcode = (*(job->jobfunc))(job->args);
+
+   SCIP_CALL( SCIPtpiAcquireLock(&threadpool->poollock) );
+
+   jobgroup = job->jobgroup;
+   jobgroup->retcode = MIN(jobgroup->retcode, job->retcode);
+   --jobgroup->npending;
+   --threadpool->npendingjobs;
+
+   /* signalling that a job has been finished; collectors wait for the last job of their group, a full queue for the
+    * first finished job, and the shutdown for the last job of all groups
+    */
+   if( threadpool->nwaitingcollectors > 0 && jobgroup->npending == 0 )
+   {
+      SCIP_CALL( SCIPtpiBroadcastCondition(&threadpool->jobfinished) );
+   }
+
+   if( threadpool->npendingjobs == threadpool->queuesize - 1 )
+   {
+      SCIP_CALL( SCIPtpiBroadcastCondition(&threadpool->queuenotfull) );
+   }
+
+   if( threadpool->npendingjobs == 0 )
+   {
+      SCIP_CALL( SCIPtpiBroadcastCondition(&threadpool->queueempty) );
+   }
+
+   SCIP_CALL( SCIPtpiReleaseLock(&threadpool->poollock) );
 
-      if( currjob == _threadpool->currentjobs->lastjob )
-         _threadpool->currentjobs->lastjob = prevjob;
+   BMSfreeMemory(&job);
 
-      _threadpool->currentjobs->njobs--;
+   return SCIP_OKAY;
+}
 
-      /* updating the finished job list */
-      if( _threadpool->finishedjobs->njobs == 0 )
+/** this function controls the execution of each of the threads */
+static
+SCIP_RETCODE threadPoolThreadRetcode(
+   void*                 threadnum           /**< thread number is passed in as argument stored inside a void pointer */
+   )
+{
+   SCIP_JOB* newjob;
+
+   _threadnumber = (int)(uintptr_t) threadnum;
+   _workerdeque = &_threadpool->deques[_threadnumber];
+
+   /* this is an endless loop that runs until the shutdown command is given */
+   while( TRUE ) /*lint !e716*/
+   {
+      newjob = threadPoolGetJob(_threadpool, FALSE);
+
+      if( newjob != NULL )
       {
-         _threadpool->finishedjobs->firstjob = newjob;
-         _threadpool->finishedjobs->lastjob = newjob;
+         SCIP_CALL( threadPoolRunJob(_threadpool, newjob) );
+         continue;
       }
-      else
+
+      SCIP_CALL( SCIPtpiAcquireLock(&(_threadpool->poollock)) );
+
+      /* all deques are empty but the shutdown command has not been given; since jobs are only submitted while holding
+       * the pool lock, no job can be missed between the check and the wait
+       */
+      while( !_threadpool->shutdown && !threadPoolHasQueuedJobs(_threadpool, FALSE) )
       {
-         _threadpool->finishedjobs->lastjob->nextjob = newjob;
-         _threadpool->finishedjobs->lastjob = newjob;
+         ++_threadpool->nidlethreads;
+         SCIP_CALL( SCIPtpiWaitCondition(&(_threadpool->queuenotempty), &(_threadpool->poollock)) );
+         --_threadpool->nidlethreads;
       }
 
-      _threadpool->finishedjobs->njobs++;
+      /* if the shutdown command has been given, then exit the thread */
+      if( _threadpool->shutdown )
+      {
+         SCIP_CALL( SCIPtpiReleaseLock(&(_threadpool->poollock)) );
 
-      /* signalling that a job has been finished */
-      SCIP_CALL( SCIPtpiBroadcastCondition(&(_threadpool)->jobfinished) );
+         return SCIP_OKAY;
+      }
 
       SCIP_CALL( SCIPtpiReleaseLock(&(_threadpool->poollock)) );
    }
@@ -210,7 +388,18 @@ int threadPoolThread(
    void*                 threadnum           /**< thread number is passed in as argument stored inside a void pointer */
    )
 {
-   return (int) threadPoolThreadRetcode(threadnum);
+   SCIP_RETCODE retcode;
+
+   /* keep the memory chunks of the block memories that are freed by this thread, e.g., of sub-SCIPs that are solved
+    * in jobs, for reuse by the following jobs
+    */
+   BMScaptureChunkCache();
+
+   retcode = threadPoolThreadRetcode(threadnum);
+
+   BMSreleaseChunkCache();
+
+   return (int) retcode;
 }
 
 /** creates a threadpool */
@@ -235,24 +424,17 @@ SCIP_RETCODE createThreadPool(
    (*thrdpool)->blockwhenfull = blockwhenfull;
    (*thrdpool)->shutdown = FALSE;
    (*thrdpool)->queueopen = TRUE;
-
-   /* allocating memory for the job queue */
-   SCIP_ALLOC( BMSallocMemory(&(*thrdpool)->jobqueue) );
-   (*thrdpool)->jobqueue->firstjob = NULL;
-   (*thrdpool)->jobqueue->lastjob = NULL;
-   (*thrdpool)->jobqueue->njobs = 0;
-
-   /* allocating memory for the job queue */
-   SCIP_ALLOC( BMSallocMemory(&(*thrdpool)->currentjobs) );
-   (*thrdpool)->currentjobs->firstjob = NULL;
-   (*thrdpool)->currentjobs->lastjob = NULL;
-   (*thrdpool)->currentjobs->njobs = 0;
-
-   /* allocating memory for the job queue */
-   SCIP_ALLOC( BMSallocMemory(&(*thrdpool)->finishedjobs) );
-   (*thrdpool)->finishedjobs->firstjob = NULL;
-   (*thrdpool)->finishedjobs->lastjob = NULL;
-   (*thrdpool)->finishedjobs->njobs = 0;
+   (*thrdpool)->jobgroups = NULL;
+   (*thrdpool)->npendingjobs = 0;
+   (*thrdpool)->nidlethreads = 0;
+   (*thrdpool)->nwaitingcollectors = 0;
+
+   /* allocating memory for the job deques of the threads and the injection deque */
+   SCIP_ALLOC( BMSallocMemoryArray(&(*thrdpool)->deques, nthreads + 1) );
+   for( i = 0; i <= (unsigned)nthreads; i++ )
+   {
+      SCIP_CALL( jobDequeInit(&(*thrdpool)->deques[i]) );
+   }
 
    /* initialising the mutex */
    SCIP_CALL( SCIPtpiInitLock(&(*thrdpool)->poollock) ); /*lint !e2482*/
@@ -263,9 +445,6 @@ SCIP_RETCODE createThreadPool(
    SCIP_CALL( SCIPtpiInitCondition(&(*thrdpool)->queueempty) );
    SCIP_CALL( SCIPtpiInitCondition(&(*thrdpool)->jobfinished) );
 
-   /* creating the threads */
-   (*thrdpool)->currworkingthreads = 0;
-
    /* allocating memory for the threads */
    SCIP_ALLOC( BMSallocMemoryArray(&((*thrdpool)->threads), nthreads) );
 
@@ -277,51 +456,42 @@ SCIP_RETCODE createThreadPool(
    }
 
    _threadnumber = nthreads;
-   /* halt while all threads are not active TODO: is synchronization required here ? */
-   /*TODO: this caused a deadlock, is it important to wait for all threads to start?
-    * while( (*thrdpool)->currworkingthreads != nthreads )
-   {}*/
 
    return SCIP_OKAY;
 }
 
-/** adding a job to the job queue.
+/** returns the job group of the given job id, creating it if it does not exist yet
  *
- *  This gives some more flexibility in the handling of new jobs.
- *  This function needs to be called from within a mutex.
+ *  This function needs to be called from within the pool lock.
  */
 static
-void jobQueueAddJob(
-   SCIP_THREADPOOL*      threadpool,           /**< pointer to store threadpool */
-   SCIP_JOB*             newjob                /**< pointer to new job */
+SCIP_RETCODE threadPoolGetJobGroup(
+   SCIP_THREADPOOL*      threadpool,         /**< the thread pool */
+   int                   jobid,              /**< id of the jobs in the group */
+   SCIP_JOBGROUP**       jobgroup            /**< pointer to store the job group */
    )
 {
-   /* @todo we want to work out what to do with a full job queue. Is there a problem if the limit is hit? */
-   /* @note it is important to have a queuesize. This will stop the code submitting infinitely many jobs. */
-   assert(threadpool->jobqueue->njobs < threadpool->queuesize);
-
-   newjob->nextjob = NULL;
-
-   /* checking the status of the job queue */
-   if( threadpool->jobqueue->njobs == 0 )
-   {
-      threadpool->jobqueue->firstjob = newjob;
-      threadpool->jobqueue->lastjob = newjob;
-   }
-   else /* it is assumed that the jobqueue is not full */
+   for( *jobgroup = threadpool->jobgroups; *jobgroup != NULL; *jobgroup = (*jobgroup)->nextgroup )
    {
-      threadpool->jobqueue->lastjob->nextjob = newjob;
-      threadpool->jobqueue->lastjob = newjob;
+      if( (*jobgroup)->jobid == jobid )
+         return SCIP_OKAY;
    }
 
-   /* signalling to all threads that the queue has jobs using the signal instead of broadcast because only one thread
-    * should be awakened */
-   SCIP_CALL_ABORT( SCIPtpiSignalCondition(&(threadpool->queuenotempty)) );
+   SCIP_ALLOC( BMSallocMemory(jobgroup) );
+   (*jobgroup)->jobid = jobid;
+   (*jobgroup)->npending = 0;
+   (*jobgroup)->retcode = SCIP_OKAY;
+   (*jobgroup)->nextgroup = threadpool->jobgroups;
+   threadpool->jobgroups = *jobgroup;
 
-   threadpool->jobqueue->njobs++;
+   return SCIP_OKAY;
 }
 
-/** adds a job to the threadpool */
+/** adds a job to the threadpool
+ *
+ *  Jobs that are submitted from a worker thread are added to the deque of the worker, all other jobs are added to the
+ *  injection deque.
+ */
 static
 SCIP_RETCODE threadPoolAddWork(
    SCIP_JOB*             newjob,             /**< job to add to threadpool */
@@ -334,7 +504,7 @@ SCIP_RETCODE threadPoolAddWork(
    SCIP_CALL( SCIPtpiAcquireLock(&(_threadpool->poollock)) );
 
    /* if the queue is full and we are blocking, then return an error. */
-   if( _threadpool->jobqueue->njobs == _threadpool->queuesize && _threadpool->blockwhenfull )
+   if( _threadpool->npendingjobs == _threadpool->queuesize && _threadpool->blockwhenfull )
    {
       SCIP_CALL( SCIPtpiReleaseLock(&(_threadpool->poollock)) );
       *status = SCIP_SUBMIT_QUEUEFULL;
@@ -342,9 +512,7 @@ SCIP_RETCODE threadPoolAddWork(
    }
 
    /* Wait until the job queue is not full. If the queue is closed or the thread pool is shut down, then stop waiting. */
-   /* @todo this needs to be checked. It is possible that a job can be submitted and then the queue is closed or the
-    * thread pool is shut down. Need to work out the best way to handle this. */
-   while( _threadpool->jobqueue->njobs == _threadpool->queuesize && !(_threadpool->shutdown || !_threadpool->queueopen) )
+   while( _threadpool->npendingjobs == _threadpool->queuesize && !(_threadpool->shutdown || !_threadpool->queueopen) )
    {
       SCIP_CALL( SCIPtpiWaitCondition(&(_threadpool->queuenotfull), &(_threadpool->poollock)) );
    }
@@ -363,44 +531,38 @@ SCIP_RETCODE threadPoolAddWork(
       return SCIP_OKAY;
    }
 
-   /* creating the job for submission */
-   newjob->nextjob = NULL;
-
-   /* adding the job to the queue */
-   /* this can only happen if the queue is not full */
-   assert(_threadpool->jobqueue->njobs != _threadpool->queuesize);
-   jobQueueAddJob(_threadpool, newjob);
-
-   SCIP_CALL( SCIPtpiReleaseLock(&(_threadpool->poollock)) );
-
-   *status = SCIP_SUBMIT_SUCCESS;
-
-   return SCIP_OKAY;
-}
+   /* registering the job in its group */
+   SCIP_CALL( threadPoolGetJobGroup(_threadpool, newjob->jobid, &newjob->jobgroup) );
+   ++newjob->jobgroup->npending;
+   ++_threadpool->npendingjobs;
 
-/** frees the jobqueue of the threadpool */
-static
-void freeJobQueue(
-   SCIP_THREADPOOL*      thrdpool            /**< pointer to thread pool */
-   )
-{
-   SCIP_JOB* currjob;
+   /* adding the job to the deque of the submitting thread */
+   if( _workerdeque != NULL )
+   {
+      SCIP_CALL( jobDequePush(_workerdeque, newjob) );
+   }
+   else
+   {
+      SCIP_CALL( jobDequePush(&_threadpool->deques[_threadpool->nthreads], newjob) );
+   }
 
-   assert(!thrdpool->queueopen);
-   assert(thrdpool->shutdown);
+   /* waking up an idle thread; only a single thread is signalled because only one thread can process the job */
+   if( _threadpool->nidlethreads > 0 )
+   {
+      SCIP_CALL( SCIPtpiSignalCondition(&(_threadpool->queuenotempty)) );
+   }
 
-   /* iterating through all jobs until all have been freed */
-   while( thrdpool->jobqueue->firstjob != NULL )
+   /* worker threads that wait for their jobs to be collected can help processing the new job */
+   if( _threadpool->nwaitingcollectors > 0 )
    {
-      currjob = thrdpool->jobqueue->firstjob->nextjob;
-      thrdpool->jobqueue->firstjob = thrdpool->jobqueue->firstjob->nextjob;
-      BMSfreeMemory(&currjob);
+      SCIP_CALL( SCIPtpiBroadcastCondition(&(_threadpool->jobfinished)) );
    }
 
-   assert(thrdpool->jobqueue->firstjob == NULL);
-   assert(thrdpool->jobqueue->lastjob == NULL);
+   SCIP_CALL( SCIPtpiReleaseLock(&(_threadpool->poollock)) );
 
-   BMSfreeMemory(&thrdpool->jobqueue);
+   *status = SCIP_SUBMIT_SUCCESS;
+
+   return SCIP_OKAY;
 }
 
 /** free the thread pool */
@@ -433,7 +595,7 @@ SCIP_RETCODE freeThreadPool(
    /* if the jobs in the queue should be completed, then we wait until the queueempty condition is set */
    if( completequeue )
    {
-      while( (*thrdpool)->jobqueue->njobs > 0 )
+      while( (*thrdpool)->npendingjobs > 0 )
       {
          SCIP_CALL( SCIPtpiWaitCondition(&((*thrdpool)->queueempty), &((*thrdpool)->poollock)) );
       }
@@ -466,13 +628,19 @@ SCIP_RETCODE freeThreadPool(
    /* freeing memory and data structures */
    BMSfreeMemoryArray(&(*thrdpool)->threads);
 
-   /* Freeing the current jobs list. This assumes that all jobs complete before the tpi is closed. */
-   assert((*thrdpool)->currentjobs->njobs == 0);
-   BMSfreeMemory(&(*thrdpool)->currentjobs);
-   assert((*thrdpool)->finishedjobs->njobs == 0);
-   BMSfreeMemory(&(*thrdpool)->finishedjobs);
+   /* freeing the deques and the jobs that have not been processed */
+   for( i = 0; i <= (*thrdpool)->nthreads; i++ )
+      jobDequeFree(&(*thrdpool)->deques[i]);
+   BMSfreeMemoryArray(&(*thrdpool)->deques);
 
-   freeJobQueue(*thrdpool);
+   /* freeing the job groups that have not been collected */
+   while( (*thrdpool)->jobgroups != NULL )
+   {
+      SCIP_JOBGROUP* nextgroup = (*thrdpool)->jobgroups->nextgroup;
+
+      BMSfreeMemory(&(*thrdpool)->jobgroups);
+      (*thrdpool)->jobgroups = nextgroup;
+   }
 
    /* destroying the conditions */
    SCIPtpiDestroyCondition(&(*thrdpool)->jobfinished);
@@ -488,45 +656,50 @@ SCIP_RETCODE freeThreadPool(
    return retcode;
 }
 
-
-/* checking a job queue */
-static
-SCIP_JOBSTATUS checkJobQueue(
-   SCIP_JOBQUEUE*        jobqueue,           /**< pointer to the job queue */
-   int                   jobid               /**< id of job to check */
+/** atomically reads the value of the given integer; all writes that happened before a corresponding atomic write of
+ *  this value by another thread are visible after the read
+ */
+int SCIPtpiAtomicLoadInt(
+   int*                  ptr                 /**< pointer to the integer */
    )
 {
-   SCIP_JOB* currjob = jobqueue->firstjob;
-
-   /* checking the job ids */
-   if( currjob != NULL )
-   {
-      while( currjob != jobqueue->lastjob )
-      {
-         if( currjob->jobid == jobid )
-            return SCIP_JOB_INQUEUE;
+   assert(ptr != NULL);
 
-         currjob = currjob->nextjob;
-      }
+#if defined(_MSC_VER)
+   return (int)_InterlockedOr((volatile long*)ptr, 0L);
+#else
+   return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+#endif
+}
 
-      if( currjob->jobid == jobid )
-         return SCIP_JOB_INQUEUE;
-   }
+/** atomically sets the given integer to the given value */
+void SCIPtpiAtomicStoreInt(
+   int*                  ptr,                /**< pointer to the integer */
+   int                   val                 /**< the new value */
+   )
+{
+   assert(ptr != NULL);
 
-   return SCIP_JOB_DOESNOTEXIST;
+#if defined(_MSC_VER)
+   (void)_InterlockedExchange((volatile long*)ptr, (long)val);
+#else
+   __atomic_store_n(ptr, val, __ATOMIC_RELEASE);
+#endif
 }
 
-/** returns whether the job id is running */
-static
-SCIP_Bool isJobRunning(
-   SCIP_JOBQUEUE*        currentjobs,        /**< queue of current jobs */
-   int                   jobid               /**< id of job to check */
+/** atomically adds the given value to the integer and returns the previous value of the integer */
+int SCIPtpiAtomicFetchAddInt(
+   int*                  ptr,                /**< pointer to the integer */
+   int                   val                 /**< the value to add */
    )
 {
-   if( checkJobQueue(currentjobs, jobid) == SCIP_JOB_INQUEUE )
-      return TRUE;
-   else
-      return FALSE;
+   assert(ptr != NULL);
+
+#if defined(_MSC_VER)
+   return (int)_InterlockedExchangeAdd((volatile long*)ptr, (long)val);
+#else
+   return __atomic_fetch_add(ptr, val, __ATOMIC_ACQ_REL);
+#endif
 }
 
 /** returns the number of threads */
@@ -561,6 +734,14 @@ SCIP_RETCODE SCIPtpiExit(
    return SCIP_OKAY;
 }
 
+/** returns whether the tpi has been initialized, i.e., whether jobs can be submitted */
+SCIP_Bool SCIPtpiIsAvailable(
+   void
+   )
+{
+   return _threadpool != NULL;
+}
+
 /** creates a job for parallel processing */
 SCIP_RETCODE SCIPtpiCreateJob(
    SCIP_JOB**            job,                /**< pointer to the job that will be created */
@@ -574,7 +755,8 @@ SCIP_RETCODE SCIPtpiCreateJob(
    (*job)->jobid = jobid;
    (*job)->jobfunc = jobfunc;
    (*job)->args = jobarg;
-   (*job)->nextjob = NULL;
+   (*job)->jobgroup = NULL;
+   (*job)->retcode = SCIP_OKAY;
 
    return SCIP_OKAY;
 }
@@ -603,7 +785,7 @@ SCIP_RETCODE SCIPtpiSumbitJob(
    assert(job != NULL);
 
    /* the job id must be set before submitting the job. The submitter controls whether a new id is required. */
-   assert(job->jobid == _threadpool->currentid);
+   assert(job->jobid <= _threadpool->currentid);
    SCIP_CALL( threadPoolAddWork(job, status) );
 
    return SCIP_OKAY;
@@ -611,67 +793,72 @@ SCIP_RETCODE SCIPtpiSumbitJob(
 
 /** blocks until all jobs of the given jobid have finished
  *  and then returns the smallest SCIP_RETCODE of all the jobs
+ *
+ *  If this function is called from a worker thread, then the worker processes pending child jobs while it waits, such
+ *  that the jobs of the given jobid are guaranteed to make progress even if all other workers are busy.
  */
 SCIP_RETCODE SCIPtpiCollectJobs(
    int                   jobid               /**< the jobid of the jobs to wait for */
    )
 {
+   SCIP_JOBGROUP* jobgroup;
+   SCIP_JOBGROUP* prevgroup;
    SCIP_RETCODE retcode;
-   SCIP_JOB* currjob;
-   SCIP_JOB* prevjob;
 
    SCIP_CALL( SCIPtpiAcquireLock(&(_threadpool->poollock)) );
 
-   while( isJobRunning(_threadpool->currentjobs, jobid) || isJobRunning(_threadpool->jobqueue, jobid) )
+   /* finding the job group; if no job has been submitted with this id, then there is nothing to collect */
+   for( jobgroup = _threadpool->jobgroups; jobgroup != NULL && jobgroup->jobid != jobid; jobgroup = jobgroup->nextgroup )
+   {}
+
+   if( jobgroup == NULL )
    {
-      SCIP_CALL( SCIPtpiWaitCondition(&_threadpool->jobfinished, &_threadpool->poollock) );
+      SCIP_CALL( SCIPtpiReleaseLock(&_threadpool->poollock) );
+      return SCIP_OKAY;
    }
 
-   /* finding the location of the processed job in the currentjobs queue */
-   retcode = SCIP_OKAY;
-   currjob = _threadpool->finishedjobs->firstjob;
-   prevjob = NULL;
-
-   while( currjob )
+   while( jobgroup->npending > 0 )
    {
-      if( currjob->jobid == jobid )
+      /* worker threads help processing the pending jobs instead of blocking */
+      if( _workerdeque != NULL )
       {
-         SCIP_JOB* nextjob;
+         SCIP_JOB* job;
 
-         /* if the job has the right jobid collect its retcode,
-          * remove it from the finished job list, and free it
-          */
-         retcode = MIN(retcode, currjob->retcode);
+         SCIP_CALL( SCIPtpiReleaseLock(&_threadpool->poollock) );
 
-         /* removing the finished job from finished jobs list */
-         if( currjob == _threadpool->finishedjobs->firstjob )
-         {
-            _threadpool->finishedjobs->firstjob = currjob->nextjob;
-         }
-         else
+         job = threadPoolGetJob(_threadpool, TRUE);
+         if( job != NULL )
          {
-            assert(prevjob != NULL);
-            prevjob->nextjob = currjob->nextjob;
+            SCIP_CALL( threadPoolRunJob(_threadpool, job) );
          }
 
-         if( currjob == _threadpool->finishedjobs->lastjob )
-            _threadpool->finishedjobs->lastjob = prevjob;
-
-         _threadpool->finishedjobs->njobs--;
+         SCIP_CALL( SCIPtpiAcquireLock(&(_threadpool->poollock)) );
 
-         /* update currjob and free finished job; prevjob stays the same */
-         nextjob = currjob->nextjob;
-         BMSfreeMemory(&currjob);
-         currjob = nextjob;
-      }
-      else
-      {
-         /* otherwise leave job untouched */
-         prevjob = currjob;
-         currjob = prevjob->nextjob;
+         if( job != NULL || jobgroup->npending == 0 || threadPoolHasQueuedJobs(_threadpool, TRUE) )
+            continue;
       }
+
+      ++_threadpool->nwaitingcollectors;
+      SCIP_CALL( SCIPtpiWaitCondition(&_threadpool->jobfinished, &_threadpool->poollock) );
+      --_threadpool->nwaitingcollectors;
    }
 
+   /* the group has been finished; remove it from the list of job groups; the predecessor is searched again because
+    * groups may have been added or removed while waiting
+    */
+   retcode = jobgroup->retcode;
+
+   if( _threadpool->jobgroups == jobgroup )
+      _threadpool->jobgroups = jobgroup->nextgroup;
+   else
+   {
+      for( prevgroup = _threadpool->jobgroups; prevgroup->nextgroup != jobgroup; prevgroup = prevgroup->nextgroup )
+         assert(prevgroup->nextgroup != NULL);
+      prevgroup->nextgroup = jobgroup->nextgroup;
+   }
+
+   BMSfreeMemory(&jobgroup);
+
    SCIP_CALL( SCIPtpiReleaseLock(&_threadpool->poollock) );
 
    return retcode;
@@ -0,0 +1,123 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   sharecoefs.c
+ * @brief  unit test that checks that copies of linear constraints share their coefficients until they are changed
+ */
+
+#include "scip/scip.h"
+#include "include/scip_test.h"
+#include "scip/cons_linear.h"
+#include "scip/scipdefplugins.h"
+
+/** GLOBAL VARIABLES **/
+static SCIP* sourcescip;
+static SCIP* targetscip;
+static SCIP_CONS* sourcecons;
+static SCIP_CONS* targetcons;
+
+/** creates a problem with one linear constraint and copies it */
+static
+void setup(void)
+{
+   SCIP_VAR* vars[3];
+   SCIP_Real vals[3] = {2.0, -1.0, 3.5};
+   SCIP_Bool valid;
+   int i;
+
+   SCIP_CALL( SCIPcreate(&sourcescip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(sourcescip) );
+   SCIP_CALL( SCIPcreateProbBasic(sourcescip, "sharecoefs") );
+
+   for( i = 0; i < 3; ++i )
+   {
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(sourcescip, &vars[i], name, 0.0, 10.0, 1.0, SCIP_VARTYPE_INTEGER) );
+      SCIP_CALL( SCIPaddVar(sourcescip, vars[i]) );
+   }
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(sourcescip, &sourcecons, "c", 3, vars, vals, -SCIPinfinity(sourcescip), 20.0) );
+   SCIP_CALL( SCIPaddCons(sourcescip, sourcecons) );
+
+   for( i = 0; i < 3; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(sourcescip, &vars[i]) );
+   }
+
+   /* the plugins are copied */
+   SCIP_CALL( SCIPcreate(&targetscip) );
+   SCIP_CALL( SCIPcopyOrig(sourcescip, targetscip, NULL, NULL, "copy", FALSE, FALSE, FALSE, &valid) );
+   cr_assert(valid);
+
+   targetcons = SCIPfindCons(targetscip, "c");
+   cr_assert(targetcons != NULL);
+}
+
+/** frees the source before the copy, such that the shared coefficients outlive the instance that created them */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPreleaseCons(sourcescip, &sourcecons) );
+   SCIP_CALL( SCIPfree(&sourcescip) );
+   SCIP_CALL( SCIPfree(&targetscip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(sharecoefs, .init = setup, .fini = teardown);
+
+/* TESTS */
+Test(sharecoefs, shared)
+{
+   cr_assert_eq(SCIPgetNVarsLinear(targetscip, targetcons), 3);
+   cr_assert(SCIPgetValsLinear(sourcescip, sourcecons) == SCIPgetValsLinear(targetscip, targetcons));
+}
+
+Test(sharecoefs, copyonwrite)
+{
+   SCIP_Real* sourcevals;
+   SCIP_Real* targetvals;
+
+   SCIP_CALL( SCIPchgCoefLinear(targetscip, targetcons, SCIPgetVarsLinear(targetscip, targetcons)[1], 4.0) );
+
+   sourcevals = SCIPgetValsLinear(sourcescip, sourcecons);
+   targetvals = SCIPgetValsLinear(targetscip, targetcons);
+
+   cr_assert(sourcevals != targetvals);
+   cr_assert_eq(sourcevals[1], -1.0);
+   cr_assert_eq(targetvals[1], 4.0);
+   cr_assert_eq(sourcevals[2], targetvals[2]);
+}
+
+Test(sharecoefs, disabled)
+{
+   SCIP* scip;
+   SCIP_CONS* cons;
+   SCIP_Bool valid;
+
+   /* the parameter settings are copied before the constraints */
+   SCIP_CALL( SCIPsetBoolParam(sourcescip, "constraints/linear/sharecoefs", FALSE) );
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPcopyOrig(sourcescip, scip, NULL, NULL, "copy", FALSE, FALSE, FALSE, &valid) );
+   cr_assert(valid);
+
+   cons = SCIPfindCons(scip, "c");
+   cr_assert(cons != NULL);
+   cr_assert(SCIPgetValsLinear(sourcescip, sourcecons) != SCIPgetValsLinear(scip, cons));
+
+   SCIP_CALL( SCIPfree(&scip) );
+}
@@ -0,0 +1,134 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   feasjump.c
+ * @brief  unit tests for the feasibility jump primal heuristic
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+#define N 6
+
+/** GLOBAL VARIABLES **/
+static SCIP* scip;
+
+/** creates an assignment problem, whose solution is not found by rounding the zero or the one vector */
+static
+void setup(void)
+{
+   SCIP_VAR* vars[N][N];
+   SCIP_Real vals[N];
+   int i;
+   int j;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "assignment") );
+
+   for( i = 0; i < N; ++i )
+   {
+      vals[i] = 1.0;
+
+      for( j = 0; j < N; ++j )
+      {
+         char name[SCIP_MAXSTRLEN];
+
+         (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x_%d_%d", i, j);
+         SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i][j], name, 0.0, 1.0, (SCIP_Real)((i + 2 * j) % N), SCIP_VARTYPE_BINARY) );
+         SCIP_CALL( SCIPaddVar(scip, vars[i][j]) );
+      }
+   }
+
+   for( i = 0; i < N; ++i )
+   {
+      SCIP_VAR* colvars[N];
+      SCIP_CONS* cons;
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "row_%d", i);
+      SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, name, N, vars[i], vals, 1.0, 1.0) );
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+      for( j = 0; j < N; ++j )
+         colvars[j] = vars[j][i];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "col_%d", i);
+      SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, name, N, colvars, vals, 1.0, 1.0) );
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+
+   for( i = 0; i < N; ++i )
+   {
+      for( j = 0; j < N; ++j )
+      {
+         SCIP_CALL( SCIPreleaseVar(scip, &vars[i][j]) );
+      }
+   }
+
+   /* only the feasibility jump heuristic may find a solution in the root node */
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/feasjump/freq", 0) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 1LL) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+}
+
+/** frees the problem */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** checks that the best solution was found by the heuristic and is feasible */
+static
+void checkSolution(void)
+{
+   SCIP_SOL* sol;
+   SCIP_Bool feasible;
+
+   sol = SCIPgetBestSol(scip);
+   cr_assert(sol != NULL);
+   cr_assert(SCIPsolGetHeur(sol) == SCIPfindHeur(scip, "feasjump"));
+
+   SCIP_CALL( SCIPcheckSolOrig(scip, sol, &feasible, FALSE, FALSE) );
+   cr_assert(feasible);
+}
+
+TestSuite(feasjump, .init = setup, .fini = teardown);
+
+/* TESTS */
+Test(feasjump, assignment)
+{
+   SCIP_CALL( SCIPsolve(scip) );
+   checkSolution();
+}
+
+/** several searches run in parallel if the task processing interface is available, and one search otherwise */
+Test(feasjump, parallel)
+{
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/feasjump/nthreads", 4) );
+   SCIP_CALL( SCIPsolve(scip) );
+   checkSolution();
+}
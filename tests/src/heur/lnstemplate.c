@@ -0,0 +1,162 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   lnstemplate.c
+ * @brief  unit tests for the template sub-SCIP of large neighborhood search heuristics
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/heuristics.h"
+
+#include "include/scip_test.h"
+
+#define NVARS 6
+
+/** GLOBAL VARIABLES **/
+static SCIP* scip;
+static SCIP_LNSTEMPLATE* lnstemplate;
+
+/** creates a knapsack problem, presolves it without reductions and creates the template */
+static
+void setup(void)
+{
+   SCIP_CONS* cons;
+   SCIP_VAR* vars[NVARS];
+   SCIP_Real weights[NVARS] = {3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
+   SCIP_Bool success;
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "lnstemplate") );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, -weights[i], SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "capacity", NVARS, vars, weights, -SCIPinfinity(scip), 15.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "propagating/maxroundsroot", 0) );
+   SCIP_CALL( SCIPpresolve(scip) );
+   cr_assert_eq(SCIPgetNVars(scip), NVARS);
+
+   SCIP_CALL( SCIPcreateLNSTemplate(scip, &lnstemplate, "lns", FALSE, &success) );
+   cr_assert(success);
+
+   SCIP_CALL( SCIPsetIntParam(SCIPgetLNSTemplateSubscip(lnstemplate), "display/verblevel", 0) );
+}
+
+/** frees the template and the problem */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfreeLNSTemplate(scip, &lnstemplate) );
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** solves the sub-SCIP of the template and returns its optimal objective value */
+static
+SCIP_Real solveTemplate(void)
+{
+   SCIP* subscip;
+   SCIP_Real objval;
+
+   subscip = SCIPgetLNSTemplateSubscip(lnstemplate);
+
+   SCIP_CALL( SCIPsolve(subscip) );
+   cr_assert_eq(SCIPgetStatus(subscip), SCIP_STATUS_OPTIMAL);
+   objval = SCIPgetPrimalbound(subscip);
+
+   SCIP_CALL( SCIPresetLNSTemplate(lnstemplate) );
+   cr_assert_eq(SCIPgetStage(subscip), SCIP_STAGE_PROBLEM);
+
+   return objval;
+}
+
+TestSuite(lnstemplate, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+/** the fixings of one neighborhood must not remain in the template for the next neighborhood */
+Test(lnstemplate, fixings)
+{
+   SCIP_VAR** vars;
+   SCIP_VAR** subvars;
+   SCIP_VAR* fixedvars[2];
+   SCIP_Real fixedvals[2] = {1.0, 1.0};
+
+   vars = SCIPgetVars(scip);
+   subvars = SCIPgetLNSTemplateSubvars(lnstemplate);
+   cr_assert(SCIPisLNSTemplateValid(scip, lnstemplate));
+
+   /* the optimum without fixings packs the capacity exactly */
+   SCIP_CALL( SCIPapplyLNSTemplate(scip, lnstemplate, NULL, NULL, 0, NULL, FALSE) );
+   cr_assert_float_eq(solveTemplate(), -15.0, 1e-6);
+
+   /* with x3 = x5 = 1, only one unit of capacity is left */
+   fixedvars[0] = vars[3];
+   fixedvars[1] = vars[5];
+   SCIP_CALL( SCIPapplyLNSTemplate(scip, lnstemplate, fixedvars, fixedvals, 2, NULL, FALSE) );
+   cr_assert_float_eq(SCIPvarGetLbOriginal(subvars[3]), 1.0, 1e-6);
+   cr_assert_float_eq(SCIPvarGetLbOriginal(subvars[5]), 1.0, 1e-6);
+   cr_assert_float_eq(solveTemplate(), -14.0, 1e-6);
+
+   /* the next neighborhood starts from the global bounds of the source SCIP */
+   fixedvars[0] = vars[0];
+   fixedvals[0] = 0.0;
+   SCIP_CALL( SCIPapplyLNSTemplate(scip, lnstemplate, fixedvars, fixedvals, 1, NULL, FALSE) );
+   cr_assert_float_eq(SCIPvarGetLbOriginal(subvars[3]), 0.0, 1e-6);
+   cr_assert_float_eq(SCIPvarGetLbOriginal(subvars[5]), 0.0, 1e-6);
+   cr_assert_float_eq(SCIPvarGetUbOriginal(subvars[0]), 0.0, 1e-6);
+   cr_assert_float_eq(solveTemplate(), -15.0, 1e-6);
+}
+
+/** the objective function of a neighborhood is restored by the reset */
+Test(lnstemplate, objective)
+{
+   SCIP_VAR** subvars;
+   SCIP_Real objcoefs[NVARS] = {-1.0, -1.0, -1.0, -1.0, -1.0, -1.0};
+   int i;
+
+   subvars = SCIPgetLNSTemplateSubvars(lnstemplate);
+
+   /* at most three items fit into the knapsack */
+   SCIP_CALL( SCIPapplyLNSTemplate(scip, lnstemplate, NULL, NULL, 0, objcoefs, FALSE) );
+   cr_assert_float_eq(solveTemplate(), -3.0, 1e-6);
+
+   for( i = 0; i < NVARS; ++i )
+      cr_assert_float_eq(SCIPvarGetObj(subvars[i]), SCIPvarGetObj(SCIPgetVars(scip)[i]), 1e-6);
+
+   SCIP_CALL( SCIPapplyLNSTemplate(scip, lnstemplate, NULL, NULL, 0, NULL, FALSE) );
+   cr_assert_float_eq(solveTemplate(), -15.0, 1e-6);
+}
@@ -0,0 +1,244 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   gf2matrix.c
+ * @brief  unit tests for the matrix over GF(2) in misc.c
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/pub_misc.h"
+
+#include "include/scip_test.h"
+
+#define NROWS 40
+#define NCOLS 600
+
+/** GLOBAL VARIABLES **/
+static SCIP* scip;
+static SCIP_RANDNUMGEN* randnumgen;
+static SCIP_GF2MATRIX* gf2matrix;
+static SCIP_Bool dense[NROWS][NCOLS];
+static SCIP_Bool rhs[NROWS];
+
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, 42, TRUE) );
+   SCIP_CALL( SCIPgf2matrixCreate(&gf2matrix, SCIPblkmem(scip), NROWS, NCOLS) );
+
+   BMSclearMemoryArray(&dense[0][0], NROWS * NCOLS);
+   BMSclearMemoryArray(rhs, NROWS);
+}
+
+static
+void teardown(void)
+{
+   SCIPgf2matrixFree(&gf2matrix);
+   SCIPfreeRandom(scip, &randnumgen);
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** fills a row with random entries, where each entry is one with the given probability */
+static
+void fillRow(
+   int                   row,                /**< row index */
+   SCIP_Real             density             /**< probability of an entry to be one */
+   )
+{
+   int j;
+
+   for( j = 0; j < NCOLS; ++j )
+   {
+      if( SCIPrandomGetReal(randnumgen, 0.0, 1.0) < density )
+      {
+         SCIP_CALL( SCIPgf2matrixFlipEntry(gf2matrix, row, j) );
+         dense[row][j] = !dense[row][j];
+      }
+   }
+
+   rhs[row] = SCIPrandomGetInt(randnumgen, 0, 1);
+   SCIPgf2matrixSetRhs(gf2matrix, row, rhs[row]);
+}
+
+/** checks that a row of the matrix equals the reference row */
+static
+void checkRow(
+   int                   row                 /**< row index */
+   )
+{
+   int cols[NCOLS];
+   int nnonzs;
+   int k;
+   int j;
+
+   nnonzs = SCIPgf2matrixGetRowNNonzs(gf2matrix, row);
+   SCIPgf2matrixGetRowNonzs(gf2matrix, row, cols);
+
+   k = 0;
+   for( j = 0; j < NCOLS; ++j )
+   {
+      cr_assert_eq(SCIPgf2matrixGetEntry(gf2matrix, row, j), dense[row][j], "entry (%d,%d) differs", row, j);
+
+      if( dense[row][j] )
+      {
+         cr_assert(k < nnonzs);
+         cr_assert_eq(cols[k], j);
+         ++k;
+      }
+   }
+   cr_assert_eq(k, nnonzs);
+   cr_assert_eq(SCIPgf2matrixGetRhs(gf2matrix, row), rhs[row]);
+}
+
+TestSuite(gf2matrix, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(gf2matrix, flip, .description = "test that flipping entries works in the sparse and the dense representation")
+{
+   int j;
+
+   cr_assert_eq(SCIPgf2matrixGetNRows(gf2matrix), NROWS);
+   cr_assert_eq(SCIPgf2matrixGetNCols(gf2matrix), NCOLS);
+
+   /* set every third entry such that the row becomes dense, and then clear the entries again */
+   for( j = NCOLS - 1; j >= 0; j -= 3 )
+   {
+      SCIP_CALL( SCIPgf2matrixFlipEntry(gf2matrix, 0, j) );
+      dense[0][j] = TRUE;
+      checkRow(0);
+   }
+
+   for( j = NCOLS - 1; j >= 0; j -= 3 )
+   {
+      SCIP_CALL( SCIPgf2matrixFlipEntry(gf2matrix, 0, j) );
+      dense[0][j] = FALSE;
+   }
+   checkRow(0);
+   cr_assert_eq(SCIPgf2matrixGetRowNNonzs(gf2matrix, 0), 0);
+
+   SCIPgf2matrixClearRow(gf2matrix, 0);
+   checkRow(0);
+}
+
+Test(gf2matrix, addrow, .description = "test that adding rows works for all combinations of sparse and dense rows")
+{
+   int round;
+   int i;
+   int j;
+
+   /* rows with even index are sparse and rows with odd index are dense */
+   for( i = 0; i < NROWS; ++i )
+      fillRow(i, (i % 2 == 0) ? 0.01 : 0.3);
+
+   for( round = 0; round < 200; ++round )
+   {
+      int row = SCIPrandomGetInt(randnumgen, 0, NROWS - 1);
+      int rowtoadd = SCIPrandomGetInt(randnumgen, 0, NROWS - 2);
+
+      if( rowtoadd >= row )
+         ++rowtoadd;
+
+      SCIP_CALL( SCIPgf2matrixAddRow(gf2matrix, row, rowtoadd) );
+
+      for( j = 0; j < NCOLS; ++j )
+         dense[row][j] = (dense[row][j] != dense[rowtoadd][j]);
+      rhs[row] = (rhs[row] != rhs[rowtoadd]);
+
+      checkRow(row);
+   }
+
+   /* adding a row to a copy of itself gives zero */
+   SCIPgf2matrixClearRow(gf2matrix, 0);
+   BMSclearMemoryArray(dense[0], NCOLS);
+   rhs[0] = FALSE;
+   SCIP_CALL( SCIPgf2matrixAddRow(gf2matrix, 0, 1) );
+   SCIP_CALL( SCIPgf2matrixAddRow(gf2matrix, 0, 1) );
+   checkRow(0);
+}
+
+Test(gf2matrix, solve, .description = "test that a solution of a feasible system is computed from the row echelon form")
+{
+   SCIP_Bool x[NCOLS];
+   SCIP_Bool solution[NCOLS];
+   int perm[NROWS];
+   int steps[NROWS];
+   int rank;
+   int i;
+   int j;
+
+   /* create a random system with a known solution and some dependent rows */
+   for( j = 0; j < NCOLS; ++j )
+      solution[j] = SCIPrandomGetInt(randnumgen, 0, 1);
+
+   for( i = 0; i < NROWS; ++i )
+   {
+      if( i % 5 == 4 )
+      {
+         SCIP_CALL( SCIPgf2matrixAddRow(gf2matrix, i, i - 1) );
+         SCIP_CALL( SCIPgf2matrixAddRow(gf2matrix, i, i - 2) );
+      }
+      else
+      {
+         SCIP_Bool val = FALSE;
+
+         fillRow(i, (i % 2 == 0) ? 0.02 : 0.5);
+
+         for( j = 0; j < NCOLS; ++j )
+            val = (val != (dense[i][j] && solution[j]));
+         SCIPgf2matrixSetRhs(gf2matrix, i, val);
+         rhs[i] = val;
+      }
+   }
+
+   SCIP_CALL( SCIPgf2matrixComputeRowEchelon(gf2matrix, perm, steps, &rank) );
+   cr_assert(rank <= NROWS - NROWS / 5);
+
+   /* the zero rows must have a zero right hand side and the steps must increase */
+   for( i = 0; i < NROWS; ++i )
+   {
+      if( i >= rank )
+      {
+         cr_assert_eq(SCIPgf2matrixGetRowNNonzs(gf2matrix, perm[i]), 0);
+         cr_assert(!SCIPgf2matrixGetRhs(gf2matrix, perm[i]));
+      }
+      else if( i > 0 )
+         cr_assert(steps[i - 1] < steps[i]);
+   }
+
+   SCIP_CALL( SCIPgf2matrixSolveRowEchelon(gf2matrix, perm, steps, rank, x) );
+
+   /* the computed solution must satisfy the original system */
+   for( i = 0; i < NROWS; ++i )
+   {
+      SCIP_Bool val = FALSE;
+
+      if( i % 5 == 4 )
+      {
+         for( j = 0; j < NCOLS; ++j )
+            dense[i][j] = (dense[i - 1][j] != dense[i - 2][j]);
+         rhs[i] = (rhs[i - 1] != rhs[i - 2]);
+      }
+
+      for( j = 0; j < NCOLS; ++j )
+         val = (val != (dense[i][j] && x[j]));
+      cr_assert_eq(val, rhs[i], "row %d is violated", i);
+   }
+}
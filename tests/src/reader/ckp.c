@@ -0,0 +1,119 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   ckp.c
+ * @brief  Unittest for writing and resuming checkpoints of interrupted solves
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/reader_ckp.h"
+
+#include "include/scip_test.h"
+
+#define NITEMS 30
+
+static SCIP* scip;
+
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+}
+
+/** creates a maximization problem with two knapsack constraints that needs some branching */
+static
+void createProblem(void)
+{
+   SCIP_VAR* vars[NITEMS];
+   SCIP_Longint weights[NITEMS];
+   SCIP_CONS* cons;
+   char name[SCIP_MAXSTRLEN];
+   int i;
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "checkpoint") );
+   SCIP_CALL( SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE) );
+   SCIP_CALL( SCIPaddOrigObjoffset(scip, 1.5) );
+
+   for( i = 0; i < NITEMS; ++i )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, (SCIP_Real)(10 + (i * 37) % 23), SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+      weights[i] = 5 + (i * 29) % 17;
+   }
+
+   SCIP_CALL( SCIPcreateConsBasicKnapsack(scip, &cons, "knap1", NITEMS, vars, weights, 97) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   for( i = 0; i < NITEMS; ++i )
+      weights[i] = 3 + (i * 13) % 19;
+
+   SCIP_CALL( SCIPcreateConsBasicKnapsack(scip, &cons, "knap2", NITEMS, vars, weights, 89) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   for( i = 0; i < NITEMS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+}
+
+/* TEST SUITE */
+TestSuite(readerckp, .init = setup, .fini = teardown);
+
+Test(readerckp, resume, .description = "check that a solve resumed from a checkpoint finds the optimal value")
+{
+   const char* filename = "resume.ckp";
+   SCIP_Real optimum;
+
+   createProblem();
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   optimum = SCIPgetPrimalbound(scip);
+
+   /* interrupt the solve after a few nodes and write a checkpoint */
+   SCIP_CALL( SCIPfreeProb(scip) );
+   createProblem();
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 5LL) );
+   SCIP_CALL( SCIPsolve(scip) );
+   SCIP_CALL( SCIPwriteCkp(scip, filename) );
+
+   /* resume the solve */
+   SCIP_CALL( SCIPfreeProb(scip) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", -1LL) );
+   SCIP_CALL( SCIPreadProb(scip, filename, NULL) );
+   cr_assert_eq(SCIPgetObjsense(scip), SCIP_OBJSENSE_MAXIMIZE);
+
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_expect(SCIPisEQ(scip, SCIPgetPrimalbound(scip), optimum));
+
+   (void)remove(filename);
+   (void)remove("resume.ckp.cip");
+}
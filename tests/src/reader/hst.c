@@ -0,0 +1,165 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   hst.c
+ * @brief  Unittest for writing and reading branching histories of variables
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+#define NVARS 5
+
+static SCIP* scip;
+
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+}
+
+/** creates a problem with a few binary variables */
+static
+void createProblem(void)
+{
+   char name[SCIP_MAXSTRLEN];
+   int i;
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "history") );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_VAR* var;
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &var, name, 0.0, 1.0, 1.0, SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, var) );
+      SCIP_CALL( SCIPreleaseVar(scip, &var) );
+   }
+}
+
+/** fills valid history values of a variable, i.e., nonnegative values that are integral for the integer counters */
+static
+void fillData(
+   SCIP_Real*            data,               /**< array to store the history values */
+   int                   seed                /**< seed to make values of different variables differ */
+   )
+{
+   int i;
+
+   for( i = 0; i < SCIP_HISTORY_NDATA; ++i )
+      data[i] = (SCIP_Real)((seed * 7 + i * 3) % 11) + 1.0;
+}
+
+/* TEST SUITE */
+TestSuite(readerhst, .init = setup, .fini = teardown);
+
+Test(readerhst, roundtrip, .description = "check that written branching histories are read back unchanged")
+{
+   const char* filename = "roundtrip.hst";
+   SCIP_Real data[SCIP_HISTORY_NDATA];
+   SCIP_Real readdata[SCIP_HISTORY_NDATA];
+   SCIP_VAR** vars;
+   int v;
+   int i;
+
+   createProblem();
+   vars = SCIPgetVars(scip);
+
+   /* the last variable keeps an empty history and should not be written */
+   for( v = 0; v < NVARS - 1; ++v )
+   {
+      fillData(data, v);
+      SCIP_CALL( SCIPaddVarHistoryData(scip, vars[v], data) );
+   }
+
+   SCIP_CALL( SCIPwriteOrigProblem(scip, filename, NULL, FALSE) );
+
+   /* read the histories into a fresh problem */
+   SCIP_CALL( SCIPfreeProb(scip) );
+   createProblem();
+   SCIP_CALL( SCIPreadProb(scip, filename, NULL) );
+   vars = SCIPgetVars(scip);
+
+   for( v = 0; v < NVARS; ++v )
+   {
+      if( v < NVARS - 1 )
+         fillData(data, v);
+      else
+         BMSclearMemoryArray(data, SCIP_HISTORY_NDATA);
+
+      SCIP_CALL( SCIPgetVarHistoryData(scip, vars[v], readdata) );
+
+      for( i = 0; i < SCIP_HISTORY_NDATA; ++i )
+         cr_expect(SCIPisEQ(scip, data[i], readdata[i]), "value %d of variable %d: expected %g, got %g",
+            i, v, data[i], readdata[i]);
+   }
+
+   /* reading again adds the observations: counts double, means stay */
+   SCIP_CALL( SCIPreadProb(scip, filename, NULL) );
+   fillData(data, 0);
+   SCIP_CALL( SCIPgetVarHistoryData(scip, vars[0], readdata) );
+   cr_expect(SCIPisEQ(scip, readdata[0], 2.0 * data[0]));
+   cr_expect(SCIPisEQ(scip, readdata[1], 2.0 * data[1]));
+   cr_expect(SCIPisEQ(scip, readdata[2], data[2]));
+   cr_expect(SCIPisEQ(scip, readdata[3], data[3]));
+
+   (void)remove(filename);
+}
+
+Test(readerhst, transformed, .description = "check that imported histories are visible to the branching rules")
+{
+   const char* filename = "transformed.hst";
+   SCIP_Real data[SCIP_HISTORY_NDATA];
+   SCIP_VAR* var;
+
+   createProblem();
+   fillData(data, 3);
+   SCIP_CALL( SCIPaddVarHistoryData(scip, SCIPgetVars(scip)[0], data) );
+   SCIP_CALL( SCIPwriteOrigProblem(scip, filename, NULL, FALSE) );
+
+   SCIP_CALL( SCIPfreeProb(scip) );
+   createProblem();
+   SCIP_CALL( SCIPtransformProb(scip) );
+   SCIP_CALL( SCIPreadProb(scip, filename, NULL) );
+
+   /* the pseudo cost queries are only available after the start of presolving */
+   SCIP_CALL( SCIPsetIntParam(scip, "presolving/maxrounds", 0) );
+   SCIP_CALL( SCIPpresolve(scip) );
+
+   SCIP_CALL( SCIPgetTransformedVar(scip, SCIPgetVars(scip)[0], &var) );
+   assert(var != NULL);
+
+   /* the imported observations count for all runs, but not for the current run */
+   cr_expect(SCIPisEQ(scip, SCIPgetVarPseudocostCount(scip, var, SCIP_BRANCHDIR_DOWNWARDS), data[0]));
+   cr_expect(SCIPisEQ(scip, SCIPgetVarPseudocostCount(scip, var, SCIP_BRANCHDIR_UPWARDS), data[1]));
+   cr_expect(SCIPisZero(scip, SCIPgetVarPseudocostCountCurrentRun(scip, var, SCIP_BRANCHDIR_DOWNWARDS)));
+
+   (void)remove(filename);
+}
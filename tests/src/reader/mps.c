@@ -0,0 +1,139 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   mps.c
+ * @brief  Unittest for the COLUMNS section of the mps reader
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+static SCIP* scip;
+
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+}
+
+/** writes a small mps file with integrality markers, lines with two entries, and an undeclared row */
+static
+void writeMps(
+   const char*           filename            /**< name of the file to write */
+   )
+{
+   FILE* fp;
+
+   fp = fopen(filename, "w");
+   fprintf(fp, "NAME          TEST\n");
+   fprintf(fp, "ROWS\n");
+   fprintf(fp, " N  obj\n");
+   fprintf(fp, " L  c1\n");
+   fprintf(fp, " G  c2\n");
+   fprintf(fp, " E  c3\n");
+   fprintf(fp, "COLUMNS\n");
+   fprintf(fp, "    x         obj       1.0        c1        2.0\n");
+   fprintf(fp, "    x         c3        -1.0\n");
+   fprintf(fp, "    MARKER    'MARKER'  'INTORG'\n");
+   fprintf(fp, "    y         c2        3.0        c1        4.0\n");
+   fprintf(fp, "* comment\n");
+   fprintf(fp, "    y         c4        5.0\n");
+   fprintf(fp, "    MARKER    'MARKER'  'INTEND'\n");
+   fprintf(fp, "    z         c3        6.0        obj       -2.0\n");
+   fprintf(fp, "RHS\n");
+   fprintf(fp, "    RHS       c1        10.0       c2        1.0\n");
+   fprintf(fp, "ENDATA\n");
+   fclose(fp);
+}
+
+/** checks the problem that was read from the file written by writeMps() */
+static
+void checkProblem(void)
+{
+   SCIP_CONS* cons;
+   SCIP_VAR** vars;
+   SCIP_Real* vals;
+
+   cr_assert_eq(SCIPgetNOrigVars(scip), 3);
+   cr_assert_eq(SCIPgetNOrigConss(scip), 3);
+
+   cr_expect_eq(SCIPvarGetType(SCIPfindVar(scip, "x")), SCIP_VARTYPE_CONTINUOUS);
+   cr_expect_eq(SCIPvarGetType(SCIPfindVar(scip, "y")), SCIP_VARTYPE_BINARY);
+   cr_expect_eq(SCIPvarGetType(SCIPfindVar(scip, "z")), SCIP_VARTYPE_CONTINUOUS);
+   cr_expect(SCIPisEQ(scip, SCIPvarGetObj(SCIPfindVar(scip, "z")), -2.0));
+
+   /* the constraints keep the order of the rows, and the coefficients keep the order of the columns */
+   cr_assert_str_eq(SCIPconsGetName(SCIPgetOrigConss(scip)[0]), "c1");
+   cr_assert_str_eq(SCIPconsGetName(SCIPgetOrigConss(scip)[2]), "c3");
+
+   cons = SCIPfindCons(scip, "c1");
+   cr_assert_not_null(cons);
+   cr_assert_eq(SCIPgetNVarsLinear(scip, cons), 2);
+   vars = SCIPgetVarsLinear(scip, cons);
+   vals = SCIPgetValsLinear(scip, cons);
+   cr_expect_str_eq(SCIPvarGetName(vars[0]), "x");
+   cr_expect_str_eq(SCIPvarGetName(vars[1]), "y");
+   cr_expect(SCIPisEQ(scip, vals[0], 2.0));
+   cr_expect(SCIPisEQ(scip, vals[1], 4.0));
+   cr_expect(SCIPisEQ(scip, SCIPgetRhsLinear(scip, cons), 10.0));
+
+   cons = SCIPfindCons(scip, "c3");
+   cr_assert_not_null(cons);
+   cr_assert_eq(SCIPgetNVarsLinear(scip, cons), 2);
+   vals = SCIPgetValsLinear(scip, cons);
+   cr_expect(SCIPisEQ(scip, vals[0], -1.0));
+   cr_expect(SCIPisEQ(scip, vals[1], 6.0));
+}
+
+/* TEST SUITE */
+TestSuite(readermps, .init = setup, .fini = teardown);
+
+Test(readermps, columns, .description = "check reading the COLUMNS section of a *.mps file")
+{
+   const char* filename = "columns.mps";
+
+   writeMps(filename);
+
+   SCIP_CALL( SCIPreadProb(scip, filename, NULL) );
+   checkProblem();
+
+   (void)remove(filename);
+}
+
+Test(readermps, columnsthreads, .description = "check reading the COLUMNS section of a *.mps file with several threads")
+{
+   const char* filename = "columnsthreads.mps";
+
+   writeMps(filename);
+
+   SCIP_CALL( SCIPsetIntParam(scip, "reading/mpsreader/nthreads", 4) );
+   SCIP_CALL( SCIPreadProb(scip, filename, NULL) );
+   checkProblem();
+
+   (void)remove(filename);
+}
@@ -0,0 +1,180 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   snp.c
+ * @brief  Unittest for writing and reading binary problem snapshots
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+static SCIP* scip;
+
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+}
+
+/** creates a maximization problem with linear, setppc, knapsack, varbound, and and constraints */
+static
+void createProblem(void)
+{
+   SCIP_VAR* vars[4];
+   SCIP_VAR* consvars[3];
+   SCIP_Longint weights[3] = {3, 4, 5};
+   SCIP_Real vals[3] = {1.0, 2.0, -1.0};
+   SCIP_CONS* cons;
+   int i;
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "snapshot") );
+   SCIP_CALL( SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE) );
+   SCIP_CALL( SCIPaddOrigObjoffset(scip, 2.5) );
+
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[0], "x0", 0.0, 1.0, 1.0, SCIP_VARTYPE_BINARY) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[1], "x1", 0.0, 1.0, 2.0, SCIP_VARTYPE_BINARY) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[2], "x2", 0.0, 1.0, 3.0, SCIP_VARTYPE_BINARY) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[3], "y", -1.5, 10.0, 0.5, SCIP_VARTYPE_CONTINUOUS) );
+   for( i = 0; i < 4; ++i )
+   {
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   consvars[0] = vars[0];
+   consvars[1] = vars[1];
+   consvars[2] = vars[3];
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "lin", 3, consvars, vals, -1.0, 7.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   /* set packing constraint with a negated variable */
+   SCIP_CALL( SCIPgetNegatedVar(scip, vars[2], &consvars[2]) );
+   SCIP_CALL( SCIPcreateConsBasicSetpack(scip, &cons, "pack", 3, consvars) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   SCIP_CALL( SCIPcreateConsBasicKnapsack(scip, &cons, "knap", 3, vars, weights, 8) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   SCIP_CALL( SCIPcreateConsBasicVarbound(scip, &cons, "vbd", vars[3], vars[0], -4.0, -SCIPinfinity(scip), 6.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   /* and constraints are stored in CIP format */
+   SCIP_CALL( SCIPcreateConsBasicAnd(scip, &cons, "and", vars[2], 2, vars) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   for( i = 0; i < 4; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+}
+
+/* TEST SUITE */
+TestSuite(readersnp, .init = setup, .fini = teardown);
+
+Test(readersnp, original, .description = "check writing and reading a snapshot of the original problem")
+{
+   const char* filename = "original.snp";
+   SCIP_CONS* cons;
+   SCIP_VAR* var;
+   SCIP_Real optimum;
+
+   createProblem();
+   SCIP_CALL( SCIPsolve(scip) );
+   optimum = SCIPgetPrimalbound(scip);
+
+   SCIP_CALL( SCIPwriteOrigProblem(scip, filename, NULL, FALSE) );
+   SCIP_CALL( SCIPfreeProb(scip) );
+   SCIP_CALL( SCIPreadProb(scip, filename, NULL) );
+
+   cr_assert_str_eq(SCIPgetProbName(scip), "snapshot");
+   cr_assert_eq(SCIPgetObjsense(scip), SCIP_OBJSENSE_MAXIMIZE);
+   cr_expect(SCIPisEQ(scip, SCIPgetOrigObjoffset(scip), 2.5));
+   cr_assert_eq(SCIPgetNOrigVars(scip), 4);
+   cr_assert_eq(SCIPgetNOrigConss(scip), 5);
+
+   var = SCIPfindVar(scip, "y");
+   cr_assert_not_null(var);
+   cr_expect_eq(SCIPvarGetType(var), SCIP_VARTYPE_CONTINUOUS);
+   cr_expect(SCIPisEQ(scip, SCIPvarGetLbOriginal(var), -1.5));
+   cr_expect(SCIPisEQ(scip, SCIPvarGetUbOriginal(var), 10.0));
+   cr_expect(SCIPisEQ(scip, SCIPvarGetObj(var), 0.5));
+
+   /* the constraints keep their order and their type */
+   cr_expect_str_eq(SCIPconsGetName(SCIPgetOrigConss(scip)[0]), "lin");
+   cr_expect_str_eq(SCIPconsGetName(SCIPgetOrigConss(scip)[4]), "and");
+
+   cons = SCIPfindCons(scip, "pack");
+   cr_assert_not_null(cons);
+   cr_expect_str_eq(SCIPconshdlrGetName(SCIPconsGetHdlr(cons)), "setppc");
+   cr_expect_eq(SCIPgetTypeSetppc(scip, cons), SCIP_SETPPCTYPE_PACKING);
+   cr_expect(SCIPvarIsNegated(SCIPgetVarsSetppc(scip, cons)[2]));
+
+   cons = SCIPfindCons(scip, "knap");
+   cr_assert_not_null(cons);
+   cr_expect_eq(SCIPgetCapacityKnapsack(scip, cons), 8);
+   cr_expect_eq(SCIPgetWeightsKnapsack(scip, cons)[2], 5);
+
+   cons = SCIPfindCons(scip, "vbd");
+   cr_assert_not_null(cons);
+   cr_expect(SCIPisEQ(scip, SCIPgetVbdcoefVarbound(scip, cons), -4.0));
+   cr_expect(SCIPisInfinity(scip, -SCIPgetLhsVarbound(scip, cons)));
+
+   cons = SCIPfindCons(scip, "and");
+   cr_assert_not_null(cons);
+   cr_expect_str_eq(SCIPconshdlrGetName(SCIPconsGetHdlr(cons)), "and");
+
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_expect(SCIPisEQ(scip, SCIPgetPrimalbound(scip), optimum));
+
+   (void)remove(filename);
+}
+
+Test(readersnp, transformed, .description = "check writing and reading a snapshot of the presolved problem")
+{
+   const char* filename = "transformed.snp";
+   SCIP_Real optimum;
+
+   createProblem();
+   SCIP_CALL( SCIPsolve(scip) );
+   optimum = SCIPgetPrimalbound(scip);
+
+   SCIP_CALL( SCIPfreeTransform(scip) );
+   SCIP_CALL( SCIPpresolve(scip) );
+   SCIP_CALL( SCIPwriteTransProblem(scip, filename, NULL, FALSE) );
+   SCIP_CALL( SCIPfreeProb(scip) );
+   SCIP_CALL( SCIPreadProb(scip, filename, NULL) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_expect(SCIPisEQ(scip, SCIPgetPrimalbound(scip), optimum));
+
+   (void)remove(filename);
+}
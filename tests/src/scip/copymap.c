@@ -0,0 +1,165 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   copymap.c
+ * @brief  unit tests for the variable maps of copies, which are looked up in a dense map during the copy process
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+#define NVARS 20
+
+/** GLOBAL VARIABLES **/
+static SCIP* sourcescip;
+static SCIP* targetscip;
+static SCIP_VAR* vars[NVARS];
+
+/** creates a problem with constraints that share variables */
+static
+void setup(void)
+{
+   SCIP_Real vals[NVARS];
+   int i;
+
+   SCIP_CALL( SCIPcreate(&sourcescip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(sourcescip) );
+   SCIP_CALL( SCIPcreateProbBasic(sourcescip, "copymap") );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(sourcescip, &vars[i], name, 0.0, 1.0, 1.0, SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(sourcescip, vars[i]) );
+      vals[i] = i + 1.0;
+   }
+
+   for( i = 0; i < 4; ++i )
+   {
+      SCIP_CONS* cons;
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "c%d", i);
+      SCIP_CALL( SCIPcreateConsBasicLinear(sourcescip, &cons, name, NVARS - 4 * i, &vars[2 * i], &vals[2 * i],
+            -SCIPinfinity(sourcescip), 50.0) );
+      SCIP_CALL( SCIPaddCons(sourcescip, cons) );
+      SCIP_CALL( SCIPreleaseCons(sourcescip, &cons) );
+   }
+
+   SCIP_CALL( SCIPcreate(&targetscip) );
+}
+
+/** frees the problems */
+static
+void teardown(void)
+{
+   int i;
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(sourcescip, &vars[i]) );
+   }
+
+   SCIP_CALL( SCIPfree(&targetscip) );
+   SCIP_CALL( SCIPfree(&sourcescip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** checks that the variables of the copied constraints are the images of the source variables in the variable map */
+static
+void checkConss(
+   SCIP_HASHMAP*         varmap              /**< variable map of the copy */
+   )
+{
+   SCIP_CONS** conss;
+   int c;
+
+   conss = SCIPgetConss(sourcescip);
+   cr_assert_eq(SCIPgetNConss(targetscip), SCIPgetNConss(sourcescip));
+
+   for( c = 0; c < SCIPgetNConss(sourcescip); ++c )
+   {
+      SCIP_CONS* targetcons;
+      SCIP_VAR** sourcevars;
+      SCIP_VAR** targetvars;
+      int v;
+
+      targetcons = SCIPfindCons(targetscip, SCIPconsGetName(conss[c]));
+      cr_assert(targetcons != NULL);
+      cr_assert_eq(SCIPgetNVarsLinear(targetscip, targetcons), SCIPgetNVarsLinear(sourcescip, conss[c]));
+
+      sourcevars = SCIPgetVarsLinear(sourcescip, conss[c]);
+      targetvars = SCIPgetVarsLinear(targetscip, targetcons);
+
+      for( v = 0; v < SCIPgetNVarsLinear(sourcescip, conss[c]); ++v )
+      {
+         cr_assert(targetvars[v] != NULL);
+         cr_assert(targetvars[v] == SCIPhashmapGetImage(varmap, sourcevars[v]));
+      }
+   }
+}
+
+TestSuite(copymap, .init = setup, .fini = teardown);
+
+/* TESTS */
+Test(copymap, copy)
+{
+   SCIP_HASHMAP* varmap;
+   SCIP_Bool valid;
+
+   SCIP_CALL( SCIPhashmapCreate(&varmap, SCIPblkmem(targetscip), NVARS) );
+   SCIP_CALL( SCIPcopyOrig(sourcescip, targetscip, varmap, NULL, "copy", FALSE, FALSE, FALSE, &valid) );
+   cr_assert(valid);
+
+   cr_assert_eq(SCIPgetNOrigVars(targetscip), NVARS);
+   checkConss(varmap);
+
+   SCIPhashmapFree(&varmap);
+}
+
+/** the copy has to use the images of a variable map that is filled by the user before the copy */
+Test(copymap, partialmap)
+{
+   SCIP_HASHMAP* varmap;
+   SCIP_VAR* uservar;
+   SCIP_Bool valid;
+
+   SCIP_CALL( SCIPhashmapCreate(&varmap, SCIPblkmem(targetscip), NVARS) );
+   SCIP_CALL( SCIPcopyPlugins(sourcescip, targetscip, TRUE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE,
+         TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, &valid) );
+   SCIP_CALL( SCIPcopyOrigProb(sourcescip, targetscip, varmap, NULL, "copy") );
+
+   SCIP_CALL( SCIPcreateVarBasic(targetscip, &uservar, "uservar", 0.0, 1.0, 0.0, SCIP_VARTYPE_BINARY) );
+   SCIP_CALL( SCIPaddVar(targetscip, uservar) );
+   SCIP_CALL( SCIPhashmapInsert(varmap, vars[5], uservar) );
+
+   SCIP_CALL( SCIPcopyOrigVars(sourcescip, targetscip, varmap, NULL, NULL, NULL, 0) );
+   SCIP_CALL( SCIPcopyOrigConss(sourcescip, targetscip, varmap, NULL, FALSE, &valid) );
+   cr_assert(valid);
+
+   cr_assert_eq(SCIPgetNOrigVars(targetscip), NVARS);
+   cr_assert(SCIPfindVar(targetscip, "x5") == NULL);
+   checkConss(varmap);
+
+   SCIP_CALL( SCIPreleaseVar(targetscip, &uservar) );
+   SCIPhashmapFree(&varmap);
+}
@@ -0,0 +1,145 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2022 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   instancepool.c
+ * @brief  unit tests for resetting and pooling SCIP instances
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/instancepool.h"
+
+#include "include/scip_test.h"
+
+/** initialization method of the instances of the pool */
+static
+SCIP_DECL_INSTANCEPOOLINIT(initInstance)
+{
+   int* ninits = (int*) userdata;
+
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/solvefreq", -1) );
+   ++(*ninits);
+
+   return SCIP_OKAY;
+}
+
+/** creates and solves a small problem */
+static
+void solveProblem(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Real             ub                  /**< upper bound of the variables */
+   )
+{
+   SCIP_VAR* vars[2];
+   SCIP_CONS* cons;
+   SCIP_Real vals[2] = { 1.0, 1.0 };
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "pooled") );
+   SCIP_CALL( SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[0], "x", 0.0, ub, 2.0, SCIP_VARTYPE_INTEGER) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[1], "y", 0.0, ub, 1.0, SCIP_VARTYPE_INTEGER) );
+   SCIP_CALL( SCIPaddVar(scip, vars[0]) );
+   SCIP_CALL( SCIPaddVar(scip, vars[1]) );
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "c", 2, vars, vals, -SCIPinfinity(scip), ub) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   SCIP_CALL( SCIPreleaseVar(scip, &vars[1]) );
+   SCIP_CALL( SCIPreleaseVar(scip, &vars[0]) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_expect(SCIPisEQ(scip, SCIPgetPrimalbound(scip), 2.0 * ub));
+}
+
+TestSuite(instancepool);
+
+Test(instancepool, reset, .description = "check that a reset instance can solve another problem")
+{
+   SCIP* scip;
+   int verblevel;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/solvefreq", -1) );
+
+   solveProblem(scip, 3.0);
+
+   /* parameters are kept unless they are reset */
+   SCIP_CALL( SCIPresetInstance(scip, FALSE) );
+   cr_assert_eq(SCIPgetStage(scip), SCIP_STAGE_INIT);
+   SCIP_CALL( SCIPgetIntParam(scip, "display/verblevel", &verblevel) );
+   cr_expect_eq(verblevel, 0);
+
+   solveProblem(scip, 5.0);
+   cr_expect_eq(SCIPgetNSols(scip) > 0, TRUE);
+
+   SCIP_CALL( SCIPresetInstance(scip, TRUE) );
+   SCIP_CALL( SCIPgetIntParam(scip, "display/verblevel", &verblevel) );
+   cr_expect_eq(verblevel, 4);
+
+   SCIP_CALL( SCIPfree(&scip) );
+}
+
+Test(instancepool, reuse, .description = "check that released instances are reused with the initial parameters")
+{
+   SCIP_INSTANCEPOOL* pool;
+   SCIP* scip1;
+   SCIP* scip2;
+   SCIP_Longint nodelimit;
+   int solvefreq;
+   int ninits = 0;
+
+   SCIP_CALL( SCIPinstancepoolCreate(&pool, initInstance, (void*) &ninits, 1) );
+   cr_assert_eq(ninits, 1);
+
+   /* the first acquisition is served by the instance created with the pool, the second creates a new one */
+   SCIP_CALL( SCIPinstancepoolAcquire(pool, &scip1) );
+   SCIP_CALL( SCIPinstancepoolAcquire(pool, &scip2) );
+   cr_expect_eq(ninits, 2);
+   cr_expect_eq(SCIPinstancepoolGetNReused(pool), 1);
+
+   SCIP_CALL( SCIPsetLongintParam(scip1, "limits/nodes", 100LL) );
+   SCIP_CALL( SCIPsetIntParam(scip1, "lp/solvefreq", -1) );
+   solveProblem(scip1, 4.0);
+   solveProblem(scip2, 6.0);
+
+   /* only one instance is kept */
+   SCIP_CALL( SCIPinstancepoolRelease(pool, &scip1) );
+   cr_expect_null(scip1);
+   SCIP_CALL( SCIPinstancepoolRelease(pool, &scip2) );
+
+   SCIP_CALL( SCIPinstancepoolAcquire(pool, &scip1) );
+   cr_expect_eq(ninits, 2);
+   cr_expect_eq(SCIPinstancepoolGetNCreated(pool), 2);
+   cr_expect_eq(SCIPgetStage(scip1), SCIP_STAGE_INIT);
+
+   /* parameters changed by the user are reset, the ones of the initialization are kept */
+   SCIP_CALL( SCIPgetLongintParam(scip1, "limits/nodes", &nodelimit) );
+   cr_expect_eq(nodelimit, -1LL);
+   SCIP_CALL( SCIPgetIntParam(scip1, "lp/solvefreq", &solvefreq) );
+   cr_expect_eq(solvefreq, -1);
+
+   solveProblem(scip1, 7.0);
+
+   SCIP_CALL( SCIPinstancepoolRelease(pool, &scip1) );
+   SCIP_CALL( SCIPinstancepoolFree(&pool) );
+   cr_expect_null(pool);
+}